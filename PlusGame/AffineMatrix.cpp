@@ -0,0 +1,333 @@
+#include "AffineMatrix.h"
+#include "MatrixSimd.h"
+
+// Constructs an affine matrix from the first three columns of a matrix.
+AffineMatrix::AffineMatrix(const Matrix& matrix) noexcept :
+	M11(matrix.M11), M12(matrix.M12), M13(matrix.M13),
+	M21(matrix.M21), M22(matrix.M22), M23(matrix.M23),
+	M31(matrix.M31), M32(matrix.M32), M33(matrix.M33),
+	M41(matrix.M41), M42(matrix.M42), M43(matrix.M43)
+{
+}
+
+// The translation vector formed from the fourth row M41, M42, M43 elements.
+Vector3 AffineMatrix::Translation() const noexcept {
+	return Vector3(M41, M42, M43);
+}
+
+void AffineMatrix::Translation(const Vector3& value) noexcept {
+	M41 = value.X;
+	M42 = value.Y;
+	M43 = value.Z;
+}
+
+/// <summary>
+/// Expands this affine matrix to a full <see cref="Matrix"/> with (0, 0, 0, 1) as fourth column.
+/// </summary>
+/// <returns>The equivalent <see cref="Matrix"/>.</returns>
+Matrix AffineMatrix::ToMatrix() const noexcept
+{
+	Matrix result;
+	ToMatrix(*this, result);
+	return result;
+}
+
+/// <summary>
+/// Expands an affine matrix to a full <see cref="Matrix"/> with (0, 0, 0, 1) as fourth column.
+/// </summary>
+/// <param name="matrix">Source <see cref="AffineMatrix"/>.</param>
+/// <param name="result">The equivalent <see cref="Matrix"/> as an output parameter.</param>
+void AffineMatrix::ToMatrix(const AffineMatrix& matrix, Matrix& result) noexcept
+{
+	result.M11 = matrix.M11;
+	result.M12 = matrix.M12;
+	result.M13 = matrix.M13;
+	result.M14 = 0.0f;
+	result.M21 = matrix.M21;
+	result.M22 = matrix.M22;
+	result.M23 = matrix.M23;
+	result.M24 = 0.0f;
+	result.M31 = matrix.M31;
+	result.M32 = matrix.M32;
+	result.M33 = matrix.M33;
+	result.M34 = 0.0f;
+	result.M41 = matrix.M41;
+	result.M42 = matrix.M42;
+	result.M43 = matrix.M43;
+	result.M44 = 1.0f;
+}
+
+/// <summary>
+/// Returns the determinant of this <see cref="AffineMatrix"/>, which is the determinant of its 3x3 linear part.
+/// </summary>
+/// <returns>Determinant of this <see cref="AffineMatrix"/>.</returns>
+float AffineMatrix::Determinant() const noexcept
+{
+	return (M11 * ((M22 * M33) - (M23 * M32))) - (M12 * ((M21 * M33) - (M23 * M31))) + (M13 * ((M21 * M32) - (M22 * M31)));
+}
+
+/// <summary>
+/// Creates a new <see cref="AffineMatrix"/> from a scale, a rotation and a translation.
+/// </summary>
+/// <param name="scale">Scale along each axis.</param>
+/// <param name="rotation"><see cref="Quaternion"/> of rotation moment.</param>
+/// <param name="translation">Position of the origin.</param>
+/// <returns>The world <see cref="AffineMatrix"/>.</returns>
+AffineMatrix AffineMatrix::CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3& translation) noexcept
+{
+	AffineMatrix result;
+	CreateFromTRS(scale, rotation, translation, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="AffineMatrix"/> from a scale, a rotation and a translation.
+/// The elements are computed exactly as by <see cref="Matrix.CreateFromTRS"/>.
+/// </summary>
+/// <param name="scale">Scale along each axis.</param>
+/// <param name="rotation"><see cref="Quaternion"/> of rotation moment.</param>
+/// <param name="translation">Position of the origin.</param>
+/// <param name="result">The world <see cref="AffineMatrix"/> as an output parameter.</param>
+void AffineMatrix::CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3& translation, AffineMatrix& result) noexcept
+{
+	float num9 = rotation.X * rotation.X;
+	float num8 = rotation.Y * rotation.Y;
+	float num7 = rotation.Z * rotation.Z;
+	float num6 = rotation.X * rotation.Y;
+	float num5 = rotation.Z * rotation.W;
+	float num4 = rotation.Z * rotation.X;
+	float num3 = rotation.Y * rotation.W;
+	float num2 = rotation.Y * rotation.Z;
+	float num = rotation.X * rotation.W;
+	result.M11 = (1.0f - (2.0f * (num8 + num7))) * scale.X;
+	result.M12 = (2.0f * (num6 + num5)) * scale.X;
+	result.M13 = (2.0f * (num4 - num3)) * scale.X;
+	result.M21 = (2.0f * (num6 - num5)) * scale.Y;
+	result.M22 = (1.0f - (2.0f * (num7 + num9))) * scale.Y;
+	result.M23 = (2.0f * (num2 + num)) * scale.Y;
+	result.M31 = (2.0f * (num4 + num3)) * scale.Z;
+	result.M32 = (2.0f * (num2 - num)) * scale.Z;
+	result.M33 = (1.0f - (2.0f * (num8 + num9))) * scale.Z;
+	result.M41 = translation.X;
+	result.M42 = translation.Y;
+	result.M43 = translation.Z;
+}
+
+/// <summary>
+/// Creates an <see cref="AffineMatrix"/> for every scale, rotation and translation at the same index in three arrays,
+/// with the fastest kernel available on this processor. Each result is identical to <see cref="CreateFromTRS"/>.
+/// </summary>
+/// <param name="scaleArray">Scales along each axis.</param>
+/// <param name="rotationArray">Rotations.</param>
+/// <param name="translationArray">Positions of the origin.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to create.</param>
+void AffineMatrix::CreateFromTRSBatch(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, AffineMatrix* resultArray, int length) noexcept
+{
+	MatrixSimd::CreateFromTRSBatch(scaleArray, rotationArray, translationArray, resultArray, length);
+}
+
+/// <summary>
+/// Creates a spherical billboard <see cref="AffineMatrix"/> for every object position in an array, all facing the same camera.
+/// Each result has the rows of <see cref="Matrix.CreateBillboard"/> for the same arguments to within 4e-7 per element:
+/// the directions are normalized in single precision, where the single-object version divides by a double-precision square root.
+/// </summary>
+/// <param name="objectPositionArray">Positions of the billboards. Each one rotates around its position.</param>
+/// <param name="cameraPosition">The camera position.</param>
+/// <param name="cameraUpVector">The camera up vector.</param>
+/// <param name="cameraForwardVector">Optional camera forward vector.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to create.</param>
+void AffineMatrix::CreateBillboardBatch(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3* cameraForwardVector,
+	AffineMatrix* resultArray, int length) noexcept
+{
+	MatrixSimd::CreateBillboardBatch(objectPositionArray, cameraPosition, cameraUpVector, cameraForwardVector, resultArray, length);
+}
+
+/// <summary>
+/// Creates a cylindrical billboard <see cref="AffineMatrix"/> for every object position in an array, all facing the same camera.
+/// Each result has the rows of <see cref="Matrix.CreateConstrainedBillboard"/> for the same arguments to within 4e-7 per element:
+/// the directions are normalized in single precision, where the single-object version divides by a double-precision square root.
+/// </summary>
+/// <param name="objectPositionArray">Positions of the billboards. Each one rotates around its position.</param>
+/// <param name="cameraPosition">The camera position.</param>
+/// <param name="rotateAxis">Axis of billboard for rotation.</param>
+/// <param name="cameraForwardVector">Optional camera forward vector.</param>
+/// <param name="objectForwardVector">Optional object forward vector.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to create.</param>
+void AffineMatrix::CreateConstrainedBillboardBatch(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3* cameraForwardVector,
+	const Vector3* objectForwardVector, AffineMatrix* resultArray, int length) noexcept
+{
+	MatrixSimd::CreateConstrainedBillboardBatch(objectPositionArray, cameraPosition, rotateAxis, cameraForwardVector, objectForwardVector, resultArray, length);
+}
+
+/// <summary>
+/// Creates a new <see cref="AffineMatrix"/> that contains a multiplication of two affine matrices.
+/// </summary>
+/// <param name="matrix1">Source <see cref="AffineMatrix"/>.</param>
+/// <param name="matrix2">Source <see cref="AffineMatrix"/>.</param>
+/// <returns>Result of the matrix multiplication.</returns>
+AffineMatrix AffineMatrix::Multiply(const AffineMatrix& matrix1, const AffineMatrix& matrix2) noexcept
+{
+	AffineMatrix result;
+	Multiply(matrix1, matrix2, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="AffineMatrix"/> that contains a multiplication of two affine matrices.
+/// Only the 36 products that can be non-zero are evaluated, in the same order as <see cref="Matrix.Multiply"/>,
+/// so the result matches the full 4x4 product of the expanded matrices.
+/// </summary>
+/// <param name="matrix1">Source <see cref="AffineMatrix"/>.</param>
+/// <param name="matrix2">Source <see cref="AffineMatrix"/>.</param>
+/// <param name="result">Result of the matrix multiplication as an output parameter.</param>
+void AffineMatrix::Multiply(const AffineMatrix& matrix1, const AffineMatrix& matrix2, AffineMatrix& result) noexcept
+{
+	auto m11 = ((matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21)) + (matrix1.M13 * matrix2.M31);
+	auto m12 = ((matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22)) + (matrix1.M13 * matrix2.M32);
+	auto m13 = ((matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23)) + (matrix1.M13 * matrix2.M33);
+	auto m21 = ((matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21)) + (matrix1.M23 * matrix2.M31);
+	auto m22 = ((matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22)) + (matrix1.M23 * matrix2.M32);
+	auto m23 = ((matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23)) + (matrix1.M23 * matrix2.M33);
+	auto m31 = ((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + (matrix1.M33 * matrix2.M31);
+	auto m32 = ((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + (matrix1.M33 * matrix2.M32);
+	auto m33 = ((matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23)) + (matrix1.M33 * matrix2.M33);
+	auto m41 = (((matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21)) + (matrix1.M43 * matrix2.M31)) + matrix2.M41;
+	auto m42 = (((matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22)) + (matrix1.M43 * matrix2.M32)) + matrix2.M42;
+	auto m43 = (((matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23)) + (matrix1.M43 * matrix2.M33)) + matrix2.M43;
+	result.M11 = m11;
+	result.M12 = m12;
+	result.M13 = m13;
+	result.M21 = m21;
+	result.M22 = m22;
+	result.M23 = m23;
+	result.M31 = m31;
+	result.M32 = m32;
+	result.M33 = m33;
+	result.M41 = m41;
+	result.M42 = m42;
+	result.M43 = m43;
+}
+
+/// <summary>
+/// Creates a new <see cref="AffineMatrix"/> which contains inversion of the specified affine matrix.
+/// </summary>
+/// <param name="matrix">Source <see cref="AffineMatrix"/>.</param>
+/// <returns>The inverted matrix.</returns>
+AffineMatrix AffineMatrix::Invert(const AffineMatrix& matrix) noexcept
+{
+	AffineMatrix result;
+	Invert(matrix, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="AffineMatrix"/> which contains inversion of the specified affine matrix.
+/// The 3x3 linear part is inverted through its adjugate and the translation is carried through the inverse,
+/// which takes a fraction of the work of the general 4x4 <see cref="Matrix.Invert"/>.
+/// A singular matrix produces infinite or NaN elements, as with <see cref="Matrix.Invert"/>.
+/// </summary>
+/// <param name="matrix">Source <see cref="AffineMatrix"/>.</param>
+/// <param name="result">The inverted matrix as output parameter.</param>
+void AffineMatrix::Invert(const AffineMatrix& matrix, AffineMatrix& result) noexcept
+{
+	// The columns of the inverse are the cross products of pairs of rows (row2 x row3, row3 x row1,
+	// row1 x row2) divided by the determinant.
+	float c11 = (matrix.M22 * matrix.M33) - (matrix.M23 * matrix.M32);
+	float c12 = (matrix.M23 * matrix.M31) - (matrix.M21 * matrix.M33);
+	float c13 = (matrix.M21 * matrix.M32) - (matrix.M22 * matrix.M31);
+	float c21 = (matrix.M32 * matrix.M13) - (matrix.M33 * matrix.M12);
+	float c22 = (matrix.M33 * matrix.M11) - (matrix.M31 * matrix.M13);
+	float c23 = (matrix.M31 * matrix.M12) - (matrix.M32 * matrix.M11);
+	float c31 = (matrix.M12 * matrix.M23) - (matrix.M13 * matrix.M22);
+	float c32 = (matrix.M13 * matrix.M21) - (matrix.M11 * matrix.M23);
+	float c33 = (matrix.M11 * matrix.M22) - (matrix.M12 * matrix.M21);
+	float invDet = 1.0f / ((matrix.M11 * c11) + (matrix.M12 * c12) + (matrix.M13 * c13));
+
+	float m11 = c11 * invDet;
+	float m12 = c21 * invDet;
+	float m13 = c31 * invDet;
+	float m21 = c12 * invDet;
+	float m22 = c22 * invDet;
+	float m23 = c32 * invDet;
+	float m31 = c13 * invDet;
+	float m32 = c23 * invDet;
+	float m33 = c33 * invDet;
+	float x = matrix.M41;
+	float y = matrix.M42;
+	float z = matrix.M43;
+
+	result.M11 = m11;
+	result.M12 = m12;
+	result.M13 = m13;
+	result.M21 = m21;
+	result.M22 = m22;
+	result.M23 = m23;
+	result.M31 = m31;
+	result.M32 = m32;
+	result.M33 = m33;
+	result.M41 = -((x * m11) + (y * m21) + (z * m31));
+	result.M42 = -((x * m12) + (y * m22) + (z * m32));
+	result.M43 = -((x * m13) + (y * m23) + (z * m33));
+}
+
+/// <summary>
+/// Creates a new <see cref="AffineMatrix"/> which contains inversion of a rigid-body transform.
+/// The linear part must be an orthonormal rotation; its inverse is then its transpose.
+/// </summary>
+/// <param name="matrix">Source <see cref="AffineMatrix"/> made of a rotation and a translation.</param>
+/// <returns>The inverted matrix.</returns>
+AffineMatrix AffineMatrix::InvertRigid(const AffineMatrix& matrix) noexcept
+{
+	AffineMatrix result;
+	InvertRigid(matrix, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="AffineMatrix"/> which contains inversion of a rigid-body transform.
+/// The linear part must be an orthonormal rotation; its inverse is then its transpose.
+/// </summary>
+/// <param name="matrix">Source <see cref="AffineMatrix"/> made of a rotation and a translation.</param>
+/// <param name="result">The inverted matrix as output parameter.</param>
+void AffineMatrix::InvertRigid(const AffineMatrix& matrix, AffineMatrix& result) noexcept
+{
+	AffineMatrix source = matrix;
+
+	result.M11 = source.M11;
+	result.M12 = source.M21;
+	result.M13 = source.M31;
+	result.M21 = source.M12;
+	result.M22 = source.M22;
+	result.M23 = source.M32;
+	result.M31 = source.M13;
+	result.M32 = source.M23;
+	result.M33 = source.M33;
+	result.M41 = -((source.M41 * source.M11) + (source.M42 * source.M12) + (source.M43 * source.M13));
+	result.M42 = -((source.M41 * source.M21) + (source.M42 * source.M22) + (source.M43 * source.M23));
+	result.M43 = -((source.M41 * source.M31) + (source.M42 * source.M32) + (source.M43 * source.M33));
+}
+
+// Affine matrix multiplication
+AffineMatrix operator*(const AffineMatrix& matrix1, const AffineMatrix& matrix2) noexcept {
+	AffineMatrix result;
+	AffineMatrix::Multiply(matrix1, matrix2, result);
+	return result;
+}
+
+// Affine matrix equality comparison
+bool operator==(const AffineMatrix& matrix1, const AffineMatrix& matrix2) noexcept {
+	return (
+		matrix1.M11 == matrix2.M11 && matrix1.M12 == matrix2.M12 && matrix1.M13 == matrix2.M13 &&
+		matrix1.M21 == matrix2.M21 && matrix1.M22 == matrix2.M22 && matrix1.M23 == matrix2.M23 &&
+		matrix1.M31 == matrix2.M31 && matrix1.M32 == matrix2.M32 && matrix1.M33 == matrix2.M33 &&
+		matrix1.M41 == matrix2.M41 && matrix1.M42 == matrix2.M42 && matrix1.M43 == matrix2.M43
+		);
+}
+
+// Affine matrix inequality comparison
+bool operator!=(const AffineMatrix& matrix1, const AffineMatrix& matrix2) noexcept {
+	return !operator==(matrix1, matrix2);
+}
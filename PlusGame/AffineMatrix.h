@@ -0,0 +1,144 @@
+#pragma once
+#include "Vector3.h"
+#include "Matrix.h"
+
+// An affine transform stored as the first three columns of a Matrix (48 bytes). The implicit
+// fourth column is (0, 0, 0, 1), so rows M11-M33 hold the linear part and M41-M43 the
+// translation, with the same row-vector convention as Matrix.
+class AffineMatrix
+{
+public:
+	float M11, M12, M13;
+	float M21, M22, M23;
+	float M31, M32, M33;
+	float M41, M42, M43;
+
+	static const AffineMatrix identity;
+
+	constexpr AffineMatrix(
+		float m11, float m12, float m13,
+		float m21, float m22, float m23,
+		float m31, float m32, float m33,
+		float m41, float m42, float m43
+	) noexcept :
+		M11(m11), M12(m12), M13(m13),
+		M21(m21), M22(m22), M23(m23),
+		M31(m31), M32(m32), M33(m33),
+		M41(m41), M42(m42), M43(m43) {}
+
+	// Drops the projective column of the matrix.
+	explicit AffineMatrix(const Matrix& matrix) noexcept;
+
+	constexpr AffineMatrix() noexcept :
+		M11(0), M12(0), M13(0),
+		M21(0), M22(0), M23(0),
+		M31(0), M32(0), M33(0),
+		M41(0), M42(0), M43(0) {}
+
+public:
+	Vector3 Translation() const noexcept;
+	void Translation(const Vector3& value) noexcept;
+	static constexpr AffineMatrix Identity() noexcept;
+
+	Matrix ToMatrix() const noexcept;
+	static void ToMatrix(const AffineMatrix& matrix, Matrix& result) noexcept;
+
+	float Determinant() const noexcept;
+
+	static AffineMatrix CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3& translation) noexcept;
+	static void CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3& translation, AffineMatrix& result) noexcept;
+	static void CreateFromTRSBatch(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, AffineMatrix* resultArray, int length) noexcept;
+
+	// One billboard per object position, laid out for instance buffers.
+	static void CreateBillboardBatch(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3* cameraForwardVector,
+		AffineMatrix* resultArray, int length) noexcept;
+	static void CreateConstrainedBillboardBatch(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3* cameraForwardVector,
+		const Vector3* objectForwardVector, AffineMatrix* resultArray, int length) noexcept;
+
+	static AffineMatrix Multiply(const AffineMatrix& matrix1, const AffineMatrix& matrix2) noexcept;
+	static void Multiply(const AffineMatrix& matrix1, const AffineMatrix& matrix2, AffineMatrix& result) noexcept;
+	static AffineMatrix Invert(const AffineMatrix& matrix) noexcept;
+	static void Invert(const AffineMatrix& matrix, AffineMatrix& result) noexcept;
+	static AffineMatrix InvertRigid(const AffineMatrix& matrix) noexcept;
+	static void InvertRigid(const AffineMatrix& matrix, AffineMatrix& result) noexcept;
+
+	static Vector3 Transform(const Vector3& position, const AffineMatrix& matrix) noexcept;
+	static void Transform(const Vector3& position, const AffineMatrix& matrix, Vector3& result) noexcept;
+	static Vector3 TransformNormal(const Vector3& normal, const AffineMatrix& matrix) noexcept;
+	static void TransformNormal(const Vector3& normal, const AffineMatrix& matrix, Vector3& result) noexcept;
+
+	// Affine matrix multiplication
+	friend AffineMatrix operator*(const AffineMatrix& matrix1, const AffineMatrix& matrix2) noexcept;
+	// Affine matrix equality comparison
+	friend bool operator==(const AffineMatrix& matrix1, const AffineMatrix& matrix2) noexcept;
+	// Affine matrix inequality comparison
+	friend bool operator!=(const AffineMatrix& matrix1, const AffineMatrix& matrix2) noexcept;
+};
+
+inline constexpr AffineMatrix AffineMatrix::identity(
+	1.0f, 0.0f, 0.0f,
+	0.0f, 1.0f, 0.0f,
+	0.0f, 0.0f, 1.0f,
+	0.0f, 0.0f, 0.0f);
+
+constexpr AffineMatrix AffineMatrix::Identity() noexcept {
+	return identity;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector3"/> that contains a transformation of a position by the specified <see cref="AffineMatrix"/>.
+/// </summary>
+/// <param name="position">Source <see cref="Vector3"/>.</param>
+/// <param name="matrix">The transformation <see cref="AffineMatrix"/>.</param>
+/// <returns>Transformed <see cref="Vector3"/>.</returns>
+inline Vector3 AffineMatrix::Transform(const Vector3& position, const AffineMatrix& matrix) noexcept
+{
+	Vector3 result;
+	Transform(position, matrix, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector3"/> that contains a transformation of a position by the specified <see cref="AffineMatrix"/>.
+/// </summary>
+/// <param name="position">Source <see cref="Vector3"/>.</param>
+/// <param name="matrix">The transformation <see cref="AffineMatrix"/>.</param>
+/// <param name="result">Transformed <see cref="Vector3"/> as an output parameter.</param>
+inline void AffineMatrix::Transform(const Vector3& position, const AffineMatrix& matrix, Vector3& result) noexcept
+{
+	auto x = (position.X * matrix.M11) + (position.Y * matrix.M21) + (position.Z * matrix.M31) + matrix.M41;
+	auto y = (position.X * matrix.M12) + (position.Y * matrix.M22) + (position.Z * matrix.M32) + matrix.M42;
+	auto z = (position.X * matrix.M13) + (position.Y * matrix.M23) + (position.Z * matrix.M33) + matrix.M43;
+	result.X = x;
+	result.Y = y;
+	result.Z = z;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector3"/> that contains a transformation of a normal by the linear part of the specified <see cref="AffineMatrix"/>.
+/// </summary>
+/// <param name="normal">Source <see cref="Vector3"/> which represents a normal vector.</param>
+/// <param name="matrix">The transformation <see cref="AffineMatrix"/>.</param>
+/// <returns>Transformed normal.</returns>
+inline Vector3 AffineMatrix::TransformNormal(const Vector3& normal, const AffineMatrix& matrix) noexcept
+{
+	Vector3 result;
+	TransformNormal(normal, matrix, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector3"/> that contains a transformation of a normal by the linear part of the specified <see cref="AffineMatrix"/>.
+/// </summary>
+/// <param name="normal">Source <see cref="Vector3"/> which represents a normal vector.</param>
+/// <param name="matrix">The transformation <see cref="AffineMatrix"/>.</param>
+/// <param name="result">Transformed normal as an output parameter.</param>
+inline void AffineMatrix::TransformNormal(const Vector3& normal, const AffineMatrix& matrix, Vector3& result) noexcept
+{
+	auto x = (normal.X * matrix.M11) + (normal.Y * matrix.M21) + (normal.Z * matrix.M31);
+	auto y = (normal.X * matrix.M12) + (normal.Y * matrix.M22) + (normal.Z * matrix.M32);
+	auto z = (normal.X * matrix.M13) + (normal.Y * matrix.M23) + (normal.Z * matrix.M33);
+	result.X = x;
+	result.Y = y;
+	result.Z = z;
+}
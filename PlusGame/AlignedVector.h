@@ -0,0 +1,662 @@
+#pragma once
+#include <cmath>
+#include "CpuFeatures.h"
+#include "MathHelper.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Quaternion.h"
+#if defined(PLUSGAME_X86)
+#include <emmintrin.h>
+#endif
+
+class Matrix;
+struct QuaternionA;
+
+// 16-byte aligned counterparts of Vector3, Vector4 and Quaternion for code that keeps its values
+// in SIMD registers, such as physics and skinning loops. Each value fills one register and moves
+// with a single aligned load or store; the operations are inline, a few SSE instructions each on
+// x86, and give the results of the unaligned types bit for bit. Containers keep the alignment
+// (std::vector since C++17). The transforms by a Matrix are defined in Matrix.h, next to the
+// Vector3 ones.
+
+#if defined(PLUSGAME_X86)
+// Register operations shared by the aligned types. Horizontal sums are formed in lane 0 in the
+// order of the scalar code.
+class AlignedVectorHelper
+{
+public:
+	template<int Lane>
+	static __m128 Splat(__m128 value) noexcept
+	{
+		return _mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+	}
+
+	static __m128 Dot3(__m128 value1, __m128 value2) noexcept
+	{
+		auto products = _mm_mul_ps(value1, value2);
+		auto sum = _mm_add_ss(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+		return _mm_add_ss(sum, _mm_movehl_ps(products, products));
+	}
+
+	static __m128 Dot4(__m128 value1, __m128 value2) noexcept
+	{
+		auto products = _mm_mul_ps(value1, value2);
+		auto sum = _mm_add_ss(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+		sum = _mm_add_ss(sum, _mm_movehl_ps(products, products));
+		return _mm_add_ss(sum, _mm_shuffle_ps(products, products, _MM_SHUFFLE(3, 3, 3, 3)));
+	}
+
+	// (a.Y * b.Z - a.Z * b.Y, a.Z * b.X - a.X * b.Z, a.X * b.Y - a.Y * b.X), as the quaternion
+	// rotation and product write it.
+	static __m128 Cross(__m128 a, __m128 b) noexcept
+	{
+		auto aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		auto aZxy = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+		auto bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		auto bZxy = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+		return _mm_sub_ps(_mm_mul_ps(aYzx, bZxy), _mm_mul_ps(aZxy, bYzx));
+	}
+
+	// X, Y and Z of xyz with the W lane taken from lane 0 of w.
+	static __m128 WithW(__m128 xyz, __m128 w) noexcept
+	{
+		auto mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		return _mm_or_ps(_mm_and_ps(mask, xyz), _mm_andnot_ps(mask, Splat<0>(w)));
+	}
+};
+#endif
+
+struct alignas(16) Vector3A
+{
+public:
+	float X;
+	float Y;
+	float Z;
+	// Fourth register lane. Construction from components clears it and the operations keep it
+	// zero for finite inputs; it takes no part in comparisons and lengths.
+	float Padding;
+
+public:
+	constexpr Vector3A() noexcept : X(0), Y(0), Z(0), Padding(0) {}
+	constexpr Vector3A(float x, float y, float z) noexcept : X(x), Y(y), Z(z), Padding(0) {}
+	constexpr explicit Vector3A(float value) noexcept : X(value), Y(value), Z(value), Padding(0) {}
+	constexpr explicit Vector3A(const Vector3& value) noexcept : X(value.X), Y(value.Y), Z(value.Z), Padding(0) {}
+
+	Vector3 ToVector3() const noexcept { return Vector3(X, Y, Z); }
+
+#if defined(PLUSGAME_X86)
+	// Moves to and from a register, fourth lane included.
+	explicit Vector3A(__m128 value) noexcept { _mm_store_ps(&X, value); }
+	__m128 ToRegister() const noexcept { return _mm_load_ps(&X); }
+#endif
+
+	// Operator overloads
+	Vector3A operator+(const Vector3A& other) const noexcept;
+	Vector3A& operator+=(const Vector3A& other) noexcept;
+	Vector3A operator-(const Vector3A& other) const noexcept;
+	Vector3A& operator-=(const Vector3A& other) noexcept;
+	Vector3A operator*(const Vector3A& other) const noexcept;
+	Vector3A operator*(float scalar) const noexcept;
+	Vector3A& operator*=(float scalar) noexcept;
+	// Division by zero gives the zero vector, as for Vector3.
+	Vector3A operator/(float scalar) const noexcept;
+	Vector3A& operator/=(float scalar) noexcept;
+	bool operator==(const Vector3A& other) const noexcept;
+	bool operator!=(const Vector3A& other) const noexcept;
+
+	float Length() const noexcept;
+	float LengthSquared() const noexcept;
+	void Normalize() noexcept;
+
+	// Static methods
+	static Vector3A Cross(const Vector3A& vector1, const Vector3A& vector2) noexcept;
+	static float Dot(const Vector3A& vector1, const Vector3A& vector2) noexcept;
+	static Vector3A Lerp(const Vector3A& value1, const Vector3A& value2, float amount) noexcept;
+	static Vector3A Max(const Vector3A& value1, const Vector3A& value2) noexcept;
+	static Vector3A Min(const Vector3A& value1, const Vector3A& value2) noexcept;
+	static Vector3A Normalize(const Vector3A& value) noexcept;
+	static Vector3A Transform(const Vector3A& position, const Matrix& matrix) noexcept;
+	static Vector3A Transform(const Vector3A& value, const QuaternionA& rotation) noexcept;
+	static Vector3A TransformNormal(const Vector3A& normal, const Matrix& matrix) noexcept;
+};
+
+struct alignas(16) Vector4A
+{
+public:
+	float X;
+	float Y;
+	float Z;
+	float W;
+
+public:
+	constexpr Vector4A() noexcept : X(0), Y(0), Z(0), W(0) {}
+	constexpr Vector4A(float x, float y, float z, float w) noexcept : X(x), Y(y), Z(z), W(w) {}
+	constexpr explicit Vector4A(float value) noexcept : X(value), Y(value), Z(value), W(value) {}
+	constexpr Vector4A(const Vector3A& value, float w) noexcept : X(value.X), Y(value.Y), Z(value.Z), W(w) {}
+	constexpr explicit Vector4A(const Vector4& value) noexcept : X(value.X), Y(value.Y), Z(value.Z), W(value.W) {}
+
+	Vector4 ToVector4() const noexcept { return Vector4(X, Y, Z, W); }
+
+#if defined(PLUSGAME_X86)
+	explicit Vector4A(__m128 value) noexcept { _mm_store_ps(&X, value); }
+	__m128 ToRegister() const noexcept { return _mm_load_ps(&X); }
+#endif
+
+	// Operator overloads
+	Vector4A operator-() const noexcept;
+	Vector4A operator+(const Vector4A& other) const noexcept;
+	Vector4A& operator+=(const Vector4A& other) noexcept;
+	Vector4A operator-(const Vector4A& other) const noexcept;
+	Vector4A& operator-=(const Vector4A& other) noexcept;
+	Vector4A operator*(const Vector4A& other) const noexcept;
+	Vector4A operator*(float scaleFactor) const noexcept;
+	Vector4A& operator*=(float scaleFactor) noexcept;
+	Vector4A operator/(const Vector4A& other) const noexcept;
+	Vector4A operator/(float divider) const noexcept;
+	bool operator==(const Vector4A& other) const noexcept;
+	bool operator!=(const Vector4A& other) const noexcept;
+
+	float Length() const noexcept;
+	float LengthSquared() const noexcept;
+	void Normalize() noexcept;
+
+	// Static methods
+	static float Dot(const Vector4A& value1, const Vector4A& value2) noexcept;
+	static Vector4A Lerp(const Vector4A& value1, const Vector4A& value2, float amount) noexcept;
+	static Vector4A Max(const Vector4A& value1, const Vector4A& value2) noexcept;
+	static Vector4A Min(const Vector4A& value1, const Vector4A& value2) noexcept;
+	static Vector4A Normalize(const Vector4A& value) noexcept;
+	static Vector4A Transform(const Vector4A& value, const Matrix& matrix) noexcept;
+};
+
+struct alignas(16) QuaternionA
+{
+public:
+	float X;
+	float Y;
+	float Z;
+	float W;
+
+public:
+	constexpr QuaternionA() noexcept : X(0), Y(0), Z(0), W(0) {}
+	constexpr QuaternionA(float x, float y, float z, float w) noexcept : X(x), Y(y), Z(z), W(w) {}
+	constexpr explicit QuaternionA(const Quaternion& value) noexcept : X(value.X), Y(value.Y), Z(value.Z), W(value.W) {}
+
+	Quaternion ToQuaternion() const noexcept { return Quaternion(X, Y, Z, W); }
+
+	static const QuaternionA Identity;
+
+#if defined(PLUSGAME_X86)
+	explicit QuaternionA(__m128 value) noexcept { _mm_store_ps(&X, value); }
+	__m128 ToRegister() const noexcept { return _mm_load_ps(&X); }
+#endif
+
+	// Operator overloads. The product applies the rotation of the operand first, as
+	// Quaternion::Multiply does.
+	QuaternionA operator-() const noexcept;
+	QuaternionA operator+(const QuaternionA& other) const noexcept;
+	QuaternionA operator-(const QuaternionA& other) const noexcept;
+	QuaternionA operator*(const QuaternionA& other) const noexcept;
+	QuaternionA operator*(float scaleFactor) const noexcept;
+	bool operator==(const QuaternionA& other) const noexcept;
+	bool operator!=(const QuaternionA& other) const noexcept;
+
+	float Length() const noexcept;
+	float LengthSquared() const noexcept;
+	// As Quaternion::Normalize<ExactPrecision>.
+	void Normalize() noexcept;
+
+	// Static methods
+	static QuaternionA Conjugate(const QuaternionA& value) noexcept;
+	static float Dot(const QuaternionA& quaternion1, const QuaternionA& quaternion2) noexcept;
+	static QuaternionA Normalize(const QuaternionA& value) noexcept;
+};
+
+static_assert(sizeof(Vector3A) == 16 && alignof(Vector3A) == 16, "Vector3A must fill one aligned register");
+static_assert(sizeof(Vector4A) == 16 && alignof(Vector4A) == 16, "Vector4A must fill one aligned register");
+static_assert(sizeof(QuaternionA) == 16 && alignof(QuaternionA) == 16, "QuaternionA must fill one aligned register");
+
+inline constexpr QuaternionA QuaternionA::Identity(0.0f, 0.0f, 0.0f, 1.0f);
+
+// Vector3A
+inline Vector3A Vector3A::operator+(const Vector3A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector3A(_mm_add_ps(ToRegister(), other.ToRegister()));
+#else
+	return Vector3A(X + other.X, Y + other.Y, Z + other.Z);
+#endif
+}
+
+inline Vector3A& Vector3A::operator+=(const Vector3A& other) noexcept
+{
+	return *this = *this + other;
+}
+
+inline Vector3A Vector3A::operator-(const Vector3A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector3A(_mm_sub_ps(ToRegister(), other.ToRegister()));
+#else
+	return Vector3A(X - other.X, Y - other.Y, Z - other.Z);
+#endif
+}
+
+inline Vector3A& Vector3A::operator-=(const Vector3A& other) noexcept
+{
+	return *this = *this - other;
+}
+
+inline Vector3A Vector3A::operator*(const Vector3A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector3A(_mm_mul_ps(ToRegister(), other.ToRegister()));
+#else
+	return Vector3A(X * other.X, Y * other.Y, Z * other.Z);
+#endif
+}
+
+inline Vector3A Vector3A::operator*(float scalar) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector3A(_mm_mul_ps(ToRegister(), _mm_set1_ps(scalar)));
+#else
+	return Vector3A(X * scalar, Y * scalar, Z * scalar);
+#endif
+}
+
+inline Vector3A& Vector3A::operator*=(float scalar) noexcept
+{
+	return *this = *this * scalar;
+}
+
+inline Vector3A Vector3A::operator/(float scalar) const noexcept
+{
+	if (scalar != 0.0f)
+		return *this * (1.0f / scalar);
+	return Vector3A();
+}
+
+inline Vector3A& Vector3A::operator/=(float scalar) noexcept
+{
+	if (scalar != 0.0f)
+		*this *= 1.0f / scalar;
+	return *this;
+}
+
+inline bool Vector3A::operator==(const Vector3A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return (_mm_movemask_ps(_mm_cmpeq_ps(ToRegister(), other.ToRegister())) & 7) == 7;
+#else
+	return X == other.X && Y == other.Y && Z == other.Z;
+#endif
+}
+
+inline bool Vector3A::operator!=(const Vector3A& other) const noexcept
+{
+	return !(*this == other);
+}
+
+inline float Vector3A::Length() const noexcept
+{
+	return std::sqrt(LengthSquared());
+}
+
+inline float Vector3A::LengthSquared() const noexcept
+{
+	return Dot(*this, *this);
+}
+
+inline void Vector3A::Normalize() noexcept
+{
+	*this = Normalize(*this);
+}
+
+// Vector3::Cross writes Y as the negation of X1 * Z2 - X2 * Z1, which is kept here so that
+// the signs of zeros match.
+inline Vector3A Vector3A::Cross(const Vector3A& vector1, const Vector3A& vector2) noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto a = vector1.ToRegister();
+	auto b = vector2.ToRegister();
+	auto aYxx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 0, 1));
+	auto aZzy = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 2, 2));
+	auto bYxx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 0, 1));
+	auto bZzy = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 2, 2));
+	auto difference = _mm_sub_ps(_mm_mul_ps(aYxx, bZzy), _mm_mul_ps(bYxx, aZzy));
+	return Vector3A(_mm_xor_ps(difference, _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f)));
+#else
+	return Vector3A(
+		vector1.Y * vector2.Z - vector2.Y * vector1.Z,
+		-(vector1.X * vector2.Z - vector2.X * vector1.Z),
+		vector1.X * vector2.Y - vector2.X * vector1.Y);
+#endif
+}
+
+inline float Vector3A::Dot(const Vector3A& vector1, const Vector3A& vector2) noexcept
+{
+#if defined(PLUSGAME_X86)
+	return _mm_cvtss_f32(AlignedVectorHelper::Dot3(vector1.ToRegister(), vector2.ToRegister()));
+#else
+	return (vector1.X * vector2.X) + (vector1.Y * vector2.Y) + (vector1.Z * vector2.Z);
+#endif
+}
+
+inline Vector3A Vector3A::Lerp(const Vector3A& value1, const Vector3A& value2, float amount) noexcept
+{
+	return value1 + (value2 - value1) * amount;
+}
+
+inline Vector3A Vector3A::Max(const Vector3A& value1, const Vector3A& value2) noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector3A(_mm_max_ps(value1.ToRegister(), value2.ToRegister()));
+#else
+	return Vector3A(MathHelper::Max(value1.X, value2.X), MathHelper::Max(value1.Y, value2.Y), MathHelper::Max(value1.Z, value2.Z));
+#endif
+}
+
+inline Vector3A Vector3A::Min(const Vector3A& value1, const Vector3A& value2) noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector3A(_mm_min_ps(value1.ToRegister(), value2.ToRegister()));
+#else
+	return Vector3A(MathHelper::Min(value1.X, value2.X), MathHelper::Min(value1.Y, value2.Y), MathHelper::Min(value1.Z, value2.Z));
+#endif
+}
+
+inline Vector3A Vector3A::Normalize(const Vector3A& value) noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto v = value.ToRegister();
+	auto factor = _mm_div_ss(_mm_set_ss(1.0f), _mm_sqrt_ss(AlignedVectorHelper::Dot3(v, v)));
+	return Vector3A(_mm_mul_ps(v, AlignedVectorHelper::Splat<0>(factor)));
+#else
+	float factor = 1.0f / value.Length();
+	return value * factor;
+#endif
+}
+
+inline Vector3A Vector3A::Transform(const Vector3A& value, const QuaternionA& rotation) noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto p = value.ToRegister();
+	auto q = rotation.ToRegister();
+	auto t = _mm_mul_ps(_mm_set1_ps(2.0f), AlignedVectorHelper::Cross(q, p));
+	auto result = _mm_add_ps(_mm_add_ps(p, _mm_mul_ps(t, AlignedVectorHelper::Splat<3>(q))), AlignedVectorHelper::Cross(q, t));
+	return Vector3A(AlignedVectorHelper::WithW(result, _mm_setzero_ps()));
+#else
+	float x = 2 * (rotation.Y * value.Z - rotation.Z * value.Y);
+	float y = 2 * (rotation.Z * value.X - rotation.X * value.Z);
+	float z = 2 * (rotation.X * value.Y - rotation.Y * value.X);
+	return Vector3A(
+		value.X + x * rotation.W + (rotation.Y * z - rotation.Z * y),
+		value.Y + y * rotation.W + (rotation.Z * x - rotation.X * z),
+		value.Z + z * rotation.W + (rotation.X * y - rotation.Y * x));
+#endif
+}
+
+// Vector4A
+inline Vector4A Vector4A::operator-() const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector4A(_mm_xor_ps(ToRegister(), _mm_set1_ps(-0.0f)));
+#else
+	return Vector4A(-X, -Y, -Z, -W);
+#endif
+}
+
+inline Vector4A Vector4A::operator+(const Vector4A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector4A(_mm_add_ps(ToRegister(), other.ToRegister()));
+#else
+	return Vector4A(X + other.X, Y + other.Y, Z + other.Z, W + other.W);
+#endif
+}
+
+inline Vector4A& Vector4A::operator+=(const Vector4A& other) noexcept
+{
+	return *this = *this + other;
+}
+
+inline Vector4A Vector4A::operator-(const Vector4A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector4A(_mm_sub_ps(ToRegister(), other.ToRegister()));
+#else
+	return Vector4A(X - other.X, Y - other.Y, Z - other.Z, W - other.W);
+#endif
+}
+
+inline Vector4A& Vector4A::operator-=(const Vector4A& other) noexcept
+{
+	return *this = *this - other;
+}
+
+inline Vector4A Vector4A::operator*(const Vector4A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector4A(_mm_mul_ps(ToRegister(), other.ToRegister()));
+#else
+	return Vector4A(X * other.X, Y * other.Y, Z * other.Z, W * other.W);
+#endif
+}
+
+inline Vector4A Vector4A::operator*(float scaleFactor) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector4A(_mm_mul_ps(ToRegister(), _mm_set1_ps(scaleFactor)));
+#else
+	return Vector4A(X * scaleFactor, Y * scaleFactor, Z * scaleFactor, W * scaleFactor);
+#endif
+}
+
+inline Vector4A& Vector4A::operator*=(float scaleFactor) noexcept
+{
+	return *this = *this * scaleFactor;
+}
+
+inline Vector4A Vector4A::operator/(const Vector4A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector4A(_mm_div_ps(ToRegister(), other.ToRegister()));
+#else
+	return Vector4A(X / other.X, Y / other.Y, Z / other.Z, W / other.W);
+#endif
+}
+
+inline Vector4A Vector4A::operator/(float divider) const noexcept
+{
+	return *this * (1.0f / divider);
+}
+
+inline bool Vector4A::operator==(const Vector4A& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return _mm_movemask_ps(_mm_cmpeq_ps(ToRegister(), other.ToRegister())) == 15;
+#else
+	return X == other.X && Y == other.Y && Z == other.Z && W == other.W;
+#endif
+}
+
+inline bool Vector4A::operator!=(const Vector4A& other) const noexcept
+{
+	return !(*this == other);
+}
+
+inline float Vector4A::Length() const noexcept
+{
+	return std::sqrt(LengthSquared());
+}
+
+inline float Vector4A::LengthSquared() const noexcept
+{
+	return Dot(*this, *this);
+}
+
+inline void Vector4A::Normalize() noexcept
+{
+	*this = Normalize(*this);
+}
+
+inline float Vector4A::Dot(const Vector4A& value1, const Vector4A& value2) noexcept
+{
+#if defined(PLUSGAME_X86)
+	return _mm_cvtss_f32(AlignedVectorHelper::Dot4(value1.ToRegister(), value2.ToRegister()));
+#else
+	return value1.X * value2.X + value1.Y * value2.Y + value1.Z * value2.Z + value1.W * value2.W;
+#endif
+}
+
+inline Vector4A Vector4A::Lerp(const Vector4A& value1, const Vector4A& value2, float amount) noexcept
+{
+	return value1 + (value2 - value1) * amount;
+}
+
+inline Vector4A Vector4A::Max(const Vector4A& value1, const Vector4A& value2) noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector4A(_mm_max_ps(value1.ToRegister(), value2.ToRegister()));
+#else
+	return Vector4A(MathHelper::Max(value1.X, value2.X), MathHelper::Max(value1.Y, value2.Y),
+		MathHelper::Max(value1.Z, value2.Z), MathHelper::Max(value1.W, value2.W));
+#endif
+}
+
+inline Vector4A Vector4A::Min(const Vector4A& value1, const Vector4A& value2) noexcept
+{
+#if defined(PLUSGAME_X86)
+	return Vector4A(_mm_min_ps(value1.ToRegister(), value2.ToRegister()));
+#else
+	return Vector4A(MathHelper::Min(value1.X, value2.X), MathHelper::Min(value1.Y, value2.Y),
+		MathHelper::Min(value1.Z, value2.Z), MathHelper::Min(value1.W, value2.W));
+#endif
+}
+
+inline Vector4A Vector4A::Normalize(const Vector4A& value) noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto v = value.ToRegister();
+	auto factor = _mm_div_ss(_mm_set_ss(1.0f), _mm_sqrt_ss(AlignedVectorHelper::Dot4(v, v)));
+	return Vector4A(_mm_mul_ps(v, AlignedVectorHelper::Splat<0>(factor)));
+#else
+	float factor = 1.0f / value.Length();
+	return value * factor;
+#endif
+}
+
+// QuaternionA
+inline QuaternionA QuaternionA::operator-() const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return QuaternionA(_mm_xor_ps(ToRegister(), _mm_set1_ps(-0.0f)));
+#else
+	return QuaternionA(-X, -Y, -Z, -W);
+#endif
+}
+
+inline QuaternionA QuaternionA::operator+(const QuaternionA& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return QuaternionA(_mm_add_ps(ToRegister(), other.ToRegister()));
+#else
+	return QuaternionA(X + other.X, Y + other.Y, Z + other.Z, W + other.W);
+#endif
+}
+
+inline QuaternionA QuaternionA::operator-(const QuaternionA& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return QuaternionA(_mm_sub_ps(ToRegister(), other.ToRegister()));
+#else
+	return QuaternionA(X - other.X, Y - other.Y, Z - other.Z, W - other.W);
+#endif
+}
+
+inline QuaternionA QuaternionA::operator*(const QuaternionA& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto a = ToRegister();
+	auto b = other.ToRegister();
+	auto aW = AlignedVectorHelper::Splat<3>(a);
+	auto bW = AlignedVectorHelper::Splat<3>(b);
+	auto xyz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, bW), _mm_mul_ps(b, aW)), AlignedVectorHelper::Cross(a, b));
+	auto w = _mm_sub_ss(_mm_mul_ss(aW, bW), AlignedVectorHelper::Dot3(a, b));
+	return QuaternionA(AlignedVectorHelper::WithW(xyz, w));
+#else
+	return QuaternionA(
+		((X * other.W) + (other.X * W)) + ((Y * other.Z) - (Z * other.Y)),
+		((Y * other.W) + (other.Y * W)) + ((Z * other.X) - (X * other.Z)),
+		((Z * other.W) + (other.Z * W)) + ((X * other.Y) - (Y * other.X)),
+		(W * other.W) - (((X * other.X) + (Y * other.Y)) + (Z * other.Z)));
+#endif
+}
+
+inline QuaternionA QuaternionA::operator*(float scaleFactor) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return QuaternionA(_mm_mul_ps(ToRegister(), _mm_set1_ps(scaleFactor)));
+#else
+	return QuaternionA(X * scaleFactor, Y * scaleFactor, Z * scaleFactor, W * scaleFactor);
+#endif
+}
+
+inline bool QuaternionA::operator==(const QuaternionA& other) const noexcept
+{
+#if defined(PLUSGAME_X86)
+	return _mm_movemask_ps(_mm_cmpeq_ps(ToRegister(), other.ToRegister())) == 15;
+#else
+	return X == other.X && Y == other.Y && Z == other.Z && W == other.W;
+#endif
+}
+
+inline bool QuaternionA::operator!=(const QuaternionA& other) const noexcept
+{
+	return !(*this == other);
+}
+
+inline float QuaternionA::Length() const noexcept
+{
+	return std::sqrt(LengthSquared());
+}
+
+inline float QuaternionA::LengthSquared() const noexcept
+{
+	return Dot(*this, *this);
+}
+
+inline void QuaternionA::Normalize() noexcept
+{
+	*this = Normalize(*this);
+}
+
+inline QuaternionA QuaternionA::Conjugate(const QuaternionA& value) noexcept
+{
+#if defined(PLUSGAME_X86)
+	return QuaternionA(_mm_xor_ps(value.ToRegister(), _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f)));
+#else
+	return QuaternionA(-value.X, -value.Y, -value.Z, value.W);
+#endif
+}
+
+inline float QuaternionA::Dot(const QuaternionA& quaternion1, const QuaternionA& quaternion2) noexcept
+{
+#if defined(PLUSGAME_X86)
+	return _mm_cvtss_f32(AlignedVectorHelper::Dot4(quaternion1.ToRegister(), quaternion2.ToRegister()));
+#else
+	return (((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W);
+#endif
+}
+
+inline QuaternionA QuaternionA::Normalize(const QuaternionA& value) noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto q = value.ToRegister();
+	auto factor = _mm_div_ss(_mm_set_ss(1.0f), _mm_sqrt_ss(AlignedVectorHelper::Dot4(q, q)));
+	return QuaternionA(_mm_mul_ps(q, AlignedVectorHelper::Splat<0>(factor)));
+#else
+	return value * (1.0f / value.Length());
+#endif
+}
@@ -1,4 +1,6 @@
 #include "BoundingBox.h"
+#include "BoundingSphere.h"
+#include "Plane.h"
 
 const Vector3 BoundingBox::MaxVector3(std::numeric_limits<float>::max());
 const Vector3 BoundingBox::MinVector3(std::numeric_limits<float>::min());
@@ -10,7 +12,7 @@ const Vector3 BoundingBox::MinVector3(std::numeric_limits<float>::min());
 ///   A value indicating if this <see cref="BoundingBox"/> contains,
 ///   intersects with or is disjoint with <paramref name="box"/>.
 /// </returns>
-ContainmentType BoundingBox::Contains(BoundingBox& box)
+ContainmentType BoundingBox::Contains(const BoundingBox& box) const noexcept
 {
 	//test if all corner is in the same side of a face by just checking min and max
 	if (box.Max.X < Min.X
@@ -41,7 +43,7 @@ ContainmentType BoundingBox::Contains(BoundingBox& box)
 ///   A value indicating if this <see cref="BoundingBox"/> contains,
 ///   intersects with or is disjoint with <paramref name="box"/>.
 /// </param>
-void BoundingBox::Contains(BoundingBox& box, ContainmentType& result)
+void BoundingBox::Contains(const BoundingBox& box, ContainmentType& result) const noexcept
 {
 	result = Contains(box);
 }
@@ -54,7 +56,7 @@ void BoundingBox::Contains(BoundingBox& box, ContainmentType& result)
 ///   <see cref="ContainmentType.Contains"/> if this <see cref="BoundingBox"/> contains
 ///   <paramref name="point"/> or <see cref="ContainmentType.Disjoint"/> if it does not.
 /// </returns>
-ContainmentType BoundingBox::Contains(Vector3& point)
+ContainmentType BoundingBox::Contains(const Vector3& point) const noexcept
 {
 	ContainmentType result;
 	this->Contains(point, result);
@@ -69,7 +71,7 @@ ContainmentType BoundingBox::Contains(Vector3& point)
 ///   <see cref="ContainmentType.Contains"/> if this <see cref="BoundingBox"/> contains
 ///   <paramref name="point"/> or <see cref="ContainmentType.Disjoint"/> if it does not.
 /// </param>
-void BoundingBox::Contains(Vector3& point, ContainmentType& result)
+void BoundingBox::Contains(const Vector3& point, ContainmentType& result) const noexcept
 {
 	//first we get if point is out of box
 	if (point.X < this->Min.X
@@ -95,7 +97,7 @@ void BoundingBox::Contains(Vector3& point, ContainmentType& result)
 /// <param name="count">The number of points to iterate</param>
 /// <returns>A bounding box that encapsulates the given point cloud.</returns>
 /// <exception cref="System.ArgumentException">Thrown if the given array is null or has no points.</exception>
-BoundingBox BoundingBox::CreateFromPoints(Vector3* points, int index = 0, int count = -1)
+BoundingBox BoundingBox::CreateFromPoints(const Vector3* points, int index = 0, int count = -1) noexcept
 {
 	if (count == -1)
 		count = sizeof(points) / sizeof(points[0]);
@@ -124,7 +126,7 @@ BoundingBox BoundingBox::CreateFromPoints(Vector3* points, int index = 0, int co
 /// <returns>
 ///   The <see cref="BoundingBox"/> enclosing <paramref name="original"/> and <paramref name="additional"/>.
 /// </returns>
-BoundingBox BoundingBox::CreateMerged(BoundingBox& original, BoundingBox& additional)
+BoundingBox BoundingBox::CreateMerged(const BoundingBox& original, const BoundingBox& additional) noexcept
 {
 	BoundingBox result;
 	CreateMerged(original, additional, result);
@@ -139,7 +141,7 @@ BoundingBox BoundingBox::CreateMerged(BoundingBox& original, BoundingBox& additi
 /// <param name="result">
 ///   The <see cref="BoundingBox"/> enclosing <paramref name="original"/> and <paramref name="additional"/>.
 /// </param>
-void BoundingBox::CreateMerged(BoundingBox& original, BoundingBox& additional, BoundingBox& result)
+void BoundingBox::CreateMerged(const BoundingBox& original, const BoundingBox& additional, BoundingBox& result) noexcept
 {
 	result.Min.X = MathHelper::Min(original.Min.X, additional.Min.X);
 	result.Min.Y = MathHelper::Min(original.Min.Y, additional.Min.Y);
@@ -153,7 +155,7 @@ void BoundingBox::CreateMerged(BoundingBox& original, BoundingBox& additional, B
 ///   Get an array of <see cref="Vector3"/> containing the corners of this <see cref="BoundingBox"/>.
 /// </summary>
 /// <returns>An array of <see cref="Vector3"/> containing the corners of this <see cref="BoundingBox"/>.</returns>
-Vector3* BoundingBox::GetCorners()
+Vector3* BoundingBox::GetCorners() noexcept
 {
 	Vector3 array[8] = {
 		  Vector3(this->Min.X, this->Max.Y, this->Max.Z),
@@ -177,7 +179,7 @@ Vector3* BoundingBox::GetCorners()
 /// <exception cref="ArgumentOutOfRangeException">
 ///   If <paramref name="corners"/> has a length of less than 8.
 /// </exception>
-void BoundingBox::GetCorners(Vector3* corners)
+void BoundingBox::GetCorners(Vector3* corners) noexcept
 {
 	corners[0].X = this->Min.X;
 	corners[0].Y = this->Max.Y;
@@ -213,7 +215,7 @@ void BoundingBox::GetCorners(Vector3* corners)
 ///   <code>true</code> if this <see cref="BoundingBox"/> intersects <paramref name="box"/>,
 ///   <code>false</code> if it does not.
 /// </returns>
-bool BoundingBox::Intersects(BoundingBox& box)
+bool BoundingBox::Intersects(const BoundingBox& box) const noexcept
 {
 	bool result;
 	Intersects(box, result);
@@ -228,7 +230,7 @@ bool BoundingBox::Intersects(BoundingBox& box)
 ///   <code>true</code> if this <see cref="BoundingBox"/> intersects <paramref name="box"/>,
 ///   <code>false</code> if it does not.
 /// </param>
-void BoundingBox::Intersects(BoundingBox& box, bool& result)
+void BoundingBox::Intersects(const BoundingBox& box, bool& result) const noexcept
 {
 	if ((this->Max.X >= box.Min.X) && (this->Min.X <= box.Max.X))
 	{
@@ -254,7 +256,7 @@ void BoundingBox::Intersects(BoundingBox& box, bool& result)
 ///   <code>true</code> if this <see cref="BoundingBox"/> intersects <paramref name="sphere"/>,
 ///   <code>false</code> if it does not.
 /// </returns>
-bool BoundingBox::Intersects(BoundingSphere& sphere)
+bool BoundingBox::Intersects(const BoundingSphere& sphere) const noexcept
 {
 	bool result;
 	Intersects(sphere, result);
@@ -269,7 +271,7 @@ bool BoundingBox::Intersects(BoundingSphere& sphere)
 ///   <code>true</code> if this <see cref="BoundingBox"/> intersects <paramref name="sphere"/>,
 ///   <code>false</code> if it does not.
 /// </param>
-void BoundingBox::Intersects(BoundingSphere& sphere, bool& result)
+void BoundingBox::Intersects(const BoundingSphere& sphere, bool& result) const noexcept
 {
 	auto squareDistance = 0.0f;
 	auto point = sphere.Center;
@@ -290,7 +292,7 @@ void BoundingBox::Intersects(BoundingSphere& sphere, bool& result)
 ///   <code>true</code> if this <see cref="BoundingBox"/> intersects <paramref name="sphere"/>,
 ///   <code>false</code> if it does not.
 /// </returns>
-bool BoundingBox::Intersects(BoundingSphere* sphere)
+bool BoundingBox::Intersects(const BoundingSphere* sphere) const noexcept
 {
 	bool result;
 	Intersects(*sphere, result);
@@ -305,7 +307,7 @@ bool BoundingBox::Intersects(BoundingSphere* sphere)
 ///   <code>true</code> if this <see cref="BoundingBox"/> intersects <paramref name="sphere"/>,
 ///   <code>false</code> if it does not.
 /// </param>
-void BoundingBox::Intersects(BoundingSphere* sphere, bool& result)
+void BoundingBox::Intersects(const BoundingSphere* sphere, bool& result) const noexcept
 {
 	auto squareDistance = 0.0f;
 	auto point = (*sphere).Center;
@@ -327,7 +329,7 @@ void BoundingBox::Intersects(BoundingSphere* sphere, bool& result)
 ///   <code>true</code> if this <see cref="BoundingBox"/> intersects <paramref name="plane"/>,
 ///   <code>false</code> if it does not.
 /// </returns>
-PlaneIntersectionType BoundingBox::Intersects(Plane& plane)
+PlaneIntersectionType BoundingBox::Intersects(const Plane& plane) const noexcept
 {
 	PlaneIntersectionType result;
 	Intersects(plane, result);
@@ -342,7 +344,7 @@ PlaneIntersectionType BoundingBox::Intersects(Plane& plane)
 ///   <code>true</code> if this <see cref="BoundingBox"/> intersects <paramref name="plane"/>,
 ///   <code>false</code> if it does not.
 /// </param>
-void BoundingBox::Intersects(Plane& plane, PlaneIntersectionType& result)
+void BoundingBox::Intersects(const Plane& plane, PlaneIntersectionType& result) const noexcept
 {
 	// See http://zach.in.tu-clausthal.de/teaching/cg_literatur/lighthouse3d_view_frustum_culling/index.html
 
@@ -1,8 +1,10 @@
 #pragma once
 #include "Vector3.h"
 #include "IntersectionEnums.h"
-#include "BoundingSphere.h"
-#include "Plane.h"
+
+class BoundingSphere;
+class Plane;
+
 class BoundingBox
 {
 public:
@@ -28,27 +30,27 @@ public:
 		/// </summary>
 		/// <param name="min">The minimum extent of the <see cref="BoundingBox"/>.</param>
 		/// <param name="max">The maximum extent of the <see cref="BoundingBox"/>.</param>
-	BoundingBox(Vector3 min, Vector3 max) : Max(max), Min(min) {}
-	BoundingBox() : Max(MaxVector3), Min(MinVector3) {}
-
-	ContainmentType Contains(BoundingBox& box);
-	void Contains(BoundingBox& box, ContainmentType& result);
-	ContainmentType Contains(Vector3& point);
-	void Contains(Vector3& point, ContainmentType& result);
-	BoundingBox CreateFromPoints(Vector3* points, int index, int count);
-	BoundingBox CreateMerged(BoundingBox& original, BoundingBox& additional);
-	void CreateMerged(BoundingBox& original, BoundingBox& additional, BoundingBox& result);
-	Vector3* GetCorners();
-	void GetCorners(Vector3* corners);
-	bool Intersects(BoundingBox& box);
-	void Intersects(BoundingBox& box, bool& result);
-	bool Intersects(BoundingSphere& sphere);
-	void Intersects(BoundingSphere& sphere, bool& result);
-	bool Intersects(BoundingSphere* sphere);
-	void Intersects(BoundingSphere* sphere, bool& result);
-
-	PlaneIntersectionType Intersects(Plane& plane);
-	void Intersects(Plane& plane, PlaneIntersectionType& result);
+	BoundingBox(Vector3 min, Vector3 max) noexcept : Max(max), Min(min) {}
+	BoundingBox() noexcept : Max(MaxVector3), Min(MinVector3) {}
+
+	ContainmentType Contains(const BoundingBox& box) const noexcept;
+	void Contains(const BoundingBox& box, ContainmentType& result) const noexcept;
+	ContainmentType Contains(const Vector3& point) const noexcept;
+	void Contains(const Vector3& point, ContainmentType& result) const noexcept;
+	static BoundingBox CreateFromPoints(const Vector3* points, int index, int count) noexcept;
+	static BoundingBox CreateMerged(const BoundingBox& original, const BoundingBox& additional) noexcept;
+	static void CreateMerged(const BoundingBox& original, const BoundingBox& additional, BoundingBox& result) noexcept;
+	Vector3* GetCorners() noexcept;
+	void GetCorners(Vector3* corners) noexcept;
+	bool Intersects(const BoundingBox& box) const noexcept;
+	void Intersects(const BoundingBox& box, bool& result) const noexcept;
+	bool Intersects(const BoundingSphere& sphere) const noexcept;
+	void Intersects(const BoundingSphere& sphere, bool& result) const noexcept;
+	bool Intersects(const BoundingSphere* sphere) const noexcept;
+	void Intersects(const BoundingSphere* sphere, bool& result) const noexcept;
+
+	PlaneIntersectionType Intersects(const Plane& plane) const noexcept;
+	void Intersects(const Plane& plane, PlaneIntersectionType& result) const noexcept;
 
 };
 
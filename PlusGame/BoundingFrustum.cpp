@@ -1,50 +1,50 @@
 #include "BoundingFrustum.h"
 
-BoundingFrustum::BoundingFrustum(Matrix& value)
+BoundingFrustum::BoundingFrustum(const Matrix& value) noexcept
 {
 	_matrix = value;
 	CreatePlanes();
 	CreateCorners();
 }
 
-Matrix BoundingFrustum::GetMatrix()
+Matrix BoundingFrustum::GetMatrix() const noexcept
 {
 	return _matrix;
 }
 
-void BoundingFrustum::SetMatrix(Matrix& value)
+void BoundingFrustum::SetMatrix(const Matrix& value) noexcept
 {
 	_matrix = value;
 	CreatePlanes();
 	CreateCorners();
 }
 
-Plane BoundingFrustum::GetNear()
+Plane BoundingFrustum::GetNear() const noexcept
 {
 	return _planes[0];
 }
 
-Plane BoundingFrustum::GetFar()
+Plane BoundingFrustum::GetFar() const noexcept
 {
 	return _planes[1];
 }
 
-Plane BoundingFrustum::GetLeft()
+Plane BoundingFrustum::GetLeft() const noexcept
 {
 	return _planes[2];
 }
 
-Plane BoundingFrustum::GetRight()
+Plane BoundingFrustum::GetRight() const noexcept
 {
 	return _planes[3];
 }
 
-Plane BoundingFrustum::GetTop()
+Plane BoundingFrustum::GetTop() const noexcept
 {
 	return _planes[4];
 }
 
-Plane BoundingFrustum::GetBottom()
+Plane BoundingFrustum::GetBottom() const noexcept
 {
 	return _planes[5];
 }
@@ -55,7 +55,7 @@ Plane BoundingFrustum::GetBottom()
 /// </summary>
 /// <param name="box">A <see cref="BoundingBox"/> for testing.</param>
 /// <returns>Result of testing for containment between this <see cref="BoundingFrustum"/> and specified <see cref="BoundingBox"/>.</returns>
-ContainmentType BoundingFrustum::Contains(BoundingBox& box)
+ContainmentType BoundingFrustum::Contains(const BoundingBox& box) const noexcept
 {
 	auto result = ContainmentType::Disjoint;
 	this->Contains(box, result);
@@ -67,7 +67,7 @@ ContainmentType BoundingFrustum::Contains(BoundingBox& box)
 /// </summary>
 /// <param name="box">A <see cref="BoundingBox"/> for testing.</param>
 /// <param name="result">Result of testing for containment between this <see cref="BoundingFrustum"/> and specified <see cref="BoundingBox"/> as an output parameter.</param>
-void BoundingFrustum::Contains(BoundingBox& box, ContainmentType& result)
+void BoundingFrustum::Contains(const BoundingBox& box, ContainmentType& result) const noexcept
 {
 	auto intersects = false;
 	for (auto i = 0; i < PlaneCount; ++i)
@@ -92,7 +92,7 @@ void BoundingFrustum::Contains(BoundingBox& box, ContainmentType& result)
 /// </summary>
 /// <param name="frustum">A <see cref="BoundingFrustum"/> for testing.</param>
 /// <returns>Result of testing for containment between this <see cref="BoundingFrustum"/> and specified <see cref="BoundingFrustum"/>.</returns>
-ContainmentType BoundingFrustum::Contains(BoundingFrustum& frustum)
+ContainmentType BoundingFrustum::Contains(const BoundingFrustum& frustum) const noexcept
 {
 	if (*this == frustum)                // We check to see if the two frustums are equal
 		return ContainmentType::Contains;// If they are, there's no need to go any further.
@@ -119,7 +119,7 @@ ContainmentType BoundingFrustum::Contains(BoundingFrustum& frustum)
 /// </summary>
 /// <param name="sphere">A <see cref="BoundingSphere"/> for testing.</param>
 /// <returns>Result of testing for containment between this <see cref="BoundingFrustum"/> and specified <see cref="BoundingSphere"/>.</returns>
-ContainmentType BoundingFrustum::Contains(BoundingSphere& sphere)
+ContainmentType BoundingFrustum::Contains(const BoundingSphere& sphere) const noexcept
 {
 	auto result = ContainmentType::Disjoint;
 	this->Contains(sphere, result);
@@ -131,7 +131,7 @@ ContainmentType BoundingFrustum::Contains(BoundingSphere& sphere)
 /// </summary>
 /// <param name="sphere">A <see cref="BoundingSphere"/> for testing.</param>
 /// <param name="result">Result of testing for containment between this <see cref="BoundingFrustum"/> and specified <see cref="BoundingSphere"/> as an output parameter.</param>
-void BoundingFrustum::Contains(BoundingSphere& sphere, ContainmentType& result)
+void BoundingFrustum::Contains(const BoundingSphere& sphere, ContainmentType& result) const noexcept
 {
 	auto intersects = false;
 	for (auto i = 0; i < PlaneCount; ++i)
@@ -158,7 +158,7 @@ void BoundingFrustum::Contains(BoundingSphere& sphere, ContainmentType& result)
 /// </summary>
 /// <param name="point">A <see cref="Vector3"/> for testing.</param>
 /// <returns>Result of testing for containment between this <see cref="BoundingFrustum"/> and specified <see cref="Vector3"/>.</returns>
-ContainmentType BoundingFrustum::Contains(Vector3 point)
+ContainmentType BoundingFrustum::Contains(Vector3 point) const noexcept
 {
 	auto result = ContainmentType::Disjoint;
 	this->Contains(point, result);
@@ -170,7 +170,7 @@ ContainmentType BoundingFrustum::Contains(Vector3 point)
 /// </summary>
 /// <param name="point">A <see cref="Vector3"/> for testing.</param>
 /// <param name="result">Result of testing for containment between this <see cref="BoundingFrustum"/> and specified <see cref="Vector3"/> as an output parameter.</param>
-void BoundingFrustum::Contains(Vector3& point, ContainmentType& result)
+void BoundingFrustum::Contains(const Vector3& point, ContainmentType& result) const noexcept
 {
 	for (auto i = 0; i < PlaneCount; ++i)
 	{
@@ -184,19 +184,19 @@ void BoundingFrustum::Contains(Vector3& point, ContainmentType& result)
 	result = ContainmentType::Contains;
 }
 
-bool BoundingFrustum::Intersects(BoundingBox& box)
+bool BoundingFrustum::Intersects(const BoundingBox& box) const noexcept
 {
 	ContainmentType containment = Contains(box);
 	return containment == ContainmentType::Intersects || containment == ContainmentType::Contains;
 }
 
-bool BoundingFrustum::Intersects(BoundingFrustum& frustum)
+bool BoundingFrustum::Intersects(const BoundingFrustum& frustum) const noexcept
 {
 	ContainmentType containment = Contains(frustum);
 	return containment == ContainmentType::Intersects || containment == ContainmentType::Contains;
 }
 
-bool BoundingFrustum::Intersects(BoundingSphere& sphere)
+bool BoundingFrustum::Intersects(const BoundingSphere& sphere) const noexcept
 {
 	ContainmentType containment = Contains(sphere);
 	return containment == ContainmentType::Intersects || containment == ContainmentType::Contains;
@@ -207,7 +207,7 @@ bool BoundingFrustum::Intersects(BoundingSphere& sphere)
 /// </summary>
 /// <param name="plane">A <see cref="Plane"/> for intersection test.</param>
 /// <returns>A plane intersection type.</returns>
-PlaneIntersectionType BoundingFrustum::Intersects(Plane& plane)
+PlaneIntersectionType BoundingFrustum::Intersects(const Plane& plane) const noexcept
 {
 	PlaneIntersectionType result;
 	Intersects(plane, result);
@@ -219,7 +219,7 @@ PlaneIntersectionType BoundingFrustum::Intersects(Plane& plane)
 /// </summary>
 /// <param name="plane">A <see cref="Plane"/> for intersection test.</param>
 /// <param name="result">A plane intersection type as an output parameter.</param>
-void BoundingFrustum::Intersects(Plane& plane, PlaneIntersectionType& result)
+void BoundingFrustum::Intersects(const Plane& plane, PlaneIntersectionType& result) const noexcept
 {
 	int cornersLenght = sizeof(_corners) / sizeof(_corners[0]);
 	result = plane.Intersects(_corners[0]);
@@ -233,7 +233,7 @@ void BoundingFrustum::Intersects(Plane& plane, PlaneIntersectionType& result)
 /// </summary>
 /// <param name="ray">A <see cref="Ray"/> for intersection test.</param>
 /// <returns>Distance at which ray intersects with this <see cref="BoundingFrustum"/> or null if no intersection happens.</returns>
-float BoundingFrustum::Intersects(Ray& ray)
+float BoundingFrustum::Intersects(const Ray& ray) const noexcept
 {
 	float result;
 	Intersects(ray, result);
@@ -245,7 +245,7 @@ float BoundingFrustum::Intersects(Ray& ray)
 /// </summary>
 /// <param name="ray">A <see cref="Ray"/> for intersection test.</param>
 /// <param name="result">Distance at which ray intersects with this <see cref="BoundingFrustum"/> or null if no intersection happens as an output parameter.</param>
-void BoundingFrustum::Intersects(Ray& ray, float& result)
+void BoundingFrustum::Intersects(const Ray& ray, float& result) const noexcept
 {
 	ContainmentType ctype;
 	this->Contains(ray.Position, ctype);
@@ -265,22 +265,22 @@ void BoundingFrustum::Intersects(Ray& ray, float& result)
 	}
 }
 
-Vector3* BoundingFrustum::GetCorners()
+Vector3* BoundingFrustum::GetCorners() noexcept
 {
 	return (Vector3*)_corners;
 }
 
-bool BoundingFrustum::operator==(BoundingFrustum& other)
+bool BoundingFrustum::operator==(const BoundingFrustum& other) const noexcept
 {
 	return _matrix == other._matrix;
 }
 
-bool BoundingFrustum::operator!=(BoundingFrustum& other)
+bool BoundingFrustum::operator!=(const BoundingFrustum& other) const noexcept
 {
 	return !(*this == other);
 }
 
-void BoundingFrustum::CreateCorners()
+void BoundingFrustum::CreateCorners() noexcept
 {
 	IntersectionPoint(this->_planes[0], this->_planes[2], this->_planes[4], this->_corners[0]);
 	IntersectionPoint(this->_planes[0], this->_planes[3], this->_planes[4], this->_corners[1]);
@@ -292,7 +292,7 @@ void BoundingFrustum::CreateCorners()
 	IntersectionPoint(this->_planes[1], this->_planes[2], this->_planes[5], this->_corners[7]);
 }
 
-void BoundingFrustum::CreatePlanes()
+void BoundingFrustum::CreatePlanes() noexcept
 {
 	this->_planes[0] = Plane(-this->_matrix.M13, -this->_matrix.M23, -this->_matrix.M33, -this->_matrix.M43);
 	this->_planes[1] = Plane(this->_matrix.M13 - this->_matrix.M14, this->_matrix.M23 - this->_matrix.M24, this->_matrix.M33 - this->_matrix.M34, this->_matrix.M43 - this->_matrix.M44);
@@ -309,7 +309,7 @@ void BoundingFrustum::CreatePlanes()
 	this->NormalizePlane(this->_planes[5]);
 }
 
-void BoundingFrustum::IntersectionPoint(Plane& a, Plane& b, Plane& c, Vector3& result)
+void BoundingFrustum::IntersectionPoint(const Plane& a, const Plane& b, const Plane& c, Vector3& result) noexcept
 {
 	// Formula used
 	//                d1 ( N2 * N3 ) + d2 ( N3 * N1 ) + d3 ( N1 * N2 )
@@ -346,7 +346,7 @@ void BoundingFrustum::IntersectionPoint(Plane& a, Plane& b, Plane& c, Vector3& r
 	result.Z = (v1.Z + v2.Z + v3.Z) / f;
 }
 
-void BoundingFrustum::NormalizePlane(Plane& p)
+void BoundingFrustum::NormalizePlane(Plane& p) noexcept
 {
 	float factor = 1.0f / Vector3::Length(p.Normal);
 	p.Normal.X *= factor;
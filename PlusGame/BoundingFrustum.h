@@ -6,20 +6,7 @@
 #include "BoundingBox.h"
 #include "BoundingSphere.h"
 #include "Ray.h"
-
-enum ContainmentType
-{
-	Disjoint,
-	Contains,
-	Intersects
-};
-
-enum PlaneIntersectionType
-{
-	Front,
-	Intersecting,
-	Back
-};
+#include "IntersectionEnums.h"
 
 class BoundingFrustum
 {
@@ -27,55 +14,55 @@ public:
 	static const int PlaneCount = 6;
 	static const int CornerCount = 8;
 
-	BoundingFrustum(Matrix& value);
+	BoundingFrustum(const Matrix& value) noexcept;
 
-	Matrix GetMatrix();
-	void SetMatrix(Matrix& value);
+	Matrix GetMatrix() const noexcept;
+	void SetMatrix(const Matrix& value) noexcept;
 
-	Plane GetNear();
-	Plane GetFar();
-	Plane GetLeft();
-	Plane GetRight();
-	Plane GetTop();
-	Plane GetBottom();
+	Plane GetNear() const noexcept;
+	Plane GetFar() const noexcept;
+	Plane GetLeft() const noexcept;
+	Plane GetRight() const noexcept;
+	Plane GetTop() const noexcept;
+	Plane GetBottom() const noexcept;
 
-	ContainmentType Contains(BoundingBox& box);
+	ContainmentType Contains(const BoundingBox& box) const noexcept;
 
-	void Contains(BoundingBox& box, ContainmentType& result);
+	void Contains(const BoundingBox& box, ContainmentType& result) const noexcept;
 
-	ContainmentType Contains(BoundingFrustum& frustum);
+	ContainmentType Contains(const BoundingFrustum& frustum) const noexcept;
 
-	ContainmentType Contains(BoundingSphere& sphere);
+	ContainmentType Contains(const BoundingSphere& sphere) const noexcept;
 
-	void Contains(BoundingSphere& sphere, ContainmentType& result);
+	void Contains(const BoundingSphere& sphere, ContainmentType& result) const noexcept;
 
-	ContainmentType Contains(Vector3 point);
+	ContainmentType Contains(Vector3 point) const noexcept;
 
-	void Contains(Vector3& point, ContainmentType& result);
+	void Contains(const Vector3& point, ContainmentType& result) const noexcept;
 
-	bool Intersects(BoundingBox& box);
-	bool Intersects(BoundingFrustum& frustum);
-	bool Intersects(BoundingSphere& sphere);
-	PlaneIntersectionType Intersects(Plane& plane);
-	void Intersects(Plane& plane, PlaneIntersectionType& result);
+	bool Intersects(const BoundingBox& box) const noexcept;
+	bool Intersects(const BoundingFrustum& frustum) const noexcept;
+	bool Intersects(const BoundingSphere& sphere) const noexcept;
+	PlaneIntersectionType Intersects(const Plane& plane) const noexcept;
+	void Intersects(const Plane& plane, PlaneIntersectionType& result) const noexcept;
 
-	float Intersects(Ray& ray);
-	void Intersects(Ray& ray, float& result);
+	float Intersects(const Ray& ray) const noexcept;
+	void Intersects(const Ray& ray, float& result) const noexcept;
 
-	Vector3* GetCorners();
+	Vector3* GetCorners() noexcept;
 
-	bool operator==(BoundingFrustum& other);
-	bool operator!=(BoundingFrustum& other);
+	bool operator==(const BoundingFrustum& other) const noexcept;
+	bool operator!=(const BoundingFrustum& other) const noexcept;
 
 private:
 	Matrix _matrix;
 	Vector3 _corners[CornerCount];
 	Plane _planes[PlaneCount];
 
-	void CreateCorners();
-	void CreatePlanes();
-	static void IntersectionPoint(Plane& a, Plane& b, Plane& c, Vector3& result);
-	void NormalizePlane(Plane& p);
+	void CreateCorners() noexcept;
+	void CreatePlanes() noexcept;
+	static void IntersectionPoint(const Plane& a, const Plane& b, const Plane& c, Vector3& result) noexcept;
+	void NormalizePlane(Plane& p) noexcept;
 };
 
 
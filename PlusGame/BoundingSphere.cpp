@@ -1,12 +1,13 @@
 #include "BoundingSphere.h"
 #include "BoundingBox.h"
+#include "Plane.h"
 
 /// <summary>
  /// Creates the smallest <see cref="BoundingSphere"/> that can contain a specified <see cref="BoundingBox"/>.
  /// </summary>
  /// <param name="box">The box to create the sphere from.</param>
  /// <returns>The new <see cref="BoundingSphere"/>.</returns>
-BoundingSphere BoundingSphere::CreateFromBoundingBox(BoundingBox& box)
+BoundingSphere BoundingSphere::CreateFromBoundingBox(const BoundingBox& box) noexcept
 {
 	BoundingSphere result;
 	CreateFromBoundingBox(box, result);
@@ -18,7 +19,7 @@ BoundingSphere BoundingSphere::CreateFromBoundingBox(BoundingBox& box)
 /// </summary>
 /// <param name="box">The box to create the sphere from.</param>
 /// <param name="result">The new <see cref="BoundingSphere"/> as an output parameter.</param>
-void BoundingSphere::CreateFromBoundingBox(BoundingBox& box, BoundingSphere& result)
+void BoundingSphere::CreateFromBoundingBox(const BoundingBox& box, BoundingSphere& result) noexcept
 {
 	// Find the center of the box.
 	Vector3 center = Vector3((box.Min.X + box.Max.X) / 2.0f,
@@ -37,7 +38,7 @@ void BoundingSphere::CreateFromBoundingBox(BoundingBox& box, BoundingSphere& res
 /// <param name="original">First sphere.</param>
 /// <param name="additional">Second sphere.</param>
 /// <returns>The new <see cref="BoundingSphere"/>.</returns>
-BoundingSphere BoundingSphere::CreateMerged(BoundingSphere& original, BoundingSphere& additional)
+BoundingSphere BoundingSphere::CreateMerged(const BoundingSphere& original, const BoundingSphere& additional) noexcept
 {
 	BoundingSphere result;
 	CreateMerged(original, additional, result);
@@ -50,7 +51,7 @@ BoundingSphere BoundingSphere::CreateMerged(BoundingSphere& original, BoundingSp
 /// <param name="original">First sphere.</param>
 /// <param name="additional">Second sphere.</param>
 /// <param name="result">The new <see cref="BoundingSphere"/> as an output parameter.</param>
-void BoundingSphere::CreateMerged(BoundingSphere& original, BoundingSphere& additional, BoundingSphere& result)
+void BoundingSphere::CreateMerged(const BoundingSphere& original, const BoundingSphere& additional, BoundingSphere& result) noexcept
 {
 	Vector3 ocenterToaCenter = Vector3::Subtract(additional.Center, original.Center);
 	float distance = Vector3::Length(ocenterToaCenter);
@@ -82,7 +83,7 @@ void BoundingSphere::CreateMerged(BoundingSphere& original, BoundingSphere& addi
 /// </summary>
 /// <param name="box">The box for testing.</param>
 /// <returns><c>true</c> if <see cref="BoundingBox"/> intersects with this sphere; <c>false</c> otherwise.</returns>
-bool BoundingSphere::Intersects(BoundingBox& box)
+bool BoundingSphere::Intersects(const BoundingBox& box) const noexcept
 {
 	return box.Intersects(this);
 }
@@ -92,12 +93,12 @@ bool BoundingSphere::Intersects(BoundingBox& box)
 /// </summary>
 /// <param name="box">The box for testing.</param>
 /// <param name="result"><c>true</c> if <see cref="BoundingBox"/> intersects with this sphere; <c>false</c> otherwise. As an output parameter.</param>
-void BoundingSphere::Intersects(BoundingBox& box, bool& result)
+void BoundingSphere::Intersects(const BoundingBox& box, bool& result) const noexcept
 {
 	box.Intersects(this, result);
 }
 
-bool BoundingSphere::Intersects(BoundingSphere& sphere)
+bool BoundingSphere::Intersects(const BoundingSphere& sphere) const noexcept
 {
 	bool result;
 	Intersects(sphere, result);
@@ -109,7 +110,7 @@ bool BoundingSphere::Intersects(BoundingSphere& sphere)
 /// </summary>
 /// <param name="sphere">The other sphere for testing.</param>
 /// <param name="result"><c>true</c> if other <see cref="BoundingSphere"/> intersects with this sphere; <c>false</c> otherwise. As an output parameter.</param>
-void BoundingSphere::Intersects(BoundingSphere& sphere, bool& result)
+void BoundingSphere::Intersects(const BoundingSphere& sphere, bool& result) const noexcept
 {
 	float sqDistance;
 	Vector3::DistanceSquared(sphere.Center, Center, sqDistance);
@@ -125,7 +126,7 @@ void BoundingSphere::Intersects(BoundingSphere& sphere, bool& result)
 /// </summary>
 /// <param name="plane">The plane for testing.</param>
 /// <returns>Type of intersection.</returns>
-PlaneIntersectionType BoundingSphere::Intersects(Plane& plane)
+PlaneIntersectionType BoundingSphere::Intersects(const Plane& plane) const noexcept
 {
 	auto result = PlaneIntersectionType::Back;
 	// TODO: we might want to inline this for performance reasons
@@ -138,7 +139,7 @@ PlaneIntersectionType BoundingSphere::Intersects(Plane& plane)
 /// </summary>
 /// <param name="plane">The plane for testing.</param>
 /// <param name="result">Type of intersection as an output parameter.</param>
-void BoundingSphere::Intersects(Plane& plane, PlaneIntersectionType& result)
+void BoundingSphere::Intersects(const Plane& plane, PlaneIntersectionType& result) const noexcept
 {
 	float distance = 0;
 	// TODO: we might want to inline this for performance reasons
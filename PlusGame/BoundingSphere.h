@@ -1,5 +1,10 @@
 #pragma once
 #include "Vector3.h"
+#include "IntersectionEnums.h"
+
+class BoundingBox;
+class Plane;
+
 class BoundingSphere
 {
 public:
@@ -13,17 +18,17 @@ public:
 	/// </summary>
 	float Radius;
 
-	BoundingSphere(Vector3 center, float radius) : Center(center), Radius(radius) {}
-	BoundingSphere() : Center(0), Radius(0) {}
-	BoundingSphere CreateFromBoundingBox(BoundingBox& box);
-	void CreateFromBoundingBox(BoundingBox& box, BoundingSphere& result);
-	BoundingSphere CreateMerged(BoundingSphere& original, BoundingSphere& additional);
-	void CreateMerged(BoundingSphere& original, BoundingSphere& additional, BoundingSphere& result);
-	bool Intersects(BoundingBox& box);
-	void Intersects(BoundingBox& box, bool& result);
-	bool Intersects(BoundingSphere& sphere);
-	void Intersects(BoundingSphere& sphere, bool& result);
-	PlaneIntersectionType Intersects(Plane& plane);
-	void Intersects(Plane& plane, PlaneIntersectionType& result);
+	BoundingSphere(Vector3 center, float radius) noexcept : Center(center), Radius(radius) {}
+	BoundingSphere() noexcept : Center(0), Radius(0) {}
+	static BoundingSphere CreateFromBoundingBox(const BoundingBox& box) noexcept;
+	static void CreateFromBoundingBox(const BoundingBox& box, BoundingSphere& result) noexcept;
+	static BoundingSphere CreateMerged(const BoundingSphere& original, const BoundingSphere& additional) noexcept;
+	static void CreateMerged(const BoundingSphere& original, const BoundingSphere& additional, BoundingSphere& result) noexcept;
+	bool Intersects(const BoundingBox& box) const noexcept;
+	void Intersects(const BoundingBox& box, bool& result) const noexcept;
+	bool Intersects(const BoundingSphere& sphere) const noexcept;
+	void Intersects(const BoundingSphere& sphere, bool& result) const noexcept;
+	PlaneIntersectionType Intersects(const Plane& plane) const noexcept;
+	void Intersects(const Plane& plane, PlaneIntersectionType& result) const noexcept;
 };
 
@@ -0,0 +1,246 @@
+#include "Camera.h"
+#include "MathHelper.h"
+
+static const unsigned char ViewDirty = 1;
+static const unsigned char InverseViewDirty = 2;
+static const unsigned char ProjectionDirty = 4;
+static const unsigned char ViewProjectionDirty = 8;
+static const unsigned char InverseViewProjectionDirty = 16;
+static const unsigned char FrustumDirty = 32;
+static const unsigned char AllDirty = 63;
+
+/// <summary>
+/// Creates a camera at the origin looking along <see cref="Vector3.Forward"/>, with a 45 degree perspective projection.
+/// </summary>
+Camera::Camera() noexcept :
+	_position(Vector3::Zero), _target(Vector3::Forward), _up(Vector3::Up),
+	_orthographic(false), _fieldOfView(MathHelper::PiOver4), _aspectRatio(1.0f), _width(1.0f), _height(1.0f),
+	_nearPlaneDistance(1.0f), _farPlaneDistance(1000.0f),
+	_dirty(AllDirty), _frustum(Matrix::identity)
+{
+}
+
+const Vector3& Camera::GetPosition() const noexcept
+{
+	return _position;
+}
+
+const Vector3& Camera::GetTarget() const noexcept
+{
+	return _target;
+}
+
+const Vector3& Camera::GetUp() const noexcept
+{
+	return _up;
+}
+
+void Camera::SetPosition(const Vector3& position) noexcept
+{
+	_position = position;
+	ViewChanged();
+}
+
+void Camera::SetTarget(const Vector3& target) noexcept
+{
+	_target = target;
+	ViewChanged();
+}
+
+void Camera::SetUp(const Vector3& up) noexcept
+{
+	_up = up;
+	ViewChanged();
+}
+
+void Camera::SetLookAt(const Vector3& position, const Vector3& target, const Vector3& up) noexcept
+{
+	_position = position;
+	_target = target;
+	_up = up;
+	ViewChanged();
+}
+
+bool Camera::IsOrthographic() const noexcept
+{
+	return _orthographic;
+}
+
+float Camera::GetFieldOfView() const noexcept
+{
+	return _fieldOfView;
+}
+
+float Camera::GetAspectRatio() const noexcept
+{
+	return _aspectRatio;
+}
+
+float Camera::GetWidth() const noexcept
+{
+	return _width;
+}
+
+float Camera::GetHeight() const noexcept
+{
+	return _height;
+}
+
+float Camera::GetNearPlaneDistance() const noexcept
+{
+	return _nearPlaneDistance;
+}
+
+float Camera::GetFarPlaneDistance() const noexcept
+{
+	return _farPlaneDistance;
+}
+
+/// <summary>
+/// Switches to a perspective projection, as built by <see cref="Matrix.CreatePerspectiveFieldOfView"/>.
+/// </summary>
+/// <param name="fieldOfView">Field of view in the y direction in radians.</param>
+/// <param name="aspectRatio">Width divided by height of the viewing volume.</param>
+/// <param name="nearPlaneDistance">Distance to the near plane.</param>
+/// <param name="farPlaneDistance">Distance to the far plane.</param>
+void Camera::SetPerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance) noexcept
+{
+	_orthographic = false;
+	_fieldOfView = fieldOfView;
+	_aspectRatio = aspectRatio;
+	_nearPlaneDistance = nearPlaneDistance;
+	_farPlaneDistance = farPlaneDistance;
+	ProjectionChanged();
+}
+
+/// <summary>
+/// Switches to an orthographic projection, as built by <see cref="Matrix.CreateOrthographic"/>.
+/// </summary>
+/// <param name="width">Width of the viewing volume.</param>
+/// <param name="height">Height of the viewing volume.</param>
+/// <param name="nearPlaneDistance">Depth of the near plane.</param>
+/// <param name="farPlaneDistance">Depth of the far plane.</param>
+void Camera::SetOrthographic(float width, float height, float nearPlaneDistance, float farPlaneDistance) noexcept
+{
+	_orthographic = true;
+	_width = width;
+	_height = height;
+	_nearPlaneDistance = nearPlaneDistance;
+	_farPlaneDistance = farPlaneDistance;
+	ProjectionChanged();
+}
+
+/// <summary>
+/// Changes the aspect ratio of the perspective projection, e.g. when the viewport is resized. The orthographic projection ignores it.
+/// </summary>
+/// <param name="aspectRatio">Width divided by height of the viewing volume.</param>
+void Camera::SetAspectRatio(float aspectRatio) noexcept
+{
+	_aspectRatio = aspectRatio;
+	if (!_orthographic)
+		ProjectionChanged();
+}
+
+void Camera::SetPlaneDistances(float nearPlaneDistance, float farPlaneDistance) noexcept
+{
+	_nearPlaneDistance = nearPlaneDistance;
+	_farPlaneDistance = farPlaneDistance;
+	ProjectionChanged();
+}
+
+/// <summary>
+/// Returns the view matrix, as built by <see cref="Matrix.CreateLookAt"/>.
+/// </summary>
+const Matrix& Camera::GetView() const noexcept
+{
+	if (_dirty & ViewDirty)
+	{
+		Matrix::CreateLookAt(_position, _target, _up, _view);
+		_dirty &= ~ViewDirty;
+	}
+	return _view;
+}
+
+/// <summary>
+/// Returns the inverse of the view matrix, i.e. the world matrix of the camera.
+/// The view is a rotation and a translation, so it is inverted by transposing the rotation.
+/// </summary>
+const Matrix& Camera::GetInverseView() const noexcept
+{
+	if (_dirty & InverseViewDirty)
+	{
+		auto& view = GetView();
+		_inverseView = Matrix(
+			view.M11, view.M21, view.M31, 0.0f,
+			view.M12, view.M22, view.M32, 0.0f,
+			view.M13, view.M23, view.M33, 0.0f,
+			_position.X, _position.Y, _position.Z, 1.0f);
+		_dirty &= ~InverseViewDirty;
+	}
+	return _inverseView;
+}
+
+/// <summary>
+/// Returns the projection matrix.
+/// </summary>
+const Matrix& Camera::GetProjection() const noexcept
+{
+	if (_dirty & ProjectionDirty)
+	{
+		if (_orthographic)
+			Matrix::CreateOrthographic(_width, _height, _nearPlaneDistance, _farPlaneDistance, _projection);
+		else
+			Matrix::CreatePerspectiveFieldOfView(_fieldOfView, _aspectRatio, _nearPlaneDistance, _farPlaneDistance, _projection);
+		_dirty &= ~ProjectionDirty;
+	}
+	return _projection;
+}
+
+/// <summary>
+/// Returns the view matrix multiplied by the projection matrix.
+/// </summary>
+const Matrix& Camera::GetViewProjection() const noexcept
+{
+	if (_dirty & ViewProjectionDirty)
+	{
+		Matrix::Multiply(GetView(), GetProjection(), _viewProjection);
+		_dirty &= ~ViewProjectionDirty;
+	}
+	return _viewProjection;
+}
+
+/// <summary>
+/// Returns the inverse of the view-projection matrix, which maps clip space back to world space.
+/// </summary>
+const Matrix& Camera::GetInverseViewProjection() const noexcept
+{
+	if (_dirty & InverseViewProjectionDirty)
+	{
+		Matrix::Invert(GetViewProjection(), _inverseViewProjection);
+		_dirty &= ~InverseViewProjectionDirty;
+	}
+	return _inverseViewProjection;
+}
+
+/// <summary>
+/// Returns the frustum of the view-projection matrix. Its planes and corners are only rebuilt after the camera changed.
+/// </summary>
+const BoundingFrustum& Camera::GetFrustum() const noexcept
+{
+	if (_dirty & FrustumDirty)
+	{
+		_frustum.SetMatrix(GetViewProjection());
+		_dirty &= ~FrustumDirty;
+	}
+	return _frustum;
+}
+
+void Camera::ViewChanged() noexcept
+{
+	_dirty |= ViewDirty | InverseViewDirty | ViewProjectionDirty | InverseViewProjectionDirty | FrustumDirty;
+}
+
+void Camera::ProjectionChanged() noexcept
+{
+	_dirty |= ProjectionDirty | ViewProjectionDirty | InverseViewProjectionDirty | FrustumDirty;
+}
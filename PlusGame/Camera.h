@@ -0,0 +1,67 @@
+#pragma once
+#include "Vector3.h"
+#include "Matrix.h"
+#include "BoundingFrustum.h"
+
+// A look-at camera with a perspective or orthographic projection. The view, projection,
+// view-projection, their inverses and the frustum are computed on first use after a change
+// and cached, so moving or turning the camera does not rebuild the projection and changing
+// the projection does not rebuild the view. The getters fill the caches and are therefore
+// not safe to call from several threads at once on the same camera.
+class Camera
+{
+public:
+	Camera() noexcept;
+
+	const Vector3& GetPosition() const noexcept;
+	const Vector3& GetTarget() const noexcept;
+	const Vector3& GetUp() const noexcept;
+	void SetPosition(const Vector3& position) noexcept;
+	void SetTarget(const Vector3& target) noexcept;
+	void SetUp(const Vector3& up) noexcept;
+	void SetLookAt(const Vector3& position, const Vector3& target, const Vector3& up) noexcept;
+
+	bool IsOrthographic() const noexcept;
+	float GetFieldOfView() const noexcept;
+	float GetAspectRatio() const noexcept;
+	float GetWidth() const noexcept;
+	float GetHeight() const noexcept;
+	float GetNearPlaneDistance() const noexcept;
+	float GetFarPlaneDistance() const noexcept;
+	void SetPerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance) noexcept;
+	void SetOrthographic(float width, float height, float nearPlaneDistance, float farPlaneDistance) noexcept;
+	void SetAspectRatio(float aspectRatio) noexcept;
+	void SetPlaneDistances(float nearPlaneDistance, float farPlaneDistance) noexcept;
+
+	const Matrix& GetView() const noexcept;
+	const Matrix& GetInverseView() const noexcept;
+	const Matrix& GetProjection() const noexcept;
+	const Matrix& GetViewProjection() const noexcept;
+	const Matrix& GetInverseViewProjection() const noexcept;
+	const BoundingFrustum& GetFrustum() const noexcept;
+
+private:
+	Vector3 _position;
+	Vector3 _target;
+	Vector3 _up;
+
+	bool _orthographic;
+	float _fieldOfView;
+	float _aspectRatio;
+	float _width;
+	float _height;
+	float _nearPlaneDistance;
+	float _farPlaneDistance;
+
+	// Bits of the cached values that are out of date.
+	mutable unsigned char _dirty;
+	mutable Matrix _view;
+	mutable Matrix _inverseView;
+	mutable Matrix _projection;
+	mutable Matrix _viewProjection;
+	mutable Matrix _inverseViewProjection;
+	mutable BoundingFrustum _frustum;
+
+	void ViewChanged() noexcept;
+	void ProjectionChanged() noexcept;
+};
@@ -0,0 +1,120 @@
+#include "CpuFeatures.h"
+
+#if defined(PLUSGAME_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(PLUSGAME_X86)
+static void QueryCpuid(unsigned int leaf, unsigned int subleaf, unsigned int registers[4])
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuidex(info, (int)leaf, (int)subleaf);
+	for (auto i = 0; i < 4; i++)
+		registers[i] = (unsigned int)info[i];
+#else
+	__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+static unsigned long long ReadExtendedControlRegister()
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	unsigned int eax, edx;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+/// <summary>
+/// Returns <c>true</c> if the processor supports SSE4.1.
+/// </summary>
+bool CpuFeatures::HasSSE41()
+{
+	return Detect().SSE41;
+}
+
+/// <summary>
+/// Returns <c>true</c> if the processor and the operating system support AVX.
+/// </summary>
+bool CpuFeatures::HasAVX()
+{
+	return Detect().AVX;
+}
+
+/// <summary>
+/// Returns <c>true</c> if the processor and the operating system support the F16C half-precision conversions.
+/// </summary>
+bool CpuFeatures::HasF16C()
+{
+	return Detect().F16C;
+}
+
+/// <summary>
+/// Returns <c>true</c> if the processor and the operating system support AVX2.
+/// </summary>
+bool CpuFeatures::HasAVX2()
+{
+	return Detect().AVX2;
+}
+
+/// <summary>
+/// Returns <c>true</c> if the processor and the operating system support FMA3.
+/// </summary>
+bool CpuFeatures::HasFMA()
+{
+	return Detect().FMA;
+}
+
+/// <summary>
+/// Returns <c>true</c> if the processor and the operating system support the AVX-512 foundation instructions.
+/// </summary>
+bool CpuFeatures::HasAVX512F()
+{
+	return Detect().AVX512F;
+}
+
+const CpuFeatures::Flags& CpuFeatures::Detect()
+{
+	static const Flags flags = []()
+	{
+		Flags result = {};
+#if defined(PLUSGAME_X86)
+		unsigned int registers[4];
+		QueryCpuid(0, 0, registers);
+		auto maxLeaf = registers[0];
+		if (maxLeaf < 1)
+			return result;
+
+		QueryCpuid(1, 0, registers);
+		auto ecx1 = registers[2];
+		result.SSE41 = (ecx1 & (1u << 19)) != 0;
+
+		// YMM state must be enabled by the OS (OSXSAVE set and XCR0 bits 1 and 2)
+		auto osXsave = (ecx1 & (1u << 27)) != 0;
+		auto xcr0 = osXsave ? ReadExtendedControlRegister() : 0ull;
+		auto osSavesYmm = (xcr0 & 0x6) == 0x6;
+		// ZMM state needs the opmask, upper ZMM0-15 and ZMM16-31 bits (5, 6 and 7) as well
+		auto osSavesZmm = osSavesYmm && (xcr0 & 0xE0) == 0xE0;
+		result.AVX = osSavesYmm && (ecx1 & (1u << 28)) != 0;
+		result.FMA = result.AVX && (ecx1 & (1u << 12)) != 0;
+		result.F16C = result.AVX && (ecx1 & (1u << 29)) != 0;
+
+		if (maxLeaf >= 7)
+		{
+			QueryCpuid(7, 0, registers);
+			result.AVX2 = result.AVX && (registers[1] & (1u << 5)) != 0;
+			result.AVX512F = result.AVX && osSavesZmm && (registers[1] & (1u << 16)) != 0;
+		}
+#endif
+		return result;
+	}();
+	return flags;
+}
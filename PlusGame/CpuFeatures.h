@@ -0,0 +1,50 @@
+#pragma once
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PLUSGAME_X86 1
+#endif
+
+// MSVC emits any intrinsic regardless of /arch, GCC and Clang only allow the ones enabled
+// for the enclosing function, so kernels above the SSE2 baseline carry a target attribute.
+#if defined(PLUSGAME_X86) && !defined(_MSC_VER) && (defined(__GNUC__) || defined(__clang__))
+#define PLUSGAME_TARGET_AVX __attribute__((target("avx")))
+#define PLUSGAME_TARGET_F16C __attribute__((target("avx,f16c")))
+// AVX-512F implies FMA, and GCC would then fuse the multiplies and adds of the intrinsics,
+// which breaks the bit-identical results; Clang only fuses within a single expression.
+#if defined(__clang__)
+#define PLUSGAME_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define PLUSGAME_TARGET_AVX512 __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#endif
+#else
+#define PLUSGAME_TARGET_AVX
+#define PLUSGAME_TARGET_F16C
+#define PLUSGAME_TARGET_AVX512
+#endif
+
+// Instruction set extensions of the running processor, queried once through CPUID.
+// AVX and above are only reported when the operating system saves the YMM state, AVX-512
+// only when it also saves the ZMM and opmask state.
+class CpuFeatures
+{
+public:
+	static bool HasSSE41();
+	static bool HasAVX();
+	static bool HasF16C();
+	static bool HasAVX2();
+	static bool HasFMA();
+	static bool HasAVX512F();
+
+private:
+	struct Flags
+	{
+		bool SSE41;
+		bool AVX;
+		bool F16C;
+		bool AVX2;
+		bool FMA;
+		bool AVX512F;
+	};
+
+	static const Flags& Detect();
+};
@@ -1,19 +1,10 @@
 #include "MathHelper.h" 
 
-const float MathHelper::E = std::exp(1.0f);
-const float MathHelper::Log10E = 0.4342945f;
-const float MathHelper::Log2E = 1.442695f;
-const float MathHelper::Pi = 3.14159274f;
-const float MathHelper::PiOver2 = MathHelper::Pi / 2.0f;
-const float MathHelper::PiOver4 = MathHelper::Pi / 4.0f;
-const float MathHelper::TwoPi = MathHelper::Pi * 2.0f;
-const float MathHelper::Tau = MathHelper::TwoPi;
-
-float MathHelper::Barycentric(float value1, float value2, float value3, float amount1, float amount2) {
+float MathHelper::Barycentric(float value1, float value2, float value3, float amount1, float amount2) noexcept {
 	return value1 + (value2 - value1) * amount1 + (value3 - value1) * amount2;
 }
 
-float MathHelper::CatmullRom(float value1, float value2, float value3, float value4, float amount) {
+float MathHelper::CatmullRom(float value1, float value2, float value3, float value4, float amount) noexcept {
 	double amountSquared = amount * amount;
 	double amountCubed = amountSquared * amount;
 	return static_cast<float>(0.5 * (2.0 * value2 +
@@ -22,23 +13,11 @@ float MathHelper::CatmullRom(float value1, float value2, float value3, float val
 		(3.0 * value2 - value1 - 3.0 * value3 + value4) * amountCubed));
 }
 
-float MathHelper::Clamp(float value, float min, float max) {
-	value = (value > max) ? max : value;
-	value = (value < min) ? min : value;
-	return value;
-}
-
-int MathHelper::Clamp(int value, int min, int max) {
-	value = (value > max) ? max : value;
-	value = (value < min) ? min : value;
-	return value;
-}
-
-float MathHelper::Distance(float value1, float value2) {
+float MathHelper::Distance(float value1, float value2) noexcept {
 	return std::abs(value1 - value2);
 }
 
-float MathHelper::Hermite(float value1, float tangent1, float value2, float tangent2, float amount) {
+float MathHelper::Hermite(float value1, float tangent1, float value2, float tangent2, float amount) noexcept {
 	double v1 = value1, v2 = value2, t1 = tangent1, t2 = tangent2, s = amount, result;
 	double sCubed = s * s * s;
 	double sSquared = s * s;
@@ -55,45 +34,25 @@ float MathHelper::Hermite(float value1, float tangent1, float value2, float tang
 	return static_cast<float>(result);
 }
 
-float MathHelper::Lerp(float value1, float value2, float amount) {
-	return value1 + (value2 - value1) * amount;
-}
-
-float MathHelper::LerpPrecise(float value1, float value2, float amount) {
+float MathHelper::LerpPrecise(float value1, float value2, float amount) noexcept {
 	return ((1 - amount) * value1) + (value2 * amount);
 }
 
-float MathHelper::Max(float value1, float value2) {
-	return (value1 > value2) ? value1 : value2;
-}
-
-int MathHelper::Max(int value1, int value2) {
-	return (value1 > value2) ? value1 : value2;
-}
-
-float MathHelper::Min(float value1, float value2) {
-	return (value1 < value2) ? value1 : value2;
-}
-
-int MathHelper::Min(int value1, int value2) {
-	return (value1 < value2) ? value1 : value2;
-}
-
-float MathHelper::SmoothStep(float value1, float value2, float amount) {
+float MathHelper::SmoothStep(float value1, float value2, float amount) noexcept {
 	float result = Clamp(amount, 0.0f, 1.0f);
 	result = Hermite(value1, 0.0f, value2, 0.0f, result);
 	return result;
 }
 
-float MathHelper::ToDegrees(float radians) {
+float MathHelper::ToDegrees(float radians) noexcept {
 	return static_cast<float>(radians * 57.295779513082320876798154814105);
 }
 
-float MathHelper::ToRadians(float degrees) {
+float MathHelper::ToRadians(float degrees) noexcept {
 	return static_cast<float>(degrees * 0.017453292519943295769236907684886);
 }
 
-float MathHelper::WrapAngle(float angle) {
+float MathHelper::WrapAngle(float angle) noexcept {
 	if ((angle > -Pi) && (angle <= Pi))
 		return angle;
 	angle = std::fmod(angle, TwoPi);
@@ -104,7 +63,7 @@ float MathHelper::WrapAngle(float angle) {
 	return angle;
 }
 
-bool MathHelper::IsPowerOfTwo(int value) {
+bool MathHelper::IsPowerOfTwo(int value) noexcept {
 	return (value > 0) && ((value & (value - 1)) == 0);
 }
 
@@ -3,33 +3,62 @@
 
 class MathHelper {
 public:
-	static const float E;
-	static const float Log10E;
-	static const float Log2E;
-	static const float Pi;
-	static const float PiOver2;
-	static const float PiOver4;
-	static const float TwoPi;
-	static const float Tau;
-
-	static float Barycentric(float value1, float value2, float value3, float amount1, float amount2);
-	static float CatmullRom(float value1, float value2, float value3, float value4, float amount);
-	static float Clamp(float value, float min, float max);
-	static int Clamp(int value, int min, int max);
-	static float Distance(float value1, float value2);
-	static float Hermite(float value1, float tangent1, float value2, float tangent2, float amount);
-	static float Lerp(float value1, float value2, float amount);
-	static float LerpPrecise(float value1, float value2, float amount);
-	static float Max(float value1, float value2);
-	static int Max(int value1, int value2);
-	static float Min(float value1, float value2);
-	static int Min(int value1, int value2);
-	static float SmoothStep(float value1, float value2, float amount);
-	static float ToDegrees(float radians);
-	static float ToRadians(float degrees);
-	static float WrapAngle(float angle);
-	static bool IsPowerOfTwo(int value);
+	static constexpr float E = 2.71828175f;
+	static constexpr float Log10E = 0.4342945f;
+	static constexpr float Log2E = 1.442695f;
+	static constexpr float Pi = 3.14159274f;
+	static constexpr float PiOver2 = Pi / 2.0f;
+	static constexpr float PiOver4 = Pi / 4.0f;
+	static constexpr float TwoPi = Pi * 2.0f;
+	static constexpr float Tau = TwoPi;
+
+	static float Barycentric(float value1, float value2, float value3, float amount1, float amount2) noexcept;
+	static float CatmullRom(float value1, float value2, float value3, float value4, float amount) noexcept;
+	static float Clamp(float value, float min, float max) noexcept;
+	static int Clamp(int value, int min, int max) noexcept;
+	static float Distance(float value1, float value2) noexcept;
+	static float Hermite(float value1, float tangent1, float value2, float tangent2, float amount) noexcept;
+	static float Lerp(float value1, float value2, float amount) noexcept;
+	static float LerpPrecise(float value1, float value2, float amount) noexcept;
+	static float Max(float value1, float value2) noexcept;
+	static int Max(int value1, int value2) noexcept;
+	static float Min(float value1, float value2) noexcept;
+	static int Min(int value1, int value2) noexcept;
+	static float SmoothStep(float value1, float value2, float amount) noexcept;
+	static float ToDegrees(float radians) noexcept;
+	static float ToRadians(float degrees) noexcept;
+	static float WrapAngle(float angle) noexcept;
+	static bool IsPowerOfTwo(int value) noexcept;
 };
 
+inline float MathHelper::Clamp(float value, float min, float max) noexcept {
+	value = (value > max) ? max : value;
+	value = (value < min) ? min : value;
+	return value;
+}
+
+inline int MathHelper::Clamp(int value, int min, int max) noexcept {
+	value = (value > max) ? max : value;
+	value = (value < min) ? min : value;
+	return value;
+}
+
+inline float MathHelper::Lerp(float value1, float value2, float amount) noexcept {
+	return value1 + (value2 - value1) * amount;
+}
+
+inline float MathHelper::Max(float value1, float value2) noexcept {
+	return (value1 > value2) ? value1 : value2;
+}
+
+inline int MathHelper::Max(int value1, int value2) noexcept {
+	return (value1 > value2) ? value1 : value2;
+}
 
+inline float MathHelper::Min(float value1, float value2) noexcept {
+	return (value1 < value2) ? value1 : value2;
+}
 
+inline int MathHelper::Min(int value1, int value2) noexcept {
+	return (value1 < value2) ? value1 : value2;
+}
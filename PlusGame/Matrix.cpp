@@ -1,23 +1,5 @@
 #include "Matrix.h"	
-
-const Matrix Matrix::identity(
-	1.0f, 0.0f, 0.0f, 0.0f,
-	0.0f, 1.0f, 0.0f, 0.0f,
-	0.0f, 0.0f, 1.0f, 0.0f,
-	0.0f, 0.0f, 0.0f, 1.0f);
-Matrix::Matrix(
-	float m11, float m12, float m13, float m14,
-	float m21, float m22, float m23, float m24,
-	float m31, float m32, float m33, float m34,
-	float m41, float m42, float m43, float m44
-) :
-	M11(m11), M12(m12), M13(m13), M14(m14),
-	M21(m21), M22(m22), M23(m23), M24(m24),
-	M31(m31), M32(m32), M33(m33), M34(m34),
-	M41(m41), M42(m42), M43(m43), M44(m44)
-{
-
-}
+#include "MatrixSimd.h"
 
 // Constructs a matrix.
 Matrix::Matrix(
@@ -25,7 +7,7 @@ Matrix::Matrix(
 	const Vector4& row2,
 	const Vector4& row3,
 	const Vector4& row4
-) :
+) noexcept :
 	M11(row1.X), M12(row1.Y), M13(row1.Z), M14(row1.W),
 	M21(row2.X), M22(row2.Y), M23(row2.Z), M24(row2.W),
 	M31(row3.X), M32(row3.Y), M33(row3.Z), M34(row3.W),
@@ -33,87 +15,6 @@ Matrix::Matrix(
 {
 }
 
-// The backward vector formed from the third row M31, M32, M33 elements.
-Vector3 Matrix::Backward() const {
-	return Vector3(M31, M32, M33);
-}
-
-void Matrix::Backward(const Vector3& value) {
-	M31 = value.X;
-	M32 = value.Y;
-	M33 = value.Z;
-}
-
-// The down vector formed from the second row -M21, -M22, -M23 elements.
-Vector3 Matrix::Down() const {
-	return Vector3(-M21, -M22, -M23);
-}
-
-void Matrix::Down(const Vector3& value) {
-	M21 = -value.X;
-	M22 = -value.Y;
-	M23 = -value.Z;
-}
-
-// The forward vector formed from the third row -M31, -M32, -M33 elements.
-Vector3 Matrix::Forward() const {
-	return Vector3(-M31, -M32, -M33);
-}
-
-void Matrix::Forward(const Vector3& value) {
-	M31 = -value.X;
-	M32 = -value.Y;
-	M33 = -value.Z;
-}
-
-// The left vector formed from the first row -M11, -M12, -M13 elements.
-Vector3 Matrix::Left() const {
-	return Vector3(-M11, -M12, -M13);
-}
-
-void Matrix::Left(const Vector3& value) {
-	M11 = -value.X;
-	M12 = -value.Y;
-	M13 = -value.Z;
-}
-
-// The right vector formed from the first row M11, M12, M13 elements.
-Vector3 Matrix::Right() const {
-	return Vector3(M11, M12, M13);
-}
-
-void Matrix::Right(const Vector3& value) {
-	M11 = value.X;
-	M12 = value.Y;
-	M13 = value.Z;
-}
-
-// Position stored in this matrix.
-Vector3 Matrix::Translation() const {
-	return Vector3(M41, M42, M43);
-}
-
-void Matrix::Translation(const Vector3& value) {
-	M41 = value.X;
-	M42 = value.Y;
-	M43 = value.Z;
-}
-
-// The upper vector formed from the second row M21, M22, M23 elements.
-Vector3 Matrix::Up() const {
-	return Vector3(M21, M22, M23);
-}
-
-void Matrix::Up(const Vector3& value) {
-	M21 = value.X;
-	M22 = value.Y;
-	M23 = value.Z;
-}
-
-Matrix Matrix::Identity() {
-	return identity;
-}
-
 /// <summary>
 /// Creates a new <see cref="Matrix"/> for spherical billboarding that rotates around specified object position.
 /// </summary>
@@ -122,8 +23,8 @@ Matrix Matrix::Identity() {
 /// <param name="cameraUpVector">The camera up vector.</param>
 /// <param name="cameraForwardVector">Optional camera forward vector.</param>
 /// <returns>The <see cref="Matrix"/> for spherical billboarding.</returns>
-Matrix Matrix::CreateBillboard(Vector3& objectPosition, Vector3& cameraPosition,
-	Vector3& cameraUpVector, Vector3* cameraForwardVector)
+Matrix Matrix::CreateBillboard(const Vector3& objectPosition, const Vector3& cameraPosition,
+	const Vector3& cameraUpVector, const Vector3* cameraForwardVector) noexcept
 {
 	Matrix result;
 
@@ -141,7 +42,7 @@ Matrix Matrix::CreateBillboard(Vector3& objectPosition, Vector3& cameraPosition,
 /// <param name="cameraUpVector">The camera up vector.</param>
 /// <param name="cameraForwardVector">Optional camera forward vector.</param>
 /// <param name="result">The <see cref="Matrix"/> for spherical billboarding as an output parameter.</param>
-void Matrix::CreateBillboard(Vector3& objectPosition, Vector3& cameraPosition, Vector3& cameraUpVector, Vector3* cameraForwardVector, Matrix& result)
+void Matrix::CreateBillboard(const Vector3& objectPosition, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3* cameraForwardVector, Matrix& result) noexcept
 {
 	Vector3 vector;
 	Vector3 vector2;
@@ -188,8 +89,8 @@ void Matrix::CreateBillboard(Vector3& objectPosition, Vector3& cameraPosition, V
 	   /// <param name="cameraForwardVector">Optional camera forward vector.</param>
 	   /// <param name="objectForwardVector">Optional object forward vector.</param>
 	   /// <returns>The <see cref="Matrix"/> for cylindrical billboarding.</returns>
-Matrix Matrix::CreateConstrainedBillboard(Vector3& objectPosition, Vector3& cameraPosition,
-	Vector3& rotateAxis, Vector3* cameraForwardVector, Vector3* objectForwardVector)
+Matrix Matrix::CreateConstrainedBillboard(const Vector3& objectPosition, const Vector3& cameraPosition,
+	const Vector3& rotateAxis, const Vector3* cameraForwardVector, const Vector3* objectForwardVector) noexcept
 {
 	Matrix result;
 	CreateConstrainedBillboard(objectPosition, cameraPosition, rotateAxis,
@@ -206,8 +107,8 @@ Matrix Matrix::CreateConstrainedBillboard(Vector3& objectPosition, Vector3& came
 	 /// <param name="cameraForwardVector">Optional camera forward vector.</param>
 	 /// <param name="objectForwardVector">Optional object forward vector.</param>
 	 /// <param name="result">The <see cref="Matrix"/> for cylindrical billboarding as an output parameter.</param>
-void  Matrix::CreateConstrainedBillboard(Vector3& objectPosition, Vector3& cameraPosition,
-	Vector3& rotateAxis, Vector3* cameraForwardVector, Vector3* objectForwardVector, Matrix& result)
+void  Matrix::CreateConstrainedBillboard(const Vector3& objectPosition, const Vector3& cameraPosition,
+	const Vector3& rotateAxis, const Vector3* cameraForwardVector, const Vector3* objectForwardVector, Matrix& result) noexcept
 {
 	float num;
 	Vector3 vector;
@@ -227,22 +128,22 @@ void  Matrix::CreateConstrainedBillboard(Vector3& objectPosition, Vector3& camer
 	}
 	Vector3 vector4 = rotateAxis;
 	Vector3::Dot(rotateAxis, vector2, num);
-	if (abs(num) > 0.9982547f)
+	if (std::abs(num) > 0.9982547f)
 	{
 		if (objectForwardVector != nullptr)
 		{
 			vector = *objectForwardVector;
 			Vector3::Dot(rotateAxis, vector, num);
-			if (abs(num) > 0.9982547f)
+			if (std::abs(num) > 0.9982547f)
 			{
 				num = ((rotateAxis.X * Vector3::Forward.X) + (rotateAxis.Y * Vector3::Forward.Y)) + (rotateAxis.Z * Vector3::Forward.Z);
-				vector = (abs(num) > 0.9982547f) ? Vector3::Right : Vector3::Forward;
+				vector = (std::abs(num) > 0.9982547f) ? Vector3::Right : Vector3::Forward;
 			}
 		}
 		else
 		{
 			num = ((rotateAxis.X * Vector3::Forward.X) + (rotateAxis.Y * Vector3::Forward.Y)) + (rotateAxis.Z * Vector3::Forward.Z);
-			vector = (abs(num) > 0.9982547f) ? Vector3::Right : Vector3::Forward;
+			vector = (std::abs(num) > 0.9982547f) ? Vector3::Right : Vector3::Forward;
 		}
 		Vector3::Cross(rotateAxis, vector, vector3);
 		vector3.Normalize();
@@ -280,7 +181,7 @@ void  Matrix::CreateConstrainedBillboard(Vector3& objectPosition, Vector3& camer
 	 /// <param name="axis">The axis of rotation.</param>
 	 /// <param name="angle">The angle of rotation in radians.</param>
 	 /// <returns>The rotation <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateFromAxisAngle(Vector3& axis, float angle)
+Matrix Matrix::CreateFromAxisAngle(const Vector3& axis, float angle) noexcept
 {
 	Matrix result;
 	CreateFromAxisAngle(axis, angle, result);
@@ -293,7 +194,7 @@ Matrix Matrix::CreateFromAxisAngle(Vector3& axis, float angle)
 /// <param name="axis">The axis of rotation.</param>
 /// <param name="angle">The angle of rotation in radians.</param>
 /// <param name="result">The rotation <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateFromAxisAngle(Vector3& axis, float angle, Matrix& result)
+void Matrix::CreateFromAxisAngle(const Vector3& axis, float angle, Matrix& result) noexcept
 {
 	float x = axis.X;
 	float y = axis.Y;
@@ -329,7 +230,7 @@ void Matrix::CreateFromAxisAngle(Vector3& axis, float angle, Matrix& result)
 	 /// </summary>
 	 /// <param name="quaternion"><see cref="Quaternion"/> of rotation moment.</param>
 	 /// <returns>The rotation <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateFromQuaternion(Quaternion& quaternion)
+Matrix Matrix::CreateFromQuaternion(const Quaternion& quaternion) noexcept
 {
 	Matrix result;
 	CreateFromQuaternion(quaternion, result);
@@ -341,7 +242,7 @@ Matrix Matrix::CreateFromQuaternion(Quaternion& quaternion)
 /// </summary>
 /// <param name="quaternion"><see cref="Quaternion"/> of rotation moment.</param>
 /// <param name="result">The rotation <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateFromQuaternion(Quaternion& quaternion, Matrix& result)
+void Matrix::CreateFromQuaternion(const Quaternion& quaternion, Matrix& result) noexcept
 {
 	float num9 = quaternion.X * quaternion.X;
 	float num8 = quaternion.Y * quaternion.Y;
@@ -370,6 +271,74 @@ void Matrix::CreateFromQuaternion(Quaternion& quaternion, Matrix& result)
 	result.M44 = 1.0f;
 }
 
+/// <summary>
+/// Creates a new world <see cref="Matrix"/> from a scale, a rotation and a translation.
+/// Gives the same result as multiplying <see cref="CreateScale"/>, <see cref="CreateFromQuaternion"/> and <see cref="CreateTranslation"/>
+/// without building the intermediate matrices.
+/// </summary>
+/// <param name="scale">Scale along each axis.</param>
+/// <param name="rotation"><see cref="Quaternion"/> of rotation moment.</param>
+/// <param name="translation">Position of the origin.</param>
+/// <returns>The world <see cref="Matrix"/>.</returns>
+Matrix Matrix::CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3& translation) noexcept
+{
+	Matrix result;
+	CreateFromTRS(scale, rotation, translation, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new world <see cref="Matrix"/> from a scale, a rotation and a translation.
+/// Gives the same result as multiplying <see cref="CreateScale"/>, <see cref="CreateFromQuaternion"/> and <see cref="CreateTranslation"/>
+/// without building the intermediate matrices.
+/// </summary>
+/// <param name="scale">Scale along each axis.</param>
+/// <param name="rotation"><see cref="Quaternion"/> of rotation moment.</param>
+/// <param name="translation">Position of the origin.</param>
+/// <param name="result">The world <see cref="Matrix"/> as an output parameter.</param>
+void Matrix::CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3& translation, Matrix& result) noexcept
+{
+	float num9 = rotation.X * rotation.X;
+	float num8 = rotation.Y * rotation.Y;
+	float num7 = rotation.Z * rotation.Z;
+	float num6 = rotation.X * rotation.Y;
+	float num5 = rotation.Z * rotation.W;
+	float num4 = rotation.Z * rotation.X;
+	float num3 = rotation.Y * rotation.W;
+	float num2 = rotation.Y * rotation.Z;
+	float num = rotation.X * rotation.W;
+	result.M11 = (1.0f - (2.0f * (num8 + num7))) * scale.X;
+	result.M12 = (2.0f * (num6 + num5)) * scale.X;
+	result.M13 = (2.0f * (num4 - num3)) * scale.X;
+	result.M14 = 0.0f;
+	result.M21 = (2.0f * (num6 - num5)) * scale.Y;
+	result.M22 = (1.0f - (2.0f * (num7 + num9))) * scale.Y;
+	result.M23 = (2.0f * (num2 + num)) * scale.Y;
+	result.M24 = 0.0f;
+	result.M31 = (2.0f * (num4 + num3)) * scale.Z;
+	result.M32 = (2.0f * (num2 - num)) * scale.Z;
+	result.M33 = (1.0f - (2.0f * (num8 + num9))) * scale.Z;
+	result.M34 = 0.0f;
+	result.M41 = translation.X;
+	result.M42 = translation.Y;
+	result.M43 = translation.Z;
+	result.M44 = 1.0f;
+}
+
+/// <summary>
+/// Creates a world <see cref="Matrix"/> for every scale, rotation and translation at the same index in three arrays,
+/// with the fastest kernel available on this processor. Each result is identical to <see cref="CreateFromTRS"/>.
+/// </summary>
+/// <param name="scaleArray">Scales along each axis.</param>
+/// <param name="rotationArray">Rotations.</param>
+/// <param name="translationArray">Positions of the origin.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to create.</param>
+void Matrix::CreateFromTRSBatch(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::CreateFromTRSBatch(scaleArray, rotationArray, translationArray, resultArray, length);
+}
+
 /// <summary>
 /// /// Creates a new rotation <see cref="Matrix"/> from the specified yaw, pitch and roll values.
 /// </summary>
@@ -379,7 +348,7 @@ void Matrix::CreateFromQuaternion(Quaternion& quaternion, Matrix& result)
 /// <returns>The rotation <see cref="Matrix"/>.</returns>
 /// <remarks>For more information about yaw, pitch and roll visit http://en.wikipedia.org/wiki/Euler_angles.
 /// </remarks>
-Matrix Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll)
+Matrix Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept
 {
 	Matrix matrix;
 	CreateFromYawPitchRoll(yaw, pitch, roll, matrix);
@@ -395,7 +364,7 @@ Matrix Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll)
 /// <param name="result">The rotation <see cref="Matrix"/> as an output parameter.</param>
 /// <remarks>For more information about yaw, pitch and roll visit http://en.wikipedia.org/wiki/Euler_angles.
 /// </remarks>
-void Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll, Matrix& result)
+void Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll, Matrix& result) noexcept
 {
 	Quaternion quaternion;
 	Quaternion::CreateFromYawPitchRoll(yaw, pitch, roll, quaternion);
@@ -409,7 +378,7 @@ void Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll, Matrix&
 	   /// <param name="cameraTarget">Lookup vector of the camera.</param>
 	   /// <param name="cameraUpVector">The direction of the upper edge of the camera.</param>
 	   /// <returns>The viewing <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateLookAt(Vector3& cameraPosition, Vector3& cameraTarget, Vector3& cameraUpVector)
+Matrix Matrix::CreateLookAt(const Vector3& cameraPosition, const Vector3& cameraTarget, const Vector3& cameraUpVector) noexcept
 {
 	Matrix matrix;
 	CreateLookAt(cameraPosition, cameraTarget, cameraUpVector, matrix);
@@ -423,7 +392,7 @@ Matrix Matrix::CreateLookAt(Vector3& cameraPosition, Vector3& cameraTarget, Vect
 /// <param name="cameraTarget">Lookup vector of the camera.</param>
 /// <param name="cameraUpVector">The direction of the upper edge of the camera.</param>
 /// <param name="result">The viewing <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateLookAt(Vector3& cameraPosition, Vector3& cameraTarget, Vector3& cameraUpVector, Matrix& result)
+void Matrix::CreateLookAt(const Vector3& cameraPosition, const Vector3& cameraTarget, const Vector3& cameraUpVector, Matrix& result) noexcept
 {
 	auto vector = Vector3::Normalize(cameraPosition - cameraTarget);
 	auto vector2 = Vector3::Normalize(Vector3::Cross(cameraUpVector, vector));
@@ -454,7 +423,7 @@ void Matrix::CreateLookAt(Vector3& cameraPosition, Vector3& cameraTarget, Vector
 /// <param name="zNearPlane">Depth of the near plane.</param>
 /// <param name="zFarPlane">Depth of the far plane.</param>
 /// <returns>The new projection <see cref="Matrix"/> for orthographic view.</returns>
-Matrix Matrix::CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane)
+Matrix Matrix::CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane) noexcept
 {
 	Matrix matrix;
 	CreateOrthographic(width, height, zNearPlane, zFarPlane, matrix);
@@ -469,7 +438,7 @@ Matrix Matrix::CreateOrthographic(float width, float height, float zNearPlane, f
 /// <param name="zNearPlane">Depth of the near plane.</param>
 /// <param name="zFarPlane">Depth of the far plane.</param>
 /// <param name="result">The new projection <see cref="Matrix"/> for orthographic view as an output parameter.</param>
-void Matrix::CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane, Matrix& result)
+void Matrix::CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane, Matrix& result) noexcept
 {
 	result.M11 = 2.0f / width;
 	result.M12 = result.M13 = result.M14 = 0.0f;
@@ -492,14 +461,14 @@ void Matrix::CreateOrthographic(float width, float height, float zNearPlane, flo
 /// <param name="zNearPlane">Depth of the near plane.</param>
 /// <param name="zFarPlane">Depth of the far plane.</param>
 /// <returns>The new projection <see cref="Matrix"/> for customized orthographic view.</returns>
-Matrix Matrix::CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane)
+Matrix Matrix::CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane) noexcept
 {
 	Matrix matrix;
 	CreateOrthographicOffCenter(left, right, bottom, top, zNearPlane, zFarPlane, matrix);
 	return matrix;
 }
 
-Matrix Matrix::CreateOrthographicOffCenter(Rectangle& viewingVolume, float zNearPlane, float zFarPlane)
+Matrix Matrix::CreateOrthographicOffCenter(const Rectangle& viewingVolume, float zNearPlane, float zFarPlane) noexcept
 {
 	Matrix matrix;
 	CreateOrthographicOffCenter(viewingVolume.GetLeft(), viewingVolume.GetRight(), viewingVolume.GetBottom(), viewingVolume.GetTop(), zNearPlane, zFarPlane, matrix);
@@ -525,7 +494,7 @@ Matrix Matrix::CreateOrthographicOffCenter(Rectangle& viewingVolume, float zNear
 /// <param name="zNearPlane">Depth of the near plane.</param>
 /// <param name="zFarPlane">Depth of the far plane.</param>
 /// <param name="result">The new projection <see cref="Matrix"/> for customized orthographic view as an output parameter.</param>
-void Matrix::CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane, Matrix& result)
+void Matrix::CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane, Matrix& result) noexcept
 {
 	result.M11 = (float)(2.0 / ((double)right - (double)left));
 	result.M12 = 0.0f;
@@ -553,7 +522,7 @@ void Matrix::CreateOrthographicOffCenter(float left, float right, float bottom,
 /// <param name="nearPlaneDistance">Distance to the near plane.</param>
 /// <param name="farPlaneDistance">Distance to the far plane.</param>
 /// <returns>The new projection <see cref="Matrix"/> for perspective view.</returns>
-Matrix Matrix::CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance)
+Matrix Matrix::CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance) noexcept
 {
 	Matrix matrix;
 	CreatePerspective(width, height, nearPlaneDistance, farPlaneDistance, matrix);
@@ -568,7 +537,7 @@ Matrix Matrix::CreatePerspective(float width, float height, float nearPlaneDista
 /// <param name="nearPlaneDistance">Distance to the near plane.</param>
 /// <param name="farPlaneDistance">Distance to the far plane, or <see cref="float.PositiveInfinity"/>.</param>
 /// <param name="result">The new projection <see cref="Matrix"/> for perspective view as an output parameter.</param>
-void Matrix::CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance, Matrix& result)
+void Matrix::CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance, Matrix& result) noexcept
 {
 	auto negFarRange = std::isinf(farPlaneDistance) ? -1.0f : farPlaneDistance / (nearPlaneDistance - farPlaneDistance);
 
@@ -591,7 +560,7 @@ void Matrix::CreatePerspective(float width, float height, float nearPlaneDistanc
 /// <param name="nearPlaneDistance">Distance to the near plane.</param>
 /// <param name="farPlaneDistance">Distance to the far plane, or <see cref="float.PositiveInfinity"/>.</param>
 /// <returns>The new projection <see cref="Matrix"/> for perspective view with FOV.</returns>
-Matrix Matrix::CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance)
+Matrix Matrix::CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance) noexcept
 {
 	Matrix result;
 	CreatePerspectiveFieldOfView(fieldOfView, aspectRatio, nearPlaneDistance, farPlaneDistance, result);
@@ -606,7 +575,7 @@ Matrix Matrix::CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio
 /// <param name="nearPlaneDistance">Distance of the near plane.</param>
 /// <param name="farPlaneDistance">Distance of the far plane, or <see cref="float.PositiveInfinity"/>.</param>
 /// <param name="result">The new projection <see cref="Matrix"/> for perspective view with FOV as an output parameter.</param>
-void Matrix::CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance, Matrix& result)
+void Matrix::CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance, Matrix& result) noexcept
 {
 	auto yScale = 1.0f / tan((double)fieldOfView * 0.5f);
 	auto xScale = yScale / aspectRatio;
@@ -633,7 +602,7 @@ void Matrix::CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio,
 /// <param name="nearPlaneDistance">Distance to the near plane.</param>
 /// <param name="farPlaneDistance">Distance to the far plane.</param>
 /// <returns>The new <see cref="Matrix"/> for customized perspective view.</returns>
-Matrix Matrix::CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance)
+Matrix Matrix::CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance) noexcept
 {
 	Matrix result;
 	CreatePerspectiveOffCenter(left, right, bottom, top, nearPlaneDistance, farPlaneDistance, result);
@@ -647,7 +616,7 @@ Matrix Matrix::CreatePerspectiveOffCenter(float left, float right, float bottom,
 /// <param name="nearPlaneDistance">Distance to the near plane.</param>
 /// <param name="farPlaneDistance">Distance to the far plane.</param>
 /// <returns>The new <see cref="Matrix"/> for customized perspective view.</returns>
-Matrix Matrix::CreatePerspectiveOffCenter(Rectangle& viewingVolume, float nearPlaneDistance, float farPlaneDistance)
+Matrix Matrix::CreatePerspectiveOffCenter(const Rectangle& viewingVolume, float nearPlaneDistance, float farPlaneDistance) noexcept
 {
 	Matrix result;
 	CreatePerspectiveOffCenter(viewingVolume.GetLeft(), viewingVolume.GetRight(), viewingVolume.GetBottom(), viewingVolume.GetTop(), nearPlaneDistance, farPlaneDistance, result);
@@ -664,7 +633,7 @@ Matrix Matrix::CreatePerspectiveOffCenter(Rectangle& viewingVolume, float nearPl
 /// <param name="nearPlaneDistance">Distance to the near plane.</param>
 /// <param name="farPlaneDistance">Distance to the far plane.</param>
 /// <param name="result">The new <see cref="Matrix"/> for customized perspective view as an output parameter.</param>
-void Matrix::CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance, Matrix& result)
+void Matrix::CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance, Matrix& result) noexcept
 {
 	result.M11 = (2.0f * nearPlaneDistance) / (right - left);
 	result.M12 = result.M13 = result.M14 = 0;
@@ -683,7 +652,7 @@ void Matrix::CreatePerspectiveOffCenter(float left, float right, float bottom, f
 /// </summary>
 /// <param name="radians">Angle in radians.</param>
 /// <returns>The rotation <see cref="Matrix"/> around X axis.</returns>
-Matrix Matrix::CreateRotationX(float radians)
+Matrix Matrix::CreateRotationX(float radians) noexcept
 {
 	Matrix result;
 	CreateRotationX(radians, result);
@@ -695,7 +664,7 @@ Matrix Matrix::CreateRotationX(float radians)
 /// </summary>
 /// <param name="radians">Angle in radians.</param>
 /// <param name="result">The rotation <see cref="Matrix"/> around X axis as an output parameter.</param>
-void Matrix::CreateRotationX(float radians, Matrix& result)
+void Matrix::CreateRotationX(float radians, Matrix& result) noexcept
 {
 	result = Matrix::Identity();
 
@@ -713,7 +682,7 @@ void Matrix::CreateRotationX(float radians, Matrix& result)
 /// </summary>
 /// <param name="radians">Angle in radians.</param>
 /// <returns>The rotation <see cref="Matrix"/> around Y axis.</returns>
-Matrix Matrix::CreateRotationY(float radians)
+Matrix Matrix::CreateRotationY(float radians) noexcept
 {
 	Matrix result;
 	CreateRotationY(radians, result);
@@ -725,7 +694,7 @@ Matrix Matrix::CreateRotationY(float radians)
 /// </summary>
 /// <param name="radians">Angle in radians.</param>
 /// <param name="result">The rotation <see cref="Matrix"/> around Y axis as an output parameter.</param>
-void Matrix::CreateRotationY(float radians, Matrix& result)
+void Matrix::CreateRotationY(float radians, Matrix& result) noexcept
 {
 	result = Matrix::Identity();
 
@@ -743,7 +712,7 @@ void Matrix::CreateRotationY(float radians, Matrix& result)
 /// </summary>
 /// <param name="radians">Angle in radians.</param>
 /// <returns>The rotation <see cref="Matrix"/> around Z axis.</returns>
-Matrix Matrix::CreateRotationZ(float radians)
+Matrix Matrix::CreateRotationZ(float radians) noexcept
 {
 	Matrix result;
 	CreateRotationZ(radians, result);
@@ -755,7 +724,7 @@ Matrix Matrix::CreateRotationZ(float radians)
 /// </summary>
 /// <param name="radians">Angle in radians.</param>
 /// <param name="result">The rotation <see cref="Matrix"/> around Z axis as an output parameter.</param>
-void Matrix::CreateRotationZ(float radians, Matrix& result)
+void Matrix::CreateRotationZ(float radians, Matrix& result) noexcept
 {
 	result = Matrix::Identity();
 
@@ -768,42 +737,16 @@ void Matrix::CreateRotationZ(float radians, Matrix& result)
 	result.M22 = val1;
 }
 
-/// <summary>
-/// Creates a new scaling <see cref="Matrix"/>.
-/// </summary>
-/// <param name="scale">Scale value for all three axises.</param>
-/// <returns>The scaling <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateScale(float scale)
-{
-	Matrix result;
-	CreateScale(scale, scale, scale, result);
-	return result;
-}
-
 /// <summary>
 /// Creates a new scaling <see cref="Matrix"/>.
 /// </summary>
 /// <param name="scale">Scale value for all three axises.</param>
 /// <param name="result">The scaling <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateScale(float scale, Matrix& result)
+void Matrix::CreateScale(float scale, Matrix& result) noexcept
 {
 	CreateScale(scale, scale, scale, result);
 }
 
-/// <summary>
-/// Creates a new scaling <see cref="Matrix"/>.
-/// </summary>
-/// <param name="xScale">Scale value for X axis.</param>
-/// <param name="yScale">Scale value for Y axis.</param>
-/// <param name="zScale">Scale value for Z axis.</param>
-/// <returns>The scaling <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateScale(float xScale, float yScale, float zScale)
-{
-	Matrix result;
-	CreateScale(xScale, yScale, zScale, result);
-	return result;
-}
-
 /// <summary>
 /// Creates a new scaling <see cref="Matrix"/>.
 /// </summary>
@@ -811,7 +754,7 @@ Matrix Matrix::CreateScale(float xScale, float yScale, float zScale)
 /// <param name="yScale">Scale value for Y axis.</param>
 /// <param name="zScale">Scale value for Z axis.</param>
 /// <param name="result">The scaling <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateScale(float xScale, float yScale, float zScale, Matrix& result)
+void Matrix::CreateScale(float xScale, float yScale, float zScale, Matrix& result) noexcept
 {
 	result.M11 = xScale;
 	result.M12 = 0;
@@ -836,7 +779,7 @@ void Matrix::CreateScale(float xScale, float yScale, float zScale, Matrix& resul
 /// </summary>
 /// <param name="scales"><see cref="Vector3"/> representing x,y and z scale values.</param>
 /// <returns>The scaling <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateScale(Vector3& scales)
+Matrix Matrix::CreateScale(const Vector3& scales) noexcept
 {
 	Matrix result;
 	CreateScale(scales, result);
@@ -848,7 +791,7 @@ Matrix Matrix::CreateScale(Vector3& scales)
 /// </summary>
 /// <param name="scales"><see cref="Vector3"/> representing x,y and z scale values.</param>
 /// <param name="result">The scaling <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateScale(Vector3& scales, Matrix& result)
+void Matrix::CreateScale(const Vector3& scales, Matrix& result) noexcept
 {
 	result.M11 = scales.X;
 	result.M12 = 0;
@@ -868,26 +811,12 @@ void Matrix::CreateScale(Vector3& scales, Matrix& result)
 	result.M44 = 1;
 }
 
-/// <summary>
-/// Creates a new translation <see cref="Matrix"/>.
-/// </summary>
-/// <param name="xPosition">X coordinate of translation.</param>
-/// <param name="yPosition">Y coordinate of translation.</param>
-/// <param name="zPosition">Z coordinate of translation.</param>
-/// <returns>The translation <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateTranslation(float xPosition, float yPosition, float zPosition)
-{
-	Matrix result;
-	CreateTranslation(xPosition, yPosition, zPosition, result);
-	return result;
-}
-
 /// <summary>
 /// Creates a new translation <see cref="Matrix"/>.
 /// </summary>
 /// <param name="position">X,Y and Z coordinates of translation.</param>
 /// <param name="result">The translation <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateTranslation(Vector3& position, Matrix& result)
+void Matrix::CreateTranslation(const Vector3& position, Matrix& result) noexcept
 {
 	result.M11 = 1;
 	result.M12 = 0;
@@ -912,7 +841,7 @@ void Matrix::CreateTranslation(Vector3& position, Matrix& result)
 /// </summary>
 /// <param name="position">X,Y and Z coordinates of translation.</param>
 /// <returns>The translation <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateTranslation(Vector3& position)
+Matrix Matrix::CreateTranslation(const Vector3& position) noexcept
 {
 	Matrix result;
 	CreateTranslation(position, result);
@@ -926,7 +855,7 @@ Matrix Matrix::CreateTranslation(Vector3& position)
 /// <param name="yPosition">Y coordinate of translation.</param>
 /// <param name="zPosition">Z coordinate of translation.</param>
 /// <param name="result">The translation <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateTranslation(float xPosition, float yPosition, float zPosition, Matrix& result)
+void Matrix::CreateTranslation(float xPosition, float yPosition, float zPosition, Matrix& result) noexcept
 {
 	result.M11 = 1;
 	result.M12 = 0;
@@ -953,7 +882,7 @@ void Matrix::CreateTranslation(float xPosition, float yPosition, float zPosition
 	/// <param name="forward">The forward direction vector.</param>
 	/// <param name="up">The upward direction vector. Usually <see cref="Vector3.Up"/>.</param>
 	/// <returns>The world <see cref="Matrix"/>.</returns>
-Matrix Matrix::CreateWorld(Vector3& position, Vector3& forward, Vector3& up)
+Matrix Matrix::CreateWorld(const Vector3& position, const Vector3& forward, const Vector3& up) noexcept
 {
 	Matrix ret;
 	CreateWorld(position, forward, up, ret);
@@ -967,7 +896,7 @@ Matrix Matrix::CreateWorld(Vector3& position, Vector3& forward, Vector3& up)
 /// <param name="forward">The forward direction vector.</param>
 /// <param name="up">The upward direction vector. Usually <see cref="Vector3.Up"/>.</param>
 /// <param name="result">The world <see cref="Matrix"/> as an output parameter.</param>
-void Matrix::CreateWorld(Vector3& position, Vector3& forward, Vector3& up, Matrix& result)
+void Matrix::CreateWorld(const Vector3& position, const Vector3& forward, const Vector3& up, Matrix& result) noexcept
 {
 	Vector3 x, y, z;
 	Vector3::Normalize(forward, z);
@@ -991,7 +920,7 @@ void Matrix::CreateWorld(Vector3& position, Vector3& forward, Vector3& up, Matri
  /// <param name="rotation">Rotation quaternion as an output parameter.</param>
  /// <param name="translation">Translation vector as an output parameter.</param>
  /// <returns><c>true</c> if matrix can be decomposed; <c>false</c> otherwise.</returns>
-bool Matrix::Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation)
+bool Matrix::Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const noexcept
 {
 	translation.X = this->M41;
 	translation.Y = this->M42;
@@ -1019,13 +948,30 @@ bool Matrix::Decompose(Vector3& scale, Quaternion& rotation, Vector3& translatio
 	rotation = Quaternion::CreateFromRotationMatrix(m1);
 	return true;
 }
+
+/// <summary>
+/// Decomposes every matrix of an array into scale, rotation and translation, four at a time with the fastest kernel available on this processor.
+/// Unlike <see cref="Decompose"/>, the handedness comes from the sign of the determinant: a mirrored matrix gets a negative X scale.
+/// The rotation is the nearest orthogonal matrix to the normalized rows, so rounding errors and slight shear do not skew it.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="Matrix"/> array.</param>
+/// <param name="scaleArray">Scale vectors as an output array.</param>
+/// <param name="rotationArray">Rotation quaternions as an output array. Matrices that cannot be decomposed get <see cref="Quaternion.Identity"/>.</param>
+/// <param name="translationArray">Translation vectors as an output array.</param>
+/// <param name="successArray">Receives <c>true</c> for every matrix that could be decomposed and <c>false</c> for those with a zero or non-finite scale. May be null.</param>
+/// <param name="length">The number of matrices to decompose.</param>
+void Matrix::DecomposeBatch(const Matrix* sourceArray, Vector3* scaleArray, Quaternion* rotationArray, Vector3* translationArray, bool* successArray, int length) noexcept
+{
+	MatrixSimd::DecomposeBatch(sourceArray, scaleArray, rotationArray, translationArray, successArray, length);
+}
+
 /// <summary>
 /// Returns a determinant of this <see cref="Matrix"/>.
 /// </summary>
 /// <returns>Determinant of this <see cref="Matrix"/></returns>
 /// <remarks>See more about determinant here - http://en.wikipedia.org/wiki/Determinant.
 /// </remarks>
-float Matrix::Determinant()
+float Matrix::Determinant() const noexcept
 {
 	float num22 = this->M11;
 	float num21 = this->M12;
@@ -1058,25 +1004,11 @@ float Matrix::Determinant()
 	  /// <param name="matrix1">The first matrix to add.</param>
 	  /// <param name="matrix2">The second matrix to add.</param>
 	  /// <returns>The result of the matrix addition.</returns>
-Matrix Matrix::Add(Matrix& matrix1, Matrix& matrix2)
-{
-	matrix1.M11 += matrix2.M11;
-	matrix1.M12 += matrix2.M12;
-	matrix1.M13 += matrix2.M13;
-	matrix1.M14 += matrix2.M14;
-	matrix1.M21 += matrix2.M21;
-	matrix1.M22 += matrix2.M22;
-	matrix1.M23 += matrix2.M23;
-	matrix1.M24 += matrix2.M24;
-	matrix1.M31 += matrix2.M31;
-	matrix1.M32 += matrix2.M32;
-	matrix1.M33 += matrix2.M33;
-	matrix1.M34 += matrix2.M34;
-	matrix1.M41 += matrix2.M41;
-	matrix1.M42 += matrix2.M42;
-	matrix1.M43 += matrix2.M43;
-	matrix1.M44 += matrix2.M44;
-	return matrix1;
+Matrix Matrix::Add(const Matrix& matrix1, const Matrix& matrix2) noexcept
+{
+	Matrix result;
+	Add(matrix1, matrix2, result);
+	return result;
 }
 
 /// <summary>
@@ -1085,7 +1017,7 @@ Matrix Matrix::Add(Matrix& matrix1, Matrix& matrix2)
 /// <param name="matrix1">The first matrix to add.</param>
 /// <param name="matrix2">The second matrix to add.</param>
 /// <param name="result">The result of the matrix addition as an output parameter.</param>
-void Matrix::Add(Matrix& matrix1, Matrix& matrix2, Matrix& result)
+void Matrix::Add(const Matrix& matrix1, const Matrix& matrix2, Matrix& result) noexcept
 {
 	result.M11 = matrix1.M11 + matrix2.M11;
 	result.M12 = matrix1.M12 + matrix2.M12;
@@ -1105,31 +1037,30 @@ void Matrix::Add(Matrix& matrix1, Matrix& matrix2, Matrix& result)
 	result.M44 = matrix1.M44 + matrix2.M44;
 
 }
+
+/// <summary>
+/// Adds the matrices at the same index in two arrays, several matrices per instruction where the processor allows it.
+/// </summary>
+/// <param name="matrix1Array">Source <see cref="Matrix"/> array, left-hand side of each sum.</param>
+/// <param name="matrix2Array">Source <see cref="Matrix"/> array, right-hand side of each sum.</param>
+/// <param name="resultArray">Destination array. May be the same array as either source.</param>
+/// <param name="length">The number of matrices to add.</param>
+void Matrix::AddBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::AddBatch(matrix1Array, matrix2Array, resultArray, length);
+}
+
 /// <summary>
 /// Divides the elements of a <see cref="Matrix"/> by the elements of another matrix.
 /// </summary>
 /// <param name="matrix1">Source <see cref="Matrix"/>.</param>
 /// <param name="matrix2">Divisor <see cref="Matrix"/>.</param>
 /// <returns>The result of dividing the matrix.</returns>
-Matrix Matrix::Divide(Matrix& matrix1, Matrix& matrix2)
-{
-	matrix1.M11 = matrix1.M11 / matrix2.M11;
-	matrix1.M12 = matrix1.M12 / matrix2.M12;
-	matrix1.M13 = matrix1.M13 / matrix2.M13;
-	matrix1.M14 = matrix1.M14 / matrix2.M14;
-	matrix1.M21 = matrix1.M21 / matrix2.M21;
-	matrix1.M22 = matrix1.M22 / matrix2.M22;
-	matrix1.M23 = matrix1.M23 / matrix2.M23;
-	matrix1.M24 = matrix1.M24 / matrix2.M24;
-	matrix1.M31 = matrix1.M31 / matrix2.M31;
-	matrix1.M32 = matrix1.M32 / matrix2.M32;
-	matrix1.M33 = matrix1.M33 / matrix2.M33;
-	matrix1.M34 = matrix1.M34 / matrix2.M34;
-	matrix1.M41 = matrix1.M41 / matrix2.M41;
-	matrix1.M42 = matrix1.M42 / matrix2.M42;
-	matrix1.M43 = matrix1.M43 / matrix2.M43;
-	matrix1.M44 = matrix1.M44 / matrix2.M44;
-	return matrix1;
+Matrix Matrix::Divide(const Matrix& matrix1, const Matrix& matrix2) noexcept
+{
+	Matrix result;
+	Divide(matrix1, matrix2, result);
+	return result;
 }
 
 /// <summary>
@@ -1138,7 +1069,7 @@ Matrix Matrix::Divide(Matrix& matrix1, Matrix& matrix2)
 /// <param name="matrix1">Source <see cref="Matrix"/>.</param>
 /// <param name="matrix2">Divisor <see cref="Matrix"/>.</param>
 /// <param name="result">The result of dividing the matrix as an output parameter.</param>
-void Matrix::Divide(Matrix& matrix1, Matrix& matrix2, Matrix& result)
+void Matrix::Divide(const Matrix& matrix1, const Matrix& matrix2, Matrix& result) noexcept
 {
 	result.M11 = matrix1.M11 / matrix2.M11;
 	result.M12 = matrix1.M12 / matrix2.M12;
@@ -1164,26 +1095,11 @@ void Matrix::Divide(Matrix& matrix1, Matrix& matrix2, Matrix& result)
 /// <param name="matrix1">Source <see cref="Matrix"/>.</param>
 /// <param name="divider">Divisor scalar.</param>
 /// <returns>The result of dividing a matrix by a scalar.</returns>
-Matrix Matrix::Divide(Matrix matrix1, float divider)
+Matrix Matrix::Divide(const Matrix& matrix1, float divider) noexcept
 {
-	float num = 1.0f / divider;
-	matrix1.M11 = matrix1.M11 * num;
-	matrix1.M12 = matrix1.M12 * num;
-	matrix1.M13 = matrix1.M13 * num;
-	matrix1.M14 = matrix1.M14 * num;
-	matrix1.M21 = matrix1.M21 * num;
-	matrix1.M22 = matrix1.M22 * num;
-	matrix1.M23 = matrix1.M23 * num;
-	matrix1.M24 = matrix1.M24 * num;
-	matrix1.M31 = matrix1.M31 * num;
-	matrix1.M32 = matrix1.M32 * num;
-	matrix1.M33 = matrix1.M33 * num;
-	matrix1.M34 = matrix1.M34 * num;
-	matrix1.M41 = matrix1.M41 * num;
-	matrix1.M42 = matrix1.M42 * num;
-	matrix1.M43 = matrix1.M43 * num;
-	matrix1.M44 = matrix1.M44 * num;
-	return matrix1;
+	Matrix result;
+	Divide(matrix1, divider, result);
+	return result;
 }
 
 /// <summary>
@@ -1192,7 +1108,7 @@ Matrix Matrix::Divide(Matrix matrix1, float divider)
 /// <param name="matrix1">Source <see cref="Matrix"/>.</param>
 /// <param name="divider">Divisor scalar.</param>
 /// <param name="result">The result of dividing a matrix by a scalar as an output parameter.</param>
-void Matrix::Divide(Matrix& matrix1, float divider, Matrix& result)
+void Matrix::Divide(const Matrix& matrix1, float divider, Matrix& result) noexcept
 {
 	float num = 1.0f / divider;
 	result.M11 = matrix1.M11 * num;
@@ -1218,7 +1134,7 @@ void Matrix::Divide(Matrix& matrix1, float divider, Matrix& result)
 	   /// </summary>
 	   /// <param name="matrix">Source <see cref="Matrix"/>.</param>
 	   /// <returns>The inverted matrix.</returns>
-Matrix Matrix::Invert(Matrix& matrix)
+Matrix Matrix::Invert(const Matrix& matrix) noexcept
 {
 	Matrix result;
 	Invert(matrix, result);
@@ -1230,7 +1146,7 @@ Matrix Matrix::Invert(Matrix& matrix)
 /// </summary>
 /// <param name="matrix">Source <see cref="Matrix"/>.</param>
 /// <param name="result">The inverted matrix as output parameter.</param>
-void Matrix::Invert(Matrix& matrix, Matrix& result)
+void Matrix::Invert(const Matrix& matrix, Matrix& result) noexcept
 {
 	float num1 = matrix.M11;
 	float num2 = matrix.M12;
@@ -1291,6 +1207,21 @@ void Matrix::Invert(Matrix& matrix, Matrix& result)
 
 }
 
+/// <summary>
+/// Inverts every <see cref="Matrix"/> of an array, e.g. world matrices into normal or picking matrices.
+/// Unlike <see cref="Invert"/> the work is done in single precision, four matrices at a time, and singular
+/// matrices are reported instead of producing infinities: they are replaced by the identity.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="Matrix"/> array.</param>
+/// <param name="destinationArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to invert.</param>
+/// <param name="singularArray">Receives <c>true</c> for every singular matrix and <c>false</c> otherwise. May be null.</param>
+/// <param name="detectRigid">If <c>true</c>, matrices made only of an orthonormal rotation and a translation are inverted by transposing the rotation.</param>
+void Matrix::InvertBatch(const Matrix* sourceArray, Matrix* destinationArray, int length, bool* singularArray, bool detectRigid) noexcept
+{
+	MatrixSimd::InvertBatch(sourceArray, destinationArray, length, singularArray, detectRigid);
+}
+
 /// <summary>
 	   /// Creates a new <see cref="Matrix"/> that contains linear interpolation of the values in specified matrixes.
 	   /// </summary>
@@ -1298,25 +1229,11 @@ void Matrix::Invert(Matrix& matrix, Matrix& result)
 	   /// <param name="matrix2">The second <see cref="Vector2"/>.</param>
 	   /// <param name="amount">Weighting value(between 0.0 and 1.0).</param>
 	   /// <returns>>The result of linear interpolation of the specified matrixes.</returns>
-Matrix Matrix::Lerp(Matrix& matrix1, Matrix& matrix2, float amount)
-{
-	matrix1.M11 = matrix1.M11 + ((matrix2.M11 - matrix1.M11) * amount);
-	matrix1.M12 = matrix1.M12 + ((matrix2.M12 - matrix1.M12) * amount);
-	matrix1.M13 = matrix1.M13 + ((matrix2.M13 - matrix1.M13) * amount);
-	matrix1.M14 = matrix1.M14 + ((matrix2.M14 - matrix1.M14) * amount);
-	matrix1.M21 = matrix1.M21 + ((matrix2.M21 - matrix1.M21) * amount);
-	matrix1.M22 = matrix1.M22 + ((matrix2.M22 - matrix1.M22) * amount);
-	matrix1.M23 = matrix1.M23 + ((matrix2.M23 - matrix1.M23) * amount);
-	matrix1.M24 = matrix1.M24 + ((matrix2.M24 - matrix1.M24) * amount);
-	matrix1.M31 = matrix1.M31 + ((matrix2.M31 - matrix1.M31) * amount);
-	matrix1.M32 = matrix1.M32 + ((matrix2.M32 - matrix1.M32) * amount);
-	matrix1.M33 = matrix1.M33 + ((matrix2.M33 - matrix1.M33) * amount);
-	matrix1.M34 = matrix1.M34 + ((matrix2.M34 - matrix1.M34) * amount);
-	matrix1.M41 = matrix1.M41 + ((matrix2.M41 - matrix1.M41) * amount);
-	matrix1.M42 = matrix1.M42 + ((matrix2.M42 - matrix1.M42) * amount);
-	matrix1.M43 = matrix1.M43 + ((matrix2.M43 - matrix1.M43) * amount);
-	matrix1.M44 = matrix1.M44 + ((matrix2.M44 - matrix1.M44) * amount);
-	return matrix1;
+Matrix Matrix::Lerp(const Matrix& matrix1, const Matrix& matrix2, float amount) noexcept
+{
+	Matrix result;
+	Lerp(matrix1, matrix2, amount, result);
+	return result;
 }
 
 /// <summary>
@@ -1326,7 +1243,7 @@ Matrix Matrix::Lerp(Matrix& matrix1, Matrix& matrix2, float amount)
 /// <param name="matrix2">The second <see cref="Vector2"/>.</param>
 /// <param name="amount">Weighting value(between 0.0 and 1.0).</param>
 /// <param name="result">The result of linear interpolation of the specified matrixes as an output parameter.</param>
-void Matrix::Lerp(Matrix& matrix1, Matrix& matrix2, float amount, Matrix& result)
+void Matrix::Lerp(const Matrix& matrix1, const Matrix& matrix2, float amount, Matrix& result) noexcept
 {
 	result.M11 = matrix1.M11 + ((matrix2.M11 - matrix1.M11) * amount);
 	result.M12 = matrix1.M12 + ((matrix2.M12 - matrix1.M12) * amount);
@@ -1346,47 +1263,31 @@ void Matrix::Lerp(Matrix& matrix1, Matrix& matrix2, float amount, Matrix& result
 	result.M44 = matrix1.M44 + ((matrix2.M44 - matrix1.M44) * amount);
 }
 
+/// <summary>
+/// Linearly interpolates the matrices at the same index in two arrays, e.g. two poses of a skinning palette.
+/// Gives the same values as calling <see cref="Lerp"/> on every pair.
+/// </summary>
+/// <param name="matrix1Array">Source <see cref="Matrix"/> array, returned at amount 0.</param>
+/// <param name="matrix2Array">Source <see cref="Matrix"/> array, returned at amount 1.</param>
+/// <param name="amount">Weighting value(between 0.0 and 1.0) shared by all pairs.</param>
+/// <param name="resultArray">Destination array. May be the same array as either source.</param>
+/// <param name="length">The number of matrices to interpolate.</param>
+void Matrix::LerpBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::LerpBatch(matrix1Array, matrix2Array, amount, resultArray, length);
+}
+
 /// <summary>
 /// Creates a new <see cref="Matrix"/> that contains a multiplication of two matrix.
 /// </summary>
 /// <param name="matrix1">Source <see cref="Matrix"/>.</param>
 /// <param name="matrix2">Source <see cref="Matrix"/>.</param>
 /// <returns>Result of the matrix multiplication.</returns>
-Matrix  Matrix::Multiply(Matrix& matrix1, Matrix& matrix2)
-{
-	auto m11 = (((matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21)) + (matrix1.M13 * matrix2.M31)) + (matrix1.M14 * matrix2.M41);
-	auto m12 = (((matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22)) + (matrix1.M13 * matrix2.M32)) + (matrix1.M14 * matrix2.M42);
-	auto m13 = (((matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23)) + (matrix1.M13 * matrix2.M33)) + (matrix1.M14 * matrix2.M43);
-	auto m14 = (((matrix1.M11 * matrix2.M14) + (matrix1.M12 * matrix2.M24)) + (matrix1.M13 * matrix2.M34)) + (matrix1.M14 * matrix2.M44);
-	auto m21 = (((matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21)) + (matrix1.M23 * matrix2.M31)) + (matrix1.M24 * matrix2.M41);
-	auto m22 = (((matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22)) + (matrix1.M23 * matrix2.M32)) + (matrix1.M24 * matrix2.M42);
-	auto m23 = (((matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23)) + (matrix1.M23 * matrix2.M33)) + (matrix1.M24 * matrix2.M43);
-	auto m24 = (((matrix1.M21 * matrix2.M14) + (matrix1.M22 * matrix2.M24)) + (matrix1.M23 * matrix2.M34)) + (matrix1.M24 * matrix2.M44);
-	auto m31 = (((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + (matrix1.M33 * matrix2.M31)) + (matrix1.M34 * matrix2.M41);
-	auto m32 = (((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + (matrix1.M33 * matrix2.M32)) + (matrix1.M34 * matrix2.M42);
-	auto m33 = (((matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23)) + (matrix1.M33 * matrix2.M33)) + (matrix1.M34 * matrix2.M43);
-	auto m34 = (((matrix1.M31 * matrix2.M14) + (matrix1.M32 * matrix2.M24)) + (matrix1.M33 * matrix2.M34)) + (matrix1.M34 * matrix2.M44);
-	auto m41 = (((matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21)) + (matrix1.M43 * matrix2.M31)) + (matrix1.M44 * matrix2.M41);
-	auto m42 = (((matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22)) + (matrix1.M43 * matrix2.M32)) + (matrix1.M44 * matrix2.M42);
-	auto m43 = (((matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23)) + (matrix1.M43 * matrix2.M33)) + (matrix1.M44 * matrix2.M43);
-	auto m44 = (((matrix1.M41 * matrix2.M14) + (matrix1.M42 * matrix2.M24)) + (matrix1.M43 * matrix2.M34)) + (matrix1.M44 * matrix2.M44);
-	matrix1.M11 = m11;
-	matrix1.M12 = m12;
-	matrix1.M13 = m13;
-	matrix1.M14 = m14;
-	matrix1.M21 = m21;
-	matrix1.M22 = m22;
-	matrix1.M23 = m23;
-	matrix1.M24 = m24;
-	matrix1.M31 = m31;
-	matrix1.M32 = m32;
-	matrix1.M33 = m33;
-	matrix1.M34 = m34;
-	matrix1.M41 = m41;
-	matrix1.M42 = m42;
-	matrix1.M43 = m43;
-	matrix1.M44 = m44;
-	return matrix1;
+Matrix  Matrix::Multiply(const Matrix& matrix1, const Matrix& matrix2) noexcept
+{
+	Matrix result;
+	Multiply(matrix1, matrix2, result);
+	return result;
 }
 
 /// <summary>
@@ -1395,40 +1296,9 @@ Matrix  Matrix::Multiply(Matrix& matrix1, Matrix& matrix2)
 /// <param name="matrix1">Source <see cref="Matrix"/>.</param>
 /// <param name="matrix2">Source <see cref="Matrix"/>.</param>
 /// <param name="result">Result of the matrix multiplication as an output parameter.</param>
-void  Matrix::Multiply(Matrix& matrix1, Matrix& matrix2, Matrix& result)
-{
-	auto m11 = (((matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21)) + (matrix1.M13 * matrix2.M31)) + (matrix1.M14 * matrix2.M41);
-	auto m12 = (((matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22)) + (matrix1.M13 * matrix2.M32)) + (matrix1.M14 * matrix2.M42);
-	auto m13 = (((matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23)) + (matrix1.M13 * matrix2.M33)) + (matrix1.M14 * matrix2.M43);
-	auto m14 = (((matrix1.M11 * matrix2.M14) + (matrix1.M12 * matrix2.M24)) + (matrix1.M13 * matrix2.M34)) + (matrix1.M14 * matrix2.M44);
-	auto m21 = (((matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21)) + (matrix1.M23 * matrix2.M31)) + (matrix1.M24 * matrix2.M41);
-	auto m22 = (((matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22)) + (matrix1.M23 * matrix2.M32)) + (matrix1.M24 * matrix2.M42);
-	auto m23 = (((matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23)) + (matrix1.M23 * matrix2.M33)) + (matrix1.M24 * matrix2.M43);
-	auto m24 = (((matrix1.M21 * matrix2.M14) + (matrix1.M22 * matrix2.M24)) + (matrix1.M23 * matrix2.M34)) + (matrix1.M24 * matrix2.M44);
-	auto m31 = (((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + (matrix1.M33 * matrix2.M31)) + (matrix1.M34 * matrix2.M41);
-	auto m32 = (((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + (matrix1.M33 * matrix2.M32)) + (matrix1.M34 * matrix2.M42);
-	auto m33 = (((matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23)) + (matrix1.M33 * matrix2.M33)) + (matrix1.M34 * matrix2.M43);
-	auto m34 = (((matrix1.M31 * matrix2.M14) + (matrix1.M32 * matrix2.M24)) + (matrix1.M33 * matrix2.M34)) + (matrix1.M34 * matrix2.M44);
-	auto m41 = (((matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21)) + (matrix1.M43 * matrix2.M31)) + (matrix1.M44 * matrix2.M41);
-	auto m42 = (((matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22)) + (matrix1.M43 * matrix2.M32)) + (matrix1.M44 * matrix2.M42);
-	auto m43 = (((matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23)) + (matrix1.M43 * matrix2.M33)) + (matrix1.M44 * matrix2.M43);
-	auto m44 = (((matrix1.M41 * matrix2.M14) + (matrix1.M42 * matrix2.M24)) + (matrix1.M43 * matrix2.M34)) + (matrix1.M44 * matrix2.M44);
-	result.M11 = m11;
-	result.M12 = m12;
-	result.M13 = m13;
-	result.M14 = m14;
-	result.M21 = m21;
-	result.M22 = m22;
-	result.M23 = m23;
-	result.M24 = m24;
-	result.M31 = m31;
-	result.M32 = m32;
-	result.M33 = m33;
-	result.M34 = m34;
-	result.M41 = m41;
-	result.M42 = m42;
-	result.M43 = m43;
-	result.M44 = m44;
+void  Matrix::Multiply(const Matrix& matrix1, const Matrix& matrix2, Matrix& result) noexcept
+{
+	MatrixSimd::Multiply(matrix1, matrix2, result);
 }
 
 /// <summary>
@@ -1437,25 +1307,11 @@ void  Matrix::Multiply(Matrix& matrix1, Matrix& matrix2, Matrix& result)
 /// <param name="matrix1">Source <see cref="Matrix"/>.</param>
 /// <param name="scaleFactor">Scalar value.</param>
 /// <returns>Result of the matrix multiplication with a scalar.</returns>
-Matrix  Matrix::Multiply(Matrix& matrix1, float scaleFactor)
-{
-	matrix1.M11 *= scaleFactor;
-	matrix1.M12 *= scaleFactor;
-	matrix1.M13 *= scaleFactor;
-	matrix1.M14 *= scaleFactor;
-	matrix1.M21 *= scaleFactor;
-	matrix1.M22 *= scaleFactor;
-	matrix1.M23 *= scaleFactor;
-	matrix1.M24 *= scaleFactor;
-	matrix1.M31 *= scaleFactor;
-	matrix1.M32 *= scaleFactor;
-	matrix1.M33 *= scaleFactor;
-	matrix1.M34 *= scaleFactor;
-	matrix1.M41 *= scaleFactor;
-	matrix1.M42 *= scaleFactor;
-	matrix1.M43 *= scaleFactor;
-	matrix1.M44 *= scaleFactor;
-	return matrix1;
+Matrix  Matrix::Multiply(const Matrix& matrix1, float scaleFactor) noexcept
+{
+	Matrix result;
+	Multiply(matrix1, scaleFactor, result);
+	return result;
 }
 
 /// <summary>
@@ -1464,7 +1320,7 @@ Matrix  Matrix::Multiply(Matrix& matrix1, float scaleFactor)
 /// <param name="matrix1">Source <see cref="Matrix"/>.</param>
 /// <param name="scaleFactor">Scalar value.</param>
 /// <param name="result">Result of the matrix multiplication with a scalar as an output parameter.</param>
-void Matrix::Multiply(Matrix& matrix1, float scaleFactor, Matrix& result)
+void Matrix::Multiply(const Matrix& matrix1, float scaleFactor, Matrix& result) noexcept
 {
 	result.M11 = matrix1.M11 * scaleFactor;
 	result.M12 = matrix1.M12 * scaleFactor;
@@ -1485,22 +1341,81 @@ void Matrix::Multiply(Matrix& matrix1, float scaleFactor, Matrix& result)
 
 }
 /// <summary>
- /// Copy the values of specified <see cref="Matrix"/> to the float array.
- /// </summary>
- /// <param name="matrix">The source <see cref="Matrix"/>.</param>
- /// <returns>The array which matrix values will be stored.</returns>
- /// <remarks>
- /// Required for OpenGL 2.0 projection matrix stuff.
- /// </remarks>
-float* Matrix::ToFloatArray(Matrix& matrix)
+/// Multiplies each pair of matrices at the same index in two arrays.
+/// </summary>
+/// <param name="matrix1Array">Source <see cref="Matrix"/> array, left-hand side of each product.</param>
+/// <param name="matrix2Array">Source <see cref="Matrix"/> array, right-hand side of each product.</param>
+/// <param name="resultArray">Destination array. May be the same array as either source.</param>
+/// <param name="length">The number of matrices to multiply.</param>
+void Matrix::MultiplyBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::MultiplyBatch(matrix1Array, matrix2Array, resultArray, length);
+}
+
+/// <summary>
+/// Multiplies one <see cref="Matrix"/> by every matrix of an array.
+/// </summary>
+/// <param name="matrix1">Source <see cref="Matrix"/>, left-hand side of every product.</param>
+/// <param name="matrix2Array">Source <see cref="Matrix"/> array, right-hand side of each product.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to multiply.</param>
+void Matrix::MultiplyBatch(const Matrix& matrix1, const Matrix* matrix2Array, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::MultiplyBatch(matrix1, matrix2Array, resultArray, length);
+}
+
+/// <summary>
+/// Multiplies every matrix of an array by one <see cref="Matrix"/>, e.g. child local transforms by their parent's world transform.
+/// </summary>
+/// <param name="matrix1Array">Source <see cref="Matrix"/> array, left-hand side of each product.</param>
+/// <param name="matrix2">Source <see cref="Matrix"/>, right-hand side of every product.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to multiply.</param>
+void Matrix::MultiplyBatch(const Matrix* matrix1Array, const Matrix& matrix2, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::MultiplyBatch(matrix1Array, matrix2, resultArray, length);
+}
+
+/// <summary>
+/// Multiplies every matrix of an array by a scalar.
+/// </summary>
+/// <param name="matrix1Array">Source <see cref="Matrix"/> array.</param>
+/// <param name="scaleFactor">Scalar value.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to multiply.</param>
+void Matrix::MultiplyBatch(const Matrix* matrix1Array, float scaleFactor, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::MultiplyBatch(matrix1Array, scaleFactor, resultArray, length);
+}
+
+/// <summary>
+/// Copies the 16 elements of a matrix, M11 to M44, to caller-provided memory.
+/// </summary>
+/// <param name="matrix">Source <see cref="Matrix"/>.</param>
+/// <param name="destination">Memory receiving 16 floats.</param>
+/// <remarks>
+/// Uses ordinary stores: a single matrix is usually read back soon, so unlike <see cref="WriteBatch"/> it should stay in the cache.
+/// </remarks>
+void Matrix::ToFloatArray(const Matrix& matrix, float* destination) noexcept
+{
+	destination[0] = matrix.M11; destination[1] = matrix.M12; destination[2] = matrix.M13; destination[3] = matrix.M14;
+	destination[4] = matrix.M21; destination[5] = matrix.M22; destination[6] = matrix.M23; destination[7] = matrix.M24;
+	destination[8] = matrix.M31; destination[9] = matrix.M32; destination[10] = matrix.M33; destination[11] = matrix.M34;
+	destination[12] = matrix.M41; destination[13] = matrix.M42; destination[14] = matrix.M43; destination[15] = matrix.M44;
+}
+
+/// <summary>
+/// Writes an array of matrices to caller-provided memory, typically a mapped GPU staging buffer, in the given layout.
+/// When <paramref name="destination"/> is 16-byte aligned the SIMD kernels use non-temporal stores, so large uploads
+/// bypass the cache instead of evicting the data the render thread works on.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="Matrix"/> array.</param>
+/// <param name="destination">Memory receiving 16 floats per matrix, or 12 for <see cref="ColumnMajor3x4"/>.</param>
+/// <param name="length">The number of matrices to write.</param>
+/// <param name="layout">Element order of the written matrices.</param>
+void Matrix::WriteBatch(const Matrix* sourceArray, float* destination, int length, MatrixLayout layout) noexcept
 {
-	float matarray[16] = {
-							matrix.M11, matrix.M12, matrix.M13, matrix.M14,
-							matrix.M21, matrix.M22, matrix.M23, matrix.M24,
-							matrix.M31, matrix.M32, matrix.M33, matrix.M34,
-							matrix.M41, matrix.M42, matrix.M43, matrix.M44
-	};
-	return matarray;
+	MatrixSimd::WriteBatch(sourceArray, destination, length, layout);
 }
 
 /// <summary>
@@ -1508,25 +1423,11 @@ float* Matrix::ToFloatArray(Matrix& matrix)
 /// </summary>
 /// <param name="matrix">Source <see cref="Matrix"/>.</param>
 /// <returns>Result of the matrix negation.</returns>
-Matrix Matrix::Negate(Matrix& matrix)
-{
-	matrix.M11 = -matrix.M11;
-	matrix.M12 = -matrix.M12;
-	matrix.M13 = -matrix.M13;
-	matrix.M14 = -matrix.M14;
-	matrix.M21 = -matrix.M21;
-	matrix.M22 = -matrix.M22;
-	matrix.M23 = -matrix.M23;
-	matrix.M24 = -matrix.M24;
-	matrix.M31 = -matrix.M31;
-	matrix.M32 = -matrix.M32;
-	matrix.M33 = -matrix.M33;
-	matrix.M34 = -matrix.M34;
-	matrix.M41 = -matrix.M41;
-	matrix.M42 = -matrix.M42;
-	matrix.M43 = -matrix.M43;
-	matrix.M44 = -matrix.M44;
-	return matrix;
+Matrix Matrix::Negate(const Matrix& matrix) noexcept
+{
+	Matrix result;
+	Negate(matrix, result);
+	return result;
 }
 
 /// <summary>
@@ -1534,7 +1435,7 @@ Matrix Matrix::Negate(Matrix& matrix)
 /// </summary>
 /// <param name="matrix">Source <see cref="Matrix"/>.</param>
 /// <param name="result">Result of the matrix negation as an output parameter.</param>
-void Matrix::Negate(Matrix& matrix, Matrix& result)
+void Matrix::Negate(const Matrix& matrix, Matrix& result) noexcept
 {
 	result.M11 = -matrix.M11;
 	result.M12 = -matrix.M12;
@@ -1554,31 +1455,28 @@ void Matrix::Negate(Matrix& matrix, Matrix& result)
 	result.M44 = -matrix.M44;
 }
 
+/// <summary>
+/// Negates every matrix of an array.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="Matrix"/> array.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to negate.</param>
+void Matrix::NegateBatch(const Matrix* sourceArray, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::NegateBatch(sourceArray, resultArray, length);
+}
+
 /// <summary>
 		/// Creates a new <see cref="Matrix"/> that contains subtraction of one matrix from another.
 		/// </summary>
 		/// <param name="matrix1">The first <see cref="Matrix"/>.</param>
 		/// <param name="matrix2">The second <see cref="Matrix"/>.</param>
 		/// <returns>The result of the matrix subtraction.</returns>
-Matrix Matrix::Subtract(Matrix& matrix1, Matrix& matrix2)
-{
-	matrix1.M11 = matrix1.M11 - matrix2.M11;
-	matrix1.M12 = matrix1.M12 - matrix2.M12;
-	matrix1.M13 = matrix1.M13 - matrix2.M13;
-	matrix1.M14 = matrix1.M14 - matrix2.M14;
-	matrix1.M21 = matrix1.M21 - matrix2.M21;
-	matrix1.M22 = matrix1.M22 - matrix2.M22;
-	matrix1.M23 = matrix1.M23 - matrix2.M23;
-	matrix1.M24 = matrix1.M24 - matrix2.M24;
-	matrix1.M31 = matrix1.M31 - matrix2.M31;
-	matrix1.M32 = matrix1.M32 - matrix2.M32;
-	matrix1.M33 = matrix1.M33 - matrix2.M33;
-	matrix1.M34 = matrix1.M34 - matrix2.M34;
-	matrix1.M41 = matrix1.M41 - matrix2.M41;
-	matrix1.M42 = matrix1.M42 - matrix2.M42;
-	matrix1.M43 = matrix1.M43 - matrix2.M43;
-	matrix1.M44 = matrix1.M44 - matrix2.M44;
-	return matrix1;
+Matrix Matrix::Subtract(const Matrix& matrix1, const Matrix& matrix2) noexcept
+{
+	Matrix result;
+	Subtract(matrix1, matrix2, result);
+	return result;
 }
 
 /// <summary>
@@ -1587,7 +1485,7 @@ Matrix Matrix::Subtract(Matrix& matrix1, Matrix& matrix2)
 /// <param name="matrix1">The first <see cref="Matrix"/>.</param>
 /// <param name="matrix2">The second <see cref="Matrix"/>.</param>
 /// <param name="result">The result of the matrix subtraction as an output parameter.</param>
-void Matrix::Subtract(Matrix& matrix1, Matrix& matrix2, Matrix& result)
+void Matrix::Subtract(const Matrix& matrix1, const Matrix& matrix2, Matrix& result) noexcept
 {
 	result.M11 = matrix1.M11 - matrix2.M11;
 	result.M12 = matrix1.M12 - matrix2.M12;
@@ -1607,12 +1505,24 @@ void Matrix::Subtract(Matrix& matrix1, Matrix& matrix2, Matrix& result)
 	result.M44 = matrix1.M44 - matrix2.M44;
 }
 
+/// <summary>
+/// Subtracts the matrices of the second array from the matrices at the same index in the first.
+/// </summary>
+/// <param name="matrix1Array">Source <see cref="Matrix"/> array.</param>
+/// <param name="matrix2Array">Source <see cref="Matrix"/> array subtracted from the first.</param>
+/// <param name="resultArray">Destination array. May be the same array as either source.</param>
+/// <param name="length">The number of matrices to subtract.</param>
+void Matrix::SubtractBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::SubtractBatch(matrix1Array, matrix2Array, resultArray, length);
+}
+
 /// <summary>
 /// Swap the matrix rows and columns.
 /// </summary>
 /// <param name="matrix">The matrix for transposing operation.</param>
 /// <returns>The new <see cref="Matrix"/> which contains the transposing result.</returns>
-Matrix Matrix::Transpose(Matrix& matrix)
+Matrix Matrix::Transpose(const Matrix& matrix) noexcept
 {
 	Matrix ret;
 	Transpose(matrix, ret);
@@ -1624,7 +1534,7 @@ Matrix Matrix::Transpose(Matrix& matrix)
 /// </summary>
 /// <param name="matrix">The matrix for transposing operation.</param>
 /// <param name="result">The new <see cref="Matrix"/> which contains the transposing result as an output parameter.</param>
-void Matrix::Transpose(Matrix& matrix, Matrix& result)
+void Matrix::Transpose(const Matrix& matrix, Matrix& result) noexcept
 {
 	Matrix ret;
 
@@ -1651,8 +1561,19 @@ void Matrix::Transpose(Matrix& matrix, Matrix& result)
 	result = ret;
 }
 
+/// <summary>
+/// Swaps the rows and columns of every matrix of an array.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="Matrix"/> array.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to transpose.</param>
+void Matrix::TransposeBatch(const Matrix* sourceArray, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::TransposeBatch(sourceArray, resultArray, length);
+}
+
 // Matrix addition
-Matrix operator+(const Matrix& matrix1, const Matrix& matrix2) {
+Matrix operator+(const Matrix& matrix1, const Matrix& matrix2) noexcept {
 	return Matrix(
 		matrix1.M11 + matrix2.M11, matrix1.M12 + matrix2.M12, matrix1.M13 + matrix2.M13, matrix1.M14 + matrix2.M14,
 		matrix1.M21 + matrix2.M21, matrix1.M22 + matrix2.M22, matrix1.M23 + matrix2.M23, matrix1.M24 + matrix2.M24,
@@ -1662,7 +1583,7 @@ Matrix operator+(const Matrix& matrix1, const Matrix& matrix2) {
 }
 
 // Matrix division by another matrix
-Matrix operator/(const Matrix& matrix1, const Matrix& matrix2) {
+Matrix operator/(const Matrix& matrix1, const Matrix& matrix2) noexcept {
 	return Matrix(
 		matrix1.M11 / matrix2.M11, matrix1.M12 / matrix2.M12, matrix1.M13 / matrix2.M13, matrix1.M14 / matrix2.M14,
 		matrix1.M21 / matrix2.M21, matrix1.M22 / matrix2.M22, matrix1.M23 / matrix2.M23, matrix1.M24 / matrix2.M24,
@@ -1672,7 +1593,7 @@ Matrix operator/(const Matrix& matrix1, const Matrix& matrix2) {
 }
 
 // Matrix division by a scalar
-Matrix operator/(const Matrix& matrix, float divider) {
+Matrix operator/(const Matrix& matrix, float divider) noexcept {
 	float num = 1.0f / divider;
 	return Matrix(
 		matrix.M11 * num, matrix.M12 * num, matrix.M13 * num, matrix.M14 * num,
@@ -1683,7 +1604,7 @@ Matrix operator/(const Matrix& matrix, float divider) {
 }
 
 // Matrix equality comparison
-bool operator==(const Matrix& matrix1, const Matrix& matrix2) {
+bool operator==(const Matrix& matrix1, const Matrix& matrix2) noexcept {
 	return (
 		matrix1.M11 == matrix2.M11 && matrix1.M12 == matrix2.M12 && matrix1.M13 == matrix2.M13 && matrix1.M14 == matrix2.M14 &&
 		matrix1.M21 == matrix2.M21 && matrix1.M22 == matrix2.M22 && matrix1.M23 == matrix2.M23 && matrix1.M24 == matrix2.M24 &&
@@ -1693,34 +1614,19 @@ bool operator==(const Matrix& matrix1, const Matrix& matrix2) {
 }
 
 // Matrix inequality comparison
-bool operator!=(const Matrix& matrix1, const Matrix& matrix2) {
+bool operator!=(const Matrix& matrix1, const Matrix& matrix2) noexcept {
 	return !operator==(matrix1, matrix2);
 }
 
 // Matrix multiplication
-Matrix operator*(const Matrix& matrix1, const Matrix& matrix2) {
-	return Matrix(
-		(((matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21)) + (matrix1.M13 * matrix2.M31)) + (matrix1.M14 * matrix2.M41),
-		(((matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22)) + (matrix1.M13 * matrix2.M32)) + (matrix1.M14 * matrix2.M42),
-		(((matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23)) + (matrix1.M13 * matrix2.M33)) + (matrix1.M14 * matrix2.M43),
-		(((matrix1.M11 * matrix2.M14) + (matrix1.M12 * matrix2.M24)) + (matrix1.M13 * matrix2.M34)) + (matrix1.M14 * matrix2.M44),
-		(((matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21)) + (matrix1.M23 * matrix2.M31)) + (matrix1.M24 * matrix2.M41),
-		(((matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22)) + (matrix1.M23 * matrix2.M32)) + (matrix1.M24 * matrix2.M42),
-		(((matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23)) + (matrix1.M23 * matrix2.M33)) + (matrix1.M24 * matrix2.M43),
-		(((matrix1.M21 * matrix2.M14) + (matrix1.M22 * matrix2.M24)) + (matrix1.M23 * matrix2.M34)) + (matrix1.M24 * matrix2.M44),
-		(((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + (matrix1.M33 * matrix2.M31)) + (matrix1.M34 * matrix2.M41),
-		(((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + (matrix1.M33 * matrix2.M32)) + (matrix1.M34 * matrix2.M42),
-		(((matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23)) + (matrix1.M33 * matrix2.M33)) + (matrix1.M34 * matrix2.M43),
-		(((matrix1.M31 * matrix2.M14) + (matrix1.M32 * matrix2.M24)) + (matrix1.M33 * matrix2.M34)) + (matrix1.M34 * matrix2.M44),
-		(((matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21)) + (matrix1.M43 * matrix2.M31)) + (matrix1.M44 * matrix2.M41),
-		(((matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22)) + (matrix1.M43 * matrix2.M32)) + (matrix1.M44 * matrix2.M42),
-		(((matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23)) + (matrix1.M43 * matrix2.M33)) + (matrix1.M44 * matrix2.M43),
-		(((matrix1.M41 * matrix2.M14) + (matrix1.M42 * matrix2.M24)) + (matrix1.M43 * matrix2.M34)) + (matrix1.M44 * matrix2.M44)
-	);
+Matrix operator*(const Matrix& matrix1, const Matrix& matrix2) noexcept {
+	Matrix result;
+	MatrixSimd::Multiply(matrix1, matrix2, result);
+	return result;
 }
 
 // Matrix multiplication by a scalar
-Matrix operator*(const Matrix& matrix, float scaleFactor) {
+Matrix operator*(const Matrix& matrix, float scaleFactor) noexcept {
 	return Matrix(
 		matrix.M11 * scaleFactor, matrix.M12 * scaleFactor, matrix.M13 * scaleFactor, matrix.M14 * scaleFactor,
 		matrix.M21 * scaleFactor, matrix.M22 * scaleFactor, matrix.M23 * scaleFactor, matrix.M24 * scaleFactor,
@@ -1730,7 +1636,7 @@ Matrix operator*(const Matrix& matrix, float scaleFactor) {
 }
 
 // Matrix subtraction
-Matrix operator-(const Matrix& matrix1, const Matrix& matrix2) {
+Matrix operator-(const Matrix& matrix1, const Matrix& matrix2) noexcept {
 	return Matrix(
 		matrix1.M11 - matrix2.M11, matrix1.M12 - matrix2.M12, matrix1.M13 - matrix2.M13, matrix1.M14 - matrix2.M14,
 		matrix1.M21 - matrix2.M21, matrix1.M22 - matrix2.M22, matrix1.M23 - matrix2.M23, matrix1.M24 - matrix2.M24,
@@ -1740,7 +1646,7 @@ Matrix operator-(const Matrix& matrix1, const Matrix& matrix2) {
 }
 
 // Matrix negation
-Matrix operator-(const Matrix& matrix) {
+Matrix operator-(const Matrix& matrix) noexcept {
 	return Matrix(
 		-matrix.M11, -matrix.M12, -matrix.M13, -matrix.M14,
 		-matrix.M21, -matrix.M22, -matrix.M23, -matrix.M24,
@@ -1748,7 +1654,7 @@ Matrix operator-(const Matrix& matrix) {
 		-matrix.M41, -matrix.M42, -matrix.M43, -matrix.M44
 	);
 }
-void Matrix::FindDeterminants(Matrix& matrix, float& major, float& minor1, float& minor2, float& minor3, float& minor4, float& minor5, float& minor6, float& minor7, float& minor8, float& minor9, float& minor10, float& minor11, float& minor12)
+void Matrix::FindDeterminants(const Matrix& matrix, float& major, float& minor1, float& minor2, float& minor3, float& minor4, float& minor5, float& minor6, float& minor7, float& minor8, float& minor9, float& minor10, float& minor11, float& minor12) noexcept
 {
 	double det1 = (double)matrix.M11 * (double)matrix.M22 - (double)matrix.M12 * (double)matrix.M21;
 	double det2 = (double)matrix.M11 * (double)matrix.M23 - (double)matrix.M13 * (double)matrix.M21;
@@ -3,7 +3,9 @@
 #include "Vector3.h"
 #include "Vector4.h" 
 #include "Quaternion.h"
+#include "AlignedVector.h"
 #include "Rectangle.h"
+#include "MatrixLayout.h"
 class Matrix
 {
 public:
@@ -40,12 +42,16 @@ public:
 		return (*this)[(row * 4) + column];
 	}
 
-	Matrix(
+	constexpr Matrix(
 		float m11, float m12, float m13, float m14,
 		float m21, float m22, float m23, float m24,
 		float m31, float m32, float m33, float m34,
 		float m41, float m42, float m43, float m44
-	);
+	) noexcept :
+		M11(m11), M12(m12), M13(m13), M14(m14),
+		M21(m21), M22(m22), M23(m23), M24(m24),
+		M31(m31), M32(m32), M33(m33), M34(m34),
+		M41(m41), M42(m42), M43(m43), M44(m44) {}
 
 	// Constructs a matrix.
 	Matrix(
@@ -53,122 +59,476 @@ public:
 		const Vector4& row2,
 		const Vector4& row3,
 		const Vector4& row4
-	);
+	) noexcept;
 
-	Matrix() :
+	constexpr Matrix() noexcept :
 		M11(0), M12(0), M13(0), M14(0),
 		M21(0), M22(0), M23(0), M24(0),
 		M31(0), M32(0), M33(0), M34(0),
 		M41(0), M42(0), M43(0), M44(0) {}
 
 public:
-	Vector3 Backward() const;
-	void Backward(const Vector3& value);
-	Vector3 Down() const;
-	void Down(const Vector3& value);
-	Vector3 Forward() const;
-	void Forward(const Vector3& value);
-	Vector3 Left() const;
-	void Left(const Vector3& value);
-	Vector3 Right() const;
-	void Right(const Vector3& value);
-	Vector3 Translation() const;
-	void Translation(const Vector3& value);
-	Vector3 Up() const;
-	void Up(const Vector3& value);
-	static Matrix Identity();
+	Vector3 Backward() const noexcept;
+	void Backward(const Vector3& value) noexcept;
+	Vector3 Down() const noexcept;
+	void Down(const Vector3& value) noexcept;
+	Vector3 Forward() const noexcept;
+	void Forward(const Vector3& value) noexcept;
+	Vector3 Left() const noexcept;
+	void Left(const Vector3& value) noexcept;
+	Vector3 Right() const noexcept;
+	void Right(const Vector3& value) noexcept;
+	Vector3 Translation() const noexcept;
+	void Translation(const Vector3& value) noexcept;
+	Vector3 Up() const noexcept;
+	void Up(const Vector3& value) noexcept;
+	static constexpr Matrix Identity() noexcept;
 
 public:
-	static Matrix CreateBillboard(Vector3& objectPosition, Vector3& cameraPosition, Vector3& cameraUpVector, Vector3* cameraForwardVector);
-	static void CreateBillboard(Vector3& objectPosition, Vector3& cameraPosition, Vector3& cameraUpVector, Vector3* cameraForwardVector, Matrix& result);
-
-	static Matrix CreateConstrainedBillboard(Vector3& objectPosition, Vector3& cameraPosition, Vector3& rotateAxis, Vector3* cameraForwardVector, Vector3* objectForwardVector);
-	static void CreateConstrainedBillboard(Vector3& objectPosition, Vector3& cameraPosition, Vector3& rotateAxis, Vector3* cameraForwardVector, Vector3* objectForwardVector, Matrix& result);
-	static Matrix CreateFromAxisAngle(Vector3& axis, float angle);
-	static void CreateFromAxisAngle(Vector3& axis, float angle, Matrix& result);
-	static Matrix CreateFromQuaternion(Quaternion& quaternion);
-	static void CreateFromQuaternion(Quaternion& quaternion, Matrix& result);
-	static Matrix CreateFromYawPitchRoll(float yaw, float pitch, float roll);
-	static void CreateFromYawPitchRoll(float yaw, float pitch, float roll, Matrix& result);
-	static void CreateLookAt(Vector3& cameraPosition, Vector3& cameraTarget, Vector3& cameraUpVector, Matrix& result);
-	static Matrix CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane);
-	static void CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane, Matrix& result);
-	static Matrix CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane);
-	static Matrix CreateOrthographicOffCenter(Rectangle& viewingVolume, float zNearPlane, float zFarPlane);
-	static void CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane, Matrix& result);
-	static Matrix CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance);
-	static void CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance, Matrix& result);
-	static Matrix CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance);
-	static void CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance, Matrix& result);
-	static Matrix CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance);
-	static Matrix CreatePerspectiveOffCenter(Rectangle& viewingVolume, float nearPlaneDistance, float farPlaneDistance);
-	static void CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance, Matrix& result);
-	static Matrix CreateRotationX(float radians);
-	static void CreateRotationX(float radians, Matrix& result);
-	static Matrix CreateRotationY(float radians);
-	static void CreateRotationY(float radians, Matrix& result);
-	static Matrix CreateRotationZ(float radians);
-	static void CreateRotationZ(float radians, Matrix& result);
-	static Matrix CreateScale(float scale);
-	static void CreateScale(float scale, Matrix& result);
-	static Matrix CreateScale(float xScale, float yScale, float zScale);
-	static void CreateScale(float xScale, float yScale, float zScale, Matrix& result);
-	static Matrix CreateScale(Vector3& scales);
-	static Matrix CreateLookAt(Vector3& cameraPosition, Vector3& cameraTarget, Vector3& cameraUpVector);
+	static Matrix CreateBillboard(const Vector3& objectPosition, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3* cameraForwardVector) noexcept;
+	static void CreateBillboard(const Vector3& objectPosition, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3* cameraForwardVector, Matrix& result) noexcept;
+
+	static Matrix CreateConstrainedBillboard(const Vector3& objectPosition, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3* cameraForwardVector, const Vector3* objectForwardVector) noexcept;
+	static void CreateConstrainedBillboard(const Vector3& objectPosition, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3* cameraForwardVector, const Vector3* objectForwardVector, Matrix& result) noexcept;
+	static Matrix CreateFromAxisAngle(const Vector3& axis, float angle) noexcept;
+	static void CreateFromAxisAngle(const Vector3& axis, float angle, Matrix& result) noexcept;
+	// Overloads with a trigonometry policy of TrigPrecision.h, as in CreateRotationY<FastTrig>(radians).
+	template<typename Trig> static Matrix CreateFromAxisAngle(const Vector3& axis, float angle) noexcept;
+	template<typename Trig> static void CreateFromAxisAngle(const Vector3& axis, float angle, Matrix& result) noexcept;
+	static Matrix CreateFromQuaternion(const Quaternion& quaternion) noexcept;
+	static void CreateFromQuaternion(const Quaternion& quaternion, Matrix& result) noexcept;
+	static Matrix CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3& translation) noexcept;
+	static void CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3& translation, Matrix& result) noexcept;
+	static void CreateFromTRSBatch(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, Matrix* resultArray, int length) noexcept;
+	static Matrix CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept;
+	static void CreateFromYawPitchRoll(float yaw, float pitch, float roll, Matrix& result) noexcept;
+	template<typename Trig> static Matrix CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept;
+	template<typename Trig> static void CreateFromYawPitchRoll(float yaw, float pitch, float roll, Matrix& result) noexcept;
+	static void CreateLookAt(const Vector3& cameraPosition, const Vector3& cameraTarget, const Vector3& cameraUpVector, Matrix& result) noexcept;
+	static Matrix CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane) noexcept;
+	static void CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane, Matrix& result) noexcept;
+	static Matrix CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane) noexcept;
+	static Matrix CreateOrthographicOffCenter(const Rectangle& viewingVolume, float zNearPlane, float zFarPlane) noexcept;
+	static void CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane, Matrix& result) noexcept;
+	static Matrix CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance) noexcept;
+	static void CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance, Matrix& result) noexcept;
+	static Matrix CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance) noexcept;
+	static void CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance, Matrix& result) noexcept;
+	static Matrix CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance) noexcept;
+	static Matrix CreatePerspectiveOffCenter(const Rectangle& viewingVolume, float nearPlaneDistance, float farPlaneDistance) noexcept;
+	static void CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance, Matrix& result) noexcept;
+	static Matrix CreateRotationX(float radians) noexcept;
+	static void CreateRotationX(float radians, Matrix& result) noexcept;
+	static Matrix CreateRotationY(float radians) noexcept;
+	static void CreateRotationY(float radians, Matrix& result) noexcept;
+	static Matrix CreateRotationZ(float radians) noexcept;
+	static void CreateRotationZ(float radians, Matrix& result) noexcept;
+	template<typename Trig> static Matrix CreateRotationX(float radians) noexcept;
+	template<typename Trig> static void CreateRotationX(float radians, Matrix& result) noexcept;
+	template<typename Trig> static Matrix CreateRotationY(float radians) noexcept;
+	template<typename Trig> static void CreateRotationY(float radians, Matrix& result) noexcept;
+	template<typename Trig> static Matrix CreateRotationZ(float radians) noexcept;
+	template<typename Trig> static void CreateRotationZ(float radians, Matrix& result) noexcept;
+	static constexpr Matrix CreateScale(float scale) noexcept;
+	static void CreateScale(float scale, Matrix& result) noexcept;
+	static constexpr Matrix CreateScale(float xScale, float yScale, float zScale) noexcept;
+	static void CreateScale(float xScale, float yScale, float zScale, Matrix& result) noexcept;
+	static Matrix CreateScale(const Vector3& scales) noexcept;
+	static Matrix CreateLookAt(const Vector3& cameraPosition, const Vector3& cameraTarget, const Vector3& cameraUpVector) noexcept;
 	//TODO add the functions regarding Plane
-	static void CreateScale(Vector3& scales, Matrix& result);
-	static Matrix CreateTranslation(float xPosition, float yPosition, float zPosition);
-	static void CreateTranslation(Vector3& position, Matrix& result);
-	static Matrix CreateTranslation(Vector3& position);
-	static void CreateTranslation(float xPosition, float yPosition, float zPosition, Matrix& result);
-	static Matrix CreateWorld(Vector3& position, Vector3& forward, Vector3& up);
-	static void CreateWorld(Vector3& position, Vector3& forward, Vector3& up, Matrix& result);
-	bool Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation);
-	float Determinant();
-	static Matrix Add(Matrix& matrix1, Matrix& matrix2);
-	static void Add(Matrix& matrix1, Matrix& matrix2, Matrix& result);
-	static Matrix Divide(Matrix& matrix1, Matrix& matrix2);
-	static void Divide(Matrix& matrix1, Matrix& matrix2, Matrix& result);
-	static Matrix Divide(Matrix matrix1, float divider);
-	static void Divide(Matrix& matrix1, float divider, Matrix& result);
-	static Matrix Invert(Matrix& matrix);
-	static void Invert(Matrix& matrix, Matrix& result);
-	static Matrix Lerp(Matrix& matrix1, Matrix& matrix2, float amount);
-	static void Lerp(Matrix& matrix1, Matrix& matrix2, float amount, Matrix& result);
-	static Matrix Multiply(Matrix& matrix1, Matrix& matrix2);
-	static void Multiply(Matrix& matrix1, Matrix& matrix2, Matrix& result);
-	static Matrix Multiply(Matrix& matrix1, float scaleFactor);
-	static void Multiply(Matrix& matrix1, float scaleFactor, Matrix& result);
-	static float* ToFloatArray(Matrix& matrix);
-	static Matrix Negate(Matrix& matrix);
-	static void Negate(Matrix& matrix, Matrix& result);
-	static Matrix Subtract(Matrix& matrix1, Matrix& matrix2);
-	static void Subtract(Matrix& matrix1, Matrix& matrix2, Matrix& result);
-
-	static Matrix Transpose(Matrix& matrix);
-	static void Transpose(Matrix& matrix, Matrix& result);
+	static void CreateScale(const Vector3& scales, Matrix& result) noexcept;
+	static constexpr Matrix CreateTranslation(float xPosition, float yPosition, float zPosition) noexcept;
+	static void CreateTranslation(const Vector3& position, Matrix& result) noexcept;
+	static Matrix CreateTranslation(const Vector3& position) noexcept;
+	static void CreateTranslation(float xPosition, float yPosition, float zPosition, Matrix& result) noexcept;
+	static Matrix CreateWorld(const Vector3& position, const Vector3& forward, const Vector3& up) noexcept;
+	static void CreateWorld(const Vector3& position, const Vector3& forward, const Vector3& up, Matrix& result) noexcept;
+	bool Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const noexcept;
+	static void DecomposeBatch(const Matrix* sourceArray, Vector3* scaleArray, Quaternion* rotationArray, Vector3* translationArray, bool* successArray, int length) noexcept;
+	float Determinant() const noexcept;
+	static Matrix Add(const Matrix& matrix1, const Matrix& matrix2) noexcept;
+	static void Add(const Matrix& matrix1, const Matrix& matrix2, Matrix& result) noexcept;
+	static void AddBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length) noexcept;
+	static Matrix Divide(const Matrix& matrix1, const Matrix& matrix2) noexcept;
+	static void Divide(const Matrix& matrix1, const Matrix& matrix2, Matrix& result) noexcept;
+	static Matrix Divide(const Matrix& matrix1, float divider) noexcept;
+	static void Divide(const Matrix& matrix1, float divider, Matrix& result) noexcept;
+	static Matrix Invert(const Matrix& matrix) noexcept;
+	static void Invert(const Matrix& matrix, Matrix& result) noexcept;
+	static void InvertBatch(const Matrix* sourceArray, Matrix* destinationArray, int length, bool* singularArray, bool detectRigid) noexcept;
+	static Matrix Lerp(const Matrix& matrix1, const Matrix& matrix2, float amount) noexcept;
+	static void Lerp(const Matrix& matrix1, const Matrix& matrix2, float amount, Matrix& result) noexcept;
+	static void LerpBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length) noexcept;
+	static Matrix Multiply(const Matrix& matrix1, const Matrix& matrix2) noexcept;
+	static void Multiply(const Matrix& matrix1, const Matrix& matrix2, Matrix& result) noexcept;
+	static Matrix Multiply(const Matrix& matrix1, float scaleFactor) noexcept;
+	static void Multiply(const Matrix& matrix1, float scaleFactor, Matrix& result) noexcept;
+	static void MultiplyBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length) noexcept;
+	static void MultiplyBatch(const Matrix& matrix1, const Matrix* matrix2Array, Matrix* resultArray, int length) noexcept;
+	static void MultiplyBatch(const Matrix* matrix1Array, const Matrix& matrix2, Matrix* resultArray, int length) noexcept;
+	static void MultiplyBatch(const Matrix* matrix1Array, float scaleFactor, Matrix* resultArray, int length) noexcept;
+	static void ToFloatArray(const Matrix& matrix, float* destination) noexcept;
+	static void WriteBatch(const Matrix* sourceArray, float* destination, int length, MatrixLayout layout) noexcept;
+	static Matrix Negate(const Matrix& matrix) noexcept;
+	static void Negate(const Matrix& matrix, Matrix& result) noexcept;
+	static void NegateBatch(const Matrix* sourceArray, Matrix* resultArray, int length) noexcept;
+	static Matrix Subtract(const Matrix& matrix1, const Matrix& matrix2) noexcept;
+	static void Subtract(const Matrix& matrix1, const Matrix& matrix2, Matrix& result) noexcept;
+	static void SubtractBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length) noexcept;
+
+	static Matrix Transpose(const Matrix& matrix) noexcept;
+	static void Transpose(const Matrix& matrix, Matrix& result) noexcept;
+	static void TransposeBatch(const Matrix* sourceArray, Matrix* resultArray, int length) noexcept;
 
 	// Matrix addition
-	friend Matrix operator+(const Matrix& matrix1, const Matrix& matrix2);
+	friend Matrix operator+(const Matrix& matrix1, const Matrix& matrix2) noexcept;
 	// Matrix division by another matrix
-	friend Matrix operator/(const Matrix& matrix1, const Matrix& matrix2);
+	friend Matrix operator/(const Matrix& matrix1, const Matrix& matrix2) noexcept;
 	// Matrix division by a scalar
-	friend Matrix operator/(const Matrix& matrix, float divider);
+	friend Matrix operator/(const Matrix& matrix, float divider) noexcept;
 	// Matrix equality comparison
-	friend bool operator==(const Matrix& matrix1, const Matrix& matrix2);
+	friend bool operator==(const Matrix& matrix1, const Matrix& matrix2) noexcept;
 	// Matrix inequality comparison
-	friend bool operator!=(const Matrix& matrix1, const Matrix& matrix2);
+	friend bool operator!=(const Matrix& matrix1, const Matrix& matrix2) noexcept;
 	// Matrix multiplication
-	friend Matrix operator*(const Matrix& matrix1, const Matrix& matrix2);
+	friend Matrix operator*(const Matrix& matrix1, const Matrix& matrix2) noexcept;
 	// Matrix multiplication by a scalar
-	friend Matrix operator*(const Matrix& matrix, float scaleFactor);
+	friend Matrix operator*(const Matrix& matrix, float scaleFactor) noexcept;
 	// Matrix subtraction
-	friend Matrix operator-(const Matrix& matrix1, const Matrix& matrix2);
+	friend Matrix operator-(const Matrix& matrix1, const Matrix& matrix2) noexcept;
 	// Matrix negation
-	friend Matrix operator-(const Matrix& matrix);
+	friend Matrix operator-(const Matrix& matrix) noexcept;
 
 private:
 
-	static void FindDeterminants(Matrix& matrix, float& major, float& minor1, float& minor2, float& minor3, float& minor4, float& minor5, float& minor6,
-		float& minor7, float& minor8, float& minor9, float& minor10, float& minor11, float& minor12);
-};
\ No newline at end of file
+	static void FindDeterminants(const Matrix& matrix, float& major, float& minor1, float& minor2, float& minor3, float& minor4, float& minor5, float& minor6,
+		float& minor7, float& minor8, float& minor9, float& minor10, float& minor11, float& minor12) noexcept;
+};
+
+inline constexpr Matrix Matrix::identity(
+	1.0f, 0.0f, 0.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 0.0f, 0.0f, 1.0f);
+
+// The backward vector formed from the third row M31, M32, M33 elements.
+inline Vector3 Matrix::Backward() const noexcept {
+	return Vector3(M31, M32, M33);
+}
+
+inline void Matrix::Backward(const Vector3& value) noexcept {
+	M31 = value.X;
+	M32 = value.Y;
+	M33 = value.Z;
+}
+
+// The down vector formed from the second row -M21, -M22, -M23 elements.
+inline Vector3 Matrix::Down() const noexcept {
+	return Vector3(-M21, -M22, -M23);
+}
+
+inline void Matrix::Down(const Vector3& value) noexcept {
+	M21 = -value.X;
+	M22 = -value.Y;
+	M23 = -value.Z;
+}
+
+// The forward vector formed from the third row -M31, -M32, -M33 elements.
+inline Vector3 Matrix::Forward() const noexcept {
+	return Vector3(-M31, -M32, -M33);
+}
+
+inline void Matrix::Forward(const Vector3& value) noexcept {
+	M31 = -value.X;
+	M32 = -value.Y;
+	M33 = -value.Z;
+}
+
+// The left vector formed from the first row -M11, -M12, -M13 elements.
+inline Vector3 Matrix::Left() const noexcept {
+	return Vector3(-M11, -M12, -M13);
+}
+
+inline void Matrix::Left(const Vector3& value) noexcept {
+	M11 = -value.X;
+	M12 = -value.Y;
+	M13 = -value.Z;
+}
+
+// The right vector formed from the first row M11, M12, M13 elements.
+inline Vector3 Matrix::Right() const noexcept {
+	return Vector3(M11, M12, M13);
+}
+
+inline void Matrix::Right(const Vector3& value) noexcept {
+	M11 = value.X;
+	M12 = value.Y;
+	M13 = value.Z;
+}
+
+// Position stored in this matrix.
+inline Vector3 Matrix::Translation() const noexcept {
+	return Vector3(M41, M42, M43);
+}
+
+inline void Matrix::Translation(const Vector3& value) noexcept {
+	M41 = value.X;
+	M42 = value.Y;
+	M43 = value.Z;
+}
+
+// The upper vector formed from the second row M21, M22, M23 elements.
+inline Vector3 Matrix::Up() const noexcept {
+	return Vector3(M21, M22, M23);
+}
+
+inline void Matrix::Up(const Vector3& value) noexcept {
+	M21 = value.X;
+	M22 = value.Y;
+	M23 = value.Z;
+}
+
+constexpr Matrix Matrix::Identity() noexcept {
+	return identity;
+}
+
+/// <summary>
+/// Creates a new scaling <see cref="Matrix"/>.
+/// </summary>
+/// <param name="scale">Scale value for all three axises.</param>
+/// <returns>The scaling <see cref="Matrix"/>.</returns>
+constexpr Matrix Matrix::CreateScale(float scale) noexcept
+{
+	return CreateScale(scale, scale, scale);
+}
+
+/// <summary>
+/// Creates a new scaling <see cref="Matrix"/>.
+/// </summary>
+/// <param name="xScale">Scale value for X axis.</param>
+/// <param name="yScale">Scale value for Y axis.</param>
+/// <param name="zScale">Scale value for Z axis.</param>
+/// <returns>The scaling <see cref="Matrix"/>.</returns>
+constexpr Matrix Matrix::CreateScale(float xScale, float yScale, float zScale) noexcept
+{
+	return Matrix(
+		xScale, 0, 0, 0,
+		0, yScale, 0, 0,
+		0, 0, zScale, 0,
+		0, 0, 0, 1);
+}
+
+/// <summary>
+/// Creates a new translation <see cref="Matrix"/>.
+/// </summary>
+/// <param name="xPosition">X coordinate of translation.</param>
+/// <param name="yPosition">Y coordinate of translation.</param>
+/// <param name="zPosition">Z coordinate of translation.</param>
+/// <returns>The translation <see cref="Matrix"/>.</returns>
+constexpr Matrix Matrix::CreateTranslation(float xPosition, float yPosition, float zPosition) noexcept
+{
+	return Matrix(
+		1, 0, 0, 0,
+		0, 1, 0, 0,
+		0, 0, 1, 0,
+		xPosition, yPosition, zPosition, 1);
+}
+
+// Single-vector transforms are defined here, where both Vector3 and Matrix are complete.
+
+/// <summary>
+/// Creates a new <see cref="Vector3"/> that contains a transformation of 3d-vector by the specified <see cref="Matrix"/>.
+/// </summary>
+/// <param name="position">Source <see cref="Vector3"/>.</param>
+/// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
+/// <returns>Transformed <see cref="Vector3"/>.</returns>
+inline Vector3 Vector3::Transform(const Vector3& position, const Matrix& matrix) noexcept
+{
+	Vector3 result;
+	Transform(position, matrix, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector3"/> that contains a transformation of 3d-vector by the specified <see cref="Matrix"/>.
+/// </summary>
+/// <param name="position">Source <see cref="Vector3"/>.</param>
+/// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
+/// <param name="result">Transformed <see cref="Vector3"/> as an output parameter.</param>
+inline void Vector3::Transform(const Vector3& position, const Matrix& matrix, Vector3& result) noexcept
+{
+	auto x = (position.X * matrix.M11) + (position.Y * matrix.M21) + (position.Z * matrix.M31) + matrix.M41;
+	auto y = (position.X * matrix.M12) + (position.Y * matrix.M22) + (position.Z * matrix.M32) + matrix.M42;
+	auto z = (position.X * matrix.M13) + (position.Y * matrix.M23) + (position.Z * matrix.M33) + matrix.M43;
+	result.X = x;
+	result.Y = y;
+	result.Z = z;
+}
+
+inline Vector3A Vector3A::Transform(const Vector3A& position, const Matrix& matrix) noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto p = position.ToRegister();
+	auto result = _mm_add_ps(_mm_mul_ps(AlignedVectorHelper::Splat<0>(p), _mm_loadu_ps(&matrix.M11)), _mm_mul_ps(AlignedVectorHelper::Splat<1>(p), _mm_loadu_ps(&matrix.M21)));
+	result = _mm_add_ps(_mm_add_ps(result, _mm_mul_ps(AlignedVectorHelper::Splat<2>(p), _mm_loadu_ps(&matrix.M31))), _mm_loadu_ps(&matrix.M41));
+	return Vector3A(AlignedVectorHelper::WithW(result, _mm_setzero_ps()));
+#else
+	Vector3 result;
+	Vector3::Transform(position.ToVector3(), matrix, result);
+	return Vector3A(result);
+#endif
+}
+
+// Rotates and scales a direction by the matrix, ignoring its translation.
+inline Vector3A Vector3A::TransformNormal(const Vector3A& normal, const Matrix& matrix) noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto n = normal.ToRegister();
+	auto result = _mm_add_ps(_mm_mul_ps(AlignedVectorHelper::Splat<0>(n), _mm_loadu_ps(&matrix.M11)), _mm_mul_ps(AlignedVectorHelper::Splat<1>(n), _mm_loadu_ps(&matrix.M21)));
+	result = _mm_add_ps(result, _mm_mul_ps(AlignedVectorHelper::Splat<2>(n), _mm_loadu_ps(&matrix.M31)));
+	return Vector3A(AlignedVectorHelper::WithW(result, _mm_setzero_ps()));
+#else
+	return Vector3A(
+		(normal.X * matrix.M11) + (normal.Y * matrix.M21) + (normal.Z * matrix.M31),
+		(normal.X * matrix.M12) + (normal.Y * matrix.M22) + (normal.Z * matrix.M32),
+		(normal.X * matrix.M13) + (normal.Y * matrix.M23) + (normal.Z * matrix.M33));
+#endif
+}
+
+inline Vector4A Vector4A::Transform(const Vector4A& value, const Matrix& matrix) noexcept
+{
+#if defined(PLUSGAME_X86)
+	auto v = value.ToRegister();
+	auto result = _mm_add_ps(_mm_mul_ps(AlignedVectorHelper::Splat<0>(v), _mm_loadu_ps(&matrix.M11)), _mm_mul_ps(AlignedVectorHelper::Splat<1>(v), _mm_loadu_ps(&matrix.M21)));
+	result = _mm_add_ps(_mm_add_ps(result, _mm_mul_ps(AlignedVectorHelper::Splat<2>(v), _mm_loadu_ps(&matrix.M31))), _mm_mul_ps(AlignedVectorHelper::Splat<3>(v), _mm_loadu_ps(&matrix.M41)));
+	return Vector4A(result);
+#else
+	return Vector4A(
+		(value.X * matrix.M11) + (value.Y * matrix.M21) + (value.Z * matrix.M31) + (value.W * matrix.M41),
+		(value.X * matrix.M12) + (value.Y * matrix.M22) + (value.Z * matrix.M32) + (value.W * matrix.M42),
+		(value.X * matrix.M13) + (value.Y * matrix.M23) + (value.Z * matrix.M33) + (value.W * matrix.M43),
+		(value.X * matrix.M14) + (value.Y * matrix.M24) + (value.Z * matrix.M34) + (value.W * matrix.M44));
+#endif
+}
+
+template<typename Trig>
+inline Matrix Matrix::CreateFromAxisAngle(const Vector3& axis, float angle) noexcept
+{
+	Matrix result;
+	CreateFromAxisAngle<Trig>(axis, angle, result);
+	return result;
+}
+
+template<typename Trig>
+inline void Matrix::CreateFromAxisAngle(const Vector3& axis, float angle, Matrix& result) noexcept
+{
+	float x = axis.X;
+	float y = axis.Y;
+	float z = axis.Z;
+	float num2, num;
+	Trig::SinCos(angle, num2, num);
+	float num11 = x * x;
+	float num10 = y * y;
+	float num9 = z * z;
+	float num8 = x * y;
+	float num7 = x * z;
+	float num6 = y * z;
+	result.M11 = num11 + (num * (1.0f - num11));
+	result.M12 = (num8 - (num * num8)) + (num2 * z);
+	result.M13 = (num7 - (num * num7)) - (num2 * y);
+	result.M14 = 0;
+	result.M21 = (num8 - (num * num8)) - (num2 * z);
+	result.M22 = num10 + (num * (1.0f - num10));
+	result.M23 = (num6 - (num * num6)) + (num2 * x);
+	result.M24 = 0;
+	result.M31 = (num7 - (num * num7)) + (num2 * y);
+	result.M32 = (num6 - (num * num6)) - (num2 * x);
+	result.M33 = num9 + (num * (1.0f - num9));
+	result.M34 = 0;
+	result.M41 = 0;
+	result.M42 = 0;
+	result.M43 = 0;
+	result.M44 = 1;
+}
+
+template<typename Trig>
+inline Matrix Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept
+{
+	Matrix result;
+	CreateFromYawPitchRoll<Trig>(yaw, pitch, roll, result);
+	return result;
+}
+
+template<typename Trig>
+inline void Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll, Matrix& result) noexcept
+{
+	Quaternion quaternion;
+	Quaternion::CreateFromYawPitchRoll<Trig>(yaw, pitch, roll, quaternion);
+	CreateFromQuaternion(quaternion, result);
+}
+
+template<typename Trig>
+inline Matrix Matrix::CreateRotationX(float radians) noexcept
+{
+	Matrix result;
+	CreateRotationX<Trig>(radians, result);
+	return result;
+}
+
+template<typename Trig>
+inline void Matrix::CreateRotationX(float radians, Matrix& result) noexcept
+{
+	result = Matrix::Identity();
+
+	float val2, val1;
+	Trig::SinCos(radians, val2, val1);
+
+	result.M22 = val1;
+	result.M23 = val2;
+	result.M32 = -val2;
+	result.M33 = val1;
+}
+
+template<typename Trig>
+inline Matrix Matrix::CreateRotationY(float radians) noexcept
+{
+	Matrix result;
+	CreateRotationY<Trig>(radians, result);
+	return result;
+}
+
+template<typename Trig>
+inline void Matrix::CreateRotationY(float radians, Matrix& result) noexcept
+{
+	result = Matrix::Identity();
+
+	float val2, val1;
+	Trig::SinCos(radians, val2, val1);
+
+	result.M11 = val1;
+	result.M13 = -val2;
+	result.M31 = val2;
+	result.M33 = val1;
+}
+
+template<typename Trig>
+inline Matrix Matrix::CreateRotationZ(float radians) noexcept
+{
+	Matrix result;
+	CreateRotationZ<Trig>(radians, result);
+	return result;
+}
+
+template<typename Trig>
+inline void Matrix::CreateRotationZ(float radians, Matrix& result) noexcept
+{
+	result = Matrix::Identity();
+
+	float val2, val1;
+	Trig::SinCos(radians, val2, val1);
+
+	result.M11 = val1;
+	result.M12 = val2;
+	result.M21 = -val2;
+	result.M22 = val1;
+}
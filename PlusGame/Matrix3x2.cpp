@@ -0,0 +1,292 @@
+#include "Matrix3x2.h"
+
+// Constructs a 2D matrix from the X and Y rows and columns of a matrix and its translation.
+Matrix3x2::Matrix3x2(const Matrix& matrix) noexcept :
+	M11(matrix.M11), M12(matrix.M12),
+	M21(matrix.M21), M22(matrix.M22),
+	M31(matrix.M41), M32(matrix.M42)
+{
+}
+
+// The translation vector formed from the third row M31, M32 elements.
+Vector2 Matrix3x2::Translation() const noexcept {
+	return Vector2(M31, M32);
+}
+
+void Matrix3x2::Translation(const Vector2& value) noexcept {
+	M31 = value.X;
+	M32 = value.Y;
+}
+
+/// <summary>
+/// Expands this 2D matrix to a full <see cref="Matrix"/> that leaves Z and W unchanged.
+/// </summary>
+/// <returns>The equivalent <see cref="Matrix"/>.</returns>
+Matrix Matrix3x2::ToMatrix() const noexcept
+{
+	Matrix result;
+	ToMatrix(*this, result);
+	return result;
+}
+
+/// <summary>
+/// Expands a 2D matrix to a full <see cref="Matrix"/> that leaves Z and W unchanged.
+/// </summary>
+/// <param name="matrix">Source <see cref="Matrix3x2"/>.</param>
+/// <param name="result">The equivalent <see cref="Matrix"/> as an output parameter.</param>
+void Matrix3x2::ToMatrix(const Matrix3x2& matrix, Matrix& result) noexcept
+{
+	result.M11 = matrix.M11;
+	result.M12 = matrix.M12;
+	result.M13 = 0.0f;
+	result.M14 = 0.0f;
+	result.M21 = matrix.M21;
+	result.M22 = matrix.M22;
+	result.M23 = 0.0f;
+	result.M24 = 0.0f;
+	result.M31 = 0.0f;
+	result.M32 = 0.0f;
+	result.M33 = 1.0f;
+	result.M34 = 0.0f;
+	result.M41 = matrix.M31;
+	result.M42 = matrix.M32;
+	result.M43 = 0.0f;
+	result.M44 = 1.0f;
+}
+
+/// <summary>
+/// Returns the determinant of this <see cref="Matrix3x2"/>, which is the determinant of its 2x2 linear part.
+/// </summary>
+/// <returns>Determinant of this <see cref="Matrix3x2"/>.</returns>
+float Matrix3x2::Determinant() const noexcept
+{
+	return (M11 * M22) - (M12 * M21);
+}
+
+/// <summary>
+/// Creates a new translation <see cref="Matrix3x2"/>.
+/// </summary>
+/// <param name="position">X and Y coordinates of translation.</param>
+/// <returns>The translation <see cref="Matrix3x2"/>.</returns>
+Matrix3x2 Matrix3x2::CreateTranslation(const Vector2& position) noexcept
+{
+	Matrix3x2 result;
+	CreateTranslation(position, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new translation <see cref="Matrix3x2"/>.
+/// </summary>
+/// <param name="position">X and Y coordinates of translation.</param>
+/// <param name="result">The translation <see cref="Matrix3x2"/> as an output parameter.</param>
+void Matrix3x2::CreateTranslation(const Vector2& position, Matrix3x2& result) noexcept
+{
+	result = identity;
+	result.M31 = position.X;
+	result.M32 = position.Y;
+}
+
+/// <summary>
+/// Creates a new scaling <see cref="Matrix3x2"/>.
+/// </summary>
+/// <param name="scale">Scale value for both axes.</param>
+/// <returns>The scaling <see cref="Matrix3x2"/>.</returns>
+Matrix3x2 Matrix3x2::CreateScale(float scale) noexcept
+{
+	Matrix3x2 result;
+	CreateScale(scale, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new scaling <see cref="Matrix3x2"/>.
+/// </summary>
+/// <param name="scale">Scale value for both axes.</param>
+/// <param name="result">The scaling <see cref="Matrix3x2"/> as an output parameter.</param>
+void Matrix3x2::CreateScale(float scale, Matrix3x2& result) noexcept
+{
+	CreateScale(Vector2(scale, scale), result);
+}
+
+/// <summary>
+/// Creates a new scaling <see cref="Matrix3x2"/>.
+/// </summary>
+/// <param name="scales"><see cref="Vector2"/> representing x and y scale values.</param>
+/// <returns>The scaling <see cref="Matrix3x2"/>.</returns>
+Matrix3x2 Matrix3x2::CreateScale(const Vector2& scales) noexcept
+{
+	Matrix3x2 result;
+	CreateScale(scales, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new scaling <see cref="Matrix3x2"/>.
+/// </summary>
+/// <param name="scales"><see cref="Vector2"/> representing x and y scale values.</param>
+/// <param name="result">The scaling <see cref="Matrix3x2"/> as an output parameter.</param>
+void Matrix3x2::CreateScale(const Vector2& scales, Matrix3x2& result) noexcept
+{
+	result = identity;
+	result.M11 = scales.X;
+	result.M22 = scales.Y;
+}
+
+/// <summary>
+/// Creates a new rotation <see cref="Matrix3x2"/>, with the elements of <see cref="Matrix.CreateRotationZ"/>.
+/// </summary>
+/// <param name="radians">Angle in radians.</param>
+/// <returns>The rotation <see cref="Matrix3x2"/>.</returns>
+Matrix3x2 Matrix3x2::CreateRotation(float radians) noexcept
+{
+	Matrix3x2 result;
+	CreateRotation(radians, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new rotation <see cref="Matrix3x2"/>, with the elements of <see cref="Matrix.CreateRotationZ"/>.
+/// </summary>
+/// <param name="radians">Angle in radians.</param>
+/// <param name="result">The rotation <see cref="Matrix3x2"/> as an output parameter.</param>
+void Matrix3x2::CreateRotation(float radians, Matrix3x2& result) noexcept
+{
+	auto val1 = std::cos(radians);
+	auto val2 = std::sin(radians);
+
+	result = identity;
+	result.M11 = val1;
+	result.M12 = val2;
+	result.M21 = -val2;
+	result.M22 = val1;
+}
+
+/// <summary>
+/// Creates a new <see cref="Matrix3x2"/> from a scale, a rotation and a translation.
+/// </summary>
+/// <param name="scale">Scale along each axis.</param>
+/// <param name="rotation">Angle of rotation in radians.</param>
+/// <param name="translation">Position of the origin.</param>
+/// <returns>The world <see cref="Matrix3x2"/>.</returns>
+Matrix3x2 Matrix3x2::CreateFromTRS(const Vector2& scale, float rotation, const Vector2& translation) noexcept
+{
+	Matrix3x2 result;
+	CreateFromTRS(scale, rotation, translation, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="Matrix3x2"/> from a scale, a rotation and a translation.
+/// The product of the scale, rotation and translation matrices is written directly.
+/// </summary>
+/// <param name="scale">Scale along each axis.</param>
+/// <param name="rotation">Angle of rotation in radians.</param>
+/// <param name="translation">Position of the origin.</param>
+/// <param name="result">The world <see cref="Matrix3x2"/> as an output parameter.</param>
+void Matrix3x2::CreateFromTRS(const Vector2& scale, float rotation, const Vector2& translation, Matrix3x2& result) noexcept
+{
+	auto cos = std::cos(rotation);
+	auto sin = std::sin(rotation);
+
+	result.M11 = cos * scale.X;
+	result.M12 = sin * scale.X;
+	result.M21 = -sin * scale.Y;
+	result.M22 = cos * scale.Y;
+	result.M31 = translation.X;
+	result.M32 = translation.Y;
+}
+
+/// <summary>
+/// Creates a new <see cref="Matrix3x2"/> that contains a multiplication of two 2D matrices.
+/// </summary>
+/// <param name="matrix1">Source <see cref="Matrix3x2"/>.</param>
+/// <param name="matrix2">Source <see cref="Matrix3x2"/>.</param>
+/// <returns>Result of the matrix multiplication.</returns>
+Matrix3x2 Matrix3x2::Multiply(const Matrix3x2& matrix1, const Matrix3x2& matrix2) noexcept
+{
+	Matrix3x2 result;
+	Multiply(matrix1, matrix2, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="Matrix3x2"/> that contains a multiplication of two 2D matrices.
+/// Applying the result is applying <paramref name="matrix1"/> and then <paramref name="matrix2"/>.
+/// </summary>
+/// <param name="matrix1">Source <see cref="Matrix3x2"/>.</param>
+/// <param name="matrix2">Source <see cref="Matrix3x2"/>.</param>
+/// <param name="result">Result of the matrix multiplication as an output parameter.</param>
+void Matrix3x2::Multiply(const Matrix3x2& matrix1, const Matrix3x2& matrix2, Matrix3x2& result) noexcept
+{
+	auto m11 = (matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21);
+	auto m12 = (matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22);
+	auto m21 = (matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21);
+	auto m22 = (matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22);
+	auto m31 = ((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + matrix2.M31;
+	auto m32 = ((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + matrix2.M32;
+	result.M11 = m11;
+	result.M12 = m12;
+	result.M21 = m21;
+	result.M22 = m22;
+	result.M31 = m31;
+	result.M32 = m32;
+}
+
+/// <summary>
+/// Creates a new <see cref="Matrix3x2"/> which contains inversion of the specified 2D matrix.
+/// </summary>
+/// <param name="matrix">Source <see cref="Matrix3x2"/>.</param>
+/// <returns>The inverted matrix.</returns>
+Matrix3x2 Matrix3x2::Invert(const Matrix3x2& matrix) noexcept
+{
+	Matrix3x2 result;
+	Invert(matrix, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="Matrix3x2"/> which contains inversion of the specified 2D matrix.
+/// A singular matrix produces infinite or NaN elements, as with <see cref="Matrix.Invert"/>.
+/// </summary>
+/// <param name="matrix">Source <see cref="Matrix3x2"/>.</param>
+/// <param name="result">The inverted matrix as output parameter.</param>
+void Matrix3x2::Invert(const Matrix3x2& matrix, Matrix3x2& result) noexcept
+{
+	float invDet = 1.0f / ((matrix.M11 * matrix.M22) - (matrix.M12 * matrix.M21));
+
+	float m11 = matrix.M22 * invDet;
+	float m12 = -matrix.M12 * invDet;
+	float m21 = -matrix.M21 * invDet;
+	float m22 = matrix.M11 * invDet;
+	float x = matrix.M31;
+	float y = matrix.M32;
+
+	result.M11 = m11;
+	result.M12 = m12;
+	result.M21 = m21;
+	result.M22 = m22;
+	result.M31 = -((x * m11) + (y * m21));
+	result.M32 = -((x * m12) + (y * m22));
+}
+
+// 2D matrix multiplication
+Matrix3x2 operator*(const Matrix3x2& matrix1, const Matrix3x2& matrix2) noexcept {
+	Matrix3x2 result;
+	Matrix3x2::Multiply(matrix1, matrix2, result);
+	return result;
+}
+
+// 2D matrix equality comparison
+bool operator==(const Matrix3x2& matrix1, const Matrix3x2& matrix2) noexcept {
+	return (
+		matrix1.M11 == matrix2.M11 && matrix1.M12 == matrix2.M12 &&
+		matrix1.M21 == matrix2.M21 && matrix1.M22 == matrix2.M22 &&
+		matrix1.M31 == matrix2.M31 && matrix1.M32 == matrix2.M32
+		);
+}
+
+// 2D matrix inequality comparison
+bool operator!=(const Matrix3x2& matrix1, const Matrix3x2& matrix2) noexcept {
+	return !operator==(matrix1, matrix2);
+}
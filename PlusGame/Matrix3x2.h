@@ -0,0 +1,76 @@
+#pragma once
+#include "Vector2.h"
+#include "Matrix.h"
+
+// A 2D affine transform: the rows and columns of a Matrix that act on X and Y (24 bytes).
+// M11-M22 hold the linear part and M31, M32 the translation, with the same row-vector
+// convention as Matrix, so sprite and UI transforms skip the 4x4 arithmetic entirely.
+class Matrix3x2
+{
+public:
+	float M11, M12;
+	float M21, M22;
+	float M31, M32;
+
+	static const Matrix3x2 identity;
+
+	constexpr Matrix3x2(
+		float m11, float m12,
+		float m21, float m22,
+		float m31, float m32
+	) noexcept :
+		M11(m11), M12(m12),
+		M21(m21), M22(m22),
+		M31(m31), M32(m32) {}
+
+	// Keeps the X and Y rows and columns of the matrix and its X and Y translation.
+	explicit Matrix3x2(const Matrix& matrix) noexcept;
+
+	constexpr Matrix3x2() noexcept :
+		M11(0), M12(0),
+		M21(0), M22(0),
+		M31(0), M32(0) {}
+
+public:
+	Vector2 Translation() const noexcept;
+	void Translation(const Vector2& value) noexcept;
+	static constexpr Matrix3x2 Identity() noexcept;
+
+	Matrix ToMatrix() const noexcept;
+	static void ToMatrix(const Matrix3x2& matrix, Matrix& result) noexcept;
+
+	float Determinant() const noexcept;
+
+	static Matrix3x2 CreateTranslation(const Vector2& position) noexcept;
+	static void CreateTranslation(const Vector2& position, Matrix3x2& result) noexcept;
+	static Matrix3x2 CreateScale(float scale) noexcept;
+	static void CreateScale(float scale, Matrix3x2& result) noexcept;
+	static Matrix3x2 CreateScale(const Vector2& scales) noexcept;
+	static void CreateScale(const Vector2& scales, Matrix3x2& result) noexcept;
+	static Matrix3x2 CreateRotation(float radians) noexcept;
+	static void CreateRotation(float radians, Matrix3x2& result) noexcept;
+	// Scale, then rotation, then translation, as for a sprite.
+	static Matrix3x2 CreateFromTRS(const Vector2& scale, float rotation, const Vector2& translation) noexcept;
+	static void CreateFromTRS(const Vector2& scale, float rotation, const Vector2& translation, Matrix3x2& result) noexcept;
+
+	static Matrix3x2 Multiply(const Matrix3x2& matrix1, const Matrix3x2& matrix2) noexcept;
+	static void Multiply(const Matrix3x2& matrix1, const Matrix3x2& matrix2, Matrix3x2& result) noexcept;
+	static Matrix3x2 Invert(const Matrix3x2& matrix) noexcept;
+	static void Invert(const Matrix3x2& matrix, Matrix3x2& result) noexcept;
+
+	// 2D matrix multiplication
+	friend Matrix3x2 operator*(const Matrix3x2& matrix1, const Matrix3x2& matrix2) noexcept;
+	// 2D matrix equality comparison
+	friend bool operator==(const Matrix3x2& matrix1, const Matrix3x2& matrix2) noexcept;
+	// 2D matrix inequality comparison
+	friend bool operator!=(const Matrix3x2& matrix1, const Matrix3x2& matrix2) noexcept;
+};
+
+inline constexpr Matrix3x2 Matrix3x2::identity(
+	1.0f, 0.0f,
+	0.0f, 1.0f,
+	0.0f, 0.0f);
+
+constexpr Matrix3x2 Matrix3x2::Identity() noexcept {
+	return identity;
+}
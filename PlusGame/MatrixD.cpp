@@ -0,0 +1,382 @@
+#include "MatrixD.h"
+#include "MatrixSimd.h"
+
+/// <summary>
+/// Converts this <see cref="MatrixD"/> to a single-precision <see cref="Matrix"/>.
+/// </summary>
+/// <returns>The rounded <see cref="Matrix"/>.</returns>
+Matrix MatrixD::ToMatrix() const noexcept
+{
+	return ToRelativeMatrix(Vector3D::Zero);
+}
+
+/// <summary>
+/// Converts every <see cref="MatrixD"/> of an array to a single-precision <see cref="Matrix"/> relative to an origin,
+/// usually the camera position, with the fastest kernel available on this processor.
+/// Each result is identical to <see cref="ToRelativeMatrix"/>.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="MatrixD"/> array.</param>
+/// <param name="origin">Position subtracted from every translation before rounding.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to convert.</param>
+void MatrixD::ToRelativeMatrixBatch(const MatrixD* sourceArray, const Vector3D& origin, Matrix* resultArray, int length) noexcept
+{
+	MatrixSimd::ToRelativeBatch(sourceArray, origin, resultArray, length);
+}
+
+/// <summary>
+/// Creates a new rotation <see cref="MatrixD"/> from a <see cref="Quaternion"/>.
+/// </summary>
+/// <param name="quaternion"><see cref="Quaternion"/> of rotation moment.</param>
+/// <returns>The rotation <see cref="MatrixD"/>.</returns>
+MatrixD MatrixD::CreateFromQuaternion(const Quaternion& quaternion) noexcept
+{
+	MatrixD result;
+	CreateFromQuaternion(quaternion, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new rotation <see cref="MatrixD"/> from a <see cref="Quaternion"/>.
+/// </summary>
+/// <param name="quaternion"><see cref="Quaternion"/> of rotation moment.</param>
+/// <param name="result">The rotation <see cref="MatrixD"/> as an output parameter.</param>
+void MatrixD::CreateFromQuaternion(const Quaternion& quaternion, MatrixD& result) noexcept
+{
+	CreateFromTRS(Vector3::One, quaternion, Vector3D::Zero, result);
+}
+
+/// <summary>
+/// Creates a new world <see cref="MatrixD"/> from a scale, a rotation and a translation.
+/// </summary>
+/// <param name="scale">Scale along each axis.</param>
+/// <param name="rotation"><see cref="Quaternion"/> of rotation moment.</param>
+/// <param name="translation">Position of the origin.</param>
+/// <returns>The world <see cref="MatrixD"/>.</returns>
+MatrixD MatrixD::CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3D& translation) noexcept
+{
+	MatrixD result;
+	CreateFromTRS(scale, rotation, translation, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new world <see cref="MatrixD"/> from a scale, a rotation and a translation.
+/// The rotation is expanded in double precision.
+/// </summary>
+/// <param name="scale">Scale along each axis.</param>
+/// <param name="rotation"><see cref="Quaternion"/> of rotation moment.</param>
+/// <param name="translation">Position of the origin.</param>
+/// <param name="result">The world <see cref="MatrixD"/> as an output parameter.</param>
+void MatrixD::CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3D& translation, MatrixD& result) noexcept
+{
+	double x = rotation.X;
+	double y = rotation.Y;
+	double z = rotation.Z;
+	double w = rotation.W;
+	double num9 = x * x;
+	double num8 = y * y;
+	double num7 = z * z;
+	double num6 = x * y;
+	double num5 = z * w;
+	double num4 = z * x;
+	double num3 = y * w;
+	double num2 = y * z;
+	double num = x * w;
+	result.M11 = (1.0 - (2.0 * (num8 + num7))) * scale.X;
+	result.M12 = (2.0 * (num6 + num5)) * scale.X;
+	result.M13 = (2.0 * (num4 - num3)) * scale.X;
+	result.M14 = 0.0;
+	result.M21 = (2.0 * (num6 - num5)) * scale.Y;
+	result.M22 = (1.0 - (2.0 * (num7 + num9))) * scale.Y;
+	result.M23 = (2.0 * (num2 + num)) * scale.Y;
+	result.M24 = 0.0;
+	result.M31 = (2.0 * (num4 + num3)) * scale.Z;
+	result.M32 = (2.0 * (num2 - num)) * scale.Z;
+	result.M33 = (1.0 - (2.0 * (num8 + num9))) * scale.Z;
+	result.M34 = 0.0;
+	result.M41 = translation.X;
+	result.M42 = translation.Y;
+	result.M43 = translation.Z;
+	result.M44 = 1.0;
+}
+
+/// <summary>
+/// Creates a new <see cref="MatrixD"/> that scales uniformly.
+/// </summary>
+/// <param name="scale">Scale value for all three axes.</param>
+/// <returns>The scaling <see cref="MatrixD"/>.</returns>
+MatrixD MatrixD::CreateScale(double scale) noexcept
+{
+	return CreateScale(Vector3D(scale));
+}
+
+/// <summary>
+/// Creates a new scaling <see cref="MatrixD"/>.
+/// </summary>
+/// <param name="scales"><see cref="Vector3D"/> representing x, y and z scale values.</param>
+/// <returns>The scaling <see cref="MatrixD"/>.</returns>
+MatrixD MatrixD::CreateScale(const Vector3D& scales) noexcept
+{
+	MatrixD result;
+	CreateScale(scales, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new scaling <see cref="MatrixD"/>.
+/// </summary>
+/// <param name="scales"><see cref="Vector3D"/> representing x, y and z scale values.</param>
+/// <param name="result">The scaling <see cref="MatrixD"/> as an output parameter.</param>
+void MatrixD::CreateScale(const Vector3D& scales, MatrixD& result) noexcept
+{
+	result = MatrixD(
+		scales.X, 0, 0, 0,
+		0, scales.Y, 0, 0,
+		0, 0, scales.Z, 0,
+		0, 0, 0, 1);
+}
+
+/// <summary>
+/// Creates a new translation <see cref="MatrixD"/>.
+/// </summary>
+/// <param name="position">X,Y and Z coordinates of translation.</param>
+/// <returns>The translation <see cref="MatrixD"/>.</returns>
+MatrixD MatrixD::CreateTranslation(const Vector3D& position) noexcept
+{
+	MatrixD result;
+	CreateTranslation(position, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new translation <see cref="MatrixD"/>.
+/// </summary>
+/// <param name="position">X,Y and Z coordinates of translation.</param>
+/// <param name="result">The translation <see cref="MatrixD"/> as an output parameter.</param>
+void MatrixD::CreateTranslation(const Vector3D& position, MatrixD& result) noexcept
+{
+	result = identity;
+	result.Translation(position);
+}
+
+/// <summary>
+/// Creates a new world <see cref="MatrixD"/>.
+/// </summary>
+/// <param name="position">The position vector.</param>
+/// <param name="forward">The forward direction vector.</param>
+/// <param name="up">The upward direction vector. Usually <see cref="Vector3D.Up"/>.</param>
+/// <returns>The world <see cref="MatrixD"/>.</returns>
+MatrixD MatrixD::CreateWorld(const Vector3D& position, const Vector3D& forward, const Vector3D& up) noexcept
+{
+	MatrixD result;
+	CreateWorld(position, forward, up, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new world <see cref="MatrixD"/>.
+/// </summary>
+/// <param name="position">The position vector.</param>
+/// <param name="forward">The forward direction vector.</param>
+/// <param name="up">The upward direction vector. Usually <see cref="Vector3D.Up"/>.</param>
+/// <param name="result">The world <see cref="MatrixD"/> as an output parameter.</param>
+void MatrixD::CreateWorld(const Vector3D& position, const Vector3D& forward, const Vector3D& up, MatrixD& result) noexcept
+{
+	Vector3D x, y, z;
+	Vector3D::Normalize(forward, z);
+	Vector3D::Cross(forward, up, x);
+	Vector3D::Cross(x, forward, y);
+	x.Normalize();
+	y.Normalize();
+
+	result = MatrixD(
+		x.X, x.Y, x.Z, 0,
+		y.X, y.Y, y.Z, 0,
+		-z.X, -z.Y, -z.Z, 0,
+		position.X, position.Y, position.Z, 1);
+}
+
+/// <summary>
+/// Returns a determinant of this <see cref="MatrixD"/>.
+/// </summary>
+/// <returns>Determinant of this <see cref="MatrixD"/></returns>
+double MatrixD::Determinant() const noexcept
+{
+	double num18 = (M33 * M44) - (M34 * M43);
+	double num17 = (M32 * M44) - (M34 * M42);
+	double num16 = (M32 * M43) - (M33 * M42);
+	double num15 = (M31 * M44) - (M34 * M41);
+	double num14 = (M31 * M43) - (M33 * M41);
+	double num13 = (M31 * M42) - (M32 * M41);
+	return ((((M11 * (((M22 * num18) - (M23 * num17)) + (M24 * num16))) - (M12 * (((M21 * num18) - (M23 * num15)) + (M24 * num14)))) + (M13 * (((M21 * num17) - (M22 * num15)) + (M24 * num13)))) - (M14 * (((M21 * num16) - (M22 * num14)) + (M23 * num13))));
+}
+
+/// <summary>
+/// Creates a new <see cref="MatrixD"/> which contains inversion of the specified matrix.
+/// </summary>
+/// <param name="matrix">Source <see cref="MatrixD"/>.</param>
+/// <returns>The inverted matrix.</returns>
+MatrixD MatrixD::Invert(const MatrixD& matrix) noexcept
+{
+	MatrixD result;
+	Invert(matrix, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="MatrixD"/> which contains inversion of the specified matrix.
+/// </summary>
+/// <param name="matrix">Source <see cref="MatrixD"/>.</param>
+/// <param name="result">The inverted matrix as output parameter.</param>
+void MatrixD::Invert(const MatrixD& matrix, MatrixD& result) noexcept
+{
+	double num1 = matrix.M11;
+	double num2 = matrix.M12;
+	double num3 = matrix.M13;
+	double num4 = matrix.M14;
+	double num5 = matrix.M21;
+	double num6 = matrix.M22;
+	double num7 = matrix.M23;
+	double num8 = matrix.M24;
+	double num9 = matrix.M31;
+	double num10 = matrix.M32;
+	double num11 = matrix.M33;
+	double num12 = matrix.M34;
+	double num13 = matrix.M41;
+	double num14 = matrix.M42;
+	double num15 = matrix.M43;
+	double num16 = matrix.M44;
+	double num17 = num11 * num16 - num12 * num15;
+	double num18 = num10 * num16 - num12 * num14;
+	double num19 = num10 * num15 - num11 * num14;
+	double num20 = num9 * num16 - num12 * num13;
+	double num21 = num9 * num15 - num11 * num13;
+	double num22 = num9 * num14 - num10 * num13;
+	double num23 = num6 * num17 - num7 * num18 + num8 * num19;
+	double num24 = -(num5 * num17 - num7 * num20 + num8 * num21);
+	double num25 = num5 * num18 - num6 * num20 + num8 * num22;
+	double num26 = -(num5 * num19 - num6 * num21 + num7 * num22);
+	double num27 = 1.0 / (num1 * num23 + num2 * num24 + num3 * num25 + num4 * num26);
+
+	result.M11 = num23 * num27;
+	result.M21 = num24 * num27;
+	result.M31 = num25 * num27;
+	result.M41 = num26 * num27;
+	result.M12 = -(num2 * num17 - num3 * num18 + num4 * num19) * num27;
+	result.M22 = (num1 * num17 - num3 * num20 + num4 * num21) * num27;
+	result.M32 = -(num1 * num18 - num2 * num20 + num4 * num22) * num27;
+	result.M42 = (num1 * num19 - num2 * num21 + num3 * num22) * num27;
+	double num28 = num7 * num16 - num8 * num15;
+	double num29 = num6 * num16 - num8 * num14;
+	double num30 = num6 * num15 - num7 * num14;
+	double num31 = num5 * num16 - num8 * num13;
+	double num32 = num5 * num15 - num7 * num13;
+	double num33 = num5 * num14 - num6 * num13;
+	result.M13 = (num2 * num28 - num3 * num29 + num4 * num30) * num27;
+	result.M23 = -(num1 * num28 - num3 * num31 + num4 * num32) * num27;
+	result.M33 = (num1 * num29 - num2 * num31 + num4 * num33) * num27;
+	result.M43 = -(num1 * num30 - num2 * num32 + num3 * num33) * num27;
+	double num34 = num7 * num12 - num8 * num11;
+	double num35 = num6 * num12 - num8 * num10;
+	double num36 = num6 * num11 - num7 * num10;
+	double num37 = num5 * num12 - num8 * num9;
+	double num38 = num5 * num11 - num7 * num9;
+	double num39 = num5 * num10 - num6 * num9;
+	result.M14 = -(num2 * num34 - num3 * num35 + num4 * num36) * num27;
+	result.M24 = (num1 * num34 - num3 * num37 + num4 * num38) * num27;
+	result.M34 = -(num1 * num35 - num2 * num37 + num4 * num39) * num27;
+	result.M44 = (num1 * num36 - num2 * num38 + num3 * num39) * num27;
+}
+
+/// <summary>
+/// Creates a new <see cref="MatrixD"/> that contains a multiplication of two matrix.
+/// </summary>
+/// <param name="matrix1">Source <see cref="MatrixD"/>.</param>
+/// <param name="matrix2">Source <see cref="MatrixD"/>.</param>
+/// <returns>Result of the matrix multiplication.</returns>
+MatrixD MatrixD::Multiply(const MatrixD& matrix1, const MatrixD& matrix2) noexcept
+{
+	MatrixD result;
+	Multiply(matrix1, matrix2, result);
+	return result;
+}
+
+/// <summary>
+/// Creates a new <see cref="MatrixD"/> that contains a multiplication of two matrix.
+/// </summary>
+/// <param name="matrix1">Source <see cref="MatrixD"/>.</param>
+/// <param name="matrix2">Source <see cref="MatrixD"/>.</param>
+/// <param name="result">Result of the matrix multiplication as an output parameter.</param>
+void MatrixD::Multiply(const MatrixD& matrix1, const MatrixD& matrix2, MatrixD& result) noexcept
+{
+	double m11 = (((matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21)) + (matrix1.M13 * matrix2.M31)) + (matrix1.M14 * matrix2.M41);
+	double m12 = (((matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22)) + (matrix1.M13 * matrix2.M32)) + (matrix1.M14 * matrix2.M42);
+	double m13 = (((matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23)) + (matrix1.M13 * matrix2.M33)) + (matrix1.M14 * matrix2.M43);
+	double m14 = (((matrix1.M11 * matrix2.M14) + (matrix1.M12 * matrix2.M24)) + (matrix1.M13 * matrix2.M34)) + (matrix1.M14 * matrix2.M44);
+	double m21 = (((matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21)) + (matrix1.M23 * matrix2.M31)) + (matrix1.M24 * matrix2.M41);
+	double m22 = (((matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22)) + (matrix1.M23 * matrix2.M32)) + (matrix1.M24 * matrix2.M42);
+	double m23 = (((matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23)) + (matrix1.M23 * matrix2.M33)) + (matrix1.M24 * matrix2.M43);
+	double m24 = (((matrix1.M21 * matrix2.M14) + (matrix1.M22 * matrix2.M24)) + (matrix1.M23 * matrix2.M34)) + (matrix1.M24 * matrix2.M44);
+	double m31 = (((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + (matrix1.M33 * matrix2.M31)) + (matrix1.M34 * matrix2.M41);
+	double m32 = (((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + (matrix1.M33 * matrix2.M32)) + (matrix1.M34 * matrix2.M42);
+	double m33 = (((matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23)) + (matrix1.M33 * matrix2.M33)) + (matrix1.M34 * matrix2.M43);
+	double m34 = (((matrix1.M31 * matrix2.M14) + (matrix1.M32 * matrix2.M24)) + (matrix1.M33 * matrix2.M34)) + (matrix1.M34 * matrix2.M44);
+	double m41 = (((matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21)) + (matrix1.M43 * matrix2.M31)) + (matrix1.M44 * matrix2.M41);
+	double m42 = (((matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22)) + (matrix1.M43 * matrix2.M32)) + (matrix1.M44 * matrix2.M42);
+	double m43 = (((matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23)) + (matrix1.M43 * matrix2.M33)) + (matrix1.M44 * matrix2.M43);
+	double m44 = (((matrix1.M41 * matrix2.M14) + (matrix1.M42 * matrix2.M24)) + (matrix1.M43 * matrix2.M34)) + (matrix1.M44 * matrix2.M44);
+	result = MatrixD(
+		m11, m12, m13, m14,
+		m21, m22, m23, m24,
+		m31, m32, m33, m34,
+		m41, m42, m43, m44);
+}
+
+/// <summary>
+/// Swap the matrix rows and columns.
+/// </summary>
+/// <param name="matrix">The matrix for transposing operation.</param>
+/// <returns>The new <see cref="MatrixD"/> which contains the transposing result.</returns>
+MatrixD MatrixD::Transpose(const MatrixD& matrix) noexcept
+{
+	MatrixD result;
+	Transpose(matrix, result);
+	return result;
+}
+
+/// <summary>
+/// Swap the matrix rows and columns.
+/// </summary>
+/// <param name="matrix">The matrix for transposing operation.</param>
+/// <param name="result">The new <see cref="MatrixD"/> which contains the transposing result as an output parameter.</param>
+void MatrixD::Transpose(const MatrixD& matrix, MatrixD& result) noexcept
+{
+	result = MatrixD(
+		matrix.M11, matrix.M21, matrix.M31, matrix.M41,
+		matrix.M12, matrix.M22, matrix.M32, matrix.M42,
+		matrix.M13, matrix.M23, matrix.M33, matrix.M43,
+		matrix.M14, matrix.M24, matrix.M34, matrix.M44);
+}
+
+// Matrix equality comparison
+bool operator==(const MatrixD& matrix1, const MatrixD& matrix2) noexcept {
+	return (
+		matrix1.M11 == matrix2.M11 && matrix1.M12 == matrix2.M12 && matrix1.M13 == matrix2.M13 && matrix1.M14 == matrix2.M14 &&
+		matrix1.M21 == matrix2.M21 && matrix1.M22 == matrix2.M22 && matrix1.M23 == matrix2.M23 && matrix1.M24 == matrix2.M24 &&
+		matrix1.M31 == matrix2.M31 && matrix1.M32 == matrix2.M32 && matrix1.M33 == matrix2.M33 && matrix1.M34 == matrix2.M34 &&
+		matrix1.M41 == matrix2.M41 && matrix1.M42 == matrix2.M42 && matrix1.M43 == matrix2.M43 && matrix1.M44 == matrix2.M44
+		);
+}
+
+// Matrix inequality comparison
+bool operator!=(const MatrixD& matrix1, const MatrixD& matrix2) noexcept {
+	return !operator==(matrix1, matrix2);
+}
+
+// Matrix multiplication
+MatrixD operator*(const MatrixD& matrix1, const MatrixD& matrix2) noexcept {
+	MatrixD result;
+	MatrixD::Multiply(matrix1, matrix2, result);
+	return result;
+}
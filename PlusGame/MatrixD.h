@@ -0,0 +1,145 @@
+#pragma once
+#include "Vector3D.h"
+#include "Matrix.h"
+
+// Double-precision counterpart of Matrix, with the same row-vector convention, for world
+// transforms of large maps. The matrices are converted to Matrix relative to the camera
+// position with ToRelativeMatrix or ToRelativeMatrixBatch, so that view, projection and
+// everything after them keep running in single precision.
+class MatrixD
+{
+public:
+	double M11, M12, M13, M14;
+	double M21, M22, M23, M24;
+	double M31, M32, M33, M34;
+	double M41, M42, M43, M44;
+
+	static const MatrixD identity;
+
+	constexpr MatrixD(
+		double m11, double m12, double m13, double m14,
+		double m21, double m22, double m23, double m24,
+		double m31, double m32, double m33, double m34,
+		double m41, double m42, double m43, double m44
+	) noexcept :
+		M11(m11), M12(m12), M13(m13), M14(m14),
+		M21(m21), M22(m22), M23(m23), M24(m24),
+		M31(m31), M32(m32), M33(m33), M34(m34),
+		M41(m41), M42(m42), M43(m43), M44(m44) {}
+
+	constexpr explicit MatrixD(const Matrix& matrix) noexcept :
+		M11(matrix.M11), M12(matrix.M12), M13(matrix.M13), M14(matrix.M14),
+		M21(matrix.M21), M22(matrix.M22), M23(matrix.M23), M24(matrix.M24),
+		M31(matrix.M31), M32(matrix.M32), M33(matrix.M33), M34(matrix.M34),
+		M41(matrix.M41), M42(matrix.M42), M43(matrix.M43), M44(matrix.M44) {}
+
+	constexpr MatrixD() noexcept :
+		M11(0), M12(0), M13(0), M14(0),
+		M21(0), M22(0), M23(0), M24(0),
+		M31(0), M32(0), M33(0), M34(0),
+		M41(0), M42(0), M43(0), M44(0) {}
+
+public:
+	Vector3D Translation() const noexcept;
+	void Translation(const Vector3D& value) noexcept;
+	static constexpr MatrixD Identity() noexcept;
+
+	// Conversions to single precision. The relative forms subtract the origin from the
+	// translation before rounding.
+	Matrix ToMatrix() const noexcept;
+	Matrix ToRelativeMatrix(const Vector3D& origin) const noexcept;
+	static void ToRelativeMatrix(const MatrixD& matrix, const Vector3D& origin, Matrix& result) noexcept;
+	static void ToRelativeMatrixBatch(const MatrixD* sourceArray, const Vector3D& origin, Matrix* resultArray, int length) noexcept;
+
+public:
+	static MatrixD CreateFromQuaternion(const Quaternion& quaternion) noexcept;
+	static void CreateFromQuaternion(const Quaternion& quaternion, MatrixD& result) noexcept;
+	static MatrixD CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3D& translation) noexcept;
+	static void CreateFromTRS(const Vector3& scale, const Quaternion& rotation, const Vector3D& translation, MatrixD& result) noexcept;
+	static MatrixD CreateScale(double scale) noexcept;
+	static MatrixD CreateScale(const Vector3D& scales) noexcept;
+	static void CreateScale(const Vector3D& scales, MatrixD& result) noexcept;
+	static MatrixD CreateTranslation(const Vector3D& position) noexcept;
+	static void CreateTranslation(const Vector3D& position, MatrixD& result) noexcept;
+	static MatrixD CreateWorld(const Vector3D& position, const Vector3D& forward, const Vector3D& up) noexcept;
+	static void CreateWorld(const Vector3D& position, const Vector3D& forward, const Vector3D& up, MatrixD& result) noexcept;
+	double Determinant() const noexcept;
+	static MatrixD Invert(const MatrixD& matrix) noexcept;
+	static void Invert(const MatrixD& matrix, MatrixD& result) noexcept;
+	static MatrixD Multiply(const MatrixD& matrix1, const MatrixD& matrix2) noexcept;
+	static void Multiply(const MatrixD& matrix1, const MatrixD& matrix2, MatrixD& result) noexcept;
+	static MatrixD Transpose(const MatrixD& matrix) noexcept;
+	static void Transpose(const MatrixD& matrix, MatrixD& result) noexcept;
+
+	friend bool operator==(const MatrixD& matrix1, const MatrixD& matrix2) noexcept;
+	friend bool operator!=(const MatrixD& matrix1, const MatrixD& matrix2) noexcept;
+	friend MatrixD operator*(const MatrixD& matrix1, const MatrixD& matrix2) noexcept;
+};
+
+// Static member definitions
+inline constexpr MatrixD MatrixD::identity(
+	1.0, 0.0, 0.0, 0.0,
+	0.0, 1.0, 0.0, 0.0,
+	0.0, 0.0, 1.0, 0.0,
+	0.0, 0.0, 0.0, 1.0);
+
+inline constexpr MatrixD MatrixD::Identity() noexcept
+{
+	return identity;
+}
+
+inline Vector3D MatrixD::Translation() const noexcept {
+	return Vector3D(M41, M42, M43);
+}
+
+inline void MatrixD::Translation(const Vector3D& value) noexcept {
+	M41 = value.X;
+	M42 = value.Y;
+	M43 = value.Z;
+}
+
+inline Matrix MatrixD::ToRelativeMatrix(const Vector3D& origin) const noexcept
+{
+	Matrix result;
+	ToRelativeMatrix(*this, origin, result);
+	return result;
+}
+
+inline void MatrixD::ToRelativeMatrix(const MatrixD& matrix, const Vector3D& origin, Matrix& result) noexcept
+{
+	result.M11 = (float)matrix.M11;
+	result.M12 = (float)matrix.M12;
+	result.M13 = (float)matrix.M13;
+	result.M14 = (float)matrix.M14;
+	result.M21 = (float)matrix.M21;
+	result.M22 = (float)matrix.M22;
+	result.M23 = (float)matrix.M23;
+	result.M24 = (float)matrix.M24;
+	result.M31 = (float)matrix.M31;
+	result.M32 = (float)matrix.M32;
+	result.M33 = (float)matrix.M33;
+	result.M34 = (float)matrix.M34;
+	result.M41 = (float)(matrix.M41 - origin.X);
+	result.M42 = (float)(matrix.M42 - origin.Y);
+	result.M43 = (float)(matrix.M43 - origin.Z);
+	result.M44 = (float)matrix.M44;
+}
+
+// Single-vector transforms are defined here, where both Vector3D and MatrixD are complete.
+
+inline Vector3D Vector3D::Transform(const Vector3D& position, const MatrixD& matrix) noexcept
+{
+	Vector3D result;
+	Transform(position, matrix, result);
+	return result;
+}
+
+inline void Vector3D::Transform(const Vector3D& position, const MatrixD& matrix, Vector3D& result) noexcept
+{
+	auto x = (position.X * matrix.M11) + (position.Y * matrix.M21) + (position.Z * matrix.M31) + matrix.M41;
+	auto y = (position.X * matrix.M12) + (position.Y * matrix.M22) + (position.Z * matrix.M32) + matrix.M42;
+	auto z = (position.X * matrix.M13) + (position.Y * matrix.M23) + (position.Z * matrix.M33) + matrix.M43;
+	result.X = x;
+	result.Y = y;
+	result.Z = z;
+}
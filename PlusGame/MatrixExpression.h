@@ -0,0 +1,267 @@
+#pragma once
+#include <type_traits>
+#include "Matrix.h"
+#include "MatrixSimd.h"
+
+// Opt-in lazy Matrix arithmetic. Wrapping an operand with MatrixExpression::Lazy makes +, -,
+// unary -, * by a float and * by a matrix build an expression instead of a Matrix, which is
+// evaluated once when it is converted to Matrix:
+//
+//     Matrix blended = MatrixExpression::Lazy(pose1) * weight1 + pose2 * weight2;
+//     Matrix worldViewProjection = MatrixExpression::Lazy(world) * view * projection;
+//
+// Element-wise operations are fused into a single pass over the 16 elements, without
+// intermediate matrices. A product is evaluated into one local matrix when it is an operand
+// of another operation, and directly into the destination otherwise. Every element is
+// computed with the same operations as the eager operators, so results are identical.
+//
+// Expressions refer to their Matrix operands, so they must be converted before the
+// operands go out of scope; do not keep them in auto variables beyond the statement.
+
+// Leaf referring to an existing matrix.
+class MatrixReference
+{
+public:
+	static const bool IsElementwise = true;
+
+	explicit MatrixReference(const Matrix& matrix) noexcept : _matrix(&matrix) {}
+
+	float Element(int index) const noexcept { return (&_matrix->M11)[index]; }
+	const Matrix& Value() const noexcept { return *_matrix; }
+	void Evaluate(Matrix& result) const noexcept { result = *_matrix; }
+	operator Matrix() const noexcept { return *_matrix; }
+
+private:
+	const Matrix* _matrix;
+};
+
+// Leaf holding the evaluated value of a product that is used by an element-wise operation.
+class MatrixValue
+{
+public:
+	static const bool IsElementwise = true;
+
+	template<typename Expression>
+	explicit MatrixValue(const Expression& expression) noexcept { expression.Evaluate(_matrix); }
+
+	float Element(int index) const noexcept { return (&_matrix.M11)[index]; }
+	const Matrix& Value() const noexcept { return _matrix; }
+	void Evaluate(Matrix& result) const noexcept { result = _matrix; }
+	operator Matrix() const noexcept { return _matrix; }
+
+private:
+	Matrix _matrix;
+};
+
+template<typename T> struct IsMatrixExpression : std::false_type {};
+template<> struct IsMatrixExpression<MatrixReference> : std::true_type {};
+template<> struct IsMatrixExpression<MatrixValue> : std::true_type {};
+
+// How an operand is stored inside an element-wise node: element-wise expressions by value,
+// products evaluated once, plain matrices by reference.
+template<typename T, bool Elementwise = T::IsElementwise> struct ElementwiseOperand { typedef T Type; };
+template<typename T> struct ElementwiseOperand<T, false> { typedef MatrixValue Type; };
+template<typename T> struct MatrixOperand { typedef typename ElementwiseOperand<T>::Type Type; };
+template<> struct MatrixOperand<Matrix> { typedef MatrixReference Type; };
+
+// How an operand is stored inside a product: expressions by value, plain matrices by reference.
+template<typename T> struct ProductOperand { typedef T Type; };
+template<> struct ProductOperand<Matrix> { typedef MatrixReference Type; };
+
+// Element-wise expressions fill every element of the destination in one loop.
+template<typename Derived>
+class ElementwiseExpression
+{
+public:
+	static const bool IsElementwise = true;
+
+	void Evaluate(Matrix& result) const noexcept
+	{
+		auto& self = static_cast<const Derived&>(*this);
+		float* destination = &result.M11;
+		for (auto i = 0; i < 16; i++)
+			destination[i] = self.Element(i);
+	}
+
+	operator Matrix() const noexcept
+	{
+		Matrix result;
+		Evaluate(result);
+		return result;
+	}
+};
+
+template<typename Left, typename Right>
+class MatrixSum : public ElementwiseExpression<MatrixSum<Left, Right>>
+{
+public:
+	MatrixSum(const Left& left, const Right& right) noexcept : _left(left), _right(right) {}
+
+	float Element(int index) const noexcept { return _left.Element(index) + _right.Element(index); }
+
+private:
+	Left _left;
+	Right _right;
+};
+
+template<typename Left, typename Right>
+class MatrixDifference : public ElementwiseExpression<MatrixDifference<Left, Right>>
+{
+public:
+	MatrixDifference(const Left& left, const Right& right) noexcept : _left(left), _right(right) {}
+
+	float Element(int index) const noexcept { return _left.Element(index) - _right.Element(index); }
+
+private:
+	Left _left;
+	Right _right;
+};
+
+template<typename Operand>
+class MatrixScale : public ElementwiseExpression<MatrixScale<Operand>>
+{
+public:
+	MatrixScale(const Operand& operand, float scaleFactor) noexcept : _operand(operand), _scaleFactor(scaleFactor) {}
+
+	float Element(int index) const noexcept { return _operand.Element(index) * _scaleFactor; }
+
+private:
+	Operand _operand;
+	float _scaleFactor;
+};
+
+template<typename Operand>
+class MatrixNegation : public ElementwiseExpression<MatrixNegation<Operand>>
+{
+public:
+	explicit MatrixNegation(const Operand& operand) noexcept : _operand(operand) {}
+
+	float Element(int index) const noexcept { return -_operand.Element(index); }
+
+private:
+	Operand _operand;
+};
+
+// Same expression as Matrix::Lerp.
+template<typename From, typename To>
+class MatrixLerp : public ElementwiseExpression<MatrixLerp<From, To>>
+{
+public:
+	MatrixLerp(const From& from, const To& to, float amount) noexcept : _from(from), _to(to), _amount(amount) {}
+
+	float Element(int index) const noexcept
+	{
+		auto from = _from.Element(index);
+		return from + ((_to.Element(index) - from) * _amount);
+	}
+
+private:
+	From _from;
+	To _to;
+	float _amount;
+};
+
+// Matrix product. Operands that are not plain matrices are evaluated into locals first, so a
+// chain such as a * b * c keeps a single intermediate and writes the last product in place.
+template<typename Left, typename Right>
+class MatrixProduct
+{
+public:
+	static const bool IsElementwise = false;
+
+	MatrixProduct(const Left& left, const Right& right) noexcept : _left(left), _right(right) {}
+
+	// The destination must not be one of the operands.
+	void Evaluate(Matrix& result) const noexcept
+	{
+		Matrix leftStorage;
+		Matrix rightStorage;
+		MatrixSimd::Multiply(Resolve(_left, leftStorage), Resolve(_right, rightStorage), result);
+	}
+
+	operator Matrix() const noexcept
+	{
+		Matrix result;
+		Evaluate(result);
+		return result;
+	}
+
+private:
+	Left _left;
+	Right _right;
+
+	static const Matrix& Resolve(const MatrixReference& operand, Matrix&) noexcept { return operand.Value(); }
+	static const Matrix& Resolve(const MatrixValue& operand, Matrix&) noexcept { return operand.Value(); }
+	template<typename Operand>
+	static const Matrix& Resolve(const Operand& operand, Matrix& storage) noexcept
+	{
+		operand.Evaluate(storage);
+		return storage;
+	}
+};
+
+template<typename L, typename R> struct IsMatrixExpression<MatrixSum<L, R>> : std::true_type {};
+template<typename L, typename R> struct IsMatrixExpression<MatrixDifference<L, R>> : std::true_type {};
+template<typename O> struct IsMatrixExpression<MatrixScale<O>> : std::true_type {};
+template<typename O> struct IsMatrixExpression<MatrixNegation<O>> : std::true_type {};
+template<typename F, typename T> struct IsMatrixExpression<MatrixLerp<F, T>> : std::true_type {};
+template<typename L, typename R> struct IsMatrixExpression<MatrixProduct<L, R>> : std::true_type {};
+
+// Enables the operators when both operands are matrices or expressions and at least one is an expression.
+template<typename Left, typename Right>
+struct EnableMatrixOperator : std::enable_if<
+	(IsMatrixExpression<Left>::value || IsMatrixExpression<Right>::value) &&
+	(IsMatrixExpression<Left>::value || std::is_same<Left, Matrix>::value) &&
+	(IsMatrixExpression<Right>::value || std::is_same<Right, Matrix>::value)> {};
+
+// Entry points of the expression layer.
+class MatrixExpression
+{
+public:
+	// Starts an expression; the operators applied to the result are evaluated lazily.
+	static MatrixReference Lazy(const Matrix& matrix) noexcept
+	{
+		return MatrixReference(matrix);
+	}
+
+	// Linear interpolation fused with the expressions that produce its operands.
+	template<typename From, typename To, typename = typename EnableMatrixOperator<From, To>::type>
+	static MatrixLerp<typename MatrixOperand<From>::Type, typename MatrixOperand<To>::Type> Lerp(const From& from, const To& to, float amount) noexcept
+	{
+		return MatrixLerp<typename MatrixOperand<From>::Type, typename MatrixOperand<To>::Type>(
+			typename MatrixOperand<From>::Type(from), typename MatrixOperand<To>::Type(to), amount);
+	}
+};
+
+template<typename Left, typename Right, typename = typename EnableMatrixOperator<Left, Right>::type>
+MatrixSum<typename MatrixOperand<Left>::Type, typename MatrixOperand<Right>::Type> operator+(const Left& left, const Right& right) noexcept
+{
+	return MatrixSum<typename MatrixOperand<Left>::Type, typename MatrixOperand<Right>::Type>(
+		typename MatrixOperand<Left>::Type(left), typename MatrixOperand<Right>::Type(right));
+}
+
+template<typename Left, typename Right, typename = typename EnableMatrixOperator<Left, Right>::type>
+MatrixDifference<typename MatrixOperand<Left>::Type, typename MatrixOperand<Right>::Type> operator-(const Left& left, const Right& right) noexcept
+{
+	return MatrixDifference<typename MatrixOperand<Left>::Type, typename MatrixOperand<Right>::Type>(
+		typename MatrixOperand<Left>::Type(left), typename MatrixOperand<Right>::Type(right));
+}
+
+template<typename Left, typename Right, typename = typename EnableMatrixOperator<Left, Right>::type>
+MatrixProduct<typename ProductOperand<Left>::Type, typename ProductOperand<Right>::Type> operator*(const Left& left, const Right& right) noexcept
+{
+	return MatrixProduct<typename ProductOperand<Left>::Type, typename ProductOperand<Right>::Type>(
+		typename ProductOperand<Left>::Type(left), typename ProductOperand<Right>::Type(right));
+}
+
+template<typename Operand, typename = typename std::enable_if<IsMatrixExpression<Operand>::value>::type>
+MatrixScale<typename MatrixOperand<Operand>::Type> operator*(const Operand& operand, float scaleFactor) noexcept
+{
+	return MatrixScale<typename MatrixOperand<Operand>::Type>(typename MatrixOperand<Operand>::Type(operand), scaleFactor);
+}
+
+template<typename Operand, typename = typename std::enable_if<IsMatrixExpression<Operand>::value>::type>
+MatrixNegation<typename MatrixOperand<Operand>::Type> operator-(const Operand& operand) noexcept
+{
+	return MatrixNegation<typename MatrixOperand<Operand>::Type>(typename MatrixOperand<Operand>::Type(operand));
+}
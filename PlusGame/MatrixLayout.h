@@ -0,0 +1,18 @@
+#pragma once
+
+enum MatrixLayout
+{
+	/// <summary>
+	/// 16 floats per matrix in the order of the fields, M11 to M44.
+	/// </summary>
+	RowMajor,
+	/// <summary>
+	/// 16 floats per matrix, transposed: M11, M21, M31, M41, M12, and so on.
+	/// </summary>
+	ColumnMajor,
+	/// <summary>
+	/// 12 floats per matrix: the first three rows of the transposed matrix, which drops the
+	/// projective column M14 to M44. The usual layout of instance world matrices.
+	/// </summary>
+	ColumnMajor3x4
+};
@@ -0,0 +1,2007 @@
+#include "MatrixSimd.h"
+#include "Matrix.h"
+#include "AffineMatrix.h"
+#include "MatrixD.h"
+#include "CpuFeatures.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+
+#if defined(PLUSGAME_X86)
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(Matrix) == 16 * sizeof(float), "Matrix must be 16 tightly packed floats");
+static_assert(sizeof(AffineMatrix) == 12 * sizeof(float), "AffineMatrix must be 12 tightly packed floats");
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be 3 tightly packed floats");
+static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must be 4 tightly packed floats");
+static_assert(sizeof(MatrixD) == 16 * sizeof(double), "MatrixD must be 16 tightly packed doubles");
+
+// A matrix is reported as singular when its determinant is below this fraction of the product
+// of its row lengths (the largest determinant those rows could have), or is NaN.
+static const float SingularTolerance = 1e-6f;
+// Largest deviation of the dot products of the rotation rows from the identity that is still
+// treated as orthonormal by the rigid-body inversion path.
+static const float RigidTolerance = 1e-5f;
+// Billboards closer to the camera than the square root of this use the fallback forward vector.
+static const float BillboardMinDistanceSquared = 0.0001f;
+// Cosine above which the direction to the camera is considered parallel to the billboard axis.
+static const float ConstrainedBillboardLimit = 0.9982547f;
+// Rows shorter than this, or not finite, cannot be decomposed.
+static const float DecomposeMinScale = 1e-30f;
+// Orthogonalization steps applied to the normalized rows before the rotation is extracted.
+static const int DecomposeOrthogonalizeSteps = 2;
+
+static bool IsRigid(const Matrix& matrix)
+{
+	if (matrix.M14 != 0.0f || matrix.M24 != 0.0f || matrix.M34 != 0.0f || matrix.M44 != 1.0f)
+		return false;
+
+	auto d11 = (matrix.M11 * matrix.M11) + (matrix.M12 * matrix.M12) + (matrix.M13 * matrix.M13);
+	auto d22 = (matrix.M21 * matrix.M21) + (matrix.M22 * matrix.M22) + (matrix.M23 * matrix.M23);
+	auto d33 = (matrix.M31 * matrix.M31) + (matrix.M32 * matrix.M32) + (matrix.M33 * matrix.M33);
+	auto d12 = (matrix.M11 * matrix.M21) + (matrix.M12 * matrix.M22) + (matrix.M13 * matrix.M23);
+	auto d13 = (matrix.M11 * matrix.M31) + (matrix.M12 * matrix.M32) + (matrix.M13 * matrix.M33);
+	auto d23 = (matrix.M21 * matrix.M31) + (matrix.M22 * matrix.M32) + (matrix.M23 * matrix.M33);
+	return std::fabs(d11 - 1.0f) <= RigidTolerance && std::fabs(d22 - 1.0f) <= RigidTolerance && std::fabs(d33 - 1.0f) <= RigidTolerance &&
+		std::fabs(d12) <= RigidTolerance && std::fabs(d13) <= RigidTolerance && std::fabs(d23) <= RigidTolerance;
+}
+
+// The inverse of a rotation followed by a translation is the transposed rotation followed by
+// the translation negated and rotated back.
+static void InvertRigid(const Matrix& matrix, Matrix& result)
+{
+	auto source = matrix;
+
+	result.M11 = source.M11;
+	result.M12 = source.M21;
+	result.M13 = source.M31;
+	result.M14 = 0.0f;
+	result.M21 = source.M12;
+	result.M22 = source.M22;
+	result.M23 = source.M32;
+	result.M24 = 0.0f;
+	result.M31 = source.M13;
+	result.M32 = source.M23;
+	result.M33 = source.M33;
+	result.M34 = 0.0f;
+	result.M41 = -((source.M41 * source.M11) + (source.M42 * source.M12) + (source.M43 * source.M13));
+	result.M42 = -((source.M41 * source.M21) + (source.M42 * source.M22) + (source.M43 * source.M23));
+	result.M43 = -((source.M41 * source.M31) + (source.M42 * source.M32) + (source.M43 * source.M33));
+	result.M44 = 1.0f;
+}
+
+// Normalized direction from the camera to the object, or the fallback when they are too close.
+static Vector3 BillboardForward(const Vector3& objectPosition, const Vector3& cameraPosition, const Vector3& fallbackForward)
+{
+	Vector3 forward(objectPosition.X - cameraPosition.X, objectPosition.Y - cameraPosition.Y, objectPosition.Z - cameraPosition.Z);
+	auto lengthSquared = forward.LengthSquared();
+	if (lengthSquared < BillboardMinDistanceSquared)
+		return fallbackForward;
+	return forward * (1.0f / std::sqrt(lengthSquared));
+}
+
+// Same steps as Matrix::CreateBillboard in single precision, with the rows written to an affine matrix.
+static void BillboardScalar(const Vector3& objectPosition, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3& fallbackForward, AffineMatrix& result)
+{
+	auto forward = BillboardForward(objectPosition, cameraPosition, fallbackForward);
+	Vector3 right;
+	Vector3 up;
+	Vector3::Cross(cameraUpVector, forward, right);
+	right.Normalize();
+	Vector3::Cross(forward, right, up);
+
+	result.M11 = right.X;
+	result.M12 = right.Y;
+	result.M13 = right.Z;
+	result.M21 = up.X;
+	result.M22 = up.Y;
+	result.M23 = up.Z;
+	result.M31 = forward.X;
+	result.M32 = forward.Y;
+	result.M33 = forward.Z;
+	result.M41 = objectPosition.X;
+	result.M42 = objectPosition.Y;
+	result.M43 = objectPosition.Z;
+}
+
+// Same steps as Matrix::CreateConstrainedBillboard in single precision. The right and forward
+// rows used when the camera looks along the axis only depend on the axis, so they are computed
+// once per batch.
+static void ConstrainedBillboardScalar(const Vector3& objectPosition, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3& fallbackForward,
+	const Vector3& parallelRight, const Vector3& parallelForward, AffineMatrix& result)
+{
+	auto toObject = BillboardForward(objectPosition, cameraPosition, fallbackForward);
+	Vector3 right = parallelRight;
+	Vector3 forward = parallelForward;
+	if (std::fabs(Vector3::Dot(rotateAxis, toObject)) <= ConstrainedBillboardLimit)
+	{
+		Vector3::Cross(rotateAxis, toObject, right);
+		right.Normalize();
+		Vector3::Cross(right, rotateAxis, forward);
+		forward.Normalize();
+	}
+
+	result.M11 = right.X;
+	result.M12 = right.Y;
+	result.M13 = right.Z;
+	result.M21 = rotateAxis.X;
+	result.M22 = rotateAxis.Y;
+	result.M23 = rotateAxis.Z;
+	result.M31 = forward.X;
+	result.M32 = forward.Y;
+	result.M33 = forward.Z;
+	result.M41 = objectPosition.X;
+	result.M42 = objectPosition.Y;
+	result.M43 = objectPosition.Z;
+}
+
+// Decomposes a matrix without shear into scale, rotation and translation:
+// - the scales are the lengths of the first three rows; a mirrored matrix (negative
+//   determinant) gets a negative X scale, so scale, rotation and translation rebuild it;
+// - the normalized rows are brought to the nearest rotation with Bjorck steps
+//   R = 1.5 R - 0.5 (R R^T) R, which converge to the orthogonal polar factor and remove the
+//   rounding and small shear that would otherwise skew the quaternion;
+// - the quaternion is taken from the largest of the four diagonal combinations, as in
+//   Quaternion::CreateFromRotationMatrix, and normalized.
+// The SSE kernel performs the same operations in the same order on four matrices at a time.
+static bool DecomposeScalar(const Matrix& matrix, Vector3& scale, Quaternion& rotation, Vector3& translation)
+{
+	translation = Vector3(matrix.M41, matrix.M42, matrix.M43);
+
+	float r[3][3] = {
+		{ matrix.M11, matrix.M12, matrix.M13 },
+		{ matrix.M21, matrix.M22, matrix.M23 },
+		{ matrix.M31, matrix.M32, matrix.M33 }
+	};
+	float length[3];
+	auto success = true;
+	for (auto i = 0; i < 3; i++)
+	{
+		length[i] = std::sqrt(((r[i][0] * r[i][0]) + (r[i][1] * r[i][1])) + (r[i][2] * r[i][2]));
+		auto factor = 1.0f / length[i];
+		r[i][0] = r[i][0] * factor;
+		r[i][1] = r[i][1] * factor;
+		r[i][2] = r[i][2] * factor;
+		// An infinite or overflowing row has an infinite length, and zero times an infinite or
+		// NaN component is NaN.
+		auto zeroed = ((r[i][0] * 0.0f) + (r[i][1] * 0.0f)) + (r[i][2] * 0.0f);
+		success = success && length[i] > DecomposeMinScale && length[i] <= FLT_MAX && zeroed == zeroed;
+	}
+
+	auto crossX = (r[1][1] * r[2][2]) - (r[2][1] * r[1][2]);
+	auto crossY = -((r[1][0] * r[2][2]) - (r[2][0] * r[1][2]));
+	auto crossZ = (r[1][0] * r[2][1]) - (r[2][0] * r[1][1]);
+	if (((r[0][0] * crossX) + (r[0][1] * crossY)) + (r[0][2] * crossZ) < 0.0f)
+	{
+		length[0] = -length[0];
+		r[0][0] = -r[0][0];
+		r[0][1] = -r[0][1];
+		r[0][2] = -r[0][2];
+	}
+
+	for (auto step = 0; step < DecomposeOrthogonalizeSteps; step++)
+	{
+		float gram[3][3];
+		for (auto i = 0; i < 3; i++)
+		{
+			for (auto j = 0; j < 3; j++)
+				gram[i][j] = ((r[i][0] * r[j][0]) + (r[i][1] * r[j][1])) + (r[i][2] * r[j][2]);
+		}
+		float next[3][3];
+		for (auto i = 0; i < 3; i++)
+		{
+			for (auto k = 0; k < 3; k++)
+				next[i][k] = (1.5f * r[i][k]) - (0.5f * (((gram[i][0] * r[0][k]) + (gram[i][1] * r[1][k])) + (gram[i][2] * r[2][k])));
+		}
+		for (auto i = 0; i < 3; i++)
+		{
+			for (auto k = 0; k < 3; k++)
+				r[i][k] = next[i][k];
+		}
+	}
+
+	auto yz = r[1][2] - r[2][1];
+	auto zx = r[2][0] - r[0][2];
+	auto xy = r[0][1] - r[1][0];
+	auto xyPlus = r[0][1] + r[1][0];
+	auto xzPlus = r[0][2] + r[2][0];
+	auto yzPlus = r[1][2] + r[2][1];
+
+	// Numerators of (X, Y, Z, W) for the largest diagonal combination.
+	auto best = ((1.0f + r[0][0]) + r[1][1]) + r[2][2];
+	float q[4] = { yz, zx, xy, best };
+	auto tx = ((1.0f + r[0][0]) - r[1][1]) - r[2][2];
+	if (tx > best)
+	{
+		best = tx;
+		q[0] = tx; q[1] = xyPlus; q[2] = xzPlus; q[3] = yz;
+	}
+	auto ty = ((1.0f - r[0][0]) + r[1][1]) - r[2][2];
+	if (ty > best)
+	{
+		best = ty;
+		q[0] = xyPlus; q[1] = ty; q[2] = yzPlus; q[3] = zx;
+	}
+	auto tz = ((1.0f - r[0][0]) - r[1][1]) + r[2][2];
+	if (tz > best)
+	{
+		best = tz;
+		q[0] = xzPlus; q[1] = yzPlus; q[2] = tz; q[3] = xy;
+	}
+	auto s = 0.5f / std::sqrt(best);
+	for (auto i = 0; i < 4; i++)
+		q[i] = q[i] * s;
+	auto norm = 1.0f / std::sqrt((((q[0] * q[0]) + (q[1] * q[1])) + (q[2] * q[2])) + (q[3] * q[3]));
+
+	scale = Vector3(length[0], length[1], length[2]);
+	rotation = success ? Quaternion(q[0] * norm, q[1] * norm, q[2] * norm, q[3] * norm) : Quaternion::Identity;
+	return success;
+}
+
+#if !defined(PLUSGAME_X86)
+// Row-vector convention: row i of the result is the i-th row of matrix1 times matrix2,
+// accumulated as (((a1 * b1) + (a2 * b2)) + (a3 * b3)) + (a4 * b4).
+static void MultiplyScalar(const Matrix& matrix1, const Matrix& matrix2, Matrix& result)
+{
+	auto m11 = (((matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21)) + (matrix1.M13 * matrix2.M31)) + (matrix1.M14 * matrix2.M41);
+	auto m12 = (((matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22)) + (matrix1.M13 * matrix2.M32)) + (matrix1.M14 * matrix2.M42);
+	auto m13 = (((matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23)) + (matrix1.M13 * matrix2.M33)) + (matrix1.M14 * matrix2.M43);
+	auto m14 = (((matrix1.M11 * matrix2.M14) + (matrix1.M12 * matrix2.M24)) + (matrix1.M13 * matrix2.M34)) + (matrix1.M14 * matrix2.M44);
+	auto m21 = (((matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21)) + (matrix1.M23 * matrix2.M31)) + (matrix1.M24 * matrix2.M41);
+	auto m22 = (((matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22)) + (matrix1.M23 * matrix2.M32)) + (matrix1.M24 * matrix2.M42);
+	auto m23 = (((matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23)) + (matrix1.M23 * matrix2.M33)) + (matrix1.M24 * matrix2.M43);
+	auto m24 = (((matrix1.M21 * matrix2.M14) + (matrix1.M22 * matrix2.M24)) + (matrix1.M23 * matrix2.M34)) + (matrix1.M24 * matrix2.M44);
+	auto m31 = (((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + (matrix1.M33 * matrix2.M31)) + (matrix1.M34 * matrix2.M41);
+	auto m32 = (((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + (matrix1.M33 * matrix2.M32)) + (matrix1.M34 * matrix2.M42);
+	auto m33 = (((matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23)) + (matrix1.M33 * matrix2.M33)) + (matrix1.M34 * matrix2.M43);
+	auto m34 = (((matrix1.M31 * matrix2.M14) + (matrix1.M32 * matrix2.M24)) + (matrix1.M33 * matrix2.M34)) + (matrix1.M34 * matrix2.M44);
+	auto m41 = (((matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21)) + (matrix1.M43 * matrix2.M31)) + (matrix1.M44 * matrix2.M41);
+	auto m42 = (((matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22)) + (matrix1.M43 * matrix2.M32)) + (matrix1.M44 * matrix2.M42);
+	auto m43 = (((matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23)) + (matrix1.M43 * matrix2.M33)) + (matrix1.M44 * matrix2.M43);
+	auto m44 = (((matrix1.M41 * matrix2.M14) + (matrix1.M42 * matrix2.M24)) + (matrix1.M43 * matrix2.M34)) + (matrix1.M44 * matrix2.M44);
+	result.M11 = m11;
+	result.M12 = m12;
+	result.M13 = m13;
+	result.M14 = m14;
+	result.M21 = m21;
+	result.M22 = m22;
+	result.M23 = m23;
+	result.M24 = m24;
+	result.M31 = m31;
+	result.M32 = m32;
+	result.M33 = m33;
+	result.M34 = m34;
+	result.M41 = m41;
+	result.M42 = m42;
+	result.M43 = m43;
+	result.M44 = m44;
+}
+
+static void MultiplyArrayScalar(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		MultiplyScalar(matrix1Array[i], matrix2Array[i], resultArray[i]);
+}
+
+static void MultiplyLeftArrayScalar(const Matrix& matrix1, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	auto left = matrix1;
+	for (auto i = 0; i < length; i++)
+		MultiplyScalar(left, matrix2Array[i], resultArray[i]);
+}
+
+static void MultiplyRightArrayScalar(const Matrix* matrix1Array, const Matrix& matrix2, Matrix* resultArray, int length)
+{
+	auto right = matrix2;
+	for (auto i = 0; i < length; i++)
+		MultiplyScalar(matrix1Array[i], right, resultArray[i]);
+}
+
+// Same cofactor expansion as Matrix::Invert, evaluated in single precision. Singular matrices
+// are replaced by the identity.
+static bool InvertScalar(const Matrix& matrix, Matrix& result)
+{
+	float num1 = matrix.M11;
+	float num2 = matrix.M12;
+	float num3 = matrix.M13;
+	float num4 = matrix.M14;
+	float num5 = matrix.M21;
+	float num6 = matrix.M22;
+	float num7 = matrix.M23;
+	float num8 = matrix.M24;
+	float num9 = matrix.M31;
+	float num10 = matrix.M32;
+	float num11 = matrix.M33;
+	float num12 = matrix.M34;
+	float num13 = matrix.M41;
+	float num14 = matrix.M42;
+	float num15 = matrix.M43;
+	float num16 = matrix.M44;
+	float num17 = num11 * num16 - num12 * num15;
+	float num18 = num10 * num16 - num12 * num14;
+	float num19 = num10 * num15 - num11 * num14;
+	float num20 = num9 * num16 - num12 * num13;
+	float num21 = num9 * num15 - num11 * num13;
+	float num22 = num9 * num14 - num10 * num13;
+	float num23 = num6 * num17 - num7 * num18 + num8 * num19;
+	float num24 = -(num5 * num17 - num7 * num20 + num8 * num21);
+	float num25 = num5 * num18 - num6 * num20 + num8 * num22;
+	float num26 = -(num5 * num19 - num6 * num21 + num7 * num22);
+	float determinant = num1 * num23 + num2 * num24 + num3 * num25 + num4 * num26;
+	float length1 = num1 * num1 + num2 * num2 + num3 * num3 + num4 * num4;
+	float length2 = num5 * num5 + num6 * num6 + num7 * num7 + num8 * num8;
+	float length3 = num9 * num9 + num10 * num10 + num11 * num11 + num12 * num12;
+	float length4 = num13 * num13 + num14 * num14 + num15 * num15 + num16 * num16;
+	float bound = std::sqrt(length1 * length2) * std::sqrt(length3 * length4);
+	if (!(std::fabs(determinant) > SingularTolerance * bound))
+	{
+		result = Matrix(
+			1.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 1.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			0.0f, 0.0f, 0.0f, 1.0f);
+		return false;
+	}
+	float num27 = 1.0f / determinant;
+
+	float num28 = num7 * num16 - num8 * num15;
+	float num29 = num6 * num16 - num8 * num14;
+	float num30 = num6 * num15 - num7 * num14;
+	float num31 = num5 * num16 - num8 * num13;
+	float num32 = num5 * num15 - num7 * num13;
+	float num33 = num5 * num14 - num6 * num13;
+	float num34 = num7 * num12 - num8 * num11;
+	float num35 = num6 * num12 - num8 * num10;
+	float num36 = num6 * num11 - num7 * num10;
+	float num37 = num5 * num12 - num8 * num9;
+	float num38 = num5 * num11 - num7 * num9;
+	float num39 = num5 * num10 - num6 * num9;
+
+	result.M11 = num23 * num27;
+	result.M21 = num24 * num27;
+	result.M31 = num25 * num27;
+	result.M41 = num26 * num27;
+	result.M12 = -(num2 * num17 - num3 * num18 + num4 * num19) * num27;
+	result.M22 = (num1 * num17 - num3 * num20 + num4 * num21) * num27;
+	result.M32 = -(num1 * num18 - num2 * num20 + num4 * num22) * num27;
+	result.M42 = (num1 * num19 - num2 * num21 + num3 * num22) * num27;
+	result.M13 = (num2 * num28 - num3 * num29 + num4 * num30) * num27;
+	result.M23 = -(num1 * num28 - num3 * num31 + num4 * num32) * num27;
+	result.M33 = (num1 * num29 - num2 * num31 + num4 * num33) * num27;
+	result.M43 = -(num1 * num30 - num2 * num32 + num3 * num33) * num27;
+	result.M14 = -(num2 * num34 - num3 * num35 + num4 * num36) * num27;
+	result.M24 = (num1 * num34 - num3 * num37 + num4 * num38) * num27;
+	result.M34 = -(num1 * num35 - num2 * num37 + num4 * num39) * num27;
+	result.M44 = (num1 * num36 - num2 * num38 + num3 * num39) * num27;
+	return true;
+}
+
+static void InvertGroupScalar(const Matrix* const* sources, Matrix* const* destinations, bool* singular, int count)
+{
+	for (auto i = 0; i < count; i++)
+		singular[i] = !InvertScalar(*sources[i], *destinations[i]);
+}
+
+static void ComposeArrayScalar(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Matrix::CreateFromTRS(scaleArray[i], rotationArray[i], translationArray[i], resultArray[i]);
+}
+
+static void ComposeAffineArrayScalar(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, AffineMatrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		AffineMatrix::CreateFromTRS(scaleArray[i], rotationArray[i], translationArray[i], resultArray[i]);
+}
+
+static void BillboardArrayScalar(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3& fallbackForward,
+	AffineMatrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		BillboardScalar(objectPositionArray[i], cameraPosition, cameraUpVector, fallbackForward, resultArray[i]);
+}
+
+static void ConstrainedBillboardArrayScalar(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3& fallbackForward,
+	const Vector3& parallelRight, const Vector3& parallelForward, AffineMatrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		ConstrainedBillboardScalar(objectPositionArray[i], cameraPosition, rotateAxis, fallbackForward, parallelRight, parallelForward, resultArray[i]);
+}
+
+static void ToRelativeArrayScalar(const MatrixD* sourceArray, const Vector3D& origin, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		MatrixD::ToRelativeMatrix(sourceArray[i], origin, resultArray[i]);
+}
+
+static void DecomposeArrayScalar(const Matrix* sourceArray, Vector3* scaleArray, Quaternion* rotationArray, Vector3* translationArray, bool* successArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		auto success = DecomposeScalar(sourceArray[i], scaleArray[i], rotationArray[i], translationArray[i]);
+		if (successArray != nullptr)
+			successArray[i] = success;
+	}
+}
+
+static void WriteArrayScalar(const Matrix* sourceArray, float* destination, int length, MatrixLayout layout)
+{
+	auto columns = (layout == ColumnMajor3x4) ? 3 : 4;
+	for (auto i = 0; i < length; i++)
+	{
+		const float* s = &sourceArray[i].M11;
+		if (layout == RowMajor)
+		{
+			for (auto j = 0; j < 16; j++)
+				destination[j] = s[j];
+		}
+		else
+		{
+			for (auto column = 0; column < columns; column++)
+			{
+				for (auto row = 0; row < 4; row++)
+					destination[column * 4 + row] = s[row * 4 + column];
+			}
+		}
+		destination += columns * 4;
+	}
+}
+
+static void AddArrayScalar(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Matrix::Add(matrix1Array[i], matrix2Array[i], resultArray[i]);
+}
+
+static void SubtractArrayScalar(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Matrix::Subtract(matrix1Array[i], matrix2Array[i], resultArray[i]);
+}
+
+static void LerpArrayScalar(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Matrix::Lerp(matrix1Array[i], matrix2Array[i], amount, resultArray[i]);
+}
+
+static void ScaleArrayScalar(const Matrix* sourceArray, float scaleFactor, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Matrix::Multiply(sourceArray[i], scaleFactor, resultArray[i]);
+}
+
+static void NegateArrayScalar(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Matrix::Negate(sourceArray[i], resultArray[i]);
+}
+
+static void TransposeArrayScalar(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Matrix::Transpose(sourceArray[i], resultArray[i]);
+}
+#else
+// One result row: broadcast each element of the matrix1 row and scale the matching matrix2 row.
+static inline __m128 MultiplyRowSse(__m128 row, __m128 b1, __m128 b2, __m128 b3, __m128 b4)
+{
+	auto sum = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b1);
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b2));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b3));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), b4));
+	return sum;
+}
+
+static void MultiplySse(const Matrix& matrix1, const Matrix& matrix2, Matrix& result)
+{
+	const float* a = &matrix1.M11;
+	const float* b = &matrix2.M11;
+	float* r = &result.M11;
+
+	// matrix2 is held in registers and each matrix1 row is read before its result row is
+	// written, so result may alias either operand.
+	auto b1 = _mm_loadu_ps(b);
+	auto b2 = _mm_loadu_ps(b + 4);
+	auto b3 = _mm_loadu_ps(b + 8);
+	auto b4 = _mm_loadu_ps(b + 12);
+
+	_mm_storeu_ps(r, MultiplyRowSse(_mm_loadu_ps(a), b1, b2, b3, b4));
+	_mm_storeu_ps(r + 4, MultiplyRowSse(_mm_loadu_ps(a + 4), b1, b2, b3, b4));
+	_mm_storeu_ps(r + 8, MultiplyRowSse(_mm_loadu_ps(a + 8), b1, b2, b3, b4));
+	_mm_storeu_ps(r + 12, MultiplyRowSse(_mm_loadu_ps(a + 12), b1, b2, b3, b4));
+}
+
+static void MultiplyArraySse(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		MultiplySse(matrix1Array[i], matrix2Array[i], resultArray[i]);
+}
+
+static void MultiplyLeftArraySse(const Matrix& matrix1, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	const float* a = &matrix1.M11;
+	auto a1 = _mm_loadu_ps(a);
+	auto a2 = _mm_loadu_ps(a + 4);
+	auto a3 = _mm_loadu_ps(a + 8);
+	auto a4 = _mm_loadu_ps(a + 12);
+
+	for (auto i = 0; i < length; i++)
+	{
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto b1 = _mm_loadu_ps(b);
+		auto b2 = _mm_loadu_ps(b + 4);
+		auto b3 = _mm_loadu_ps(b + 8);
+		auto b4 = _mm_loadu_ps(b + 12);
+		_mm_storeu_ps(r, MultiplyRowSse(a1, b1, b2, b3, b4));
+		_mm_storeu_ps(r + 4, MultiplyRowSse(a2, b1, b2, b3, b4));
+		_mm_storeu_ps(r + 8, MultiplyRowSse(a3, b1, b2, b3, b4));
+		_mm_storeu_ps(r + 12, MultiplyRowSse(a4, b1, b2, b3, b4));
+	}
+}
+
+static void MultiplyRightArraySse(const Matrix* matrix1Array, const Matrix& matrix2, Matrix* resultArray, int length)
+{
+	const float* b = &matrix2.M11;
+	auto b1 = _mm_loadu_ps(b);
+	auto b2 = _mm_loadu_ps(b + 4);
+	auto b3 = _mm_loadu_ps(b + 8);
+	auto b4 = _mm_loadu_ps(b + 12);
+
+	for (auto i = 0; i < length; i++)
+	{
+		const float* a = &matrix1Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto a1 = _mm_loadu_ps(a);
+		auto a2 = _mm_loadu_ps(a + 4);
+		auto a3 = _mm_loadu_ps(a + 8);
+		auto a4 = _mm_loadu_ps(a + 12);
+		_mm_storeu_ps(r, MultiplyRowSse(a1, b1, b2, b3, b4));
+		_mm_storeu_ps(r + 4, MultiplyRowSse(a2, b1, b2, b3, b4));
+		_mm_storeu_ps(r + 8, MultiplyRowSse(a3, b1, b2, b3, b4));
+		_mm_storeu_ps(r + 12, MultiplyRowSse(a4, b1, b2, b3, b4));
+	}
+}
+
+// a * b - c * d
+static inline __m128 DifferenceOfProductsSse(__m128 a, __m128 b, __m128 c, __m128 d)
+{
+	return _mm_sub_ps(_mm_mul_ps(a, b), _mm_mul_ps(c, d));
+}
+
+// a * x - b * y + c * z
+static inline __m128 CofactorSse(__m128 a, __m128 x, __m128 b, __m128 y, __m128 c, __m128 z)
+{
+	return _mm_add_ps(_mm_sub_ps(_mm_mul_ps(a, x), _mm_mul_ps(b, y)), _mm_mul_ps(c, z));
+}
+
+// Four inversions side by side: after transposing, lane j of each register holds one element
+// of the j-th matrix, so the cofactor expansion of Matrix::Invert runs unchanged (in single
+// precision) on all four at once. Unused lanes repeat the first matrix.
+static void InvertGroupSse(const Matrix* const* sources, Matrix* const* destinations, bool* singular, int count)
+{
+	const float* s[4];
+	for (auto i = 0; i < 4; i++)
+		s[i] = &sources[i < count ? i : 0]->M11;
+
+	__m128 e[16];
+	for (auto row = 0; row < 4; row++)
+	{
+		auto r0 = _mm_loadu_ps(s[0] + row * 4);
+		auto r1 = _mm_loadu_ps(s[1] + row * 4);
+		auto r2 = _mm_loadu_ps(s[2] + row * 4);
+		auto r3 = _mm_loadu_ps(s[3] + row * 4);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		e[row * 4] = r0;
+		e[row * 4 + 1] = r1;
+		e[row * 4 + 2] = r2;
+		e[row * 4 + 3] = r3;
+	}
+
+	auto n17 = DifferenceOfProductsSse(e[10], e[15], e[11], e[14]);
+	auto n18 = DifferenceOfProductsSse(e[9], e[15], e[11], e[13]);
+	auto n19 = DifferenceOfProductsSse(e[9], e[14], e[10], e[13]);
+	auto n20 = DifferenceOfProductsSse(e[8], e[15], e[11], e[12]);
+	auto n21 = DifferenceOfProductsSse(e[8], e[14], e[10], e[12]);
+	auto n22 = DifferenceOfProductsSse(e[8], e[13], e[9], e[12]);
+	auto n23 = CofactorSse(e[5], n17, e[6], n18, e[7], n19);
+	auto n24 = CofactorSse(e[4], n17, e[6], n20, e[7], n21);
+	auto n25 = CofactorSse(e[4], n18, e[5], n20, e[7], n22);
+	auto n26 = CofactorSse(e[4], n19, e[5], n21, e[6], n22);
+
+	// n24 and n26 hold the cofactors with their sign flipped, so they are subtracted.
+	auto determinant = _mm_sub_ps(_mm_mul_ps(e[0], n23), _mm_mul_ps(e[1], n24));
+	determinant = _mm_add_ps(determinant, _mm_mul_ps(e[2], n25));
+	determinant = _mm_sub_ps(determinant, _mm_mul_ps(e[3], n26));
+
+	__m128 lengths[4];
+	for (auto row = 0; row < 4; row++)
+	{
+		auto x = e[row * 4];
+		auto y = e[row * 4 + 1];
+		auto z = e[row * 4 + 2];
+		auto w = e[row * 4 + 3];
+		lengths[row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w)));
+	}
+	auto bound = _mm_mul_ps(_mm_sqrt_ps(_mm_mul_ps(lengths[0], lengths[1])), _mm_sqrt_ps(_mm_mul_ps(lengths[2], lengths[3])));
+	auto magnitude = _mm_andnot_ps(_mm_set1_ps(-0.0f), determinant);
+	auto valid = _mm_cmpgt_ps(magnitude, _mm_mul_ps(_mm_set1_ps(SingularTolerance), bound));
+	auto positive = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+	auto negative = _mm_sub_ps(_mm_setzero_ps(), positive);
+
+	auto n28 = DifferenceOfProductsSse(e[6], e[15], e[7], e[14]);
+	auto n29 = DifferenceOfProductsSse(e[5], e[15], e[7], e[13]);
+	auto n30 = DifferenceOfProductsSse(e[5], e[14], e[6], e[13]);
+	auto n31 = DifferenceOfProductsSse(e[4], e[15], e[7], e[12]);
+	auto n32 = DifferenceOfProductsSse(e[4], e[14], e[6], e[12]);
+	auto n33 = DifferenceOfProductsSse(e[4], e[13], e[5], e[12]);
+	auto n34 = DifferenceOfProductsSse(e[6], e[11], e[7], e[10]);
+	auto n35 = DifferenceOfProductsSse(e[5], e[11], e[7], e[9]);
+	auto n36 = DifferenceOfProductsSse(e[5], e[10], e[6], e[9]);
+	auto n37 = DifferenceOfProductsSse(e[4], e[11], e[7], e[8]);
+	auto n38 = DifferenceOfProductsSse(e[4], e[10], e[6], e[8]);
+	auto n39 = DifferenceOfProductsSse(e[4], e[9], e[5], e[8]);
+
+	__m128 r[16];
+	r[0] = _mm_mul_ps(n23, positive);
+	r[4] = _mm_mul_ps(n24, negative);
+	r[8] = _mm_mul_ps(n25, positive);
+	r[12] = _mm_mul_ps(n26, negative);
+	r[1] = _mm_mul_ps(CofactorSse(e[1], n17, e[2], n18, e[3], n19), negative);
+	r[5] = _mm_mul_ps(CofactorSse(e[0], n17, e[2], n20, e[3], n21), positive);
+	r[9] = _mm_mul_ps(CofactorSse(e[0], n18, e[1], n20, e[3], n22), negative);
+	r[13] = _mm_mul_ps(CofactorSse(e[0], n19, e[1], n21, e[2], n22), positive);
+	r[2] = _mm_mul_ps(CofactorSse(e[1], n28, e[2], n29, e[3], n30), positive);
+	r[6] = _mm_mul_ps(CofactorSse(e[0], n28, e[2], n31, e[3], n32), negative);
+	r[10] = _mm_mul_ps(CofactorSse(e[0], n29, e[1], n31, e[3], n33), positive);
+	r[14] = _mm_mul_ps(CofactorSse(e[0], n30, e[1], n32, e[2], n33), negative);
+	r[3] = _mm_mul_ps(CofactorSse(e[1], n34, e[2], n35, e[3], n36), negative);
+	r[7] = _mm_mul_ps(CofactorSse(e[0], n34, e[2], n37, e[3], n38), positive);
+	r[11] = _mm_mul_ps(CofactorSse(e[0], n35, e[1], n37, e[3], n39), negative);
+	r[15] = _mm_mul_ps(CofactorSse(e[0], n36, e[1], n38, e[2], n39), positive);
+
+	// Singular lanes are replaced by the identity.
+	auto one = _mm_set1_ps(1.0f);
+	for (auto i = 0; i < 16; i++)
+	{
+		auto fallback = (i % 5) == 0 ? one : _mm_setzero_ps();
+		r[i] = _mm_or_ps(_mm_and_ps(valid, r[i]), _mm_andnot_ps(valid, fallback));
+	}
+
+	auto validMask = _mm_movemask_ps(valid);
+	for (auto i = 0; i < count; i++)
+		singular[i] = (validMask & (1 << i)) == 0;
+
+	for (auto row = 0; row < 4; row++)
+	{
+		auto c0 = r[row * 4];
+		auto c1 = r[row * 4 + 1];
+		auto c2 = r[row * 4 + 2];
+		auto c3 = r[row * 4 + 3];
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		_mm_storeu_ps(&destinations[0]->M11 + row * 4, c0);
+		if (count > 1)
+			_mm_storeu_ps(&destinations[1]->M11 + row * 4, c1);
+		if (count > 2)
+			_mm_storeu_ps(&destinations[2]->M11 + row * 4, c2);
+		if (count > 3)
+			_mm_storeu_ps(&destinations[3]->M11 + row * 4, c3);
+	}
+}
+
+// Loads four consecutive Vector3 (three registers of packed floats) as one register per component.
+static inline void LoadVector3x4Sse(const Vector3* vectors, __m128& x, __m128& y, __m128& z)
+{
+	const float* v = &vectors[0].X;
+	auto a = _mm_loadu_ps(v);
+	auto b = _mm_loadu_ps(v + 4);
+	auto c = _mm_loadu_ps(v + 8);
+	auto xPairs = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 0));
+	auto yPairs0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+	auto yPairs1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+	auto zPairs = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 1, 3, 2));
+	x = _mm_shuffle_ps(a, xPairs, _MM_SHUFFLE(3, 1, 3, 0));
+	y = _mm_shuffle_ps(yPairs0, yPairs1, _MM_SHUFFLE(2, 0, 2, 0));
+	z = _mm_shuffle_ps(zPairs, c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// The nine scaled rotation elements of four transforms, one register per element, with the
+// operations of Matrix::CreateFromTRS in the same order.
+struct ComposedRotationSse
+{
+	__m128 M11, M12, M13, M21, M22, M23, M31, M32, M33;
+};
+
+static inline ComposedRotationSse ComposeRotationSse(const Vector3* scaleArray, const Quaternion* rotationArray)
+{
+	auto qx = _mm_loadu_ps(&rotationArray[0].X);
+	auto qy = _mm_loadu_ps(&rotationArray[1].X);
+	auto qz = _mm_loadu_ps(&rotationArray[2].X);
+	auto qw = _mm_loadu_ps(&rotationArray[3].X);
+	_MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+
+	__m128 sx, sy, sz;
+	LoadVector3x4Sse(scaleArray, sx, sy, sz);
+
+	auto one = _mm_set1_ps(1.0f);
+	auto two = _mm_set1_ps(2.0f);
+	auto num9 = _mm_mul_ps(qx, qx);
+	auto num8 = _mm_mul_ps(qy, qy);
+	auto num7 = _mm_mul_ps(qz, qz);
+	auto num6 = _mm_mul_ps(qx, qy);
+	auto num5 = _mm_mul_ps(qz, qw);
+	auto num4 = _mm_mul_ps(qz, qx);
+	auto num3 = _mm_mul_ps(qy, qw);
+	auto num2 = _mm_mul_ps(qy, qz);
+	auto num = _mm_mul_ps(qx, qw);
+
+	ComposedRotationSse r;
+	r.M11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(num8, num7))), sx);
+	r.M12 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(num6, num5)), sx);
+	r.M13 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(num4, num3)), sx);
+	r.M21 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(num6, num5)), sy);
+	r.M22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(num7, num9))), sy);
+	r.M23 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(num2, num)), sy);
+	r.M31 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(num4, num3)), sz);
+	r.M32 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(num2, num)), sz);
+	r.M33 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(num8, num9))), sz);
+	return r;
+}
+
+// Four transforms at a time, transposed back into rows on the way out.
+static void ComposeArraySse(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, Matrix* resultArray, int length)
+{
+	auto zero = _mm_setzero_ps();
+	auto one = _mm_set1_ps(1.0f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto r = ComposeRotationSse(scaleArray + i, rotationArray + i);
+		__m128 tx, ty, tz;
+		LoadVector3x4Sse(translationArray + i, tx, ty, tz);
+		auto tw = one;
+
+		auto row1 = zero;
+		auto row2 = zero;
+		auto row3 = zero;
+		_MM_TRANSPOSE4_PS(r.M11, r.M12, r.M13, row1);
+		_MM_TRANSPOSE4_PS(r.M21, r.M22, r.M23, row2);
+		_MM_TRANSPOSE4_PS(r.M31, r.M32, r.M33, row3);
+		_MM_TRANSPOSE4_PS(tx, ty, tz, tw);
+
+		float* d = &resultArray[i].M11;
+		_mm_storeu_ps(d, r.M11);
+		_mm_storeu_ps(d + 4, r.M21);
+		_mm_storeu_ps(d + 8, r.M31);
+		_mm_storeu_ps(d + 12, tx);
+		_mm_storeu_ps(d + 16, r.M12);
+		_mm_storeu_ps(d + 20, r.M22);
+		_mm_storeu_ps(d + 24, r.M32);
+		_mm_storeu_ps(d + 28, ty);
+		_mm_storeu_ps(d + 32, r.M13);
+		_mm_storeu_ps(d + 36, r.M23);
+		_mm_storeu_ps(d + 40, r.M33);
+		_mm_storeu_ps(d + 44, tz);
+		_mm_storeu_ps(d + 48, row1);
+		_mm_storeu_ps(d + 52, row2);
+		_mm_storeu_ps(d + 56, row3);
+		_mm_storeu_ps(d + 60, tw);
+	}
+	for (; i < length; i++)
+		Matrix::CreateFromTRS(scaleArray[i], rotationArray[i], translationArray[i], resultArray[i]);
+}
+
+// Four affine matrices are 48 consecutive floats: three 4x4 transposes of the twelve element
+// registers, one register per element, give them in order.
+static inline void StoreAffine4Sse(AffineMatrix* destination,
+	__m128 m11, __m128 m12, __m128 m13, __m128 m21, __m128 m22, __m128 m23,
+	__m128 m31, __m128 m32, __m128 m33, __m128 m41, __m128 m42, __m128 m43)
+{
+	_MM_TRANSPOSE4_PS(m11, m12, m13, m21);
+	_MM_TRANSPOSE4_PS(m22, m23, m31, m32);
+	_MM_TRANSPOSE4_PS(m33, m41, m42, m43);
+
+	float* d = &destination->M11;
+	_mm_storeu_ps(d, m11);
+	_mm_storeu_ps(d + 4, m22);
+	_mm_storeu_ps(d + 8, m33);
+	_mm_storeu_ps(d + 12, m12);
+	_mm_storeu_ps(d + 16, m23);
+	_mm_storeu_ps(d + 20, m41);
+	_mm_storeu_ps(d + 24, m13);
+	_mm_storeu_ps(d + 28, m31);
+	_mm_storeu_ps(d + 32, m42);
+	_mm_storeu_ps(d + 36, m21);
+	_mm_storeu_ps(d + 40, m32);
+	_mm_storeu_ps(d + 44, m43);
+}
+
+static void ComposeAffineArraySse(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, AffineMatrix* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto r = ComposeRotationSse(scaleArray + i, rotationArray + i);
+		__m128 tx, ty, tz;
+		LoadVector3x4Sse(translationArray + i, tx, ty, tz);
+		StoreAffine4Sse(resultArray + i, r.M11, r.M12, r.M13, r.M21, r.M22, r.M23, r.M31, r.M32, r.M33, tx, ty, tz);
+	}
+	for (; i < length; i++)
+		AffineMatrix::CreateFromTRS(scaleArray[i], rotationArray[i], translationArray[i], resultArray[i]);
+}
+
+static inline __m128 DotSse(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz)
+{
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+}
+
+// Same expressions as Vector3::Cross, negation included.
+static inline void CrossSse(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz, __m128& x, __m128& y, __m128& z)
+{
+	x = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(by, az));
+	y = _mm_xor_ps(_mm_sub_ps(_mm_mul_ps(ax, bz), _mm_mul_ps(bx, az)), _mm_set1_ps(-0.0f));
+	z = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(bx, ay));
+}
+
+static inline void NormalizeSse(__m128& x, __m128& y, __m128& z)
+{
+	auto factor = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(DotSse(x, y, z, x, y, z)));
+	x = _mm_mul_ps(x, factor);
+	y = _mm_mul_ps(y, factor);
+	z = _mm_mul_ps(z, factor);
+}
+
+static inline __m128 SelectSse(__m128 mask, __m128 a, __m128 b)
+{
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Four directions from the camera to the objects, as BillboardForward.
+static inline void BillboardForwardSse(__m128 px, __m128 py, __m128 pz, const Vector3& cameraPosition, const Vector3& fallbackForward,
+	__m128& x, __m128& y, __m128& z)
+{
+	x = _mm_sub_ps(px, _mm_set1_ps(cameraPosition.X));
+	y = _mm_sub_ps(py, _mm_set1_ps(cameraPosition.Y));
+	z = _mm_sub_ps(pz, _mm_set1_ps(cameraPosition.Z));
+	auto lengthSquared = DotSse(x, y, z, x, y, z);
+	auto factor = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSquared));
+	auto tooClose = _mm_cmplt_ps(lengthSquared, _mm_set1_ps(BillboardMinDistanceSquared));
+	x = SelectSse(tooClose, _mm_set1_ps(fallbackForward.X), _mm_mul_ps(x, factor));
+	y = SelectSse(tooClose, _mm_set1_ps(fallbackForward.Y), _mm_mul_ps(y, factor));
+	z = SelectSse(tooClose, _mm_set1_ps(fallbackForward.Z), _mm_mul_ps(z, factor));
+}
+
+// Four billboards at a time, one register per vector component.
+static void BillboardArraySse(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3& fallbackForward,
+	AffineMatrix* resultArray, int length)
+{
+	auto upX = _mm_set1_ps(cameraUpVector.X);
+	auto upY = _mm_set1_ps(cameraUpVector.Y);
+	auto upZ = _mm_set1_ps(cameraUpVector.Z);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 px, py, pz;
+		LoadVector3x4Sse(objectPositionArray + i, px, py, pz);
+		__m128 fx, fy, fz;
+		BillboardForwardSse(px, py, pz, cameraPosition, fallbackForward, fx, fy, fz);
+		__m128 rx, ry, rz;
+		CrossSse(upX, upY, upZ, fx, fy, fz, rx, ry, rz);
+		NormalizeSse(rx, ry, rz);
+		__m128 ux, uy, uz;
+		CrossSse(fx, fy, fz, rx, ry, rz, ux, uy, uz);
+		StoreAffine4Sse(resultArray + i, rx, ry, rz, ux, uy, uz, fx, fy, fz, px, py, pz);
+	}
+	for (; i < length; i++)
+		BillboardScalar(objectPositionArray[i], cameraPosition, cameraUpVector, fallbackForward, resultArray[i]);
+}
+
+// Lanes looking along the axis are computed like the others and then replaced by the
+// precomputed rows.
+static void ConstrainedBillboardArraySse(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3& fallbackForward,
+	const Vector3& parallelRight, const Vector3& parallelForward, AffineMatrix* resultArray, int length)
+{
+	auto ax = _mm_set1_ps(rotateAxis.X);
+	auto ay = _mm_set1_ps(rotateAxis.Y);
+	auto az = _mm_set1_ps(rotateAxis.Z);
+	auto absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	auto limit = _mm_set1_ps(ConstrainedBillboardLimit);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 px, py, pz;
+		LoadVector3x4Sse(objectPositionArray + i, px, py, pz);
+		__m128 tx, ty, tz;
+		BillboardForwardSse(px, py, pz, cameraPosition, fallbackForward, tx, ty, tz);
+		auto parallel = _mm_cmpgt_ps(_mm_and_ps(DotSse(ax, ay, az, tx, ty, tz), absMask), limit);
+
+		__m128 rx, ry, rz;
+		CrossSse(ax, ay, az, tx, ty, tz, rx, ry, rz);
+		NormalizeSse(rx, ry, rz);
+		__m128 fx, fy, fz;
+		CrossSse(rx, ry, rz, ax, ay, az, fx, fy, fz);
+		NormalizeSse(fx, fy, fz);
+
+		rx = SelectSse(parallel, _mm_set1_ps(parallelRight.X), rx);
+		ry = SelectSse(parallel, _mm_set1_ps(parallelRight.Y), ry);
+		rz = SelectSse(parallel, _mm_set1_ps(parallelRight.Z), rz);
+		fx = SelectSse(parallel, _mm_set1_ps(parallelForward.X), fx);
+		fy = SelectSse(parallel, _mm_set1_ps(parallelForward.Y), fy);
+		fz = SelectSse(parallel, _mm_set1_ps(parallelForward.Z), fz);
+		StoreAffine4Sse(resultArray + i, rx, ry, rz, ax, ay, az, fx, fy, fz, px, py, pz);
+	}
+	for (; i < length; i++)
+		ConstrainedBillboardScalar(objectPositionArray[i], cameraPosition, rotateAxis, fallbackForward, parallelRight, parallelForward, resultArray[i]);
+}
+
+// Each row is converted as two pairs of doubles; the origin is subtracted from the translation
+// row in double precision, with 0 for M44, before rounding.
+static void ToRelativeArraySse(const MatrixD* sourceArray, const Vector3D& origin, Matrix* resultArray, int length)
+{
+	auto originXY = _mm_set_pd(origin.Y, origin.X);
+	auto originZW = _mm_set_pd(0.0, origin.Z);
+	for (auto i = 0; i < length; i++)
+	{
+		const double* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		for (auto row = 0; row < 3; row++)
+		{
+			auto low = _mm_cvtpd_ps(_mm_loadu_pd(s + row * 4));
+			auto high = _mm_cvtpd_ps(_mm_loadu_pd(s + row * 4 + 2));
+			_mm_storeu_ps(r + row * 4, _mm_movelh_ps(low, high));
+		}
+		auto low = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(s + 12), originXY));
+		auto high = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(s + 14), originZW));
+		_mm_storeu_ps(r + 12, _mm_movelh_ps(low, high));
+	}
+}
+
+// Inverse of LoadVector3x4Sse. The overlapping stores write the vectors in order, so the
+// fourth lane of each transposed row is overwritten by the next vector.
+static inline void StoreVector3x4Sse(Vector3* vectors, __m128 x, __m128 y, __m128 z)
+{
+	auto w = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+	float* v = &vectors[0].X;
+	_mm_storeu_ps(v, x);
+	_mm_storeu_ps(v + 3, y);
+	_mm_storeu_ps(v + 6, z);
+	_mm_storel_pi((__m64*)(v + 9), w);
+	_mm_store_ss(v + 11, _mm_movehl_ps(w, w));
+}
+
+// One Bjorck step on the rows a, b and c of four matrices.
+static inline void OrthogonalizeStepSse(__m128& ax, __m128& ay, __m128& az, __m128& bx, __m128& by, __m128& bz, __m128& cx, __m128& cy, __m128& cz)
+{
+	auto oneAndHalf = _mm_set1_ps(1.5f);
+	auto half = _mm_set1_ps(0.5f);
+	auto aa = DotSse(ax, ay, az, ax, ay, az);
+	auto bb = DotSse(bx, by, bz, bx, by, bz);
+	auto cc = DotSse(cx, cy, cz, cx, cy, cz);
+	auto ab = DotSse(ax, ay, az, bx, by, bz);
+	auto ac = DotSse(ax, ay, az, cx, cy, cz);
+	auto bc = DotSse(bx, by, bz, cx, cy, cz);
+	auto step = [&](__m128 row, __m128 g0, __m128 g1, __m128 g2, __m128 a, __m128 b, __m128 c)
+	{
+		auto sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(g0, a), _mm_mul_ps(g1, b)), _mm_mul_ps(g2, c));
+		return _mm_sub_ps(_mm_mul_ps(oneAndHalf, row), _mm_mul_ps(half, sum));
+	};
+	auto nax = step(ax, aa, ab, ac, ax, bx, cx);
+	auto nay = step(ay, aa, ab, ac, ay, by, cy);
+	auto naz = step(az, aa, ab, ac, az, bz, cz);
+	auto nbx = step(bx, ab, bb, bc, ax, bx, cx);
+	auto nby = step(by, ab, bb, bc, ay, by, cy);
+	auto nbz = step(bz, ab, bb, bc, az, bz, cz);
+	auto ncx = step(cx, ac, bc, cc, ax, bx, cx);
+	auto ncy = step(cy, ac, bc, cc, ay, by, cy);
+	auto ncz = step(cz, ac, bc, cc, az, bz, cz);
+	ax = nax; ay = nay; az = naz;
+	bx = nbx; by = nby; bz = nbz;
+	cx = ncx; cy = ncy; cz = ncz;
+}
+
+// Length of a row of four matrices, and the row divided by it.
+static inline __m128 NormalizeRowSse(__m128& x, __m128& y, __m128& z)
+{
+	auto length = _mm_sqrt_ps(DotSse(x, y, z, x, y, z));
+	auto factor = _mm_div_ps(_mm_set1_ps(1.0f), length);
+	x = _mm_mul_ps(x, factor);
+	y = _mm_mul_ps(y, factor);
+	z = _mm_mul_ps(z, factor);
+	return length;
+}
+
+// Mask of the lanes whose row length is above DecomposeMinScale and finite, and whose normalized
+// row has no infinite or NaN component, as checked by DecomposeScalar.
+static inline __m128 IsDecomposableRowSse(__m128 length, __m128 x, __m128 y, __m128 z)
+{
+	auto zero = _mm_setzero_ps();
+	auto zeroed = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, zero), _mm_mul_ps(y, zero)), _mm_mul_ps(z, zero));
+	auto inRange = _mm_and_ps(_mm_cmpgt_ps(length, _mm_set1_ps(DecomposeMinScale)), _mm_cmple_ps(length, _mm_set1_ps(FLT_MAX)));
+	return _mm_and_ps(inRange, _mm_cmpord_ps(zeroed, zeroed));
+}
+
+static void DecomposeArraySse(const Matrix* sourceArray, Vector3* scaleArray, Quaternion* rotationArray, Vector3* translationArray, bool* successArray, int length)
+{
+	auto one = _mm_set1_ps(1.0f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		// One register per element, one matrix per lane.
+		const float* s0 = &sourceArray[i].M11;
+		const float* s1 = &sourceArray[i + 1].M11;
+		const float* s2 = &sourceArray[i + 2].M11;
+		const float* s3 = &sourceArray[i + 3].M11;
+		auto ax = _mm_loadu_ps(s0), ay = _mm_loadu_ps(s1), az = _mm_loadu_ps(s2), a4 = _mm_loadu_ps(s3);
+		auto bx = _mm_loadu_ps(s0 + 4), by = _mm_loadu_ps(s1 + 4), bz = _mm_loadu_ps(s2 + 4), b4 = _mm_loadu_ps(s3 + 4);
+		auto cx = _mm_loadu_ps(s0 + 8), cy = _mm_loadu_ps(s1 + 8), cz = _mm_loadu_ps(s2 + 8), c4 = _mm_loadu_ps(s3 + 8);
+		auto tx = _mm_loadu_ps(s0 + 12), ty = _mm_loadu_ps(s1 + 12), tz = _mm_loadu_ps(s2 + 12), t4 = _mm_loadu_ps(s3 + 12);
+		_MM_TRANSPOSE4_PS(ax, ay, az, a4);
+		_MM_TRANSPOSE4_PS(bx, by, bz, b4);
+		_MM_TRANSPOSE4_PS(cx, cy, cz, c4);
+		_MM_TRANSPOSE4_PS(tx, ty, tz, t4);
+		StoreVector3x4Sse(translationArray + i, tx, ty, tz);
+
+		auto scaleX = NormalizeRowSse(ax, ay, az);
+		auto scaleY = NormalizeRowSse(bx, by, bz);
+		auto scaleZ = NormalizeRowSse(cx, cy, cz);
+		auto success = _mm_and_ps(_mm_and_ps(IsDecomposableRowSse(scaleX, ax, ay, az), IsDecomposableRowSse(scaleY, bx, by, bz)), IsDecomposableRowSse(scaleZ, cx, cy, cz));
+
+		__m128 crossX, crossY, crossZ;
+		CrossSse(bx, by, bz, cx, cy, cz, crossX, crossY, crossZ);
+		auto mirrored = _mm_cmplt_ps(DotSse(ax, ay, az, crossX, crossY, crossZ), _mm_setzero_ps());
+		auto flip = _mm_and_ps(mirrored, _mm_set1_ps(-0.0f));
+		scaleX = _mm_xor_ps(scaleX, flip);
+		ax = _mm_xor_ps(ax, flip);
+		ay = _mm_xor_ps(ay, flip);
+		az = _mm_xor_ps(az, flip);
+
+		for (auto step = 0; step < DecomposeOrthogonalizeSteps; step++)
+			OrthogonalizeStepSse(ax, ay, az, bx, by, bz, cx, cy, cz);
+
+		auto yz = _mm_sub_ps(bz, cy);
+		auto zx = _mm_sub_ps(cx, az);
+		auto xy = _mm_sub_ps(ay, bx);
+		auto xyPlus = _mm_add_ps(ay, bx);
+		auto xzPlus = _mm_add_ps(az, cx);
+		auto yzPlus = _mm_add_ps(bz, cy);
+
+		auto best = _mm_add_ps(_mm_add_ps(_mm_add_ps(one, ax), by), cz);
+		auto qx = yz, qy = zx, qz = xy, qw = best;
+		auto traceX = _mm_sub_ps(_mm_sub_ps(_mm_add_ps(one, ax), by), cz);
+		auto useX = _mm_cmpgt_ps(traceX, best);
+		best = SelectSse(useX, traceX, best);
+		qx = SelectSse(useX, traceX, qx); qy = SelectSse(useX, xyPlus, qy); qz = SelectSse(useX, xzPlus, qz); qw = SelectSse(useX, yz, qw);
+		auto traceY = _mm_sub_ps(_mm_add_ps(_mm_sub_ps(one, ax), by), cz);
+		auto useY = _mm_cmpgt_ps(traceY, best);
+		best = SelectSse(useY, traceY, best);
+		qx = SelectSse(useY, xyPlus, qx); qy = SelectSse(useY, traceY, qy); qz = SelectSse(useY, yzPlus, qz); qw = SelectSse(useY, zx, qw);
+		auto traceZ = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(one, ax), by), cz);
+		auto useZ = _mm_cmpgt_ps(traceZ, best);
+		best = SelectSse(useZ, traceZ, best);
+		qx = SelectSse(useZ, xzPlus, qx); qy = SelectSse(useZ, yzPlus, qy); qz = SelectSse(useZ, traceZ, qz); qw = SelectSse(useZ, xy, qw);
+
+		auto factor = _mm_div_ps(_mm_set1_ps(0.5f), _mm_sqrt_ps(best));
+		qx = _mm_mul_ps(qx, factor);
+		qy = _mm_mul_ps(qy, factor);
+		qz = _mm_mul_ps(qz, factor);
+		qw = _mm_mul_ps(qw, factor);
+		auto lengthSquared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, qx), _mm_mul_ps(qy, qy)), _mm_mul_ps(qz, qz)), _mm_mul_ps(qw, qw));
+		auto norm = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+		qx = _mm_and_ps(success, _mm_mul_ps(qx, norm));
+		qy = _mm_and_ps(success, _mm_mul_ps(qy, norm));
+		qz = _mm_and_ps(success, _mm_mul_ps(qz, norm));
+		qw = SelectSse(success, _mm_mul_ps(qw, norm), one);
+
+		StoreVector3x4Sse(scaleArray + i, scaleX, scaleY, scaleZ);
+		_MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+		_mm_storeu_ps(&rotationArray[i].X, qx);
+		_mm_storeu_ps(&rotationArray[i + 1].X, qy);
+		_mm_storeu_ps(&rotationArray[i + 2].X, qz);
+		_mm_storeu_ps(&rotationArray[i + 3].X, qw);
+		if (successArray != nullptr)
+		{
+			auto bits = _mm_movemask_ps(success);
+			for (auto lane = 0; lane < 4; lane++)
+				successArray[i + lane] = ((bits >> lane) & 1) != 0;
+		}
+	}
+	for (; i < length; i++)
+	{
+		auto success = DecomposeScalar(sourceArray[i], scaleArray[i], rotationArray[i], translationArray[i]);
+		if (successArray != nullptr)
+			successArray[i] = success;
+	}
+}
+
+static inline void StoreSse(float* destination, __m128 value, bool stream)
+{
+	if (stream)
+		_mm_stream_ps(destination, value);
+	else
+		_mm_storeu_ps(destination, value);
+}
+
+// Non-temporal stores need 16-byte alignment; every layout is a multiple of 16 bytes per
+// matrix, so an aligned destination stays aligned for the whole array.
+static void WriteArraySse(const Matrix* sourceArray, float* destination, int length, MatrixLayout layout)
+{
+	auto stream = ((reinterpret_cast<uintptr_t>(destination) & 15) == 0);
+	for (auto i = 0; i < length; i++)
+	{
+		const float* s = &sourceArray[i].M11;
+		auto row1 = _mm_loadu_ps(s);
+		auto row2 = _mm_loadu_ps(s + 4);
+		auto row3 = _mm_loadu_ps(s + 8);
+		auto row4 = _mm_loadu_ps(s + 12);
+		if (layout != RowMajor)
+			_MM_TRANSPOSE4_PS(row1, row2, row3, row4);
+		StoreSse(destination, row1, stream);
+		StoreSse(destination + 4, row2, stream);
+		StoreSse(destination + 8, row3, stream);
+		if (layout == ColumnMajor3x4)
+		{
+			destination += 12;
+			continue;
+		}
+		StoreSse(destination + 12, row4, stream);
+		destination += 16;
+	}
+	if (stream)
+		_mm_sfence();
+}
+
+// The element-wise kernels handle one matrix per iteration as four rows. Every lane goes
+// through the same single operation as the scalar code, and each matrix is fully loaded
+// before it is stored, so the result may alias a source.
+static void AddArraySse(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		for (auto j = 0; j < 16; j += 4)
+			_mm_storeu_ps(r + j, _mm_add_ps(_mm_loadu_ps(a + j), _mm_loadu_ps(b + j)));
+	}
+}
+
+static void SubtractArraySse(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		for (auto j = 0; j < 16; j += 4)
+			_mm_storeu_ps(r + j, _mm_sub_ps(_mm_loadu_ps(a + j), _mm_loadu_ps(b + j)));
+	}
+}
+
+static inline __m128 LerpSse(const float* a, const float* b, __m128 t)
+{
+	auto from = _mm_loadu_ps(a);
+	return _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b), from), t));
+}
+
+static void LerpArraySse(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length)
+{
+	auto t = _mm_set1_ps(amount);
+	for (auto i = 0; i < length; i++)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto blend1 = LerpSse(a, b, t);
+		auto blend2 = LerpSse(a + 4, b + 4, t);
+		auto blend3 = LerpSse(a + 8, b + 8, t);
+		auto blend4 = LerpSse(a + 12, b + 12, t);
+		_mm_storeu_ps(r, blend1);
+		_mm_storeu_ps(r + 4, blend2);
+		_mm_storeu_ps(r + 8, blend3);
+		_mm_storeu_ps(r + 12, blend4);
+	}
+}
+
+static void ScaleArraySse(const Matrix* sourceArray, float scaleFactor, Matrix* resultArray, int length)
+{
+	auto factor = _mm_set1_ps(scaleFactor);
+	for (auto i = 0; i < length; i++)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		for (auto j = 0; j < 16; j += 4)
+			_mm_storeu_ps(r + j, _mm_mul_ps(_mm_loadu_ps(s + j), factor));
+	}
+}
+
+// Negation flips the sign bit, as the unary minus of the scalar code does.
+static void NegateArraySse(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	auto sign = _mm_set1_ps(-0.0f);
+	for (auto i = 0; i < length; i++)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		for (auto j = 0; j < 16; j += 4)
+			_mm_storeu_ps(r + j, _mm_xor_ps(_mm_loadu_ps(s + j), sign));
+	}
+}
+
+static void TransposeArraySse(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto row1 = _mm_loadu_ps(s);
+		auto row2 = _mm_loadu_ps(s + 4);
+		auto row3 = _mm_loadu_ps(s + 8);
+		auto row4 = _mm_loadu_ps(s + 12);
+		_MM_TRANSPOSE4_PS(row1, row2, row3, row4);
+		_mm_storeu_ps(r, row1);
+		_mm_storeu_ps(r + 4, row2);
+		_mm_storeu_ps(r + 8, row3);
+		_mm_storeu_ps(r + 12, row4);
+	}
+}
+
+// Two result rows per register: each 128-bit lane holds one matrix1 row, matrix2 rows are
+// duplicated into both lanes.
+PLUSGAME_TARGET_AVX
+static inline __m256 MultiplyRowPairAvx(__m256 rows, __m256 b1, __m256 b2, __m256 b3, __m256 b4)
+{
+	auto sum = _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(0, 0, 0, 0)), b1);
+	sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(1, 1, 1, 1)), b2));
+	sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(2, 2, 2, 2)), b3));
+	sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(3, 3, 3, 3)), b4));
+	return sum;
+}
+
+PLUSGAME_TARGET_AVX
+static void MultiplyAvx(const Matrix& matrix1, const Matrix& matrix2, Matrix& result)
+{
+	const float* a = &matrix1.M11;
+	const float* b = &matrix2.M11;
+	float* r = &result.M11;
+
+	auto b1 = _mm256_broadcast_ps((const __m128*)b);
+	auto b2 = _mm256_broadcast_ps((const __m128*)(b + 4));
+	auto b3 = _mm256_broadcast_ps((const __m128*)(b + 8));
+	auto b4 = _mm256_broadcast_ps((const __m128*)(b + 12));
+
+	_mm256_storeu_ps(r, MultiplyRowPairAvx(_mm256_loadu_ps(a), b1, b2, b3, b4));
+	_mm256_storeu_ps(r + 8, MultiplyRowPairAvx(_mm256_loadu_ps(a + 8), b1, b2, b3, b4));
+}
+
+// The batch kernels fill a 256-bit register with two rows of the same product rather than
+// one row of two products: that gives the same lane utilisation without gathering rows of
+// neighbouring matrices into one register, and lets the shared operand stay in registers.
+PLUSGAME_TARGET_AVX
+static void MultiplyArrayAvx(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		MultiplyAvx(matrix1Array[i], matrix2Array[i], resultArray[i]);
+}
+
+PLUSGAME_TARGET_AVX
+static void MultiplyLeftArrayAvx(const Matrix& matrix1, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	const float* a = &matrix1.M11;
+	auto a12 = _mm256_loadu_ps(a);
+	auto a34 = _mm256_loadu_ps(a + 8);
+
+	for (auto i = 0; i < length; i++)
+	{
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto b1 = _mm256_broadcast_ps((const __m128*)b);
+		auto b2 = _mm256_broadcast_ps((const __m128*)(b + 4));
+		auto b3 = _mm256_broadcast_ps((const __m128*)(b + 8));
+		auto b4 = _mm256_broadcast_ps((const __m128*)(b + 12));
+		_mm256_storeu_ps(r, MultiplyRowPairAvx(a12, b1, b2, b3, b4));
+		_mm256_storeu_ps(r + 8, MultiplyRowPairAvx(a34, b1, b2, b3, b4));
+	}
+}
+
+PLUSGAME_TARGET_AVX
+static void MultiplyRightArrayAvx(const Matrix* matrix1Array, const Matrix& matrix2, Matrix* resultArray, int length)
+{
+	const float* b = &matrix2.M11;
+	auto b1 = _mm256_broadcast_ps((const __m128*)b);
+	auto b2 = _mm256_broadcast_ps((const __m128*)(b + 4));
+	auto b3 = _mm256_broadcast_ps((const __m128*)(b + 8));
+	auto b4 = _mm256_broadcast_ps((const __m128*)(b + 12));
+
+	for (auto i = 0; i < length; i++)
+	{
+		const float* a = &matrix1Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto a12 = _mm256_loadu_ps(a);
+		auto a34 = _mm256_loadu_ps(a + 8);
+		_mm256_storeu_ps(r, MultiplyRowPairAvx(a12, b1, b2, b3, b4));
+		_mm256_storeu_ps(r + 8, MultiplyRowPairAvx(a34, b1, b2, b3, b4));
+	}
+}
+
+PLUSGAME_TARGET_AVX
+static void ToRelativeArrayAvx(const MatrixD* sourceArray, const Vector3D& origin, Matrix* resultArray, int length)
+{
+	auto translationOrigin = _mm256_set_pd(0.0, origin.Z, origin.Y, origin.X);
+	for (auto i = 0; i < length; i++)
+	{
+		const double* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		_mm_storeu_ps(r, _mm256_cvtpd_ps(_mm256_loadu_pd(s)));
+		_mm_storeu_ps(r + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(s + 4)));
+		_mm_storeu_ps(r + 8, _mm256_cvtpd_ps(_mm256_loadu_pd(s + 8)));
+		_mm_storeu_ps(r + 12, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(s + 12), translationOrigin)));
+	}
+}
+
+// The element-wise kernels handle two matrices per iteration as four 256-bit registers,
+// and a trailing odd matrix as two.
+PLUSGAME_TARGET_AVX
+static void AddArrayAvx(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto sum1 = _mm256_add_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b));
+		auto sum2 = _mm256_add_ps(_mm256_loadu_ps(a + 8), _mm256_loadu_ps(b + 8));
+		auto sum3 = _mm256_add_ps(_mm256_loadu_ps(a + 16), _mm256_loadu_ps(b + 16));
+		auto sum4 = _mm256_add_ps(_mm256_loadu_ps(a + 24), _mm256_loadu_ps(b + 24));
+		_mm256_storeu_ps(r, sum1);
+		_mm256_storeu_ps(r + 8, sum2);
+		_mm256_storeu_ps(r + 16, sum3);
+		_mm256_storeu_ps(r + 24, sum4);
+	}
+	if (i < length)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto sum1 = _mm256_add_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b));
+		auto sum2 = _mm256_add_ps(_mm256_loadu_ps(a + 8), _mm256_loadu_ps(b + 8));
+		_mm256_storeu_ps(r, sum1);
+		_mm256_storeu_ps(r + 8, sum2);
+	}
+}
+
+PLUSGAME_TARGET_AVX
+static void SubtractArrayAvx(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto difference1 = _mm256_sub_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b));
+		auto difference2 = _mm256_sub_ps(_mm256_loadu_ps(a + 8), _mm256_loadu_ps(b + 8));
+		auto difference3 = _mm256_sub_ps(_mm256_loadu_ps(a + 16), _mm256_loadu_ps(b + 16));
+		auto difference4 = _mm256_sub_ps(_mm256_loadu_ps(a + 24), _mm256_loadu_ps(b + 24));
+		_mm256_storeu_ps(r, difference1);
+		_mm256_storeu_ps(r + 8, difference2);
+		_mm256_storeu_ps(r + 16, difference3);
+		_mm256_storeu_ps(r + 24, difference4);
+	}
+	if (i < length)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto difference1 = _mm256_sub_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b));
+		auto difference2 = _mm256_sub_ps(_mm256_loadu_ps(a + 8), _mm256_loadu_ps(b + 8));
+		_mm256_storeu_ps(r, difference1);
+		_mm256_storeu_ps(r + 8, difference2);
+	}
+}
+
+PLUSGAME_TARGET_AVX
+static inline __m256 LerpAvx(const float* a, const float* b, __m256 t)
+{
+	auto from = _mm256_loadu_ps(a);
+	return _mm256_add_ps(from, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(b), from), t));
+}
+
+PLUSGAME_TARGET_AVX
+static void LerpArrayAvx(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length)
+{
+	auto t = _mm256_set1_ps(amount);
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto blend1 = LerpAvx(a, b, t);
+		auto blend2 = LerpAvx(a + 8, b + 8, t);
+		auto blend3 = LerpAvx(a + 16, b + 16, t);
+		auto blend4 = LerpAvx(a + 24, b + 24, t);
+		_mm256_storeu_ps(r, blend1);
+		_mm256_storeu_ps(r + 8, blend2);
+		_mm256_storeu_ps(r + 16, blend3);
+		_mm256_storeu_ps(r + 24, blend4);
+	}
+	if (i < length)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto blend1 = LerpAvx(a, b, t);
+		auto blend2 = LerpAvx(a + 8, b + 8, t);
+		_mm256_storeu_ps(r, blend1);
+		_mm256_storeu_ps(r + 8, blend2);
+	}
+}
+
+PLUSGAME_TARGET_AVX
+static void ScaleArrayAvx(const Matrix* sourceArray, float scaleFactor, Matrix* resultArray, int length)
+{
+	auto factor = _mm256_set1_ps(scaleFactor);
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto product1 = _mm256_mul_ps(_mm256_loadu_ps(s), factor);
+		auto product2 = _mm256_mul_ps(_mm256_loadu_ps(s + 8), factor);
+		auto product3 = _mm256_mul_ps(_mm256_loadu_ps(s + 16), factor);
+		auto product4 = _mm256_mul_ps(_mm256_loadu_ps(s + 24), factor);
+		_mm256_storeu_ps(r, product1);
+		_mm256_storeu_ps(r + 8, product2);
+		_mm256_storeu_ps(r + 16, product3);
+		_mm256_storeu_ps(r + 24, product4);
+	}
+	if (i < length)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto product1 = _mm256_mul_ps(_mm256_loadu_ps(s), factor);
+		auto product2 = _mm256_mul_ps(_mm256_loadu_ps(s + 8), factor);
+		_mm256_storeu_ps(r, product1);
+		_mm256_storeu_ps(r + 8, product2);
+	}
+}
+
+PLUSGAME_TARGET_AVX
+static void NegateArrayAvx(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	auto sign = _mm256_set1_ps(-0.0f);
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto negated1 = _mm256_xor_ps(_mm256_loadu_ps(s), sign);
+		auto negated2 = _mm256_xor_ps(_mm256_loadu_ps(s + 8), sign);
+		auto negated3 = _mm256_xor_ps(_mm256_loadu_ps(s + 16), sign);
+		auto negated4 = _mm256_xor_ps(_mm256_loadu_ps(s + 24), sign);
+		_mm256_storeu_ps(r, negated1);
+		_mm256_storeu_ps(r + 8, negated2);
+		_mm256_storeu_ps(r + 16, negated3);
+		_mm256_storeu_ps(r + 24, negated4);
+	}
+	if (i < length)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto negated1 = _mm256_xor_ps(_mm256_loadu_ps(s), sign);
+		auto negated2 = _mm256_xor_ps(_mm256_loadu_ps(s + 8), sign);
+		_mm256_storeu_ps(r, negated1);
+		_mm256_storeu_ps(r + 8, negated2);
+	}
+}
+
+// Two matrices are transposed together: the 128-bit halves are regrouped so that register n
+// holds row n of both matrices, the in-lane shuffles of _MM_TRANSPOSE4_PS turn those into
+// columns, and the halves are regrouped back per matrix.
+PLUSGAME_TARGET_AVX
+static void TransposeArrayAvx(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto first12 = _mm256_loadu_ps(s);
+		auto first34 = _mm256_loadu_ps(s + 8);
+		auto second12 = _mm256_loadu_ps(s + 16);
+		auto second34 = _mm256_loadu_ps(s + 24);
+		auto row1 = _mm256_permute2f128_ps(first12, second12, 0x20);
+		auto row2 = _mm256_permute2f128_ps(first12, second12, 0x31);
+		auto row3 = _mm256_permute2f128_ps(first34, second34, 0x20);
+		auto row4 = _mm256_permute2f128_ps(first34, second34, 0x31);
+		auto low12 = _mm256_unpacklo_ps(row1, row2);
+		auto low34 = _mm256_unpacklo_ps(row3, row4);
+		auto high12 = _mm256_unpackhi_ps(row1, row2);
+		auto high34 = _mm256_unpackhi_ps(row3, row4);
+		auto column1 = _mm256_shuffle_ps(low12, low34, _MM_SHUFFLE(1, 0, 1, 0));
+		auto column2 = _mm256_shuffle_ps(low12, low34, _MM_SHUFFLE(3, 2, 3, 2));
+		auto column3 = _mm256_shuffle_ps(high12, high34, _MM_SHUFFLE(1, 0, 1, 0));
+		auto column4 = _mm256_shuffle_ps(high12, high34, _MM_SHUFFLE(3, 2, 3, 2));
+		_mm256_storeu_ps(r, _mm256_permute2f128_ps(column1, column2, 0x20));
+		_mm256_storeu_ps(r + 8, _mm256_permute2f128_ps(column3, column4, 0x20));
+		_mm256_storeu_ps(r + 16, _mm256_permute2f128_ps(column1, column2, 0x31));
+		_mm256_storeu_ps(r + 24, _mm256_permute2f128_ps(column3, column4, 0x31));
+	}
+	TransposeArraySse(sourceArray + i, resultArray + i, length - i);
+}
+
+// A 512-bit register holds a whole matrix, so the AVX-512 kernels handle four matrices per
+// iteration and any remaining ones one at a time. Only the AVX-512 foundation set is used.
+PLUSGAME_TARGET_AVX512
+static void AddArrayAvx512(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto sum1 = _mm512_add_ps(_mm512_loadu_ps(a), _mm512_loadu_ps(b));
+		auto sum2 = _mm512_add_ps(_mm512_loadu_ps(a + 16), _mm512_loadu_ps(b + 16));
+		auto sum3 = _mm512_add_ps(_mm512_loadu_ps(a + 32), _mm512_loadu_ps(b + 32));
+		auto sum4 = _mm512_add_ps(_mm512_loadu_ps(a + 48), _mm512_loadu_ps(b + 48));
+		_mm512_storeu_ps(r, sum1);
+		_mm512_storeu_ps(r + 16, sum2);
+		_mm512_storeu_ps(r + 32, sum3);
+		_mm512_storeu_ps(r + 48, sum4);
+	}
+	for (; i < length; i++)
+		_mm512_storeu_ps(&resultArray[i].M11, _mm512_add_ps(_mm512_loadu_ps(&matrix1Array[i].M11), _mm512_loadu_ps(&matrix2Array[i].M11)));
+}
+
+PLUSGAME_TARGET_AVX512
+static void SubtractArrayAvx512(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto difference1 = _mm512_sub_ps(_mm512_loadu_ps(a), _mm512_loadu_ps(b));
+		auto difference2 = _mm512_sub_ps(_mm512_loadu_ps(a + 16), _mm512_loadu_ps(b + 16));
+		auto difference3 = _mm512_sub_ps(_mm512_loadu_ps(a + 32), _mm512_loadu_ps(b + 32));
+		auto difference4 = _mm512_sub_ps(_mm512_loadu_ps(a + 48), _mm512_loadu_ps(b + 48));
+		_mm512_storeu_ps(r, difference1);
+		_mm512_storeu_ps(r + 16, difference2);
+		_mm512_storeu_ps(r + 32, difference3);
+		_mm512_storeu_ps(r + 48, difference4);
+	}
+	for (; i < length; i++)
+		_mm512_storeu_ps(&resultArray[i].M11, _mm512_sub_ps(_mm512_loadu_ps(&matrix1Array[i].M11), _mm512_loadu_ps(&matrix2Array[i].M11)));
+}
+
+PLUSGAME_TARGET_AVX512
+static inline __m512 LerpAvx512(const float* a, const float* b, __m512 t)
+{
+	auto from = _mm512_loadu_ps(a);
+	return _mm512_add_ps(from, _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(b), from), t));
+}
+
+PLUSGAME_TARGET_AVX512
+static void LerpArrayAvx512(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length)
+{
+	auto t = _mm512_set1_ps(amount);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		const float* a = &matrix1Array[i].M11;
+		const float* b = &matrix2Array[i].M11;
+		float* r = &resultArray[i].M11;
+		auto blend1 = LerpAvx512(a, b, t);
+		auto blend2 = LerpAvx512(a + 16, b + 16, t);
+		auto blend3 = LerpAvx512(a + 32, b + 32, t);
+		auto blend4 = LerpAvx512(a + 48, b + 48, t);
+		_mm512_storeu_ps(r, blend1);
+		_mm512_storeu_ps(r + 16, blend2);
+		_mm512_storeu_ps(r + 32, blend3);
+		_mm512_storeu_ps(r + 48, blend4);
+	}
+	for (; i < length; i++)
+		_mm512_storeu_ps(&resultArray[i].M11, LerpAvx512(&matrix1Array[i].M11, &matrix2Array[i].M11, t));
+}
+
+PLUSGAME_TARGET_AVX512
+static void ScaleArrayAvx512(const Matrix* sourceArray, float scaleFactor, Matrix* resultArray, int length)
+{
+	auto factor = _mm512_set1_ps(scaleFactor);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto product1 = _mm512_mul_ps(_mm512_loadu_ps(s), factor);
+		auto product2 = _mm512_mul_ps(_mm512_loadu_ps(s + 16), factor);
+		auto product3 = _mm512_mul_ps(_mm512_loadu_ps(s + 32), factor);
+		auto product4 = _mm512_mul_ps(_mm512_loadu_ps(s + 48), factor);
+		_mm512_storeu_ps(r, product1);
+		_mm512_storeu_ps(r + 16, product2);
+		_mm512_storeu_ps(r + 32, product3);
+		_mm512_storeu_ps(r + 48, product4);
+	}
+	for (; i < length; i++)
+		_mm512_storeu_ps(&resultArray[i].M11, _mm512_mul_ps(_mm512_loadu_ps(&sourceArray[i].M11), factor));
+}
+
+// _mm512_xor_ps needs AVX512DQ, so the sign is flipped with the integer form.
+PLUSGAME_TARGET_AVX512
+static inline __m512 NegateAvx512(const float* s, __m512i sign)
+{
+	return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_loadu_ps(s)), sign));
+}
+
+PLUSGAME_TARGET_AVX512
+static void NegateArrayAvx512(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	auto sign = _mm512_set1_epi32((int)0x80000000u);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto negated1 = NegateAvx512(s, sign);
+		auto negated2 = NegateAvx512(s + 16, sign);
+		auto negated3 = NegateAvx512(s + 32, sign);
+		auto negated4 = NegateAvx512(s + 48, sign);
+		_mm512_storeu_ps(r, negated1);
+		_mm512_storeu_ps(r + 16, negated2);
+		_mm512_storeu_ps(r + 32, negated3);
+		_mm512_storeu_ps(r + 48, negated4);
+	}
+	for (; i < length; i++)
+		_mm512_storeu_ps(&resultArray[i].M11, NegateAvx512(&sourceArray[i].M11, sign));
+}
+
+// With the whole matrix in one register the transpose is a single cross-lane permutation. The
+// zero-masking form with every lane selected gives the same result without the undefined source
+// operand of _mm512_permutexvar_ps, which GCC reports as maybe uninitialized.
+PLUSGAME_TARGET_AVX512
+static inline __m512 TransposeAvx512(const float* source, __m512i order)
+{
+	return _mm512_maskz_permutexvar_ps(0xFFFF, order, _mm512_loadu_ps(source));
+}
+
+PLUSGAME_TARGET_AVX512
+static void TransposeArrayAvx512(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	auto order = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		const float* s = &sourceArray[i].M11;
+		float* r = &resultArray[i].M11;
+		auto transposed1 = TransposeAvx512(s, order);
+		auto transposed2 = TransposeAvx512(s + 16, order);
+		auto transposed3 = TransposeAvx512(s + 32, order);
+		auto transposed4 = TransposeAvx512(s + 48, order);
+		_mm512_storeu_ps(r, transposed1);
+		_mm512_storeu_ps(r + 16, transposed2);
+		_mm512_storeu_ps(r + 32, transposed3);
+		_mm512_storeu_ps(r + 48, transposed4);
+	}
+	for (; i < length; i++)
+		_mm512_storeu_ps(&resultArray[i].M11, TransposeAvx512(&sourceArray[i].M11, order));
+}
+#endif
+
+/// <summary>
+/// Multiplies two matrices with the fastest kernel available on this processor.
+/// </summary>
+/// <param name="matrix1">Source <see cref="Matrix"/>.</param>
+/// <param name="matrix2">Source <see cref="Matrix"/>.</param>
+/// <param name="result">Result of the matrix multiplication as an output parameter. May alias either source.</param>
+void MatrixSimd::Multiply(const Matrix& matrix1, const Matrix& matrix2, Matrix& result)
+{
+	Kernels().Multiply(matrix1, matrix2, result);
+}
+
+/// <summary>
+/// Multiplies each pair of matrices at the same index in two arrays.
+/// </summary>
+/// <param name="matrix1Array">Left-hand matrices.</param>
+/// <param name="matrix2Array">Right-hand matrices.</param>
+/// <param name="resultArray">Destination array. May be the same array as either source.</param>
+/// <param name="length">The number of products to compute.</param>
+void MatrixSimd::MultiplyBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	Kernels().MultiplyArray(matrix1Array, matrix2Array, resultArray, length);
+}
+
+/// <summary>
+/// Multiplies one matrix by every matrix of an array.
+/// </summary>
+/// <param name="matrix1">Left-hand matrix shared by all products.</param>
+/// <param name="matrix2Array">Right-hand matrices.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of products to compute.</param>
+void MatrixSimd::MultiplyBatch(const Matrix& matrix1, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	Kernels().MultiplyLeftArray(matrix1, matrix2Array, resultArray, length);
+}
+
+/// <summary>
+/// Multiplies every matrix of an array by one matrix.
+/// </summary>
+/// <param name="matrix1Array">Left-hand matrices.</param>
+/// <param name="matrix2">Right-hand matrix shared by all products.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of products to compute.</param>
+void MatrixSimd::MultiplyBatch(const Matrix* matrix1Array, const Matrix& matrix2, Matrix* resultArray, int length)
+{
+	Kernels().MultiplyRightArray(matrix1Array, matrix2, resultArray, length);
+}
+
+/// <summary>
+/// Inverts every matrix of an array in single precision, four at a time.
+/// Singular matrices are replaced by the identity and flagged in <paramref name="singularArray"/>.
+/// </summary>
+/// <param name="sourceArray">Matrices to invert.</param>
+/// <param name="destinationArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to invert.</param>
+/// <param name="singularArray">Receives <c>true</c> for every singular matrix. May be null.</param>
+/// <param name="detectRigid">If <c>true</c>, matrices made only of an orthonormal rotation and a translation are inverted by transposition.</param>
+void MatrixSimd::InvertBatch(const Matrix* sourceArray, Matrix* destinationArray, int length, bool* singularArray, bool detectRigid)
+{
+	auto invertGroup = Kernels().InvertGroup;
+	const Matrix* sources[4];
+	Matrix* destinations[4];
+	int indices[4];
+	bool singular[4];
+	auto count = 0;
+
+	auto flush = [&]()
+	{
+		invertGroup(sources, destinations, singular, count);
+		if (singularArray != nullptr)
+		{
+			for (auto i = 0; i < count; i++)
+				singularArray[indices[i]] = singular[i];
+		}
+		count = 0;
+	};
+
+	for (auto i = 0; i < length; i++)
+	{
+		if (detectRigid && IsRigid(sourceArray[i]))
+		{
+			InvertRigid(sourceArray[i], destinationArray[i]);
+			if (singularArray != nullptr)
+				singularArray[i] = false;
+			continue;
+		}
+
+		sources[count] = &sourceArray[i];
+		destinations[count] = &destinationArray[i];
+		indices[count] = i;
+		if (++count == 4)
+			flush();
+	}
+
+	if (count > 0)
+		flush();
+}
+
+/// <summary>
+/// Builds a world matrix from every scale, rotation and translation at the same index in three arrays.
+/// </summary>
+/// <param name="scaleArray">Scales along each axis.</param>
+/// <param name="rotationArray">Rotations.</param>
+/// <param name="translationArray">Positions of the origin.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to build.</param>
+void MatrixSimd::CreateFromTRSBatch(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, Matrix* resultArray, int length)
+{
+	Kernels().ComposeArray(scaleArray, rotationArray, translationArray, resultArray, length);
+}
+
+/// <summary>
+/// Builds an affine world matrix from every scale, rotation and translation at the same index in three arrays.
+/// </summary>
+/// <param name="scaleArray">Scales along each axis.</param>
+/// <param name="rotationArray">Rotations.</param>
+/// <param name="translationArray">Positions of the origin.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to build.</param>
+void MatrixSimd::CreateFromTRSBatch(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, AffineMatrix* resultArray, int length)
+{
+	Kernels().ComposeAffineArray(scaleArray, rotationArray, translationArray, resultArray, length);
+}
+
+/// <summary>
+/// Builds a spherical billboard matrix for every object position in an array, all facing the same camera.
+/// </summary>
+/// <param name="objectPositionArray">Positions of the billboards.</param>
+/// <param name="cameraPosition">The camera position.</param>
+/// <param name="cameraUpVector">The camera up vector.</param>
+/// <param name="cameraForwardVector">Optional camera forward vector.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to build.</param>
+void MatrixSimd::CreateBillboardBatch(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3* cameraForwardVector,
+	AffineMatrix* resultArray, int length)
+{
+	auto fallbackForward = (cameraForwardVector != nullptr) ? Vector3::Negate(*cameraForwardVector) : Vector3::Forward;
+	Kernels().BillboardArray(objectPositionArray, cameraPosition, cameraUpVector, fallbackForward, resultArray, length);
+}
+
+/// <summary>
+/// Builds a cylindrical billboard matrix for every object position in an array, all facing the same camera.
+/// </summary>
+/// <param name="objectPositionArray">Positions of the billboards.</param>
+/// <param name="cameraPosition">The camera position.</param>
+/// <param name="rotateAxis">Axis of billboard for rotation.</param>
+/// <param name="cameraForwardVector">Optional camera forward vector.</param>
+/// <param name="objectForwardVector">Optional object forward vector.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to build.</param>
+void MatrixSimd::CreateConstrainedBillboardBatch(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3* cameraForwardVector,
+	const Vector3* objectForwardVector, AffineMatrix* resultArray, int length)
+{
+	auto fallbackForward = (cameraForwardVector != nullptr) ? Vector3::Negate(*cameraForwardVector) : Vector3::Forward;
+
+	// Reference direction for the billboards the camera sees along the axis, as chosen by Matrix::CreateConstrainedBillboard.
+	auto reference = (std::fabs(Vector3::Dot(rotateAxis, Vector3::Forward)) > ConstrainedBillboardLimit) ? Vector3::Right : Vector3::Forward;
+	if (objectForwardVector != nullptr && std::fabs(Vector3::Dot(rotateAxis, *objectForwardVector)) <= ConstrainedBillboardLimit)
+		reference = *objectForwardVector;
+	Vector3 parallelRight;
+	Vector3 parallelForward;
+	Vector3::Cross(rotateAxis, reference, parallelRight);
+	parallelRight.Normalize();
+	Vector3::Cross(parallelRight, rotateAxis, parallelForward);
+	parallelForward.Normalize();
+
+	Kernels().ConstrainedBillboardArray(objectPositionArray, cameraPosition, rotateAxis, fallbackForward, parallelRight, parallelForward, resultArray, length);
+}
+
+/// <summary>
+/// Converts every double-precision matrix of an array to single precision relative to an origin.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="MatrixD"/> array.</param>
+/// <param name="origin">Position subtracted from every translation before rounding.</param>
+/// <param name="resultArray">Destination array.</param>
+/// <param name="length">The number of matrices to convert.</param>
+void MatrixSimd::ToRelativeBatch(const MatrixD* sourceArray, const Vector3D& origin, Matrix* resultArray, int length)
+{
+	Kernels().ToRelativeArray(sourceArray, origin, resultArray, length);
+}
+
+/// <summary>
+/// Decomposes every matrix of an array into scale, rotation and translation.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="Matrix"/> array.</param>
+/// <param name="scaleArray">Receives the scales.</param>
+/// <param name="rotationArray">Receives the rotations.</param>
+/// <param name="translationArray">Receives the translations.</param>
+/// <param name="successArray">Receives <c>false</c> for the matrices that cannot be decomposed. May be null.</param>
+/// <param name="length">The number of matrices to decompose.</param>
+void MatrixSimd::DecomposeBatch(const Matrix* sourceArray, Vector3* scaleArray, Quaternion* rotationArray, Vector3* translationArray, bool* successArray, int length)
+{
+	Kernels().DecomposeArray(sourceArray, scaleArray, rotationArray, translationArray, successArray, length);
+}
+
+/// <summary>
+/// Writes an array of matrices to memory in the given layout.
+/// </summary>
+/// <param name="sourceArray">Source <see cref="Matrix"/> array.</param>
+/// <param name="destination">Memory receiving the elements.</param>
+/// <param name="length">The number of matrices to write.</param>
+/// <param name="layout">Element order of the written matrices.</param>
+void MatrixSimd::WriteBatch(const Matrix* sourceArray, float* destination, int length, MatrixLayout layout)
+{
+	Kernels().WriteArray(sourceArray, destination, length, layout);
+}
+
+/// <summary>
+/// Adds the matrices at the same index in two arrays.
+/// </summary>
+/// <param name="matrix1Array">Left-hand matrices.</param>
+/// <param name="matrix2Array">Right-hand matrices.</param>
+/// <param name="resultArray">Destination array. May be the same array as either source.</param>
+/// <param name="length">The number of sums to compute.</param>
+void MatrixSimd::AddBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	Kernels().AddArray(matrix1Array, matrix2Array, resultArray, length);
+}
+
+/// <summary>
+/// Subtracts the matrices of the second array from the matrices at the same index in the first.
+/// </summary>
+/// <param name="matrix1Array">Left-hand matrices.</param>
+/// <param name="matrix2Array">Right-hand matrices.</param>
+/// <param name="resultArray">Destination array. May be the same array as either source.</param>
+/// <param name="length">The number of differences to compute.</param>
+void MatrixSimd::SubtractBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length)
+{
+	Kernels().SubtractArray(matrix1Array, matrix2Array, resultArray, length);
+}
+
+/// <summary>
+/// Linearly interpolates the matrices at the same index in two arrays by one amount.
+/// </summary>
+/// <param name="matrix1Array">Matrices at amount 0.</param>
+/// <param name="matrix2Array">Matrices at amount 1.</param>
+/// <param name="amount">Weighting value shared by all interpolations.</param>
+/// <param name="resultArray">Destination array. May be the same array as either source.</param>
+/// <param name="length">The number of interpolations to compute.</param>
+void MatrixSimd::LerpBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length)
+{
+	Kernels().LerpArray(matrix1Array, matrix2Array, amount, resultArray, length);
+}
+
+/// <summary>
+/// Multiplies every matrix of an array by a scalar.
+/// </summary>
+/// <param name="matrix1Array">Source matrices.</param>
+/// <param name="scaleFactor">Scalar value.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to scale.</param>
+void MatrixSimd::MultiplyBatch(const Matrix* matrix1Array, float scaleFactor, Matrix* resultArray, int length)
+{
+	Kernels().ScaleArray(matrix1Array, scaleFactor, resultArray, length);
+}
+
+/// <summary>
+/// Negates every matrix of an array.
+/// </summary>
+/// <param name="sourceArray">Source matrices.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to negate.</param>
+void MatrixSimd::NegateBatch(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	Kernels().NegateArray(sourceArray, resultArray, length);
+}
+
+/// <summary>
+/// Transposes every matrix of an array.
+/// </summary>
+/// <param name="sourceArray">Source matrices.</param>
+/// <param name="resultArray">Destination array. May be the same array as the source.</param>
+/// <param name="length">The number of matrices to transpose.</param>
+void MatrixSimd::TransposeBatch(const Matrix* sourceArray, Matrix* resultArray, int length)
+{
+	Kernels().TransposeArray(sourceArray, resultArray, length);
+}
+
+/// <summary>
+/// Returns the name of the kernel set selected for this processor.
+/// </summary>
+const char* MatrixSimd::GetKernelName()
+{
+	return Kernels().Name;
+}
+
+const MatrixSimd::KernelTable& MatrixSimd::Kernels()
+{
+	static const KernelTable table = []()
+	{
+#if defined(PLUSGAME_X86)
+		// The AVX-512 set only replaces the element-wise kernels, which are bound by memory
+		// bandwidth and gain from the wider loads; everything else keeps the AVX kernels.
+		if (CpuFeatures::HasAVX512F())
+			return KernelTable{ "AVX-512", MultiplyAvx, MultiplyArrayAvx, MultiplyLeftArrayAvx, MultiplyRightArrayAvx, InvertGroupSse, ComposeArraySse, ComposeAffineArraySse,
+				BillboardArraySse, ConstrainedBillboardArraySse, ToRelativeArrayAvx, WriteArraySse, DecomposeArraySse,
+				AddArrayAvx512, SubtractArrayAvx512, LerpArrayAvx512, ScaleArrayAvx512, NegateArrayAvx512, TransposeArrayAvx512 };
+		if (CpuFeatures::HasAVX())
+			return KernelTable{ "AVX", MultiplyAvx, MultiplyArrayAvx, MultiplyLeftArrayAvx, MultiplyRightArrayAvx, InvertGroupSse, ComposeArraySse, ComposeAffineArraySse,
+				BillboardArraySse, ConstrainedBillboardArraySse, ToRelativeArrayAvx, WriteArraySse, DecomposeArraySse,
+				AddArrayAvx, SubtractArrayAvx, LerpArrayAvx, ScaleArrayAvx, NegateArrayAvx, TransposeArrayAvx };
+		return KernelTable{ "SSE", MultiplySse, MultiplyArraySse, MultiplyLeftArraySse, MultiplyRightArraySse, InvertGroupSse, ComposeArraySse, ComposeAffineArraySse,
+			BillboardArraySse, ConstrainedBillboardArraySse, ToRelativeArraySse, WriteArraySse, DecomposeArraySse,
+			AddArraySse, SubtractArraySse, LerpArraySse, ScaleArraySse, NegateArraySse, TransposeArraySse };
+#else
+		return KernelTable{ "Scalar", MultiplyScalar, MultiplyArrayScalar, MultiplyLeftArrayScalar, MultiplyRightArrayScalar, InvertGroupScalar, ComposeArrayScalar, ComposeAffineArrayScalar,
+			BillboardArrayScalar, ConstrainedBillboardArrayScalar, ToRelativeArrayScalar, WriteArrayScalar, DecomposeArrayScalar,
+			AddArrayScalar, SubtractArrayScalar, LerpArrayScalar, ScaleArrayScalar, NegateArrayScalar, TransposeArrayScalar };
+#endif
+	}();
+	return table;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "MatrixLayout.h"
+
+class Matrix;
+class AffineMatrix;
+class MatrixD;
+class Quaternion;
+struct Vector3;
+struct Vector3D;
+
+// Vectorized kernels behind the Matrix arithmetic. The widest instruction set supported by
+// the processor is picked once through CpuFeatures; every kernel keeps the scalar summation
+// order and avoids fused multiply-add, so results are bit-identical on every path.
+class MatrixSimd
+{
+public:
+	static void Multiply(const Matrix& matrix1, const Matrix& matrix2, Matrix& result);
+	static void MultiplyBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length);
+	static void MultiplyBatch(const Matrix& matrix1, const Matrix* matrix2Array, Matrix* resultArray, int length);
+	static void MultiplyBatch(const Matrix* matrix1Array, const Matrix& matrix2, Matrix* resultArray, int length);
+	static void InvertBatch(const Matrix* sourceArray, Matrix* destinationArray, int length, bool* singularArray, bool detectRigid);
+	static void CreateFromTRSBatch(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, Matrix* resultArray, int length);
+	static void CreateFromTRSBatch(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, AffineMatrix* resultArray, int length);
+	static void CreateBillboardBatch(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3* cameraForwardVector,
+		AffineMatrix* resultArray, int length);
+	static void CreateConstrainedBillboardBatch(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3* cameraForwardVector,
+		const Vector3* objectForwardVector, AffineMatrix* resultArray, int length);
+	static void ToRelativeBatch(const MatrixD* sourceArray, const Vector3D& origin, Matrix* resultArray, int length);
+	static void WriteBatch(const Matrix* sourceArray, float* destination, int length, MatrixLayout layout);
+	static void DecomposeBatch(const Matrix* sourceArray, Vector3* scaleArray, Quaternion* rotationArray, Vector3* translationArray, bool* successArray, int length);
+	static void AddBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length);
+	static void SubtractBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length);
+	static void LerpBatch(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length);
+	static void MultiplyBatch(const Matrix* matrix1Array, float scaleFactor, Matrix* resultArray, int length);
+	static void NegateBatch(const Matrix* sourceArray, Matrix* resultArray, int length);
+	static void TransposeBatch(const Matrix* sourceArray, Matrix* resultArray, int length);
+
+	// Name of the kernel set in use ("Scalar", "SSE", "AVX" or "AVX-512").
+	static const char* GetKernelName();
+
+private:
+	typedef void (*MultiplyKernel)(const Matrix& matrix1, const Matrix& matrix2, Matrix& result);
+	typedef void (*MultiplyArrayKernel)(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length);
+	typedef void (*MultiplyLeftArrayKernel)(const Matrix& matrix1, const Matrix* matrix2Array, Matrix* resultArray, int length);
+	typedef void (*MultiplyRightArrayKernel)(const Matrix* matrix1Array, const Matrix& matrix2, Matrix* resultArray, int length);
+	// Inverts up to four matrices at once and flags the singular ones.
+	typedef void (*InvertGroupKernel)(const Matrix* const* sources, Matrix* const* destinations, bool* singular, int count);
+	typedef void (*ComposeArrayKernel)(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, Matrix* resultArray, int length);
+	typedef void (*ComposeAffineArrayKernel)(const Vector3* scaleArray, const Quaternion* rotationArray, const Vector3* translationArray, AffineMatrix* resultArray, int length);
+	// The forward vector used for objects at the camera position is resolved once per batch.
+	typedef void (*BillboardArrayKernel)(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& cameraUpVector, const Vector3& fallbackForward,
+		AffineMatrix* resultArray, int length);
+	// So are the right and forward rows of the objects the camera sees along the axis.
+	typedef void (*ConstrainedBillboardArrayKernel)(const Vector3* objectPositionArray, const Vector3& cameraPosition, const Vector3& rotateAxis, const Vector3& fallbackForward,
+		const Vector3& parallelRight, const Vector3& parallelForward, AffineMatrix* resultArray, int length);
+	typedef void (*ToRelativeArrayKernel)(const MatrixD* sourceArray, const Vector3D& origin, Matrix* resultArray, int length);
+	typedef void (*WriteArrayKernel)(const Matrix* sourceArray, float* destination, int length, MatrixLayout layout);
+	typedef void (*DecomposeArrayKernel)(const Matrix* sourceArray, Vector3* scaleArray, Quaternion* rotationArray, Vector3* translationArray, bool* successArray, int length);
+	typedef void (*CombineArrayKernel)(const Matrix* matrix1Array, const Matrix* matrix2Array, Matrix* resultArray, int length);
+	typedef void (*LerpArrayKernel)(const Matrix* matrix1Array, const Matrix* matrix2Array, float amount, Matrix* resultArray, int length);
+	typedef void (*ScaleArrayKernel)(const Matrix* sourceArray, float scaleFactor, Matrix* resultArray, int length);
+	typedef void (*MapArrayKernel)(const Matrix* sourceArray, Matrix* resultArray, int length);
+
+	struct KernelTable
+	{
+		const char* Name;
+		MultiplyKernel Multiply;
+		MultiplyArrayKernel MultiplyArray;
+		MultiplyLeftArrayKernel MultiplyLeftArray;
+		MultiplyRightArrayKernel MultiplyRightArray;
+		InvertGroupKernel InvertGroup;
+		ComposeArrayKernel ComposeArray;
+		ComposeAffineArrayKernel ComposeAffineArray;
+		BillboardArrayKernel BillboardArray;
+		ConstrainedBillboardArrayKernel ConstrainedBillboardArray;
+		ToRelativeArrayKernel ToRelativeArray;
+		WriteArrayKernel WriteArray;
+		DecomposeArrayKernel DecomposeArray;
+		CombineArrayKernel AddArray;
+		CombineArrayKernel SubtractArray;
+		LerpArrayKernel LerpArray;
+		ScaleArrayKernel ScaleArray;
+		MapArrayKernel NegateArray;
+		MapArrayKernel TransposeArray;
+	};
+
+	static const KernelTable& Kernels();
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include <cmath>
+#include "CpuFeatures.h"
+#if defined(PLUSGAME_X86)
+#include <xmmintrin.h>
+#endif
+
+// Precision tiers of Normalize, from the slowest to the fastest.
+enum NormalizePrecision
+{
+	/// <summary>
+	/// Square root and divide in single precision, with the results of the Normalize overloads
+	/// of Vector3 and Vector4 without a policy.
+	/// </summary>
+	NormalizeExact,
+	/// <summary>
+	/// Reciprocal square root estimate refined by one Newton-Raphson step, within 1e-6 of the
+	/// exact length.
+	/// </summary>
+	NormalizeRefined,
+	/// <summary>
+	/// Reciprocal square root estimate alone, within 4e-4 of the exact length.
+	/// </summary>
+	NormalizeEstimate,
+	NormalizePrecisionCount
+};
+
+// Policies for Normalize<Precision>, one per tier. Each computes the reciprocal of a length
+// from its square; the batch kernels use the same instructions in the same order, so a batch
+// gives the results of the single-value overload on the same processor. Without SSE the
+// estimate tiers fall back to the exact computation.
+struct ExactPrecision
+{
+	static constexpr NormalizePrecision Value = NormalizeExact;
+
+	static float ReciprocalSqrt(float value) noexcept
+	{
+		return 1.0f / std::sqrt(value);
+	}
+};
+
+struct RefinedPrecision
+{
+	static constexpr NormalizePrecision Value = NormalizeRefined;
+
+	static float ReciprocalSqrt(float value) noexcept
+	{
+#if defined(PLUSGAME_X86)
+		float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+		return estimate * (1.5f - (((0.5f * value) * estimate) * estimate));
+#else
+		return 1.0f / std::sqrt(value);
+#endif
+	}
+};
+
+struct EstimatePrecision
+{
+	static constexpr NormalizePrecision Value = NormalizeEstimate;
+
+	static float ReciprocalSqrt(float value) noexcept
+	{
+#if defined(PLUSGAME_X86)
+		return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+#else
+		return 1.0f / std::sqrt(value);
+#endif
+	}
+};
@@ -0,0 +1,390 @@
+#include "PackedVector.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Quaternion.h"
+#include "MathHelper.h"
+#include "VectorSimd.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+static_assert(sizeof(Half3) == 6, "Half3 must be 3 tightly packed halves");
+static_assert(sizeof(Half4) == 8, "Half4 must be 4 tightly packed halves");
+static_assert(sizeof(Snorm16x3) == 6, "Snorm16x3 must be 3 tightly packed shorts");
+static_assert(sizeof(Snorm16x4) == 8, "Snorm16x4 must be 4 tightly packed shorts");
+static_assert(sizeof(Octahedral16) == 4, "Octahedral16 must be 2 tightly packed shorts");
+static_assert(sizeof(Snorm1010102) == 4, "Snorm1010102 must be a single 32-bit value");
+
+static void CheckCount(int sourceCount, int destinationCount)
+{
+	if (sourceCount != destinationCount)
+		throw std::out_of_range("Source and destination spans have different element counts");
+}
+
+// Rounds value, clamped to [-1, 1], to the nearest multiple of 1 / scale.
+static int PackSnorm(float value, float scale) noexcept
+{
+	return static_cast<int>(std::lrint(MathHelper::Clamp(value, -1.0f, 1.0f) * scale));
+}
+
+// The lowest value is one below -scale and also decodes to -1.
+static float UnpackSnorm(int value, float scale) noexcept
+{
+	return MathHelper::Max(static_cast<float>(value) / scale, -1.0f);
+}
+
+/// <summary>
+/// Converts a float to the nearest half-precision value. Values beyond the half range become
+/// infinities and NaNs stay NaNs, with the upper bits of their payload.
+/// </summary>
+uint16_t HalfHelper::Pack(float value) noexcept
+{
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	uint32_t sign = bits & 0x80000000u;
+	uint32_t magnitude = bits ^ sign;
+	uint32_t result;
+
+	if (magnitude >= 0x47800000u)
+	{
+		// 65536 and above, infinity or NaN
+		result = magnitude > 0x7F800000u ? 0x7E00u | ((magnitude >> 13) & 0x3FFu) : 0x7C00u;
+	}
+	else if (magnitude < 0x38800000u)
+	{
+		// Below the smallest normal half: adding 0.5 aligns the value on the half subnormal
+		// step, and the float addition rounds it.
+		float aligned;
+		std::memcpy(&aligned, &magnitude, sizeof(aligned));
+		aligned += 0.5f;
+		std::memcpy(&result, &aligned, sizeof(result));
+		result -= 0x3F000000u;
+	}
+	else
+	{
+		// Rebias the exponent and round the mantissa to nearest even; a carry into the
+		// exponent gives the next power of two, or infinity.
+		result = (magnitude + 0xC8000FFFu + ((magnitude >> 13) & 1u)) >> 13;
+	}
+	return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+/// <summary>
+/// Converts a half-precision value to a float, which is exact. NaNs come out quiet.
+/// </summary>
+float HalfHelper::Unpack(uint16_t value) noexcept
+{
+	uint32_t bits = (value & 0x7FFFu) << 13;
+	uint32_t exponent = bits & 0x0F800000u;
+	bits += 0x38000000u;
+
+	if (exponent == 0x0F800000u)
+	{
+		// Infinity or NaN
+		bits += 0x38000000u;
+		if ((bits & 0x007FFFFFu) != 0)
+			bits |= 0x00400000u;
+	}
+	else if (exponent == 0)
+	{
+		// Zero or subnormal, renormalized by the float subtraction
+		bits += 0x00800000u;
+		float renormalized;
+		std::memcpy(&renormalized, &bits, sizeof(renormalized));
+		renormalized -= 6.103515625e-05f;
+		std::memcpy(&bits, &renormalized, sizeof(bits));
+	}
+	bits |= (value & 0x8000u) << 16;
+
+	float result;
+	std::memcpy(&result, &bits, sizeof(result));
+	return result;
+}
+
+/// <summary>
+/// Packs the components of a <see cref="Vector3"/> into half precision.
+/// </summary>
+Half3::Half3(const Vector3& value) noexcept
+	: X(HalfHelper::Pack(value.X)), Y(HalfHelper::Pack(value.Y)), Z(HalfHelper::Pack(value.Z))
+{
+}
+
+Vector3 Half3::ToVector3() const noexcept
+{
+	return Vector3(HalfHelper::Unpack(X), HalfHelper::Unpack(Y), HalfHelper::Unpack(Z));
+}
+
+/// <summary>
+/// Packs every vector of a span into the span of <see cref="Half3"/> with the same count.
+/// </summary>
+void Half3::Pack(StridedSpan<const Vector3> source, StridedSpan<Half3> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::PackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Unpacks every <see cref="Half3"/> of a span into the span of vectors with the same count.
+/// </summary>
+void Half3::Unpack(StridedSpan<const Half3> source, StridedSpan<Vector3> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::UnpackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Packs the components of a <see cref="Vector4"/> into half precision.
+/// </summary>
+Half4::Half4(const Vector4& value) noexcept
+	: X(HalfHelper::Pack(value.X)), Y(HalfHelper::Pack(value.Y)), Z(HalfHelper::Pack(value.Z)), W(HalfHelper::Pack(value.W))
+{
+}
+
+/// <summary>
+/// Packs the components of a <see cref="Quaternion"/> into half precision.
+/// </summary>
+Half4::Half4(const Quaternion& value) noexcept
+	: X(HalfHelper::Pack(value.X)), Y(HalfHelper::Pack(value.Y)), Z(HalfHelper::Pack(value.Z)), W(HalfHelper::Pack(value.W))
+{
+}
+
+Vector4 Half4::ToVector4() const noexcept
+{
+	return Vector4(HalfHelper::Unpack(X), HalfHelper::Unpack(Y), HalfHelper::Unpack(Z), HalfHelper::Unpack(W));
+}
+
+Quaternion Half4::ToQuaternion() const noexcept
+{
+	return Quaternion(HalfHelper::Unpack(X), HalfHelper::Unpack(Y), HalfHelper::Unpack(Z), HalfHelper::Unpack(W));
+}
+
+/// <summary>
+/// Packs every vector of a span into the span of <see cref="Half4"/> with the same count.
+/// </summary>
+void Half4::Pack(StridedSpan<const Vector4> source, StridedSpan<Half4> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::PackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Packs every quaternion of a span into the span of <see cref="Half4"/> with the same count.
+/// </summary>
+void Half4::Pack(StridedSpan<const Quaternion> source, StridedSpan<Half4> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::PackStrided(reinterpret_cast<const Vector4*>(source.GetData()), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Unpacks every <see cref="Half4"/> of a span into the span of vectors with the same count.
+/// </summary>
+void Half4::Unpack(StridedSpan<const Half4> source, StridedSpan<Vector4> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::UnpackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Unpacks every <see cref="Half4"/> of a span into the span of quaternions with the same count.
+/// </summary>
+void Half4::Unpack(StridedSpan<const Half4> source, StridedSpan<Quaternion> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::UnpackStrided(source.GetData(), source.GetStride(), reinterpret_cast<Vector4*>(destination.GetData()), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Packs the components of a <see cref="Vector3"/>, clamped to [-1, 1].
+/// </summary>
+Snorm16x3::Snorm16x3(const Vector3& value) noexcept
+	: X(static_cast<int16_t>(PackSnorm(value.X, 32767.0f))), Y(static_cast<int16_t>(PackSnorm(value.Y, 32767.0f))),
+	Z(static_cast<int16_t>(PackSnorm(value.Z, 32767.0f)))
+{
+}
+
+Vector3 Snorm16x3::ToVector3() const noexcept
+{
+	return Vector3(UnpackSnorm(X, 32767.0f), UnpackSnorm(Y, 32767.0f), UnpackSnorm(Z, 32767.0f));
+}
+
+/// <summary>
+/// Packs every vector of a span into the span of <see cref="Snorm16x3"/> with the same count.
+/// </summary>
+void Snorm16x3::Pack(StridedSpan<const Vector3> source, StridedSpan<Snorm16x3> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::PackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Unpacks every <see cref="Snorm16x3"/> of a span into the span of vectors with the same count.
+/// </summary>
+void Snorm16x3::Unpack(StridedSpan<const Snorm16x3> source, StridedSpan<Vector3> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::UnpackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Packs the components of a <see cref="Vector4"/>, clamped to [-1, 1].
+/// </summary>
+Snorm16x4::Snorm16x4(const Vector4& value) noexcept
+	: X(static_cast<int16_t>(PackSnorm(value.X, 32767.0f))), Y(static_cast<int16_t>(PackSnorm(value.Y, 32767.0f))),
+	Z(static_cast<int16_t>(PackSnorm(value.Z, 32767.0f))), W(static_cast<int16_t>(PackSnorm(value.W, 32767.0f)))
+{
+}
+
+/// <summary>
+/// Packs the components of a unit <see cref="Quaternion"/>.
+/// </summary>
+Snorm16x4::Snorm16x4(const Quaternion& value) noexcept
+	: X(static_cast<int16_t>(PackSnorm(value.X, 32767.0f))), Y(static_cast<int16_t>(PackSnorm(value.Y, 32767.0f))),
+	Z(static_cast<int16_t>(PackSnorm(value.Z, 32767.0f))), W(static_cast<int16_t>(PackSnorm(value.W, 32767.0f)))
+{
+}
+
+Vector4 Snorm16x4::ToVector4() const noexcept
+{
+	return Vector4(UnpackSnorm(X, 32767.0f), UnpackSnorm(Y, 32767.0f), UnpackSnorm(Z, 32767.0f), UnpackSnorm(W, 32767.0f));
+}
+
+/// <summary>
+/// Unpacks the quaternion as stored; it is within 3e-5 of unit length and can be normalized if needed.
+/// </summary>
+Quaternion Snorm16x4::ToQuaternion() const noexcept
+{
+	return Quaternion(UnpackSnorm(X, 32767.0f), UnpackSnorm(Y, 32767.0f), UnpackSnorm(Z, 32767.0f), UnpackSnorm(W, 32767.0f));
+}
+
+/// <summary>
+/// Packs every vector of a span into the span of <see cref="Snorm16x4"/> with the same count.
+/// </summary>
+void Snorm16x4::Pack(StridedSpan<const Vector4> source, StridedSpan<Snorm16x4> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::PackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Packs every quaternion of a span into the span of <see cref="Snorm16x4"/> with the same count.
+/// </summary>
+void Snorm16x4::Pack(StridedSpan<const Quaternion> source, StridedSpan<Snorm16x4> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::PackStrided(reinterpret_cast<const Vector4*>(source.GetData()), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Unpacks every <see cref="Snorm16x4"/> of a span into the span of vectors with the same count.
+/// </summary>
+void Snorm16x4::Unpack(StridedSpan<const Snorm16x4> source, StridedSpan<Vector4> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::UnpackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Unpacks every <see cref="Snorm16x4"/> of a span into the span of quaternions with the same count.
+/// </summary>
+void Snorm16x4::Unpack(StridedSpan<const Snorm16x4> source, StridedSpan<Quaternion> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::UnpackStrided(source.GetData(), source.GetStride(), reinterpret_cast<Vector4*>(destination.GetData()), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Encodes the direction of a non-zero <see cref="Vector3"/>.
+/// </summary>
+Octahedral16::Octahedral16(const Vector3& value) noexcept
+{
+	float inverseNorm = 1.0f / ((std::fabs(value.X) + std::fabs(value.Y)) + std::fabs(value.Z));
+	float u = value.X * inverseNorm;
+	float v = value.Y * inverseNorm;
+	if (value.Z < 0.0f)
+	{
+		float foldedU = (1.0f - std::fabs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+		float foldedV = (1.0f - std::fabs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+		u = foldedU;
+		v = foldedV;
+	}
+	X = static_cast<int16_t>(PackSnorm(u, 32767.0f));
+	Y = static_cast<int16_t>(PackSnorm(v, 32767.0f));
+}
+
+/// <summary>
+/// Decodes the unit vector.
+/// </summary>
+Vector3 Octahedral16::ToVector3() const noexcept
+{
+	float u = UnpackSnorm(X, 32767.0f);
+	float v = UnpackSnorm(Y, 32767.0f);
+	float z = (1.0f - std::fabs(u)) - std::fabs(v);
+	float fold = MathHelper::Max(-z, 0.0f);
+	u += u >= 0.0f ? -fold : fold;
+	v += v >= 0.0f ? -fold : fold;
+
+	Vector3 result(u, v, z);
+	result.Normalize();
+	return result;
+}
+
+/// <summary>
+/// Encodes every vector of a span into the span of <see cref="Octahedral16"/> with the same count.
+/// </summary>
+void Octahedral16::Pack(StridedSpan<const Vector3> source, StridedSpan<Octahedral16> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::PackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Decodes every <see cref="Octahedral16"/> of a span into the span of unit vectors with the same count.
+/// </summary>
+void Octahedral16::Unpack(StridedSpan<const Octahedral16> source, StridedSpan<Vector3> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::UnpackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Packs the components of a <see cref="Vector4"/>, clamped to [-1, 1].
+/// </summary>
+Snorm1010102::Snorm1010102(const Vector4& value) noexcept
+{
+	auto x = static_cast<uint32_t>(PackSnorm(value.X, 511.0f)) & 0x3FFu;
+	auto y = static_cast<uint32_t>(PackSnorm(value.Y, 511.0f)) & 0x3FFu;
+	auto z = static_cast<uint32_t>(PackSnorm(value.Z, 511.0f)) & 0x3FFu;
+	auto w = static_cast<uint32_t>(PackSnorm(value.W, 1.0f)) & 0x3u;
+	PackedValue = x | (y << 10) | (z << 20) | (w << 30);
+}
+
+Vector4 Snorm1010102::ToVector4() const noexcept
+{
+	// Shifting each field to the top and back sign-extends it.
+	auto packed = static_cast<int32_t>(PackedValue);
+	return Vector4(
+		UnpackSnorm(static_cast<int32_t>(PackedValue << 22) >> 22, 511.0f),
+		UnpackSnorm(static_cast<int32_t>(PackedValue << 12) >> 22, 511.0f),
+		UnpackSnorm(static_cast<int32_t>(PackedValue << 2) >> 22, 511.0f),
+		UnpackSnorm(packed >> 30, 1.0f));
+}
+
+/// <summary>
+/// Packs every vector of a span into the span of <see cref="Snorm1010102"/> with the same count.
+/// </summary>
+void Snorm1010102::Pack(StridedSpan<const Vector4> source, StridedSpan<Snorm1010102> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::PackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Unpacks every <see cref="Snorm1010102"/> of a span into the span of vectors with the same count.
+/// </summary>
+void Snorm1010102::Unpack(StridedSpan<const Snorm1010102> source, StridedSpan<Vector4> destination)
+{
+	CheckCount(source.GetCount(), destination.GetCount());
+	VectorSimd::UnpackStrided(source.GetData(), source.GetStride(), destination.GetData(), destination.GetStride(), source.GetCount());
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include <cstdint>
+#include "StridedSpan.h"
+
+struct Vector3;
+class Vector4;
+class Quaternion;
+
+// Compact storage formats for positions, normals and rotations. Single values convert through
+// the constructors and the To methods; spans convert in bulk through Pack and Unpack, which run
+// the VectorSimd kernels, give the same results as the single-value conversions, and throw
+// std::out_of_range if the element counts differ. Packing rounds to the nearest representable
+// value and clamps to the range of the format.
+
+// Conversions between float and IEEE 754 half precision, with the rounding to nearest even and
+// the results of the F16C instructions.
+class HalfHelper
+{
+public:
+	static uint16_t Pack(float value) noexcept;
+	static float Unpack(uint16_t value) noexcept;
+};
+
+// Three half-precision floats (6 bytes).
+struct Half3
+{
+	uint16_t X;
+	uint16_t Y;
+	uint16_t Z;
+
+	constexpr Half3() noexcept : X(0), Y(0), Z(0) {}
+	explicit Half3(const Vector3& value) noexcept;
+
+	Vector3 ToVector3() const noexcept;
+
+	static void Pack(StridedSpan<const Vector3> source, StridedSpan<Half3> destination);
+	static void Unpack(StridedSpan<const Half3> source, StridedSpan<Vector3> destination);
+};
+
+// Four half-precision floats (8 bytes).
+struct Half4
+{
+	uint16_t X;
+	uint16_t Y;
+	uint16_t Z;
+	uint16_t W;
+
+	constexpr Half4() noexcept : X(0), Y(0), Z(0), W(0) {}
+	explicit Half4(const Vector4& value) noexcept;
+	explicit Half4(const Quaternion& value) noexcept;
+
+	Vector4 ToVector4() const noexcept;
+	Quaternion ToQuaternion() const noexcept;
+
+	static void Pack(StridedSpan<const Vector4> source, StridedSpan<Half4> destination);
+	static void Pack(StridedSpan<const Quaternion> source, StridedSpan<Half4> destination);
+	static void Unpack(StridedSpan<const Half4> source, StridedSpan<Vector4> destination);
+	static void Unpack(StridedSpan<const Half4> source, StridedSpan<Quaternion> destination);
+};
+
+// Three components in [-1, 1] stored as multiples of 1 / 32767 (6 bytes).
+struct Snorm16x3
+{
+	int16_t X;
+	int16_t Y;
+	int16_t Z;
+
+	constexpr Snorm16x3() noexcept : X(0), Y(0), Z(0) {}
+	explicit Snorm16x3(const Vector3& value) noexcept;
+
+	Vector3 ToVector3() const noexcept;
+
+	static void Pack(StridedSpan<const Vector3> source, StridedSpan<Snorm16x3> destination);
+	static void Unpack(StridedSpan<const Snorm16x3> source, StridedSpan<Vector3> destination);
+};
+
+// Four components in [-1, 1] stored as multiples of 1 / 32767 (8 bytes), enough for the
+// rotations of an animation.
+struct Snorm16x4
+{
+	int16_t X;
+	int16_t Y;
+	int16_t Z;
+	int16_t W;
+
+	constexpr Snorm16x4() noexcept : X(0), Y(0), Z(0), W(0) {}
+	explicit Snorm16x4(const Vector4& value) noexcept;
+	explicit Snorm16x4(const Quaternion& value) noexcept;
+
+	Vector4 ToVector4() const noexcept;
+	Quaternion ToQuaternion() const noexcept;
+
+	static void Pack(StridedSpan<const Vector4> source, StridedSpan<Snorm16x4> destination);
+	static void Pack(StridedSpan<const Quaternion> source, StridedSpan<Snorm16x4> destination);
+	static void Unpack(StridedSpan<const Snorm16x4> source, StridedSpan<Vector4> destination);
+	static void Unpack(StridedSpan<const Snorm16x4> source, StridedSpan<Quaternion> destination);
+};
+
+// A unit vector mapped onto the octahedron |x| + |y| + |z| = 1, whose lower half is folded over
+// the upper one, and stored as the two Snorm16 coordinates of the unfolded square (4 bytes).
+// Decoded vectors are normalized and within 7e-5 radians of the encoded direction.
+struct Octahedral16
+{
+	int16_t X;
+	int16_t Y;
+
+	constexpr Octahedral16() noexcept : X(0), Y(0) {}
+	explicit Octahedral16(const Vector3& value) noexcept;
+
+	Vector3 ToVector3() const noexcept;
+
+	static void Pack(StridedSpan<const Vector3> source, StridedSpan<Octahedral16> destination);
+	static void Unpack(StridedSpan<const Octahedral16> source, StridedSpan<Vector3> destination);
+};
+
+// X, Y and Z in [-1, 1] as 10-bit multiples of 1 / 511 and W as a 2-bit -1, 0 or 1, such as
+// the handedness of a tangent frame (4 bytes). X is in the low bits.
+struct Snorm1010102
+{
+	uint32_t PackedValue;
+
+	constexpr Snorm1010102() noexcept : PackedValue(0) {}
+	explicit Snorm1010102(const Vector4& value) noexcept;
+
+	Vector4 ToVector4() const noexcept;
+
+	static void Pack(StridedSpan<const Vector4> source, StridedSpan<Snorm1010102> destination);
+	static void Unpack(StridedSpan<const Snorm1010102> source, StridedSpan<Vector4> destination);
+};
@@ -0,0 +1,178 @@
+#include "Parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Ranges are cut into at most this many chunks per thread, so threads that finish early can
+// pick up the remaining work without making the chunks too small to amortize the atomics.
+static const int ChunksPerThread = 4;
+
+static thread_local bool insideWorker = false;
+
+// Workers sleep on a condition variable until a new generation of work is published, then
+// claim chunks through an atomic counter alongside the calling thread.
+class WorkerPool
+{
+public:
+	WorkerPool()
+	{
+		auto hardwareThreads = (int)std::thread::hardware_concurrency();
+		for (auto i = 1; i < hardwareThreads; i++)
+			_threads.emplace_back([this]() { Run(); });
+	}
+
+	~WorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+		}
+		_wake.notify_all();
+		for (auto& thread : _threads)
+			thread.join();
+	}
+
+	int GetThreadCount() const
+	{
+		return (int)_threads.size() + 1;
+	}
+
+	// Runs one parallel loop; returns false without doing anything if the pool is busy.
+	bool TryExecute(int count, int chunkSize, const std::function<void(int begin, int end)>& body)
+	{
+		std::unique_lock<std::mutex> owner(_owner, std::try_to_lock);
+		if (!owner.owns_lock())
+			return false;
+
+		auto chunkCount = (count + chunkSize - 1) / chunkSize;
+		{
+			// Workers still leaving the previous loop must not see the new state half written.
+			std::unique_lock<std::mutex> lock(_mutex);
+			_done.wait(lock, [this]() { return _busy == 0; });
+			_body = &body;
+			_count = count;
+			_chunkSize = chunkSize;
+			_chunkCount = chunkCount;
+			_nextChunk = 0;
+			_pending = chunkCount;
+			_generation++;
+		}
+		_wake.notify_all();
+
+		RunChunks();
+
+		std::unique_lock<std::mutex> lock(_mutex);
+		_done.wait(lock, [this]() { return _pending == 0; });
+		_body = nullptr;
+		return true;
+	}
+
+private:
+	std::vector<std::thread> _threads;
+	std::mutex _owner;
+	std::mutex _mutex;
+	std::condition_variable _wake;
+	std::condition_variable _done;
+	bool _stopping = false;
+	unsigned long long _generation = 0;
+	int _busy = 0;
+
+	const std::function<void(int begin, int end)>* _body = nullptr;
+	int _count = 0;
+	int _chunkSize = 0;
+	int _chunkCount = 0;
+	std::atomic<int> _nextChunk{ 0 };
+	std::atomic<int> _pending{ 0 };
+
+	void Run()
+	{
+		insideWorker = true;
+		unsigned long long seen = 0;
+		std::unique_lock<std::mutex> lock(_mutex);
+		for (;;)
+		{
+			_wake.wait(lock, [&]() { return _stopping || _generation != seen; });
+			if (_stopping)
+				return;
+			seen = _generation;
+			_busy++;
+			lock.unlock();
+
+			RunChunks();
+
+			lock.lock();
+			_busy--;
+			if (_busy == 0)
+				_done.notify_all();
+		}
+	}
+
+	void RunChunks()
+	{
+		for (;;)
+		{
+			auto chunk = _nextChunk.fetch_add(1);
+			if (chunk >= _chunkCount)
+				return;
+			auto begin = chunk * _chunkSize;
+			auto end = std::min(begin + _chunkSize, _count);
+			(*_body)(begin, end);
+			if (_pending.fetch_sub(1) == 1)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_done.notify_all();
+			}
+		}
+	}
+};
+
+static WorkerPool& Pool()
+{
+	static WorkerPool pool;
+	return pool;
+}
+
+/// <summary>
+/// Calls <paramref name="body"/> on consecutive sub-ranges of [0, <paramref name="count"/>) on the worker threads and the calling thread.
+/// Ranges no larger than <paramref name="grainSize"/>, nested calls and calls made while the pool is busy run serially on the calling thread.
+/// The body must not throw.
+/// </summary>
+/// <param name="count">Number of indices to process.</param>
+/// <param name="grainSize">Smallest number of indices handed to one call of the body.</param>
+/// <param name="body">Function processing the indices from begin (inclusive) to end (exclusive).</param>
+void Parallel::For(int count, int grainSize, const std::function<void(int begin, int end)>& body)
+{
+	if (count <= 0)
+		return;
+
+	grainSize = std::max(grainSize, 1);
+	if (count <= grainSize || insideWorker)
+	{
+		body(0, count);
+		return;
+	}
+
+	auto& pool = Pool();
+	auto threadCount = pool.GetThreadCount();
+	if (threadCount == 1)
+	{
+		body(0, count);
+		return;
+	}
+
+	auto chunkCount = threadCount * ChunksPerThread;
+	auto chunkSize = std::max(grainSize, (count + chunkCount - 1) / chunkCount);
+	if (!pool.TryExecute(count, chunkSize, body))
+		body(0, count);
+}
+
+/// <summary>
+/// Returns the number of threads that take part in <see cref="Parallel.For"/>, including the calling thread.
+/// </summary>
+int Parallel::GetThreadCount()
+{
+	return Pool().GetThreadCount();
+}
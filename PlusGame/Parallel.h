@@ -0,0 +1,16 @@
+#pragma once
+#include <functional>
+
+// Splits index ranges across a pool of worker threads that is started on first use and kept
+// for the lifetime of the process. The calling thread takes part in the work, and a call made
+// from inside a worker, or while another thread owns the pool, runs serially.
+class Parallel
+{
+public:
+	// Calls body(begin, end) on consecutive sub-ranges of [0, count) of at least grainSize
+	// indices and returns once all of them are done.
+	static void For(int count, int grainSize, const std::function<void(int begin, int end)>& body);
+
+	// Number of threads that take part in a parallel loop, including the caller.
+	static int GetThreadCount();
+};
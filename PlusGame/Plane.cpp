@@ -1,17 +1,20 @@
 #include "Plane.h" 
+#include "BoundingBox.h"
+#include "BoundingFrustum.h"
+#include "BoundingSphere.h"
 
 
-Plane::Plane(Vector4 value)
+Plane::Plane(Vector4 value) noexcept
 	: Plane(Vector3(value.X, value.Y, value.Z), value.W)
 {
 }
 
-Plane::Plane(Vector3 normal, float d)
+Plane::Plane(Vector3 normal, float d) noexcept
 	: Normal(normal), D(d)
 {
 }
 
-Plane::Plane(Vector3 a, Vector3 b, Vector3 c)
+Plane::Plane(Vector3 a, Vector3 b, Vector3 c) noexcept
 {
 	Vector3 ab = b - a;
 	Vector3 ac = c - a;
@@ -21,12 +24,12 @@ Plane::Plane(Vector3 a, Vector3 b, Vector3 c)
 	D = -(Vector3::Dot(Normal, a));
 }
 
-Plane::Plane(float a, float b, float c, float d)
+Plane::Plane(float a, float b, float c, float d) noexcept
 	: Plane(Vector3(a, b, c), d)
 {
 }
 
-Plane::Plane(Vector3 pointOnPlane, Vector3 normal)
+Plane::Plane(Vector3 pointOnPlane, Vector3 normal) noexcept
 	: Normal(normal)
 {
 	D = -(
@@ -36,44 +39,14 @@ Plane::Plane(Vector3 pointOnPlane, Vector3 normal)
 		);
 }
 
-float Plane::Dot(Vector4 value)
-{
-	return ((((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z)) + (D * value.W));
-}
-
-void Plane::Dot(Vector4& value, float& result)
-{
-	result = (((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z)) + (D * value.W);
-}
-
-float Plane::DotCoordinate(Vector3 value)
-{
-	return ((((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z)) + D);
-}
-
-void Plane::DotCoordinate(Vector3& value, float& result)
-{
-	result = (((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z)) + D;
-}
-
-float Plane::DotNormal(Vector3 value)
-{
-	return (((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z));
-}
-
-void Plane::DotNormal(Vector3& value, float& result)
-{
-	result = ((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z);
-}
-
-Plane Plane::Transform(Plane plane, Matrix matrix)
+Plane Plane::Transform(Plane plane, const Matrix& matrix) noexcept
 {
 	Plane result;
 	Transform(plane, matrix, result);
 	return result;
 }
 
-void Plane::Transform(Plane& plane, Matrix& matrix, Plane& result)
+void Plane::Transform(const Plane& plane, const Matrix& matrix, Plane& result) noexcept
 {
 	Matrix transformedMatrix;
 	Matrix::Invert(matrix, transformedMatrix);
@@ -87,20 +60,20 @@ void Plane::Transform(Plane& plane, Matrix& matrix, Plane& result)
 	result = Plane(transformedVector);
 }
 
-Plane Plane::Transform(Plane plane, Quaternion rotation)
+Plane Plane::Transform(Plane plane, Quaternion rotation) noexcept
 {
 	Plane result;
 	Transform(plane, rotation, result);
 	return result;
 }
 
-void Plane::Transform(Plane& plane, Quaternion& rotation, Plane& result)
+void Plane::Transform(const Plane& plane, const Quaternion& rotation, Plane& result) noexcept
 {
 	Vector3::Transform(plane.Normal, rotation, result.Normal);
 	result.D = plane.D;
 }
 
-void Plane::Normalize()
+void Plane::Normalize() noexcept
 {
 	float length = Vector3::Length(Normal);
 	float factor = 1.0f / length;
@@ -108,14 +81,14 @@ void Plane::Normalize()
 	D = D * factor;
 }
 
-Plane Plane::Normalize(Plane value)
+Plane Plane::Normalize(Plane value) noexcept
 {
 	Plane ret;
 	Normalize(value, ret);
 	return ret;
 }
 
-void Plane::Normalize(Plane& value, Plane& result)
+void Plane::Normalize(const Plane& value, Plane& result) noexcept
 {
 	float length = Vector3::Length(value.Normal);
 	float factor = 1.0f / length;
@@ -123,52 +96,52 @@ void Plane::Normalize(Plane& value, Plane& result)
 	result.D = value.D * factor;
 }
 
-bool Plane::operator!=(Plane& other)
+bool Plane::operator!=(const Plane& other) const noexcept
 {
 	return !Equals(other);
 }
 
-bool Plane::operator==(Plane& other)
+bool Plane::operator==(const Plane& other) const noexcept
 {
 	return Equals(other);
 }
 
-bool Plane::Equals(Plane& other)
+bool Plane::Equals(const Plane& other) const noexcept
 {
 	return (Normal == other.Normal) && (D == other.D);
 }
 
-int Plane::GetHashCode()
+int Plane::GetHashCode() const noexcept
 {
 	return 0; //Normal.GetHashCode() ^ std::hash<float>{}(D);
 }
 
-PlaneIntersectionType Plane::Intersects(BoundingBox box)
+PlaneIntersectionType Plane::Intersects(const BoundingBox& box) const noexcept
 {
 	return box.Intersects(*this);
 }
 
-void Plane::Intersects(BoundingBox& box, PlaneIntersectionType& result)
+void Plane::Intersects(const BoundingBox& box, PlaneIntersectionType& result) const noexcept
 {
 	box.Intersects(*this, result);
 }
 
-PlaneIntersectionType Plane::Intersects(BoundingFrustum frustum)
+PlaneIntersectionType Plane::Intersects(const BoundingFrustum& frustum) const noexcept
 {
 	return frustum.Intersects(*this);
 }
 
-PlaneIntersectionType Plane::Intersects(BoundingSphere sphere)
+PlaneIntersectionType Plane::Intersects(BoundingSphere sphere) const noexcept
 {
 	return sphere.Intersects(*this);
 }
 
-void Plane::Intersects(BoundingSphere& sphere, PlaneIntersectionType& result)
+void Plane::Intersects(const BoundingSphere& sphere, PlaneIntersectionType& result) const noexcept
 {
 	sphere.Intersects(*this, result);
 }
 
-PlaneIntersectionType Plane::Intersects(Vector3& point)
+PlaneIntersectionType Plane::Intersects(const Vector3& point) const noexcept
 {
 	float distance;
 	DotCoordinate(point, distance);
@@ -182,7 +155,7 @@ PlaneIntersectionType Plane::Intersects(Vector3& point)
 	return PlaneIntersectionType::Intersecting;
 }
 
-void Plane::Deconstruct(Vector3& normal, float& d)
+void Plane::Deconstruct(Vector3& normal, float& d) const noexcept
 {
 	normal = Normal;
 	d = D;
@@ -194,7 +167,7 @@ void Plane::Deconstruct(Vector3& normal, float& d)
 /// <param name="point">The point to check with</param>
 /// <param name="plane">The plane to check against</param>
 /// <returns>Greater than zero if on the positive side, less than zero if on the negative size, 0 otherwise</returns>
-float Plane::ClassifyPoint(Vector3& point, Plane& plane)
+float Plane::ClassifyPoint(const Vector3& point, const Plane& plane) noexcept
 {
 	return point.X * plane.Normal.X + point.Y * plane.Normal.Y + point.Z * plane.Normal.Z + plane.D;
 }
@@ -205,7 +178,7 @@ float Plane::ClassifyPoint(Vector3& point, Plane& plane)
 /// <param name="point">The point to check</param>
 /// <param name="plane">The place to check</param>
 /// <returns>The perpendicular distance from the point to the plane</returns>
-float Plane::PerpendicularDistance(Vector3& point, Plane& plane)
+float Plane::PerpendicularDistance(const Vector3& point, const Plane& plane) noexcept
 {
 	// dist = (ax + by + cz + d) / sqrt(a*a + b*b + c*c)
 	return (float)abs((plane.Normal.X * point.X + plane.Normal.Y * point.Y + plane.Normal.Z * point.Z)
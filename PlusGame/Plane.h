@@ -4,9 +4,11 @@
 #include "Vector4.h"
 #include "Matrix.h"
 #include "Quaternion.h"
-#include "BoundingBox.h"
-#include "BoundingFrustum.h"
-#include "BoundingSphere.h" 
+#include "IntersectionEnums.h"
+
+class BoundingBox;
+class BoundingFrustum;
+class BoundingSphere;
 
 class Plane
 {
@@ -14,45 +16,75 @@ public:
 	float D;
 	Vector3 Normal;
 
-	Plane() { Plane(0); };
-	Plane(Vector4 value);
-	Plane(Vector3 normal, float d);
-	Plane(Vector3 a, Vector3 b, Vector3 c);
-	Plane(float a, float b, float c, float d);
-	Plane(Vector3 pointOnPlane, Vector3 normal);
+	Plane() noexcept : D(0), Normal() {}
+	Plane(Vector4 value) noexcept;
+	Plane(Vector3 normal, float d) noexcept;
+	Plane(Vector3 a, Vector3 b, Vector3 c) noexcept;
+	Plane(float a, float b, float c, float d) noexcept;
+	Plane(Vector3 pointOnPlane, Vector3 normal) noexcept;
 
-	float Dot(Vector4 value);
-	void Dot(Vector4& value, float& result);
-	float DotCoordinate(Vector3 value);
-	void DotCoordinate(Vector3& value, float& result);
-	float DotNormal(Vector3 value);
-	void DotNormal(Vector3& value, float& result);
+	float Dot(Vector4 value) const noexcept;
+	void Dot(const Vector4& value, float& result) const noexcept;
+	float DotCoordinate(Vector3 value) const noexcept;
+	void DotCoordinate(const Vector3& value, float& result) const noexcept;
+	float DotNormal(Vector3 value) const noexcept;
+	void DotNormal(const Vector3& value, float& result) const noexcept;
 
-	static Plane Transform(Plane plane, Matrix matrix);
-	static void Transform(Plane& plane, Matrix& matrix, Plane& result);
-	static Plane Transform(Plane plane, Quaternion rotation);
-	static void Transform(Plane& plane, Quaternion& rotation, Plane& result);
+	static Plane Transform(Plane plane, const Matrix& matrix) noexcept;
+	static void Transform(const Plane& plane, const Matrix& matrix, Plane& result) noexcept;
+	static Plane Transform(Plane plane, Quaternion rotation) noexcept;
+	static void Transform(const Plane& plane, const Quaternion& rotation, Plane& result) noexcept;
 
-	void Normalize();
-	static Plane Normalize(Plane value);
-	static void Normalize(Plane& value, Plane& result);
+	void Normalize() noexcept;
+	static Plane Normalize(Plane value) noexcept;
+	static void Normalize(const Plane& value, Plane& result) noexcept;
 
-	bool operator!=(Plane& other);
-	bool operator==(Plane& other);
+	bool operator!=(const Plane& other) const noexcept;
+	bool operator==(const Plane& other) const noexcept;
 
-	bool Equals(Plane& other);
-	int GetHashCode();
+	bool Equals(const Plane& other) const noexcept;
+	int GetHashCode() const noexcept;
 
-	PlaneIntersectionType Intersects(BoundingBox box);
-	void Intersects(BoundingBox& box, PlaneIntersectionType& result);
-	PlaneIntersectionType Intersects(BoundingFrustum frustum);
-	PlaneIntersectionType Intersects(BoundingSphere sphere);
-	void Intersects(BoundingSphere& sphere, PlaneIntersectionType& result);
+	PlaneIntersectionType Intersects(const BoundingBox& box) const noexcept;
+	void Intersects(const BoundingBox& box, PlaneIntersectionType& result) const noexcept;
+	PlaneIntersectionType Intersects(const BoundingFrustum& frustum) const noexcept;
+	PlaneIntersectionType Intersects(BoundingSphere sphere) const noexcept;
+	void Intersects(const BoundingSphere& sphere, PlaneIntersectionType& result) const noexcept;
 
-	PlaneIntersectionType Intersects(Vector3& point);
+	PlaneIntersectionType Intersects(const Vector3& point) const noexcept;
 
-	void Deconstruct(Vector3& normal, float& d);
+	void Deconstruct(Vector3& normal, float& d) const noexcept;
 
-	static float ClassifyPoint(Vector3& point, Plane& plane);
-	static float PerpendicularDistance(Vector3& point, Plane& plane);
+	static float ClassifyPoint(const Vector3& point, const Plane& plane) noexcept;
+	static float PerpendicularDistance(const Vector3& point, const Plane& plane) noexcept;
 };
+
+inline float Plane::Dot(Vector4 value) const noexcept
+{
+	return ((((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z)) + (D * value.W));
+}
+
+inline void Plane::Dot(const Vector4& value, float& result) const noexcept
+{
+	result = (((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z)) + (D * value.W);
+}
+
+inline float Plane::DotCoordinate(Vector3 value) const noexcept
+{
+	return ((((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z)) + D);
+}
+
+inline void Plane::DotCoordinate(const Vector3& value, float& result) const noexcept
+{
+	result = (((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z)) + D;
+}
+
+inline float Plane::DotNormal(Vector3 value) const noexcept
+{
+	return (((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z));
+}
+
+inline void Plane::DotNormal(const Vector3& value, float& result) const noexcept
+{
+	result = ((Normal.X * value.X) + (Normal.Y * value.Y)) + (Normal.Z * value.Z);
+}
@@ -1,18 +1,7 @@
 #include "Point.h"
+#include "Vector2.h"
 
-Point::Point(int x, int y)
-{
-	this->X = x;
-	this->Y = y;
-}
-
-Point::Point(int value)
-{
-	X = value;
-	Y = value;
-}
-
-size_t Point::GetHashCode() const {
+size_t Point::GetHashCode() const noexcept {
 	size_t hash = 17;
 	hash = hash * 23 + std::hash<int>()(X);
 	hash = hash * 23 + std::hash<int>()(Y);
@@ -23,11 +12,11 @@ std::string Point::ToString() const {
 	return "{X:" + std::to_string(X) + " Y:" + std::to_string(Y) + "}";
 }
 
-Vector2 Point::ToVector2() const {
+Vector2 Point::ToVector2() const noexcept {
 	return Vector2(X, Y);
 }
 
-void Point::Deconstruct(int& x, int& y) const {
+void Point::Deconstruct(int& x, int& y) const noexcept {
 	x = X;
 	y = Y;
 }
@@ -1,42 +1,44 @@
 #pragma once
 #include <string>
-#include "Vector2.h"
+
+struct Vector2;
+
 struct Point
 {
 public:
 	int X;
 	int Y;
 
-	Point(int x, int y) : X(x), Y(y) {}
-	Point(int value) : X(value), Y(value) {}
+	Point(int x, int y) noexcept : X(x), Y(y) {}
+	Point(int value) noexcept : X(value), Y(value) {}
 
-	Point operator+(const Point& value2) const {
+	Point operator+(const Point& value2) const noexcept {
 		return Point(X + value2.X, Y + value2.Y);
 	}
 
-	Point operator-(const Point& value2) const {
+	Point operator-(const Point& value2) const noexcept {
 		return Point(X - value2.X, Y - value2.Y);
 	}
 
-	Point operator*(const Point& value2) const {
+	Point operator*(const Point& value2) const noexcept {
 		return Point(X * value2.X, Y * value2.Y);
 	}
 
-	Point operator/(const Point& divisor) const {
+	Point operator/(const Point& divisor) const noexcept {
 		return Point(X / divisor.X, Y / divisor.Y);
 	}
 
-	bool operator==(const Point& other) const {
+	bool operator==(const Point& other) const noexcept {
 		return X == other.X && Y == other.Y;
 	}
 
-	bool operator!=(const Point& other) const {
+	bool operator!=(const Point& other) const noexcept {
 		return !(*this == other);
 	}
 
-	size_t GetHashCode() const;
+	size_t GetHashCode() const noexcept;
 	std::string ToString() const;
-	Vector2 ToVector2() const;
-	void Deconstruct(int& x, int& y) const;
+	Vector2 ToVector2() const noexcept;
+	void Deconstruct(int& x, int& y) const noexcept;
 };
 
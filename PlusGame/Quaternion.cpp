@@ -1,7 +1,7 @@
 #include "Quaternion.h"
+#include "Matrix.h"
 
-const Quaternion Quaternion::Identity(0, 0, 0, 1);
-Quaternion& Quaternion::operator=(const Quaternion& other)
+Quaternion& Quaternion::operator=(const Quaternion& other) noexcept
 {
 	if (this != &other)
 	{
@@ -13,12 +13,12 @@ Quaternion& Quaternion::operator=(const Quaternion& other)
 	return *this;
 }
 
-Quaternion Quaternion::Add(const Quaternion& quaternion1, const Quaternion& quaternion2)
+Quaternion Quaternion::Add(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept
 {
 	return Quaternion(quaternion1.X + quaternion2.X, quaternion1.Y + quaternion2.Y, quaternion1.Z + quaternion2.Z, quaternion1.W + quaternion2.W);
 }
 
-void Quaternion::Add(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result)
+void Quaternion::Add(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result) noexcept
 {
 	result.X = quaternion1.X + quaternion2.X;
 	result.Y = quaternion1.Y + quaternion2.Y;
@@ -26,7 +26,7 @@ void Quaternion::Add(const Quaternion& quaternion1, const Quaternion& quaternion
 	result.W = quaternion1.W + quaternion2.W;
 }
 
-Quaternion Quaternion::Concatenate(const Quaternion& value1, const Quaternion& value2)
+Quaternion Quaternion::Concatenate(const Quaternion& value1, const Quaternion& value2) noexcept
 {
 	Quaternion quaternion;
 
@@ -48,7 +48,7 @@ Quaternion Quaternion::Concatenate(const Quaternion& value1, const Quaternion& v
 	return quaternion;
 }
 
-void Quaternion::Concatenate(const Quaternion& value1, const Quaternion& value2, Quaternion& result)
+void Quaternion::Concatenate(const Quaternion& value1, const Quaternion& value2, Quaternion& result) noexcept
 {
 	float x1 = value1.X;
 	float y1 = value1.Y;
@@ -66,19 +66,19 @@ void Quaternion::Concatenate(const Quaternion& value1, const Quaternion& value2,
 	result.W = (w2 * w1) - (((x2 * x1) + (y2 * y1)) + (z2 * z1));
 }
 
-void Quaternion::Conjugate()
+void Quaternion::Conjugate() noexcept
 {
 	X = -X;
 	Y = -Y;
 	Z = -Z;
 }
 
-void Quaternion::Conjugate(Quaternion& value)
+void Quaternion::Conjugate(Quaternion& value) noexcept
 {
 	value.X = -value.X, value.Y = -value.Y, value.Z = -value.Z;
 }
 
-void Quaternion::Conjugate(const Quaternion& value, Quaternion& result)
+void Quaternion::Conjugate(const Quaternion& value, Quaternion& result) noexcept
 {
 	result.X = -value.X;
 	result.Y = -value.Y;
@@ -86,7 +86,7 @@ void Quaternion::Conjugate(const Quaternion& value, Quaternion& result)
 	result.W = value.W;
 }
 
-Quaternion Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle)
+Quaternion Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle) noexcept
 {
 	float half = angle * 0.5f;
 	float sinHalf = sin(half);
@@ -95,7 +95,7 @@ Quaternion Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle)
 	return Quaternion(axis.X * sinHalf, axis.Y * sinHalf, axis.Z * sinHalf, cosHalf);
 }
 
-void Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle, Quaternion& result)
+void Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle, Quaternion& result) noexcept
 {
 	float half = angle * 0.5f;
 	float sinHalf = sin(half);
@@ -107,7 +107,7 @@ void Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle, Quaternio
 	result.W = cosHalf;
 }
 
-Quaternion Quaternion::CreateFromYawPitchRoll(float yaw, float pitch, float roll)
+Quaternion Quaternion::CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept
 {
 	float halfRoll = roll * 0.5f;
 	float halfPitch = pitch * 0.5f;
@@ -126,7 +126,7 @@ Quaternion Quaternion::CreateFromYawPitchRoll(float yaw, float pitch, float roll
 		(cosYaw * cosPitch * cosRoll) + (sinYaw * sinPitch * sinRoll));
 }
 
-void Quaternion::CreateFromYawPitchRoll(float yaw, float pitch, float roll, Quaternion& result)
+void Quaternion::CreateFromYawPitchRoll(float yaw, float pitch, float roll, Quaternion& result) noexcept
 {
 	float halfRoll = roll * 0.5f;
 	float halfPitch = pitch * 0.5f;
@@ -145,7 +145,7 @@ void Quaternion::CreateFromYawPitchRoll(float yaw, float pitch, float roll, Quat
 	result.W = (cosYaw * cosPitch * cosRoll) + (sinYaw * sinPitch * sinRoll);
 }
 
-Quaternion Quaternion::Divide(Quaternion& quaternion1, Quaternion& quaternion2)
+Quaternion Quaternion::Divide(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept
 {
 	Quaternion quaternion;
 	float x = quaternion1.X;
@@ -169,7 +169,7 @@ Quaternion Quaternion::Divide(Quaternion& quaternion1, Quaternion& quaternion2)
 	return quaternion;
 }
 
-void Quaternion::Divide(Quaternion& quaternion1, Quaternion& quaternion2, Quaternion& result)
+void Quaternion::Divide(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result) noexcept
 {
 	float x = quaternion1.X;
 	float y = quaternion1.Y;
@@ -191,27 +191,27 @@ void Quaternion::Divide(Quaternion& quaternion1, Quaternion& quaternion2, Quater
 	result.W = (w * num) - num10;
 }
 
-float Quaternion::Dot(Quaternion& quaternion1, Quaternion& quaternion2)
+float Quaternion::Dot(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept
 {
 	return ((((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W));
 }
 
-void Quaternion::Dot(Quaternion& quaternion1, Quaternion& quaternion2, float& result)
+void Quaternion::Dot(const Quaternion& quaternion1, const Quaternion& quaternion2, float& result) noexcept
 {
 	result = (((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W);
 }
 
-float Quaternion::Length()
+float Quaternion::Length() const noexcept
 {
 	return sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W));
 }
 
-float Quaternion::LengthSquared()
+float Quaternion::LengthSquared() const noexcept
 {
 	return (X * X) + (Y * Y) + (Z * Z) + (W * W);
 }
 
-Quaternion  Quaternion::Lerp(Quaternion& quaternion1, Quaternion& quaternion2, float amount)
+Quaternion  Quaternion::Lerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount) noexcept
 {
 	float num = amount;
 	float num2 = 1.0f - num;
@@ -240,7 +240,7 @@ Quaternion  Quaternion::Lerp(Quaternion& quaternion1, Quaternion& quaternion2, f
 	return quaternion;
 }
 
-void  Quaternion::Lerp(Quaternion& quaternion1, Quaternion& quaternion2, float amount, Quaternion& result)
+void  Quaternion::Lerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount, Quaternion& result) noexcept
 {
 	float num = amount;
 	float num2 = 1.0f - num;
@@ -267,7 +267,7 @@ void  Quaternion::Lerp(Quaternion& quaternion1, Quaternion& quaternion2, float a
 	result.W *= num3;
 }
 
-Quaternion Quaternion::Slerp(Quaternion& quaternion1, Quaternion& quaternion2, float amount)
+Quaternion Quaternion::Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount) noexcept
 {
 	float num2;
 	float num3;
@@ -299,7 +299,7 @@ Quaternion Quaternion::Slerp(Quaternion& quaternion1, Quaternion& quaternion2, f
 	return quaternion;
 }
 
-void Quaternion::Slerp(Quaternion& quaternion1, Quaternion& quaternion2, float amount, Quaternion& result)
+void Quaternion::Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount, Quaternion& result) noexcept
 {
 	float num2;
 	float num3;
@@ -329,7 +329,7 @@ void Quaternion::Slerp(Quaternion& quaternion1, Quaternion& quaternion2, float a
 	result.W = (num3 * quaternion1.W) + (num2 * quaternion2.W);
 }
 
-Quaternion Quaternion::Subtract(Quaternion& quaternion1, Quaternion& quaternion2)
+Quaternion Quaternion::Subtract(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept
 {
 	Quaternion quaternion;
 	quaternion.X = quaternion1.X - quaternion2.X;
@@ -339,7 +339,7 @@ Quaternion Quaternion::Subtract(Quaternion& quaternion1, Quaternion& quaternion2
 	return quaternion;
 }
 
-void Quaternion::Subtract(Quaternion& quaternion1, Quaternion& quaternion2, Quaternion& result)
+void Quaternion::Subtract(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result) noexcept
 {
 	result.X = quaternion1.X - quaternion2.X;
 	result.Y = quaternion1.Y - quaternion2.Y;
@@ -347,7 +347,7 @@ void Quaternion::Subtract(Quaternion& quaternion1, Quaternion& quaternion2, Quat
 	result.W = quaternion1.W - quaternion2.W;
 }
 
-Quaternion Quaternion::Multiply(Quaternion& quaternion1, Quaternion& quaternion2)
+Quaternion Quaternion::Multiply(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept
 {
 	Quaternion quaternion;
 	float x = quaternion1.X;
@@ -369,7 +369,7 @@ Quaternion Quaternion::Multiply(Quaternion& quaternion1, Quaternion& quaternion2
 	return quaternion;
 }
 
-Quaternion Quaternion::Multiply(Quaternion& quaternion1, float scaleFactor)
+Quaternion Quaternion::Multiply(const Quaternion& quaternion1, float scaleFactor) noexcept
 {
 	Quaternion quaternion;
 	quaternion.X = quaternion1.X * scaleFactor;
@@ -379,7 +379,7 @@ Quaternion Quaternion::Multiply(Quaternion& quaternion1, float scaleFactor)
 	return quaternion;
 }
 
-void Quaternion::Multiply(Quaternion& quaternion1, float scaleFactor, Quaternion& result)
+void Quaternion::Multiply(const Quaternion& quaternion1, float scaleFactor, Quaternion& result) noexcept
 {
 	result.X = quaternion1.X * scaleFactor;
 	result.Y = quaternion1.Y * scaleFactor;
@@ -387,7 +387,7 @@ void Quaternion::Multiply(Quaternion& quaternion1, float scaleFactor, Quaternion
 	result.W = quaternion1.W * scaleFactor;
 }
 
-void Quaternion::Multiply(Quaternion& quaternion1, Quaternion& quaternion2, Quaternion& result)
+void Quaternion::Multiply(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result) noexcept
 {
 	float x = quaternion1.X;
 	float y = quaternion1.Y;
@@ -407,7 +407,7 @@ void Quaternion::Multiply(Quaternion& quaternion1, Quaternion& quaternion2, Quat
 	result.W = (w * num) - num9;
 }
 
-void Quaternion::Negate(Quaternion& quaternion)
+void Quaternion::Negate(Quaternion& quaternion) noexcept
 {
 	quaternion.X = -quaternion.X;
 	quaternion.Y = -quaternion.Y;
@@ -415,14 +415,14 @@ void Quaternion::Negate(Quaternion& quaternion)
 	quaternion.W = -quaternion.W;
 }
 
-void Quaternion::Negate() {
+void Quaternion::Negate() noexcept {
 	X = -X;
 	Y = -Y;
 	Z = -Z;
 	W = -W;
 }
 
-void Quaternion::Normalize()
+void Quaternion::Normalize() noexcept
 {
 	float num = 1.0f / sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W));
 	X *= num;
@@ -431,7 +431,7 @@ void Quaternion::Normalize()
 	W *= num;
 }
 
-Quaternion Quaternion::CreateFromRotationMatrix(Matrix& matrix)
+Quaternion Quaternion::CreateFromRotationMatrix(const Matrix& matrix) noexcept
 {
 	Quaternion quaternion;
 	float sqrtv;
@@ -485,7 +485,7 @@ Quaternion Quaternion::CreateFromRotationMatrix(Matrix& matrix)
 	return quaternion;
 }
 
-void Quaternion::CreateFromRotationMatrix(Matrix& matrix, Quaternion& result)
+void Quaternion::CreateFromRotationMatrix(const Matrix& matrix, Quaternion& result) noexcept
 {
 	float sqrtv;
 	float half;
@@ -533,7 +533,7 @@ void Quaternion::CreateFromRotationMatrix(Matrix& matrix, Quaternion& result)
 			result.W = (matrix.M12 - matrix.M21) * half;
 		}
 }
-Quaternion Quaternion::operator+(const Quaternion& quaternion) const
+Quaternion Quaternion::operator+(const Quaternion& quaternion) const noexcept
 {
 	Quaternion result;
 	result.X = X + quaternion.X;
@@ -543,7 +543,7 @@ Quaternion Quaternion::operator+(const Quaternion& quaternion) const
 	return result;
 }
 
-Quaternion Quaternion::operator/(const Quaternion& quaternion) const
+Quaternion Quaternion::operator/(const Quaternion& quaternion) const noexcept
 {
 	Quaternion result;
 	float x = X;
@@ -567,17 +567,17 @@ Quaternion Quaternion::operator/(const Quaternion& quaternion) const
 	return result;
 }
 
-bool Quaternion::operator==(const Quaternion& quaternion) const
+bool Quaternion::operator==(const Quaternion& quaternion) const noexcept
 {
 	return X == quaternion.X && Y == quaternion.Y && Z == quaternion.Z && W == quaternion.W;
 }
 
-bool Quaternion::operator!=(const Quaternion& quaternion) const
+bool Quaternion::operator!=(const Quaternion& quaternion) const noexcept
 {
 	return !(*this == quaternion);
 }
 
-Quaternion Quaternion::operator*(const Quaternion& quaternion) const
+Quaternion Quaternion::operator*(const Quaternion& quaternion) const noexcept
 {
 	Quaternion result;
 	float x = X;
@@ -599,7 +599,7 @@ Quaternion Quaternion::operator*(const Quaternion& quaternion) const
 	return result;
 }
 
-Quaternion Quaternion::operator*(float scaleFactor) const
+Quaternion Quaternion::operator*(float scaleFactor) const noexcept
 {
 	Quaternion result;
 	result.X = X * scaleFactor;
@@ -609,7 +609,7 @@ Quaternion Quaternion::operator*(float scaleFactor) const
 	return result;
 }
 
-Quaternion Quaternion::operator-(const Quaternion& quaternion) const
+Quaternion Quaternion::operator-(const Quaternion& quaternion) const noexcept
 {
 	Quaternion result;
 	result.X = X - quaternion.X;
@@ -619,7 +619,7 @@ Quaternion Quaternion::operator-(const Quaternion& quaternion) const
 	return result;
 }
 
-Quaternion Quaternion::operator-() const
+Quaternion Quaternion::operator-() const noexcept
 {
 	Quaternion result;
 	result.X = -X;
@@ -1,6 +1,9 @@
 #pragma once
 #include "Vector3.h"
-#include "Matrix.h"
+#include "VectorSimd.h"
+#include "TrigPrecision.h"
+
+class Matrix;
 class Quaternion
 {
 public:
@@ -12,73 +15,217 @@ public:
 
 	float W;
 
-	Quaternion() :X(0), Y(0), Z(0), W(0) {}
-	Quaternion(float x, float y, float z, float w) :X(x), Y(y), Z(z), W(w) {}
-	Quaternion(Vector3 value, float w) :X(value.X), Y(value.Y), Z(value.Z), W(w) {}
+	constexpr Quaternion() noexcept :X(0), Y(0), Z(0), W(0) {}
+	constexpr Quaternion(float x, float y, float z, float w) noexcept :X(x), Y(y), Z(z), W(w) {}
+	constexpr Quaternion(Vector3 value, float w) noexcept :X(value.X), Y(value.Y), Z(value.Z), W(w) {}
 	//Quaternion(Vector4 value) {}
 
 	static const Quaternion Identity;
 
 	// Assignment operator
-	Quaternion& operator=(const Quaternion& other);
+	Quaternion& operator=(const Quaternion& other) noexcept;
 
 	// Quaternion operations
-	static Quaternion Add(const Quaternion& quaternion1, const Quaternion& quaternion2);
-	static void Add(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result);
-
-	static Quaternion Concatenate(const Quaternion& value1, const Quaternion& value2);
-	static void Concatenate(const Quaternion& value1, const Quaternion& value2, Quaternion& result);
-
-	void Conjugate();
-	static void Conjugate(Quaternion& value);
-	static void Conjugate(const Quaternion& value, Quaternion& result);
-
-	static Quaternion CreateFromAxisAngle(const Vector3& axis, float angle);
-	static void CreateFromAxisAngle(const Vector3& axis, float angle, Quaternion& result);
-
-	static Quaternion CreateFromYawPitchRoll(float yaw, float pitch, float roll);
-	static void CreateFromYawPitchRoll(float yaw, float pitch, float roll, Quaternion& result);
-
-	static Quaternion Divide(Quaternion& quaternion1, Quaternion& quaternion2);
-	static void Divide(Quaternion& quaternion1, Quaternion& quaternion2, Quaternion& result);
+	static Quaternion Add(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept;
+	static void Add(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result) noexcept;
+
+	static Quaternion Concatenate(const Quaternion& value1, const Quaternion& value2) noexcept;
+	static void Concatenate(const Quaternion& value1, const Quaternion& value2, Quaternion& result) noexcept;
+
+	void Conjugate() noexcept;
+	static void Conjugate(Quaternion& value) noexcept;
+	static void Conjugate(const Quaternion& value, Quaternion& result) noexcept;
+
+	static Quaternion CreateFromAxisAngle(const Vector3& axis, float angle) noexcept;
+	static void CreateFromAxisAngle(const Vector3& axis, float angle, Quaternion& result) noexcept;
+	// Overloads with a trigonometry policy of TrigPrecision.h, as in CreateFromAxisAngle<FastTrig>(axis, angle).
+	template<typename Trig> static Quaternion CreateFromAxisAngle(const Vector3& axis, float angle) noexcept;
+	template<typename Trig> static void CreateFromAxisAngle(const Vector3& axis, float angle, Quaternion& result) noexcept;
+
+	static Quaternion CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept;
+	static void CreateFromYawPitchRoll(float yaw, float pitch, float roll, Quaternion& result) noexcept;
+	template<typename Trig> static Quaternion CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept;
+	template<typename Trig> static void CreateFromYawPitchRoll(float yaw, float pitch, float roll, Quaternion& result) noexcept;
+	// One rotation per index of the yaw, pitch and roll arrays.
+	template<typename Trig> static void CreateFromYawPitchRoll(const float* yawArray, const float* pitchArray, const float* rollArray, Quaternion* resultArray, int length) noexcept;
+
+	static Quaternion Divide(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept;
+	static void Divide(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result) noexcept;
+
+	static float Dot(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept;
+	static void Dot(const Quaternion& quaternion1, const Quaternion& quaternion2, float& result) noexcept;
+
+	float Length() const noexcept;
+	float LengthSquared() const noexcept;
+
+	static Quaternion Lerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount) noexcept;
+	static void Lerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount, Quaternion& result) noexcept;
+
+	static Quaternion Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount) noexcept;
+	static void Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount, Quaternion& result) noexcept;
+	template<typename Trig> static Quaternion Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount) noexcept;
+	template<typename Trig> static void Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount, Quaternion& result) noexcept;
+	// Interpolates the quaternions at the same index of both arrays by the amount at that index.
+	template<typename Trig> static void Slerp(const Quaternion* quaternion1Array, const Quaternion* quaternion2Array, const float* amountArray, Quaternion* resultArray, int length) noexcept;
+
+	static Quaternion Subtract(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept;
+	static void Subtract(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result) noexcept;
+
+	static Quaternion Multiply(const Quaternion& quaternion1, const Quaternion& quaternion2) noexcept;
+	static Quaternion Multiply(const Quaternion& quaternion1, float scaleFactor) noexcept;
+	static void Multiply(const Quaternion& quaternion1, float scaleFactor, Quaternion& result) noexcept;
+	static void Multiply(const Quaternion& quaternion1, const Quaternion& quaternion2, Quaternion& result) noexcept;
+
+	static void Negate(Quaternion& quaternion) noexcept;
+
+	void Negate() noexcept;
+	void Normalize() noexcept;
+	// Normalize with the precision policy of NormalizePrecision.h, as in Normalize<RefinedPrecision>(value).
+	template<typename Precision> void Normalize() noexcept;
+	template<typename Precision> static Quaternion Normalize(Quaternion value) noexcept;
+	template<typename Precision> static void Normalize(const Quaternion& value, Quaternion& result) noexcept;
+	template<typename Precision> static void Normalize(const Quaternion* sourceArray, Quaternion* destinationArray, int length) noexcept;
+
+	static Quaternion CreateFromRotationMatrix(const Matrix& matrix) noexcept;
+	static void CreateFromRotationMatrix(const Matrix& matrix, Quaternion& result) noexcept;
+
+	Quaternion operator+(const Quaternion& quaternion) const noexcept;
+	Quaternion operator/(const Quaternion& quaternion) const noexcept;
+	bool operator==(const Quaternion& quaternion) const noexcept;
+	bool operator!=(const Quaternion& quaternion) const noexcept;
+	Quaternion operator*(const Quaternion& quaternion) const noexcept;
+	Quaternion operator*(float scaleFactor) const noexcept;
+	Quaternion operator-(const Quaternion& quaternion) const noexcept;
+	Quaternion operator-() const noexcept;
 
-	static float Dot(Quaternion& quaternion1, Quaternion& quaternion2);
-	static void Dot(Quaternion& quaternion1, Quaternion& quaternion2, float& result);
-
-	float Length();
-	float LengthSquared();
+	//TODO implement the rest of the function that depend on Matrix
+};
 
-	static Quaternion Lerp(Quaternion& quaternion1, Quaternion& quaternion2, float amount);
-	static void Lerp(Quaternion& quaternion1, Quaternion& quaternion2, float amount, Quaternion& result);
+inline constexpr Quaternion Quaternion::Identity(0, 0, 0, 1);
 
-	static Quaternion Slerp(Quaternion& quaternion1, Quaternion& quaternion2, float amount);
-	static void Slerp(Quaternion& quaternion1, Quaternion& quaternion2, float amount, Quaternion& result);
+template<typename Precision>
+inline void Quaternion::Normalize() noexcept
+{
+	Normalize<Precision>(*this, *this);
+}
 
-	static Quaternion Subtract(Quaternion& quaternion1, Quaternion& quaternion2);
-	static void Subtract(Quaternion& quaternion1, Quaternion& quaternion2, Quaternion& result);
+template<typename Precision>
+inline Quaternion Quaternion::Normalize(Quaternion value) noexcept
+{
+	Normalize<Precision>(value, value);
+	return value;
+}
 
-	static Quaternion Multiply(Quaternion& quaternion1, Quaternion& quaternion2);
-	static Quaternion Multiply(Quaternion& quaternion1, float scaleFactor);
-	static void Multiply(Quaternion& quaternion1, float scaleFactor, Quaternion& result);
-	static void Multiply(Quaternion& quaternion1, Quaternion& quaternion2, Quaternion& result);
+template<typename Precision>
+inline void Quaternion::Normalize(const Quaternion& value, Quaternion& result) noexcept
+{
+	float num = Precision::ReciprocalSqrt((value.X * value.X) + (value.Y * value.Y) + (value.Z * value.Z) + (value.W * value.W));
+	result.X = value.X * num;
+	result.Y = value.Y * num;
+	result.Z = value.Z * num;
+	result.W = value.W * num;
+}
+
+template<typename Precision>
+inline void Quaternion::Normalize(const Quaternion* sourceArray, Quaternion* destinationArray, int length) noexcept
+{
+	VectorSimd::NormalizeArray(sourceArray, destinationArray, length, Precision::Value);
+}
 
-	static void Negate(Quaternion& quaternion);
+template<typename Trig>
+inline Quaternion Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle) noexcept
+{
+	Quaternion result;
+	CreateFromAxisAngle<Trig>(axis, angle, result);
+	return result;
+}
 
-	void Negate();
-	void Normalize();
+template<typename Trig>
+inline void Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle, Quaternion& result) noexcept
+{
+	float sinHalf, cosHalf;
+	Trig::SinCos(angle * 0.5f, sinHalf, cosHalf);
 
-	static Quaternion CreateFromRotationMatrix(Matrix& matrix);
-	static void CreateFromRotationMatrix(Matrix& matrix, Quaternion& result);
+	result.X = axis.X * sinHalf;
+	result.Y = axis.Y * sinHalf;
+	result.Z = axis.Z * sinHalf;
+	result.W = cosHalf;
+}
 
-	Quaternion operator+(const Quaternion& quaternion) const;
-	Quaternion operator/(const Quaternion& quaternion) const;
-	bool operator==(const Quaternion& quaternion) const;
-	bool operator!=(const Quaternion& quaternion) const;
-	Quaternion operator*(const Quaternion& quaternion) const;
-	Quaternion operator*(float scaleFactor) const;
-	Quaternion operator-(const Quaternion& quaternion) const;
-	Quaternion operator-() const;
+template<typename Trig>
+inline Quaternion Quaternion::CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept
+{
+	Quaternion result;
+	CreateFromYawPitchRoll<Trig>(yaw, pitch, roll, result);
+	return result;
+}
 
-	//TODO implement the rest of the function that depend on Matrix
-};
+template<typename Trig>
+inline void Quaternion::CreateFromYawPitchRoll(float yaw, float pitch, float roll, Quaternion& result) noexcept
+{
+	float sinRoll, cosRoll, sinPitch, cosPitch, sinYaw, cosYaw;
+	Trig::SinCos(roll * 0.5f, sinRoll, cosRoll);
+	Trig::SinCos(pitch * 0.5f, sinPitch, cosPitch);
+	Trig::SinCos(yaw * 0.5f, sinYaw, cosYaw);
+
+	result.X = (cosYaw * sinPitch * cosRoll) + (sinYaw * cosPitch * sinRoll);
+	result.Y = (sinYaw * cosPitch * cosRoll) - (cosYaw * sinPitch * sinRoll);
+	result.Z = (cosYaw * cosPitch * sinRoll) - (sinYaw * sinPitch * cosRoll);
+	result.W = (cosYaw * cosPitch * cosRoll) + (sinYaw * sinPitch * sinRoll);
+}
+
+template<typename Trig>
+inline void Quaternion::CreateFromYawPitchRoll(const float* yawArray, const float* pitchArray, const float* rollArray, Quaternion* resultArray, int length) noexcept
+{
+	VectorSimd::CreateFromYawPitchRollArray(yawArray, pitchArray, rollArray, resultArray, length, Trig::Value);
+}
 
+template<typename Trig>
+inline Quaternion Quaternion::Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount) noexcept
+{
+	Quaternion result;
+	Slerp<Trig>(quaternion1, quaternion2, amount, result);
+	return result;
+}
+
+// One arc cosine and two SinCos instead of an arc cosine and three sines: the weight of the
+// first quaternion, sin((1 - amount) * angle), is expanded from the sines and cosines of angle
+// and amount * angle.
+template<typename Trig>
+inline void Quaternion::Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount, Quaternion& result) noexcept
+{
+	float weight1;
+	float weight2;
+	float dot = (((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W);
+	bool flip = false;
+	if (dot < 0.0f)
+	{
+		flip = true;
+		dot = -dot;
+	}
+	if (dot > 0.999999f)
+	{
+		weight1 = 1.0f - amount;
+		weight2 = flip ? -amount : amount;
+	}
+	else
+	{
+		float angle = Trig::Acos(dot);
+		float sinAngle, cosAngle, sinAmountAngle, cosAmountAngle;
+		Trig::SinCos(angle, sinAngle, cosAngle);
+		Trig::SinCos(amount * angle, sinAmountAngle, cosAmountAngle);
+		float inverseSinAngle = 1.0f / sinAngle;
+		weight1 = ((sinAngle * cosAmountAngle) - (cosAngle * sinAmountAngle)) * inverseSinAngle;
+		weight2 = flip ? (-sinAmountAngle * inverseSinAngle) : (sinAmountAngle * inverseSinAngle);
+	}
+	result.X = (weight1 * quaternion1.X) + (weight2 * quaternion2.X);
+	result.Y = (weight1 * quaternion1.Y) + (weight2 * quaternion2.Y);
+	result.Z = (weight1 * quaternion1.Z) + (weight2 * quaternion2.Z);
+	result.W = (weight1 * quaternion1.W) + (weight2 * quaternion2.W);
+}
+
+template<typename Trig>
+inline void Quaternion::Slerp(const Quaternion* quaternion1Array, const Quaternion* quaternion2Array, const float* amountArray, Quaternion* resultArray, int length) noexcept
+{
+	VectorSimd::SlerpArray(quaternion1Array, quaternion2Array, amountArray, resultArray, length, Trig::Value);
+}
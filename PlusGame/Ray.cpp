@@ -1,4 +1,7 @@
 #include "Ray.h"
+#include "BoundingBox.h"
+#include "BoundingSphere.h"
+#include "Plane.h"
 
 // adapted from http://www.scratchapixel.com/lessons/3d-basic-lessons/lesson-7-intersecting-simple-shapes/ray-box-intersection/
 /// <summary>
@@ -9,7 +12,7 @@
 /// The distance along the ray of the intersection or <code>NULL</code> if this
 /// <see cref="Ray"/> does not intersect the <see cref="BoundingBox"/>.
 /// </returns>			
-float Ray::Intersects(BoundingBox& box) {
+float Ray::Intersects(const BoundingBox& box) const noexcept {
 	const float Epsilon = 1e-6f;
 
 	float tMin = -std::numeric_limits<float>::infinity();
@@ -84,7 +87,7 @@ float Ray::Intersects(BoundingBox& box) {
 /// The distance along the ray of the intersection or <code>null</code> if this
 /// <see cref="Ray"/> does not intersect the <see cref="BoundingSphere"/>.
 /// </param>
-void Ray::Intersects(BoundingSphere& sphere, float& result)
+void Ray::Intersects(const BoundingSphere& sphere, float& result) const noexcept
 {
 	// Find the vector between where the ray starts the the sphere's centre
 	Vector3 difference = sphere.Center - this->Position;
@@ -128,7 +131,7 @@ void Ray::Intersects(BoundingSphere& sphere, float& result)
 /// The distance along the ray of the intersection or <code>null</code> if this
 /// <see cref="Ray"/> does not intersect the <see cref="Plane"/>.
 /// </param>
-void Ray::Intersects(Plane& plane, float& result)
+void Ray::Intersects(const Plane& plane, float& result) const noexcept
 {
 	auto den = Vector3::Dot(Direction, plane.Normal);
 	if (abs(den) < 0.00001f)
@@ -158,7 +161,7 @@ void Ray::Intersects(Plane& plane, float& result)
 /// The distance along the ray of the intersection or <code>null</code> if this
 /// <see cref="Ray"/> does not intersect the <see cref="BoundingBox"/>.
 /// </param>
-void Ray::Intersects(BoundingBox& box, float& result)
+void Ray::Intersects(const BoundingBox& box, float& result) const noexcept
 {
 	result = Intersects(box);
 }
@@ -171,7 +174,7 @@ void Ray::Intersects(BoundingBox& box, float& result)
 /// The distance along the ray of the intersection or <code>null</code> if this
 /// <see cref="Ray"/> does not intersect the <see cref="BoundingSphere"/>.
 /// </returns>
-float Ray::Intersects(BoundingSphere& sphere)
+float Ray::Intersects(const BoundingSphere& sphere) const noexcept
 {
 	float result;
 	Intersects(sphere, result);
@@ -186,7 +189,7 @@ float Ray::Intersects(BoundingSphere& sphere)
 /// The distance along the ray of the intersection or <code>null</code> if this
 /// <see cref="Ray"/> does not intersect the <see cref="Plane"/>.
 /// </returns>
-float Ray::Intersects(Plane plane)
+float Ray::Intersects(Plane plane) const noexcept
 {
 	float result;
 	Intersects(plane, result);
@@ -1,5 +1,10 @@
 #pragma once
-#include "BoundingBox.h"
+#include "Vector3.h"
+
+class BoundingBox;
+class BoundingSphere;
+class Plane;
+
 class Ray
 {
 public:
@@ -13,16 +18,16 @@ public:
 	/// </summary>
 	Vector3 Position;
 
-	Ray(Vector3 position, Vector3 direction) : Position(position), Direction(direction) { }
-	Ray() : Position(Vector3(0)), Direction(Vector3(0)) { }
+	Ray(Vector3 position, Vector3 direction) noexcept : Position(position), Direction(direction) { }
+	Ray() noexcept : Position(Vector3(0)), Direction(Vector3(0)) { }
 
-	float Intersects(BoundingBox& box);
-	void Intersects(BoundingSphere& sphere, float& result);
-	void Intersects(Plane& plane, float& result);
+	float Intersects(const BoundingBox& box) const noexcept;
+	void Intersects(const BoundingSphere& sphere, float& result) const noexcept;
+	void Intersects(const Plane& plane, float& result) const noexcept;
 
-	void Intersects(BoundingBox& box, float& result);
-	float Intersects(BoundingSphere& sphere);
-	float Intersects(Plane plane);
+	void Intersects(const BoundingBox& box, float& result) const noexcept;
+	float Intersects(const BoundingSphere& sphere) const noexcept;
+	float Intersects(Plane plane) const noexcept;
 
 };
 
@@ -1,46 +1,47 @@
 #include "Rectangle.h"
+#include "Vector2.h"
 
-int Rectangle::GetRight()
+int Rectangle::GetRight() const noexcept
 {
 	return X + Width;
 }
 
-int Rectangle::GetLeft()
+int Rectangle::GetLeft() const noexcept
 {
 	return X;
 }
 
-int Rectangle::GetTop()
+int Rectangle::GetTop() const noexcept
 {
 	return Y;
 }
 
-int Rectangle::GetBottom()
+int Rectangle::GetBottom() const noexcept
 {
 	return Y + Height;
 }
 
-bool Rectangle::IsEmpty()
+bool Rectangle::IsEmpty() const noexcept
 {
 	return ((((this->Width == 0) && (this->Height == 0)) && (this->X == 0)) && (this->Y == 0));;
 }
 
-Point Rectangle::GetLocation()
+Point Rectangle::GetLocation() const noexcept
 {
 	return Point(X, Y);
 }
 
-Point Rectangle::GetSize()
+Point Rectangle::GetSize() const noexcept
 {
 	return Point(Width, Height);
 }
 
-Point Rectangle::GetCenter()
+Point Rectangle::GetCenter() const noexcept
 {
 	return Point(this->X + (this->Width / 2), this->Y + (this->Height / 2));
 }
 
-Rectangle::Rectangle(Point position, Point size)
+Rectangle::Rectangle(Point position, Point size) noexcept
 {
 	X = position.X;
 	Y = position.Y;
@@ -54,7 +55,7 @@ Rectangle::Rectangle(Point position, Point size)
 /// <param name="x">The x coordinate of the point to check for containment.</param>
 /// <param name="y">The y coordinate of the point to check for containment.</param>
 /// <returns><c>true</c> if the provided coordinates lie inside this <see cref="Rectangle"/>; <c>false</c> otherwise.</returns>
-bool Rectangle::Contains(int x, int y)
+bool Rectangle::Contains(int x, int y) const noexcept
 {
 	return ((((this->X <= x) && (x < (this->X + this->Width))) && (this->Y <= y)) && (y < (this->Y + this->Height)));
 }
@@ -65,7 +66,7 @@ bool Rectangle::Contains(int x, int y)
 /// <param name="x">The x coordinate of the point to check for containment.</param>
 /// <param name="y">The y coordinate of the point to check for containment.</param>
 /// <returns><c>true</c> if the provided coordinates lie inside this <see cref="Rectangle"/>; <c>false</c> otherwise.</returns>
-bool Rectangle::Contains(float x, float y)
+bool Rectangle::Contains(float x, float y) const noexcept
 {
 	return ((((this->X <= x) && (x < (this->X + this->Width))) && (this->Y <= y)) && (y < (this->Y + this->Height)));
 }
@@ -75,7 +76,7 @@ bool Rectangle::Contains(float x, float y)
 /// </summary>
 /// <param name="value">The coordinates to check for inclusion in this <see cref="Rectangle"/>.</param>
 /// <returns><c>true</c> if the provided <see cref="Point"/> lies inside this <see cref="Rectangle"/>; <c>false</c> otherwise.</returns>
-bool Rectangle::Contains(Point value)
+bool Rectangle::Contains(Point value) const noexcept
 {
 	return ((((this->X <= value.X) && (value.X < (this->X + this->Width))) && (this->Y <= value.Y)) && (value.Y < (this->Y + this->Height)));
 }
@@ -85,7 +86,7 @@ bool Rectangle::Contains(Point value)
 /// </summary>
 /// <param name="value">The coordinates to check for inclusion in this <see cref="Rectangle"/>.</param>
 /// <param name="result"><c>true</c> if the provided <see cref="Point"/> lies inside this <see cref="Rectangle"/>; <c>false</c> otherwise. As an output parameter.</param>
-void Rectangle::Contains(Point& value, bool& result)
+void Rectangle::Contains(const Point& value, bool& result) const noexcept
 {
 	result = ((((this->X <= value.X) && (value.X < (this->X + this->Width))) && (this->Y <= value.Y)) && (value.Y < (this->Y + this->Height)));
 }
@@ -95,7 +96,7 @@ void Rectangle::Contains(Point& value, bool& result)
 /// </summary>
 /// <param name="value">The coordinates to check for inclusion in this <see cref="Rectangle"/>.</param>
 /// <returns><c>true</c> if the provided <see cref="Vector2"/> lies inside this <see cref="Rectangle"/>; <c>false</c> otherwise.</returns>
-bool Rectangle::Contains(Vector2& value)
+bool Rectangle::Contains(const Vector2& value) const noexcept
 {
 	return ((((this->X <= value.X) && (value.X < (this->X + this->Width))) && (this->Y <= value.Y)) && (value.Y < (this->Y + this->Height)));
 }
@@ -105,7 +106,7 @@ bool Rectangle::Contains(Vector2& value)
 /// </summary>
 /// <param name="value">The coordinates to check for inclusion in this <see cref="Rectangle"/>.</param>
 /// <param name="result"><c>true</c> if the provided <see cref="Vector2"/> lies inside this <see cref="Rectangle"/>; <c>false</c> otherwise. As an output parameter.</param>
-void Rectangle::Contains(Vector2& value, bool& result)
+void Rectangle::Contains(const Vector2& value, bool& result) const noexcept
 {
 	result = ((((this->X <= value.X) && (value.X < (this->X + this->Width))) && (this->Y <= value.Y)) && (value.Y < (this->Y + this->Height)));
 }
@@ -115,7 +116,7 @@ void Rectangle::Contains(Vector2& value, bool& result)
 /// </summary>
 /// <param name="value">The <see cref="Rectangle"/> to check for inclusion in this <see cref="Rectangle"/>.</param>
 /// <returns><c>true</c> if the provided <see cref="Rectangle"/>'s bounds lie entirely inside this <see cref="Rectangle"/>; <c>false</c> otherwise.</returns>
-bool Rectangle::Contains(Rectangle& value)
+bool Rectangle::Contains(const Rectangle& value) const noexcept
 {
 	return ((((this->X <= value.X) && ((value.X + value.Width) <= (this->X + this->Width))) && (this->Y <= value.Y)) && ((value.Y + value.Height) <= (this->Y + this->Height)));
 }
@@ -125,7 +126,7 @@ bool Rectangle::Contains(Rectangle& value)
 /// </summary>
 /// <param name="value">The <see cref="Rectangle"/> to check for inclusion in this <see cref="Rectangle"/>.</param>
 /// <param name="result"><c>true</c> if the provided <see cref="Rectangle"/>'s bounds lie entirely inside this <see cref="Rectangle"/>; <c>false</c> otherwise. As an output parameter.</param>
-void Rectangle::Contains(Rectangle& value, bool& result)
+void Rectangle::Contains(const Rectangle& value, bool& result) const noexcept
 {
 	result = ((((this->X <= value.X) && ((value.X + value.Width) <= (this->X + this->Width))) && (this->Y <= value.Y)) && ((value.Y + value.Height) <= (this->Y + this->Height)));
 }
@@ -135,7 +136,7 @@ void Rectangle::Contains(Rectangle& value, bool& result)
 /// </summary>
 /// <param name="horizontalAmount">Value to adjust the left and right edges.</param>
 /// <param name="verticalAmount">Value to adjust the top and bottom edges.</param>
-void Rectangle::Inflate(int horizontalAmount, int verticalAmount)
+void Rectangle::Inflate(int horizontalAmount, int verticalAmount) noexcept
 {
 	X -= horizontalAmount;
 	Y -= verticalAmount;
@@ -148,7 +149,7 @@ void Rectangle::Inflate(int horizontalAmount, int verticalAmount)
 /// </summary>
 /// <param name="horizontalAmount">Value to adjust the left and right edges.</param>
 /// <param name="verticalAmount">Value to adjust the top and bottom edges.</param>
-void Rectangle::Inflate(float horizontalAmount, float verticalAmount)
+void Rectangle::Inflate(float horizontalAmount, float verticalAmount) noexcept
 {
 	X -= (int)horizontalAmount;
 	Y -= (int)verticalAmount;
@@ -161,7 +162,7 @@ void Rectangle::Inflate(float horizontalAmount, float verticalAmount)
 /// </summary>
 /// <param name="value">The other rectangle for testing.</param>
 /// <returns><c>true</c> if other <see cref="Rectangle"/> intersects with this rectangle; <c>false</c> otherwise.</returns>
-bool Rectangle::Intersects(Rectangle& value)
+bool Rectangle::Intersects(const Rectangle& value) const noexcept
 {
 	return value.GetLeft() < GetRight() &&
 		GetLeft() < value.GetRight() &&
@@ -175,7 +176,7 @@ bool Rectangle::Intersects(Rectangle& value)
 /// </summary>
 /// <param name="value">The other rectangle for testing.</param>
 /// <param name="result"><c>true</c> if other <see cref="Rectangle"/> intersects with this rectangle; <c>false</c> otherwise. As an output parameter.</param>
-void Rectangle::Intersects(Rectangle& value, bool result)
+void Rectangle::Intersects(const Rectangle& value, bool& result) const noexcept
 {
 	result = value.GetLeft() < GetRight() &&
 		GetLeft() < value.GetRight() &&
@@ -189,7 +190,7 @@ void Rectangle::Intersects(Rectangle& value, bool result)
 /// <param name="value1">The first <see cref="Rectangle"/>.</param>
 /// <param name="value2">The second <see cref="Rectangle"/>.</param>
 /// <returns>Overlapping region of the two rectangles.</returns>
-Rectangle Rectangle::Intersect(Rectangle& value1, Rectangle& value2)
+Rectangle Rectangle::Intersect(const Rectangle& value1, const Rectangle& value2) noexcept
 {
 	Rectangle rectangle;
 	Intersect(value1, value2, rectangle);
@@ -202,7 +203,7 @@ Rectangle Rectangle::Intersect(Rectangle& value1, Rectangle& value2)
 /// <param name="value1">The first <see cref="Rectangle"/>.</param>
 /// <param name="value2">The second <see cref="Rectangle"/>.</param>
 /// <param name="result">Overlapping region of the two rectangles as an output parameter.</param>
-void Rectangle::Intersect(Rectangle& value1, Rectangle& value2, Rectangle& result)
+void Rectangle::Intersect(const Rectangle& value1, const Rectangle& value2, Rectangle& result) noexcept
 {
 	if (value1.Intersects(value2))
 	{
@@ -223,7 +224,7 @@ void Rectangle::Intersect(Rectangle& value1, Rectangle& value2, Rectangle& resul
 /// </summary>
 /// <param name="offsetX">The x coordinate to add to this <see cref="Rectangle"/>.</param>
 /// <param name="offsetY">The y coordinate to add to this <see cref="Rectangle"/>.</param>
-void Rectangle::Offset(int offsetX, int offsetY)
+void Rectangle::Offset(int offsetX, int offsetY) noexcept
 {
 	X += offsetX;
 	Y += offsetY;
@@ -234,7 +235,7 @@ void Rectangle::Offset(int offsetX, int offsetY)
 /// </summary>
 /// <param name="offsetX">The x coordinate to add to this <see cref="Rectangle"/>.</param>
 /// <param name="offsetY">The y coordinate to add to this <see cref="Rectangle"/>.</param>
-void Rectangle::Offset(float offsetX, float offsetY)
+void Rectangle::Offset(float offsetX, float offsetY) noexcept
 {
 	X += (int)offsetX;
 	Y += (int)offsetY;
@@ -244,7 +245,7 @@ void Rectangle::Offset(float offsetX, float offsetY)
 /// Changes the <see cref="Location"/> of this <see cref="Rectangle"/>.
 /// </summary>
 /// <param name="amount">The x and y components to add to this <see cref="Rectangle"/>.</param>
-void Rectangle::Offset(Point& amount)
+void Rectangle::Offset(const Point& amount) noexcept
 {
 	X += amount.X;
 	Y += amount.Y;
@@ -254,7 +255,7 @@ void Rectangle::Offset(Point& amount)
 /// Changes the <see cref="Location"/> of this <see cref="Rectangle"/>.
 /// </summary>
 /// <param name="amount">The x and y components to add to this <see cref="Rectangle"/>.</param>
-void Rectangle::Offset(Vector2& amount)
+void Rectangle::Offset(const Vector2& amount) noexcept
 {
 	X += (int)amount.X;
 	Y += (int)amount.Y;
@@ -266,7 +267,7 @@ void Rectangle::Offset(Vector2& amount)
 /// <param name="value1">The first <see cref="Rectangle"/>.</param>
 /// <param name="value2">The second <see cref="Rectangle"/>.</param>
 /// <returns>The union of the two rectangles.</returns>
-Rectangle Rectangle::Union(Rectangle& value1, Rectangle& value2)
+Rectangle Rectangle::Union(const Rectangle& value1, const Rectangle& value2) noexcept
 {
 	int x = MathHelper::Min(value1.X, value2.X);
 	int y = MathHelper::Min(value1.Y, value2.Y);
@@ -281,7 +282,7 @@ Rectangle Rectangle::Union(Rectangle& value1, Rectangle& value2)
 /// <param name="value1">The first <see cref="Rectangle"/>.</param>
 /// <param name="value2">The second <see cref="Rectangle"/>.</param>
 /// <param name="result">The union of the two rectangles as an output parameter.</param>
-void Rectangle::Union(Rectangle& value1, Rectangle& value2, Rectangle& result)
+void Rectangle::Union(const Rectangle& value1, const Rectangle& value2, Rectangle& result) noexcept
 {
 	result.X = MathHelper::Min(value1.X, value2.X);
 	result.Y = MathHelper::Min(value1.Y, value2.Y);
@@ -13,42 +13,42 @@ public:
 	int Height;
 
 public:
-	int GetRight();
-	int GetLeft();
-	int GetTop();
-	int GetBottom();
-
-	bool IsEmpty();
-
-	Point GetLocation();
-	Point GetSize();
-	Point GetCenter();
-
-	Rectangle() : X(0), Y(0), Height(0), Width(0) {}
-	Rectangle(int x, int y, int w, int h) : X(x), Y(y), Height(h), Width(w) {}
-	Rectangle(Point position, Point size);
-
-	bool Contains(int x, int y);
-	bool Contains(float x, float y);
-	bool Contains(Point value);
-	void Contains(Point& value, bool& result);
-	bool Contains(Vector2& value);
-	void Contains(Vector2& value, bool& result);
-	bool Contains(Rectangle& value);
-	void Contains(Rectangle& value, bool& result);
-
-	void Inflate(int horizontalAmount, int verticalAmount);
-	void Inflate(float horizontalAmount, float verticalAmount);
-	bool Intersects(Rectangle& value);
-	void Intersects(Rectangle& value, bool result);
-
-	void Offset(int offsetX, int offsetY);
-	void Offset(float offsetX, float offsetY);
-	void Offset(Point& amount);
-	void Offset(Vector2& amount);
-
-	static Rectangle Intersect(Rectangle& value1, Rectangle& value2);
-	static void Intersect(Rectangle& value1, Rectangle& value2, Rectangle& result);
-	static Rectangle Union(Rectangle& value1, Rectangle& value2);
-	static void Union(Rectangle& value1, Rectangle& value2, Rectangle& result);
+	int GetRight() const noexcept;
+	int GetLeft() const noexcept;
+	int GetTop() const noexcept;
+	int GetBottom() const noexcept;
+
+	bool IsEmpty() const noexcept;
+
+	Point GetLocation() const noexcept;
+	Point GetSize() const noexcept;
+	Point GetCenter() const noexcept;
+
+	Rectangle() noexcept : X(0), Y(0), Height(0), Width(0) {}
+	Rectangle(int x, int y, int w, int h) noexcept : X(x), Y(y), Height(h), Width(w) {}
+	Rectangle(Point position, Point size) noexcept;
+
+	bool Contains(int x, int y) const noexcept;
+	bool Contains(float x, float y) const noexcept;
+	bool Contains(Point value) const noexcept;
+	void Contains(const Point& value, bool& result) const noexcept;
+	bool Contains(const Vector2& value) const noexcept;
+	void Contains(const Vector2& value, bool& result) const noexcept;
+	bool Contains(const Rectangle& value) const noexcept;
+	void Contains(const Rectangle& value, bool& result) const noexcept;
+
+	void Inflate(int horizontalAmount, int verticalAmount) noexcept;
+	void Inflate(float horizontalAmount, float verticalAmount) noexcept;
+	bool Intersects(const Rectangle& value) const noexcept;
+	void Intersects(const Rectangle& value, bool& result) const noexcept;
+
+	void Offset(int offsetX, int offsetY) noexcept;
+	void Offset(float offsetX, float offsetY) noexcept;
+	void Offset(const Point& amount) noexcept;
+	void Offset(const Vector2& amount) noexcept;
+
+	static Rectangle Intersect(const Rectangle& value1, const Rectangle& value2) noexcept;
+	static void Intersect(const Rectangle& value1, const Rectangle& value2, Rectangle& result) noexcept;
+	static Rectangle Union(const Rectangle& value1, const Rectangle& value2) noexcept;
+	static void Union(const Rectangle& value1, const Rectangle& value2, Rectangle& result) noexcept;
 };
\ No newline at end of file
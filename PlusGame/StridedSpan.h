@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+// Non-owning view of count elements of type T that start stride bytes apart, such as the
+// positions inside an interleaved vertex buffer:
+//
+//     StridedSpan<Vector3> positions(vertices, offsetof(Vertex, Position), sizeof(Vertex), vertexCount);
+//
+// A span whose stride is sizeof(T) is a plain packed array. Use a const T for read-only
+// views; a StridedSpan<T> converts to a StridedSpan<const T>.
+template<typename T>
+class StridedSpan
+{
+public:
+	typedef typename std::conditional<std::is_const<T>::value, const void, void>::type Buffer;
+
+	StridedSpan() noexcept : _data(nullptr), _count(0), _stride(sizeof(T)) {}
+	StridedSpan(T* data, int count) noexcept : _data(data), _count(count), _stride(sizeof(T)) {}
+	StridedSpan(T* data, int count, int stride) noexcept : _data(data), _count(count), _stride(stride) {}
+	// Elements at offset bytes into each record of stride bytes of buffer.
+	StridedSpan(Buffer* buffer, int offset, int stride, int count) noexcept
+		: _data(reinterpret_cast<T*>(static_cast<Byte*>(buffer) + offset)), _count(count), _stride(stride) {}
+
+	template<typename U, typename = typename std::enable_if<std::is_same<T, const U>::value>::type>
+	StridedSpan(const StridedSpan<U>& other) noexcept : _data(other.GetData()), _count(other.GetCount()), _stride(other.GetStride()) {}
+
+	T* GetData() const noexcept { return _data; }
+	int GetCount() const noexcept { return _count; }
+	int GetStride() const noexcept { return _stride; }
+	bool IsPacked() const noexcept { return _stride == sizeof(T); }
+
+	T& operator[](int index) const noexcept
+	{
+		return *reinterpret_cast<T*>(reinterpret_cast<Byte*>(_data) + static_cast<std::ptrdiff_t>(index) * _stride);
+	}
+
+	// The count elements starting at first.
+	StridedSpan Slice(int first, int count) const noexcept { return StridedSpan(&(*this)[first], count, _stride); }
+
+private:
+	typedef typename std::conditional<std::is_const<T>::value, const unsigned char, unsigned char>::type Byte;
+
+	T* _data;
+	int _count;
+	int _stride;
+};
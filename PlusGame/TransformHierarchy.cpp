@@ -0,0 +1,304 @@
+#include "TransformHierarchy.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <stdexcept>
+
+// The local transform of the node was set since the last update.
+static const unsigned char LocalChanged = 1;
+// The world transform of the node has to be recomputed.
+static const unsigned char WorldChanged = 2;
+
+TransformHierarchy::TransformHierarchy() : _levelStarts(1, 0), _layoutValid(true), _anyDirty(false)
+{
+}
+
+/// <summary>
+/// Adds a node to the hierarchy. Its world transform is computed by the next <see cref="Update"/>.
+/// </summary>
+/// <param name="parent">Handle of the parent node, or <see cref="NoParent"/> for a root.</param>
+/// <param name="scale">Local scale.</param>
+/// <param name="rotation">Local rotation.</param>
+/// <param name="translation">Local translation.</param>
+/// <returns>Handle of the new node.</returns>
+int TransformHierarchy::AddNode(int parent, const Vector3& scale, const Quaternion& rotation, const Vector3& translation)
+{
+	if (parent != NoParent && (parent < 0 || parent >= GetNodeCount()))
+		throw std::out_of_range("Parent node does not exist");
+
+	auto handle = GetNodeCount();
+	auto parentIndex = (parent == NoParent) ? -1 : _indices[parent];
+	_parents.push_back(parentIndex);
+	_scales.push_back(scale);
+	_rotations.push_back(rotation);
+	_translations.push_back(translation);
+	_locals.push_back(Matrix::identity);
+	_worlds.push_back(Matrix::identity);
+	_dirty.push_back(LocalChanged | WorldChanged);
+	_depths.push_back((parentIndex < 0) ? 0 : _depths[parentIndex] + 1);
+	_handles.push_back(handle);
+	_indices.push_back(handle);
+	_layoutValid = false;
+	_anyDirty = true;
+	return handle;
+}
+
+/// <summary>
+/// Reserves storage for <paramref name="capacity"/> nodes.
+/// </summary>
+void TransformHierarchy::Reserve(int capacity)
+{
+	_parents.reserve(capacity);
+	_scales.reserve(capacity);
+	_rotations.reserve(capacity);
+	_translations.reserve(capacity);
+	_locals.reserve(capacity);
+	_worlds.reserve(capacity);
+	_dirty.reserve(capacity);
+	_depths.reserve(capacity);
+	_handles.reserve(capacity);
+	_indices.reserve(capacity);
+}
+
+int TransformHierarchy::GetNodeCount() const noexcept
+{
+	return (int)_indices.size();
+}
+
+int TransformHierarchy::GetLevelCount() const noexcept
+{
+	return (int)_levelStarts.size() - 1;
+}
+
+int TransformHierarchy::GetParent(int node) const noexcept
+{
+	auto parentIndex = _parents[_indices[node]];
+	return (parentIndex < 0) ? NoParent : _handles[parentIndex];
+}
+
+Vector3 TransformHierarchy::GetScale(int node) const noexcept
+{
+	return _scales[_indices[node]];
+}
+
+Quaternion TransformHierarchy::GetRotation(int node) const noexcept
+{
+	return _rotations[_indices[node]];
+}
+
+Vector3 TransformHierarchy::GetTranslation(int node) const noexcept
+{
+	return _translations[_indices[node]];
+}
+
+void TransformHierarchy::SetScale(int node, const Vector3& scale) noexcept
+{
+	auto index = _indices[node];
+	_scales[index] = scale;
+	MarkDirty(index);
+}
+
+void TransformHierarchy::SetRotation(int node, const Quaternion& rotation) noexcept
+{
+	auto index = _indices[node];
+	_rotations[index] = rotation;
+	MarkDirty(index);
+}
+
+void TransformHierarchy::SetTranslation(int node, const Vector3& translation) noexcept
+{
+	auto index = _indices[node];
+	_translations[index] = translation;
+	MarkDirty(index);
+}
+
+void TransformHierarchy::SetLocal(int node, const Vector3& scale, const Quaternion& rotation, const Vector3& translation) noexcept
+{
+	auto index = _indices[node];
+	_scales[index] = scale;
+	_rotations[index] = rotation;
+	_translations[index] = translation;
+	MarkDirty(index);
+}
+
+const Matrix& TransformHierarchy::GetLocal(int node) const noexcept
+{
+	return _locals[_indices[node]];
+}
+
+const Matrix& TransformHierarchy::GetWorld(int node) const noexcept
+{
+	return _worlds[_indices[node]];
+}
+
+/// <summary>
+/// Recomputes the local and world matrices of the changed nodes and the world matrices of their descendants.
+/// Levels are processed from the roots down; the nodes of one level are split across <see cref="Parallel.For"/>.
+/// </summary>
+void TransformHierarchy::Update()
+{
+	if (!_layoutValid)
+		RebuildLayout();
+	if (!_anyDirty)
+		return;
+
+	for (auto level = 0; level < GetLevelCount(); level++)
+	{
+		auto begin = _levelStarts[level];
+		auto count = _levelStarts[level + 1] - begin;
+		Parallel::For(count, ParallelGrainSize, [this, begin](int first, int last)
+		{
+			UpdateRange(begin + first, begin + last);
+		});
+	}
+
+	std::fill(_dirty.begin(), _dirty.end(), (unsigned char)0);
+	_anyDirty = false;
+}
+
+/// <summary>
+/// Recomputes every local and world matrix of the hierarchy.
+/// </summary>
+void TransformHierarchy::UpdateAll()
+{
+	std::fill(_dirty.begin(), _dirty.end(), (unsigned char)(LocalChanged | WorldChanged));
+	_anyDirty = true;
+	Update();
+}
+
+void TransformHierarchy::MarkDirty(int index) noexcept
+{
+	_dirty[index] = LocalChanged | WorldChanged;
+	_anyDirty = true;
+}
+
+// Reorders the nodes breadth-first: roots in insertion order, then the children of every
+// node of a level in the order of their parents, which keeps siblings adjacent.
+void TransformHierarchy::RebuildLayout()
+{
+	auto count = GetNodeCount();
+
+	std::vector<int> childStarts(count + 1, 0);
+	for (auto i = 0; i < count; i++)
+	{
+		if (_parents[i] >= 0)
+			childStarts[_parents[i] + 1]++;
+	}
+	for (auto i = 0; i < count; i++)
+		childStarts[i + 1] += childStarts[i];
+
+	std::vector<int> children(childStarts[count]);
+	std::vector<int> childFill(childStarts.begin(), childStarts.end() - 1);
+	for (auto i = 0; i < count; i++)
+	{
+		if (_parents[i] >= 0)
+			children[childFill[_parents[i]]++] = i;
+	}
+
+	std::vector<int> order;
+	order.reserve(count);
+	for (auto i = 0; i < count; i++)
+	{
+		if (_parents[i] < 0)
+			order.push_back(i);
+	}
+	for (auto position = 0; position < (int)order.size(); position++)
+	{
+		auto node = order[position];
+		order.insert(order.end(), children.begin() + childStarts[node], children.begin() + childStarts[node + 1]);
+	}
+
+	std::vector<int> newIndices(count);
+	for (auto i = 0; i < count; i++)
+		newIndices[order[i]] = i;
+
+	std::vector<int> parents(count);
+	std::vector<Vector3> scales(count);
+	std::vector<Quaternion> rotations(count);
+	std::vector<Vector3> translations(count);
+	std::vector<Matrix> locals(count);
+	std::vector<Matrix> worlds(count);
+	std::vector<unsigned char> dirty(count);
+	std::vector<int> depths(count);
+	std::vector<int> handles(count);
+	for (auto i = 0; i < count; i++)
+	{
+		auto old = order[i];
+		parents[i] = (_parents[old] < 0) ? -1 : newIndices[_parents[old]];
+		scales[i] = _scales[old];
+		rotations[i] = _rotations[old];
+		translations[i] = _translations[old];
+		locals[i] = _locals[old];
+		worlds[i] = _worlds[old];
+		dirty[i] = _dirty[old];
+		depths[i] = _depths[old];
+		handles[i] = _handles[old];
+		_indices[handles[i]] = i;
+	}
+	_parents.swap(parents);
+	_scales.swap(scales);
+	_rotations.swap(rotations);
+	_translations.swap(translations);
+	_locals.swap(locals);
+	_worlds.swap(worlds);
+	_dirty.swap(dirty);
+	_depths.swap(depths);
+	_handles.swap(handles);
+
+	_levelStarts.clear();
+	for (auto i = 0; i < count; i++)
+	{
+		if (i == 0 || _depths[i] != _depths[i - 1])
+			_levelStarts.push_back(i);
+	}
+	_levelStarts.push_back(count);
+	_layoutValid = true;
+}
+
+// Updates the nodes [begin, end) of one level; all levels above must be up to date.
+void TransformHierarchy::UpdateRange(int begin, int end) noexcept
+{
+	for (auto i = begin; i < end; i++)
+	{
+		auto parent = _parents[i];
+		if (parent >= 0 && _dirty[parent] != 0)
+			_dirty[i] |= WorldChanged;
+	}
+
+	auto i = begin;
+	while (i < end)
+	{
+		if ((_dirty[i] & LocalChanged) == 0)
+		{
+			i++;
+			continue;
+		}
+
+		auto runEnd = i + 1;
+		while (runEnd < end && (_dirty[runEnd] & LocalChanged) != 0)
+			runEnd++;
+		Matrix::CreateFromTRSBatch(&_scales[i], &_rotations[i], &_translations[i], &_locals[i], runEnd - i);
+		i = runEnd;
+	}
+
+	// Changed siblings are adjacent, so each run shares one parent world matrix.
+	i = begin;
+	while (i < end)
+	{
+		if (_dirty[i] == 0)
+		{
+			i++;
+			continue;
+		}
+
+		auto parent = _parents[i];
+		auto runEnd = i + 1;
+		while (runEnd < end && _dirty[runEnd] != 0 && _parents[runEnd] == parent)
+			runEnd++;
+
+		if (parent < 0)
+			std::copy(_locals.begin() + i, _locals.begin() + runEnd, _worlds.begin() + i);
+		else
+			Matrix::MultiplyBatch(&_locals[i], _worlds[parent], &_worlds[i], runEnd - i);
+		i = runEnd;
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+#include "Vector3.h"
+#include "Quaternion.h"
+#include "Matrix.h"
+
+// Scene graph transforms kept as structure-of-arrays in breadth-first order, so every level
+// is one contiguous range and the children of a node sit next to each other. Nodes are
+// addressed by the handle returned from AddNode, which stays valid when the layout is rebuilt.
+// Update recomputes the world matrices of the nodes whose local transform changed and of
+// their descendants only, one level at a time with the levels split across Parallel.
+class TransformHierarchy
+{
+public:
+	static const int NoParent = -1;
+
+	TransformHierarchy();
+
+	// Adds a node below parent (or a root for NoParent) and returns its handle.
+	int AddNode(int parent, const Vector3& scale, const Quaternion& rotation, const Vector3& translation);
+	void Reserve(int capacity);
+
+	int GetNodeCount() const noexcept;
+	int GetParent(int node) const noexcept;
+
+	Vector3 GetScale(int node) const noexcept;
+	Quaternion GetRotation(int node) const noexcept;
+	Vector3 GetTranslation(int node) const noexcept;
+	void SetScale(int node, const Vector3& scale) noexcept;
+	void SetRotation(int node, const Quaternion& rotation) noexcept;
+	void SetTranslation(int node, const Vector3& translation) noexcept;
+	void SetLocal(int node, const Vector3& scale, const Quaternion& rotation, const Vector3& translation) noexcept;
+
+	// Valid after Update.
+	int GetLevelCount() const noexcept;
+	const Matrix& GetLocal(int node) const noexcept;
+	const Matrix& GetWorld(int node) const noexcept;
+
+	void Update();
+	// Marks every node as changed and recomputes the whole hierarchy.
+	void UpdateAll();
+
+private:
+	// Levels with fewer nodes are processed on the calling thread.
+	static const int ParallelGrainSize = 2048;
+
+	// Indexed by position in the breadth-first layout.
+	std::vector<int> _parents;
+	std::vector<Vector3> _scales;
+	std::vector<Quaternion> _rotations;
+	std::vector<Vector3> _translations;
+	std::vector<Matrix> _locals;
+	std::vector<Matrix> _worlds;
+	std::vector<unsigned char> _dirty;
+	std::vector<int> _depths;
+	std::vector<int> _handles;
+
+	// Position in the layout of every handle.
+	std::vector<int> _indices;
+	// First position of every level, followed by the node count.
+	std::vector<int> _levelStarts;
+	bool _layoutValid;
+	bool _anyDirty;
+
+	void MarkDirty(int index) noexcept;
+	void RebuildLayout();
+	void UpdateRange(int begin, int end) noexcept;
+};
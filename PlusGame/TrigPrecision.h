@@ -0,0 +1,110 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "MathHelper.h"
+
+// Precision tiers of the rotation and interpolation functions that take a trigonometry policy.
+enum TrigPrecision
+{
+	/// <summary>
+	/// Standard library sine, cosine and arc cosine in single precision.
+	/// </summary>
+	TrigExact,
+	/// <summary>
+	/// Polynomial approximations: sine and cosine within 1e-7 for angles up to 8192 radians in
+	/// magnitude, arc cosine within 5e-7 radians. Larger, infinite and NaN angles fall back to
+	/// the standard library.
+	/// </summary>
+	TrigFast,
+	TrigPrecisionCount
+};
+
+// Policies for the functions with a Trig template parameter, such as
+// Quaternion::Slerp<FastTrig>. SinCos gives the sine and the cosine of one angle together,
+// which is all the rotation functions need. The batch kernels compute FastTrig with the same
+// operations in the same order, so a batch gives the results of the single-value overload.
+struct ExactTrig
+{
+	static constexpr TrigPrecision Value = TrigExact;
+
+	static void SinCos(float value, float& sin, float& cos) noexcept
+	{
+		sin = std::sin(value);
+		cos = std::cos(value);
+	}
+
+	static float Acos(float value) noexcept
+	{
+		return std::acos(value);
+	}
+};
+
+struct FastTrig
+{
+	static constexpr TrigPrecision Value = TrigFast;
+
+	// 2 / Pi, and Pi / 2 split in three parts whose products with a quadrant number are exact
+	// for the first two, so that the reduced angle keeps its precision (Cody-Waite reduction).
+	static constexpr float TwoOverPi = 0.636619772f;
+	static constexpr float PiOver2A = 1.5703125f;
+	static constexpr float PiOver2B = 4.83751297e-4f;
+	static constexpr float PiOver2C = 7.54978995e-8f;
+	// Adding and subtracting 1.5 * 2^23 rounds a float to the nearest integer. While the biased
+	// sum stays below 2^24 its last mantissa bits hold that integer modulo 4.
+	static constexpr float RoundingBias = 12582912.0f;
+	// Largest angle the reduction above keeps within the polynomial error; SinCos uses the
+	// standard library beyond it.
+	static constexpr float MaxAngle = 8192.0f;
+
+	// Minimax polynomials for the sine and the cosine on [-Pi / 4, Pi / 4].
+	static constexpr float Sin1 = -1.6666654611e-1f;
+	static constexpr float Sin2 = 8.3321608736e-3f;
+	static constexpr float Sin3 = -1.9515295891e-4f;
+	static constexpr float Cos1 = 4.166664568298827e-2f;
+	static constexpr float Cos2 = -1.388731625493765e-3f;
+	static constexpr float Cos3 = 2.443315711809948e-5f;
+
+	// acos(x) = sqrt(1 - x) * polynomial(x) on [0, 1] (Abramowitz and Stegun 4.4.46).
+	static constexpr float Acos0 = 1.5707963050f;
+	static constexpr float Acos1 = -0.2145988016f;
+	static constexpr float Acos2 = 0.0889789874f;
+	static constexpr float Acos3 = -0.0501743046f;
+	static constexpr float Acos4 = 0.0308918810f;
+	static constexpr float Acos5 = -0.0170881256f;
+	static constexpr float Acos6 = 0.0066700901f;
+	static constexpr float Acos7 = -0.0012624911f;
+
+	static void SinCos(float value, float& sin, float& cos) noexcept
+	{
+		if (!(std::fabs(value) <= MaxAngle))
+		{
+			sin = std::sin(value);
+			cos = std::cos(value);
+			return;
+		}
+
+		float biased = (value * TwoOverPi) + RoundingBias;
+		float quadrant = biased - RoundingBias;
+		float x = ((value - (quadrant * PiOver2A)) - (quadrant * PiOver2B)) - (quadrant * PiOver2C);
+		float z = x * x;
+		float sinX = ((((Sin3 * z) + Sin2) * z + Sin1) * z) * x + x;
+		float cosX = (((((Cos3 * z) + Cos2) * z + Cos1) * z) * z - (0.5f * z)) + 1.0f;
+
+		uint32_t bits;
+		std::memcpy(&bits, &biased, sizeof(bits));
+		uint32_t index = bits & 3;
+		float s = (index & 1) ? cosX : sinX;
+		float c = (index & 1) ? sinX : cosX;
+		sin = (index & 2) ? -s : s;
+		cos = ((index + 1) & 2) ? -c : c;
+	}
+
+	static float Acos(float value) noexcept
+	{
+		float x = std::fabs(value);
+		float polynomial = ((((((((Acos7 * x) + Acos6) * x + Acos5) * x + Acos4) * x + Acos3) * x + Acos2) * x + Acos1) * x) + Acos0;
+		float result = std::sqrt(1.0f - x) * polynomial;
+		return value < 0.0f ? MathHelper::Pi - result : result;
+	}
+};
@@ -1,77 +1,82 @@
 #include "Vector2.h"
+#include "Vector3.h"
+#include "Matrix.h"
+#include "Matrix3x2.h"
+#include "VectorSimd.h"
+#include <stdexcept>
 
-Vector2 operator-(const Vector2& value) {
+Vector2 operator-(const Vector2& value) noexcept {
 	return Vector2(-value.X, -value.Y);
 }
 
-Vector2 operator+(const Vector2& value1, const Vector2& value2) {
+Vector2 operator+(const Vector2& value1, const Vector2& value2) noexcept {
 	return Vector2(value1.X + value2.X, value1.Y + value2.Y);
 }
 
-Vector2 operator-(const Vector2& value1, const Vector2& value2) {
+Vector2 operator-(const Vector2& value1, const Vector2& value2) noexcept {
 	return Vector2(value1.X - value2.X, value1.Y - value2.Y);
 }
 
-Vector2 operator*(const Vector2& value1, const Vector2& value2) {
+Vector2 operator*(const Vector2& value1, const Vector2& value2) noexcept {
 	return Vector2(value1.X * value2.X, value1.Y * value2.Y);
 }
 
-Vector2 operator*(const Vector2& value, float scaleFactor) {
+Vector2 operator*(const Vector2& value, float scaleFactor) noexcept {
 	return Vector2(value.X * scaleFactor, value.Y * scaleFactor);
 }
 
-Vector2 operator*(float scaleFactor, const Vector2& value) {
+Vector2 operator*(float scaleFactor, const Vector2& value) noexcept {
 	return Vector2(value.X * scaleFactor, value.Y * scaleFactor);
 }
 
-Vector2 operator/(const Vector2& value1, const Vector2& value2) {
+Vector2 operator/(const Vector2& value1, const Vector2& value2) noexcept {
 	return Vector2(value1.X / value2.X, value1.Y / value2.Y);
 }
 
-Vector2 operator/(const Vector2& value, float divider) {
+Vector2 operator/(const Vector2& value, float divider) noexcept {
 	float factor = 1.0f / divider;
 	return Vector2(value.X * factor, value.Y * factor);
 }
 
-bool operator==(const Vector2& value1, const Vector2& value2) {
+bool operator==(const Vector2& value1, const Vector2& value2) noexcept {
 	return value1.X == value2.X && value1.Y == value2.Y;
 }
 
-bool operator!=(const Vector2& value1, const Vector2& value2) {
+bool operator!=(const Vector2& value1, const Vector2& value2) noexcept {
 	return value1.X != value2.X || value1.Y != value2.Y;
 }
 
-Vector2 Vector2::Add(Vector2 value1, Vector2 value2)
+Vector2 Vector2::Add(Vector2 value1, Vector2 value2) noexcept
 {
 	value1.X += value2.X;
 	value1.Y += value2.Y;
 	return value1;
 }
 
-void Vector2::Add(Vector2& value1, Vector2& value2, Vector2& result)
+void Vector2::Add(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept
 {
 	result.X = value1.X + value2.X;
 	result.Y = value1.Y + value2.Y;
 }
 
-void Vector2::Ceiling()
+void Vector2::Ceiling() noexcept
 {
 	X = std::ceil(X);
 	Y = std::ceil(Y);
 }
 
-Vector2 Vector2::Ceiling(Vector2 value)
+Vector2 Vector2::Ceiling(Vector2 value) noexcept
 {
 	return Vector2(std::ceil(value.X), std::ceil(value.Y));
 }
 
-void Vector2::Ceiling(Vector2& value, Vector2& result)
+void Vector2::Ceiling(const Vector2& value, Vector2& result) noexcept
 {
 	result.X = std::ceil(value.X);
 	result.Y = std::ceil(value.Y);
 }
 
-Vector2 Vector2::Barycentric(Vector2 value1, Vector2 value2, Vector2 value3, float amount1, float amount2)
+Vector2 Vector2::Barycentric(Vector2 value1, Vector2 value2, Vector2 value3, float amount1, float amount2) noexcept
 {
 	return Vector2(
 		value1.X + (amount1 * (value2.X - value1.X)) + (amount2 * (value3.X - value1.X)),
@@ -79,24 +84,24 @@ Vector2 Vector2::Barycentric(Vector2 value1, Vector2 value2, Vector2 value3, flo
 	);
 }
 
-void Vector2::Barycentric(Vector2& value1, Vector2& value2, Vector2& value3, float amount1, float amount2, Vector2& result)
+void Vector2::Barycentric(const Vector2& value1, const Vector2& value2, const Vector2& value3, float amount1, float amount2, Vector2& result) noexcept
 {
 	result.X = value1.X + (amount1 * (value2.X - value1.X)) + (amount2 * (value3.X - value1.X));
 	result.Y = value1.Y + (amount1 * (value2.Y - value1.Y)) + (amount2 * (value3.Y - value1.Y));
 }
 
-Vector2 Vector2::CatmullRom(Vector2 value1, Vector2 value2, Vector2 value3, Vector2 value4, float amount)
+Vector2 Vector2::CatmullRom(Vector2 value1, Vector2 value2, Vector2 value3, Vector2 value4, float amount) noexcept
 {
 	return Vector2(MathHelper::CatmullRom(value1.X, value2.X, value3.X, value4.X, amount), MathHelper::CatmullRom(value1.Y, value2.Y, value3.Y, value4.Y, amount));
 }
 
-void Vector2::CatmullRom(Vector2& value1, Vector2& value2, Vector2& value3, Vector2& value4, float amount, Vector2& result)
+void Vector2::CatmullRom(const Vector2& value1, const Vector2& value2, const Vector2& value3, const Vector2& value4, float amount, Vector2& result) noexcept
 {
 	result.X = MathHelper::CatmullRom(value1.X, value2.X, value3.X, value4.X, amount);
 	result.Y = MathHelper::CatmullRom(value1.Y, value2.Y, value3.Y, value4.Y, amount);
 }
 
-Vector2 Vector2::Clamp(Vector2 value1, Vector2 min, Vector2 max)
+Vector2 Vector2::Clamp(Vector2 value1, Vector2 min, Vector2 max) noexcept
 {
 	return Vector2(
 		std::fmax(min.X, std::fmin(value1.X, max.X)),
@@ -104,50 +109,50 @@ Vector2 Vector2::Clamp(Vector2 value1, Vector2 min, Vector2 max)
 	);
 }
 
-void Vector2::Clamp(Vector2& value1, Vector2& min, Vector2& max, Vector2& result)
+void Vector2::Clamp(const Vector2& value1, const Vector2& min, const Vector2& max, Vector2& result) noexcept
 {
 	result.X = std::fmax(min.X, std::fmin(value1.X, max.X));
 	result.Y = std::fmax(min.Y, std::fmin(value1.Y, max.Y));
 }
 
-float Vector2::Distance(Vector2 value1, Vector2 value2)
+float Vector2::Distance(Vector2 value1, Vector2 value2) noexcept
 {
 	float v1 = value1.X - value2.X, v2 = value1.Y - value2.Y;
 	return std::sqrt((v1 * v1) + (v2 * v2));
 }
 
-void Vector2::Distance(Vector2& value1, Vector2& value2, float& result)
+void Vector2::Distance(const Vector2& value1, const Vector2& value2, float& result) noexcept
 {
 	float v1 = value1.X - value2.X, v2 = value1.Y - value2.Y;
 	result = std::sqrt((v1 * v1) + (v2 * v2));
 }
 
-float Vector2::DistanceSquared(Vector2 value1, Vector2 value2)
+float Vector2::DistanceSquared(Vector2 value1, Vector2 value2) noexcept
 {
 	float v1 = value1.X - value2.X, v2 = value1.Y - value2.Y;
 	return (v1 * v1) + (v2 * v2);
 }
 
-void Vector2::DistanceSquared(Vector2& value1, Vector2& value2, float& result)
+void Vector2::DistanceSquared(const Vector2& value1, const Vector2& value2, float& result) noexcept
 {
 	float v1 = value1.X - value2.X, v2 = value1.Y - value2.Y;
 	result = (v1 * v1) + (v2 * v2);
 }
 
-Vector2 Vector2::Divide(Vector2 value1, Vector2 value2)
+Vector2 Vector2::Divide(Vector2 value1, Vector2 value2) noexcept
 {
 	value1.X /= value2.X;
 	value1.Y /= value2.Y;
 	return value1;
 }
 
-void Vector2::Divide(Vector2& value1, Vector2& value2, Vector2& result)
+void Vector2::Divide(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept
 {
 	result.X = value1.X / value2.X;
 	result.Y = value1.Y / value2.Y;
 }
 
-Vector2 Vector2::Divide(Vector2 value1, float divider)
+Vector2 Vector2::Divide(Vector2 value1, float divider) noexcept
 {
 	float factor = 1.0f / divider;
 	value1.X *= factor;
@@ -155,51 +160,51 @@ Vector2 Vector2::Divide(Vector2 value1, float divider)
 	return value1;
 }
 
-void Vector2::Divide(Vector2& value1, float divider, Vector2& result)
+void Vector2::Divide(const Vector2& value1, float divider, Vector2& result) noexcept
 {
 	float factor = 1.0f / divider;
 	result.X = value1.X * factor;
 	result.Y = value1.Y * factor;
 }
 
-float Vector2::Dot(Vector2 value1, Vector2 value2)
+float Vector2::Dot(Vector2 value1, Vector2 value2) noexcept
 {
 	return (value1.X * value2.X) + (value1.Y * value2.Y);
 }
 
-void Vector2::Dot(Vector2& value1, Vector2& value2, float& result)
+void Vector2::Dot(const Vector2& value1, const Vector2& value2, float& result) noexcept
 {
 	result = (value1.X * value2.X) + (value1.Y * value2.Y);
 }
 
-bool Vector2::Equals(Vector2 other)
+bool Vector2::Equals(Vector2 other) const noexcept
 {
 	return (X == other.X) && (Y == other.Y);
 }
 
-void Vector2::Floor()
+void Vector2::Floor() noexcept
 {
 	X = std::floor(X);
 	Y = std::floor(Y);
 }
 
-Vector2 Vector2::Floor(Vector2 value)
+Vector2 Vector2::Floor(Vector2 value) noexcept
 {
 	return Vector2(std::floor(value.X), std::floor(value.Y));
 }
 
-void Vector2::Floor(Vector2& value, Vector2& result)
+void Vector2::Floor(const Vector2& value, Vector2& result) noexcept
 {
 	result.X = std::floor(value.X);
 	result.Y = std::floor(value.Y);
 }
 
-int Vector2::GetHashCode()
+int Vector2::GetHashCode() const noexcept
 {
 	return 1; //_cast<int>((X.GetHashCode() * 397) ^ Y.GetHashCode());
 }
 
-Vector2 Vector2::Hermite(Vector2 value1, Vector2 tangent1, Vector2 value2, Vector2 tangent2, float amount)
+Vector2 Vector2::Hermite(Vector2 value1, Vector2 tangent1, Vector2 value2, Vector2 tangent2, float amount) noexcept
 {
 	return Vector2(
 		MathHelper::Hermite(value1.X, tangent1.X, value2.X, tangent2.X, amount),
@@ -207,23 +212,23 @@ Vector2 Vector2::Hermite(Vector2 value1, Vector2 tangent1, Vector2 value2, Vecto
 	);
 }
 
-void Vector2::Hermite(Vector2& value1, Vector2& tangent1, Vector2& value2, Vector2& tangent2, float amount, Vector2& result)
+void Vector2::Hermite(const Vector2& value1, const Vector2& tangent1, const Vector2& value2, const Vector2& tangent2, float amount, Vector2& result) noexcept
 {
 	result.X = MathHelper::Hermite(value1.X, tangent1.X, value2.X, tangent2.X, amount);
 	result.Y = MathHelper::Hermite(value1.Y, tangent1.Y, value2.Y, tangent2.Y, amount);
 }
 
-float Vector2::Length()
+float Vector2::Length() const noexcept
 {
 	return sqrt((X * X) + (Y * Y));
 }
 
-float Vector2::LengthSquared()
+float Vector2::LengthSquared() const noexcept
 {
 	return (X * X) + (Y * Y);
 }
 
-Vector2 Vector2::Lerp(Vector2 value1, Vector2 value2, float amount)
+Vector2 Vector2::Lerp(Vector2 value1, Vector2 value2, float amount) noexcept
 {
 	return Vector2(
 		MathHelper::Lerp(value1.X, value2.X, amount),
@@ -231,13 +236,13 @@ Vector2 Vector2::Lerp(Vector2 value1, Vector2 value2, float amount)
 	);
 }
 
-void Vector2::Lerp(Vector2& value1, Vector2& value2, float amount, Vector2& result)
+void Vector2::Lerp(const Vector2& value1, const Vector2& value2, float amount, Vector2& result) noexcept
 {
 	result.X = MathHelper::Lerp(value1.X, value2.X, amount);
 	result.Y = MathHelper::Lerp(value1.Y, value2.Y, amount);
 }
 
-Vector2 Vector2::LerpPrecise(Vector2 value1, Vector2 value2, float amount)
+Vector2 Vector2::LerpPrecise(Vector2 value1, Vector2 value2, float amount) noexcept
 {
 	return Vector2(
 		MathHelper::LerpPrecise(value1.X, value2.X, amount),
@@ -245,13 +250,13 @@ Vector2 Vector2::LerpPrecise(Vector2 value1, Vector2 value2, float amount)
 	);
 }
 
-void Vector2::LerpPrecise(Vector2& value1, Vector2& value2, float amount, Vector2& result)
+void Vector2::LerpPrecise(const Vector2& value1, const Vector2& value2, float amount, Vector2& result) noexcept
 {
 	result.X = MathHelper::LerpPrecise(value1.X, value2.X, amount);
 	result.Y = MathHelper::LerpPrecise(value1.Y, value2.Y, amount);
 }
 
-Vector2 Vector2::Max(Vector2 value1, Vector2 value2)
+Vector2 Vector2::Max(Vector2 value1, Vector2 value2) noexcept
 {
 	return Vector2(
 		value1.X > value2.X ? value1.X : value2.X,
@@ -259,13 +264,13 @@ Vector2 Vector2::Max(Vector2 value1, Vector2 value2)
 	);
 }
 
-void Vector2::Max(Vector2& value1, Vector2& value2, Vector2& result)
+void Vector2::Max(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept
 {
 	result.X = value1.X > value2.X ? value1.X : value2.X;
 	result.Y = value1.Y > value2.Y ? value1.Y : value2.Y;
 }
 
-Vector2 Vector2::Min(Vector2 value1, Vector2 value2)
+Vector2 Vector2::Min(Vector2 value1, Vector2 value2) noexcept
 {
 	return Vector2(
 		value1.X < value2.X ? value1.X : value2.X,
@@ -273,59 +278,59 @@ Vector2 Vector2::Min(Vector2 value1, Vector2 value2)
 	);
 }
 
-void Vector2::Min(Vector2& value1, Vector2& value2, Vector2& result)
+void Vector2::Min(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept
 {
 	result.X = value1.X < value2.X ? value1.X : value2.X;
 	result.Y = value1.Y < value2.Y ? value1.Y : value2.Y;
 }
 
-Vector2 Vector2::Multiply(Vector2 value1, Vector2 value2)
+Vector2 Vector2::Multiply(Vector2 value1, Vector2 value2) noexcept
 {
 	value1.X *= value2.X;
 	value1.Y *= value2.Y;
 	return value1;
 }
 
-void Vector2::Multiply(Vector2& value1, Vector2& value2, Vector2& result)
+void Vector2::Multiply(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept
 {
 	result.X = value1.X * value2.X;
 	result.Y = value1.Y * value2.Y;
 }
 
-Vector2 Vector2::Multiply(Vector2 value1, float scaleFactor)
+Vector2 Vector2::Multiply(Vector2 value1, float scaleFactor) noexcept
 {
 	value1.X *= scaleFactor;
 	value1.Y *= scaleFactor;
 	return value1;
 }
 
-void Vector2::Multiply(Vector2& value1, float scaleFactor, Vector2& result)
+void Vector2::Multiply(const Vector2& value1, float scaleFactor, Vector2& result) noexcept
 {
 	result.X = value1.X * scaleFactor;
 	result.Y = value1.Y * scaleFactor;
 }
 
-Vector2 Vector2::Negate(Vector2 value)
+Vector2 Vector2::Negate(Vector2 value) noexcept
 {
 	value.X = -value.X;
 	value.Y = -value.Y;
 	return value;
 }
 
-void Vector2::Negate(Vector2& value, Vector2& result)
+void Vector2::Negate(const Vector2& value, Vector2& result) noexcept
 {
 	result.X = -value.X;
 	result.Y = -value.Y;
 }
 
-void Vector2::Normalize()
+void Vector2::Normalize() noexcept
 {
 	float val = 1.0f / sqrt((X * X) + (Y * Y));
 	X *= val;
 	Y *= val;
 }
 
-Vector2 Vector2::Normalize(Vector2 value)
+Vector2 Vector2::Normalize(Vector2 value) noexcept
 {
 	float val = 1.0f / sqrt((value.X * value.X) + (value.Y * value.Y));
 	value.X *= val;
@@ -333,14 +338,14 @@ Vector2 Vector2::Normalize(Vector2 value)
 	return value;
 }
 
-void Vector2::Normalize(Vector2& value, Vector2& result)
+void Vector2::Normalize(const Vector2& value, Vector2& result) noexcept
 {
 	float val = 1.0f / sqrt((value.X * value.X) + (value.Y * value.Y));
 	result.X = value.X * val;
 	result.Y = value.Y * val;
 }
 
-Vector2 Vector2::Reflect(Vector2 vector, Vector2 normal)
+Vector2 Vector2::Reflect(Vector2 vector, Vector2 normal) noexcept
 {
 	Vector2 result(0, 0);
 	float val = 2.0f * ((vector.X * normal.X) + (vector.Y * normal.Y));
@@ -349,33 +354,33 @@ Vector2 Vector2::Reflect(Vector2 vector, Vector2 normal)
 	return result;
 }
 
-void Vector2::Reflect(Vector2& vector, Vector2& normal, Vector2& result)
+void Vector2::Reflect(const Vector2& vector, const Vector2& normal, Vector2& result) noexcept
 {
 	float val = 2.0f * ((vector.X * normal.X) + (vector.Y * normal.Y));
 	result.X = vector.X - (normal.X * val);
 	result.Y = vector.Y - (normal.Y * val);
 }
 
-void Vector2::Round()
+void Vector2::Round() noexcept
 {
 	X = round(X);
 	Y = round(Y);
 }
 
-Vector2 Vector2::Round(Vector2 value)
+Vector2 Vector2::Round(Vector2 value) noexcept
 {
 	value.X = round(value.X);
 	value.Y = round(value.Y);
 	return value;
 }
 
-void Vector2::Round(Vector2& value, Vector2& result)
+void Vector2::Round(const Vector2& value, Vector2& result) noexcept
 {
 	result.X = round(value.X);
 	result.Y = round(value.Y);
 }
 
-Vector2 Vector2::SmoothStep(Vector2 value1, Vector2 value2, float amount)
+Vector2 Vector2::SmoothStep(Vector2 value1, Vector2 value2, float amount) noexcept
 {
 	return Vector2(
 		MathHelper::SmoothStep(value1.X, value2.X, amount),
@@ -383,32 +388,194 @@ Vector2 Vector2::SmoothStep(Vector2 value1, Vector2 value2, float amount)
 	);
 }
 
-void Vector2::SmoothStep(Vector2& value1, Vector2& value2, float amount, Vector2& result)
+void Vector2::SmoothStep(const Vector2& value1, const Vector2& value2, float amount, Vector2& result) noexcept
 {
 	result.X = MathHelper::SmoothStep(value1.X, value2.X, amount);
 	result.Y = MathHelper::SmoothStep(value1.Y, value2.Y, amount);
 }
 
-Vector2 Vector2::Subtract(Vector2 value1, Vector2 value2)
+Vector2 Vector2::Subtract(Vector2 value1, Vector2 value2) noexcept
 {
 	value1.X -= value2.X;
 	value1.Y -= value2.Y;
 	return value1;
 }
 
-void Vector2::Subtract(Vector2& value1, Vector2& value2, Vector2& result)
+void Vector2::Subtract(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept
 {
 	result.X = value1.X - value2.X;
 	result.Y = value1.Y - value2.Y;
 }
 
-std::string Vector2::ToString()
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of 2d-vector by the specified <see cref="Matrix"/>.
+/// </summary>
+/// <param name="position">Source <see cref="Vector2"/>.</param>
+/// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
+/// <returns>Transformed <see cref="Vector2"/>.</returns>
+Vector2 Vector2::Transform(Vector2 position, const Matrix& matrix) noexcept
+{
+	Transform(position, matrix, position);
+	return position;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of 2d-vector by the specified <see cref="Matrix"/>.
+/// </summary>
+/// <param name="position">Source <see cref="Vector2"/>.</param>
+/// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
+/// <param name="result">Transformed <see cref="Vector2"/> as an output parameter.</param>
+void Vector2::Transform(const Vector2& position, const Matrix& matrix, Vector2& result) noexcept
+{
+	auto x = (position.X * matrix.M11) + (position.Y * matrix.M21) + matrix.M41;
+	auto y = (position.X * matrix.M12) + (position.Y * matrix.M22) + matrix.M42;
+	result.X = x;
+	result.Y = y;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of 2d-vector by the specified <see cref="Matrix3x2"/>.
+/// The result is the same as with the equivalent <see cref="Matrix"/>.
+/// </summary>
+/// <param name="position">Source <see cref="Vector2"/>.</param>
+/// <param name="matrix">The transformation <see cref="Matrix3x2"/>.</param>
+/// <returns>Transformed <see cref="Vector2"/>.</returns>
+Vector2 Vector2::Transform(Vector2 position, const Matrix3x2& matrix) noexcept
+{
+	Transform(position, matrix, position);
+	return position;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of 2d-vector by the specified <see cref="Matrix3x2"/>.
+/// The result is the same as with the equivalent <see cref="Matrix"/>.
+/// </summary>
+/// <param name="position">Source <see cref="Vector2"/>.</param>
+/// <param name="matrix">The transformation <see cref="Matrix3x2"/>.</param>
+/// <param name="result">Transformed <see cref="Vector2"/> as an output parameter.</param>
+void Vector2::Transform(const Vector2& position, const Matrix3x2& matrix, Vector2& result) noexcept
+{
+	auto x = (position.X * matrix.M11) + (position.Y * matrix.M21) + matrix.M31;
+	auto y = (position.X * matrix.M12) + (position.Y * matrix.M22) + matrix.M32;
+	result.X = x;
+	result.Y = y;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of 2d-vector by the specified <see cref="Quaternion"/>, representing the rotation.
+/// </summary>
+/// <param name="value">Source <see cref="Vector2"/>.</param>
+/// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
+/// <returns>Transformed <see cref="Vector2"/>.</returns>
+Vector2 Vector2::Transform(Vector2 value, const Quaternion& rotation) noexcept
+{
+	Transform(value, rotation, value);
+	return value;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of 2d-vector by the specified <see cref="Quaternion"/>, representing the rotation.
+/// The vector is rotated as a <see cref="Vector3"/> with a zero Z and the rotated Z is dropped.
+/// </summary>
+/// <param name="value">Source <see cref="Vector2"/>.</param>
+/// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
+/// <param name="result">Transformed <see cref="Vector2"/> as an output parameter.</param>
+void Vector2::Transform(const Vector2& value, const Quaternion& rotation, Vector2& result) noexcept
+{
+	auto rotated = Vector3::Transform(Vector3(value.X, value.Y, 0.0f), rotation);
+	result.X = rotated.X;
+	result.Y = rotated.Y;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of the specified normal by the specified <see cref="Matrix"/>.
+/// </summary>
+/// <param name="normal">Source <see cref="Vector2"/> which represents a normal vector.</param>
+/// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
+/// <returns>Transformed normal.</returns>
+Vector2 Vector2::TransformNormal(Vector2 normal, const Matrix& matrix) noexcept
+{
+	TransformNormal(normal, matrix, normal);
+	return normal;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of the specified normal by the specified <see cref="Matrix"/>.
+/// </summary>
+/// <param name="normal">Source <see cref="Vector2"/> which represents a normal vector.</param>
+/// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
+/// <param name="result">Transformed normal as an output parameter.</param>
+void Vector2::TransformNormal(const Vector2& normal, const Matrix& matrix, Vector2& result) noexcept
+{
+	auto x = (normal.X * matrix.M11) + (normal.Y * matrix.M21);
+	auto y = (normal.X * matrix.M12) + (normal.Y * matrix.M22);
+	result.X = x;
+	result.Y = y;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of the specified normal by the linear part of the specified <see cref="Matrix3x2"/>.
+/// </summary>
+/// <param name="normal">Source <see cref="Vector2"/> which represents a normal vector.</param>
+/// <param name="matrix">The transformation <see cref="Matrix3x2"/>.</param>
+/// <returns>Transformed normal.</returns>
+Vector2 Vector2::TransformNormal(Vector2 normal, const Matrix3x2& matrix) noexcept
+{
+	TransformNormal(normal, matrix, normal);
+	return normal;
+}
+
+/// <summary>
+/// Creates a new <see cref="Vector2"/> that contains a transformation of the specified normal by the linear part of the specified <see cref="Matrix3x2"/>.
+/// </summary>
+/// <param name="normal">Source <see cref="Vector2"/> which represents a normal vector.</param>
+/// <param name="matrix">The transformation <see cref="Matrix3x2"/>.</param>
+/// <param name="result">Transformed normal as an output parameter.</param>
+void Vector2::TransformNormal(const Vector2& normal, const Matrix3x2& matrix, Vector2& result) noexcept
+{
+	auto x = (normal.X * matrix.M11) + (normal.Y * matrix.M21);
+	auto y = (normal.X * matrix.M12) + (normal.Y * matrix.M22);
+	result.X = x;
+	result.Y = y;
+}
+
+/// <summary>
+/// Apply transformation on all vectors of a strided span of <see cref="Vector2"/> by the specified <see cref="Matrix3x2"/>
+/// and places the results in another span, which may be the source.
+/// </summary>
+/// <param name="source">Source vectors.</param>
+/// <param name="matrix">The transformation <see cref="Matrix3x2"/>.</param>
+/// <param name="destination">Destination vectors, as many as in the source.</param>
+void Vector2::Transform(StridedSpan<const Vector2> source, const Matrix3x2& matrix, StridedSpan<Vector2> destination)
+{
+	if (source.GetCount() != destination.GetCount())
+		throw std::out_of_range("Source and destination spans have different element counts");
+
+	VectorSimd::TransformStrided(source.GetData(), source.GetStride(), matrix, destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Apply transformation on all normals of a strided span of <see cref="Vector2"/> by the linear part of the specified <see cref="Matrix3x2"/>
+/// and places the results in another span, which may be the source.
+/// </summary>
+/// <param name="source">Source normals.</param>
+/// <param name="matrix">The transformation <see cref="Matrix3x2"/>.</param>
+/// <param name="destination">Destination normals, as many as in the source.</param>
+void Vector2::TransformNormal(StridedSpan<const Vector2> source, const Matrix3x2& matrix, StridedSpan<Vector2> destination)
+{
+	if (source.GetCount() != destination.GetCount())
+		throw std::out_of_range("Source and destination spans have different element counts");
+
+	VectorSimd::TransformNormalStrided(source.GetData(), source.GetStride(), matrix, destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+std::string Vector2::ToString() const
 {
 	return "{X:" + std::to_string(X) + " Y:" + std::to_string(Y) + "}";
 }
 
 // Assuming Point is defined appropriately in your code
-Point Vector2::ToPoint()
+Point Vector2::ToPoint() const noexcept
 {
 	return Point(static_cast<int>(X), static_cast<int>(Y));
 }
\ No newline at end of file
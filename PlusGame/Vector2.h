@@ -3,6 +3,12 @@
 #include "MathHelper.h"
 #include <string>
 #include "Point.h"
+#include "StridedSpan.h"
+#include "VectorSimd.h"
+
+class Matrix;
+class Matrix3x2;
+class Quaternion;
 
 struct Vector2
 {
@@ -11,123 +17,167 @@ public:
 	float Y;
 
 public:
-	Vector2(float x, float y) : X(x), Y(y) {}
-	Vector2(float value) : X(value), Y(value) {}
+	constexpr Vector2(float x, float y) noexcept : X(x), Y(y) {}
+	constexpr Vector2(float value) noexcept : X(value), Y(value) {}
 
-	friend Vector2 operator-(const Vector2& value);
+	friend Vector2 operator-(const Vector2& value) noexcept;
 
 	// Binary addition
-	friend Vector2 operator+(const Vector2& value1, const Vector2& value2);
+	friend Vector2 operator+(const Vector2& value1, const Vector2& value2) noexcept;
 
 	// Binary subtraction
-	friend Vector2 operator-(const Vector2& value1, const Vector2& value2);
+	friend Vector2 operator-(const Vector2& value1, const Vector2& value2) noexcept;
 
 	// Component-wise multiplication
-	friend Vector2 operator*(const Vector2& value1, const Vector2& value2);
+	friend Vector2 operator*(const Vector2& value1, const Vector2& value2) noexcept;
 
 	// Scalar multiplication
-	friend Vector2 operator*(const Vector2& value, float scaleFactor);
-	friend Vector2 operator*(float scaleFactor, const Vector2& value);
+	friend Vector2 operator*(const Vector2& value, float scaleFactor) noexcept;
+	friend Vector2 operator*(float scaleFactor, const Vector2& value) noexcept;
 
 	// Component-wise division
-	friend Vector2 operator/(const Vector2& value1, const Vector2& value2);
+	friend Vector2 operator/(const Vector2& value1, const Vector2& value2) noexcept;
 
 	// Scalar division
-	friend Vector2 operator/(const Vector2& value, float divider);
+	friend Vector2 operator/(const Vector2& value, float divider) noexcept;
 
 	// Equality comparison
-	friend bool operator==(const Vector2& value1, const Vector2& value2);
+	friend bool operator==(const Vector2& value1, const Vector2& value2) noexcept;
 
 	// Inequality comparison
-	friend bool operator!=(const Vector2& value1, const Vector2& value2);
+	friend bool operator!=(const Vector2& value1, const Vector2& value2) noexcept;
 
-	static Vector2 Add(Vector2 value1, Vector2 value2);
-	static void Add(Vector2& value1, Vector2& value2, Vector2& result);
+	static Vector2 Add(Vector2 value1, Vector2 value2) noexcept;
+	static void Add(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept;
 
-	static Vector2 Barycentric(Vector2 value1, Vector2 value2, Vector2 value3, float amount1, float amount2);
-	static void Barycentric(Vector2& value1, Vector2& value2, Vector2& value3, float amount1, float amount2, Vector2& result);
+	static Vector2 Barycentric(Vector2 value1, Vector2 value2, Vector2 value3, float amount1, float amount2) noexcept;
+	static void Barycentric(const Vector2& value1, const Vector2& value2, const Vector2& value3, float amount1, float amount2, Vector2& result) noexcept;
 
-	static Vector2 CatmullRom(Vector2 value1, Vector2 value2, Vector2 value3, Vector2 value4, float amount);
-	static void CatmullRom(Vector2& value1, Vector2& value2, Vector2& value3, Vector2& value4, float amount, Vector2& result);
+	static Vector2 CatmullRom(Vector2 value1, Vector2 value2, Vector2 value3, Vector2 value4, float amount) noexcept;
+	static void CatmullRom(const Vector2& value1, const Vector2& value2, const Vector2& value3, const Vector2& value4, float amount, Vector2& result) noexcept;
 
-	void Ceiling();
-	static Vector2 Ceiling(Vector2 value);
-	static void Ceiling(Vector2& value, Vector2& result);
+	void Ceiling() noexcept;
+	static Vector2 Ceiling(Vector2 value) noexcept;
+	static void Ceiling(const Vector2& value, Vector2& result) noexcept;
 
-	static Vector2 Clamp(Vector2 value1, Vector2 min, Vector2 max);
-	static void Clamp(Vector2& value1, Vector2& min, Vector2& max, Vector2& result);
+	static Vector2 Clamp(Vector2 value1, Vector2 min, Vector2 max) noexcept;
+	static void Clamp(const Vector2& value1, const Vector2& min, const Vector2& max, Vector2& result) noexcept;
 
-	static float Distance(Vector2 value1, Vector2 value2);
-	static void Distance(Vector2& value1, Vector2& value2, float& result);
+	static float Distance(Vector2 value1, Vector2 value2) noexcept;
+	static void Distance(const Vector2& value1, const Vector2& value2, float& result) noexcept;
 
-	static float DistanceSquared(Vector2 value1, Vector2 value2);
-	static void DistanceSquared(Vector2& value1, Vector2& value2, float& result);
+	static float DistanceSquared(Vector2 value1, Vector2 value2) noexcept;
+	static void DistanceSquared(const Vector2& value1, const Vector2& value2, float& result) noexcept;
 
-	static Vector2 Divide(Vector2 value1, Vector2 value2);
-	static void Divide(Vector2& value1, Vector2& value2, Vector2& result);
+	static Vector2 Divide(Vector2 value1, Vector2 value2) noexcept;
+	static void Divide(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept;
 
-	static Vector2 Divide(Vector2 value1, float divider);
-	static void Divide(Vector2& value1, float divider, Vector2& result);
+	static Vector2 Divide(Vector2 value1, float divider) noexcept;
+	static void Divide(const Vector2& value1, float divider, Vector2& result) noexcept;
 
-	static float Dot(Vector2 value1, Vector2 value2);
-	static void Dot(Vector2& value1, Vector2& value2, float& result);
+	static float Dot(Vector2 value1, Vector2 value2) noexcept;
+	static void Dot(const Vector2& value1, const Vector2& value2, float& result) noexcept;
 
-	bool Equals(Vector2 other);
+	bool Equals(Vector2 other) const noexcept;
 
-	void Floor();
-	static Vector2 Floor(Vector2 value);
-	static void Floor(Vector2& value, Vector2& result);
+	void Floor() noexcept;
+	static Vector2 Floor(Vector2 value) noexcept;
+	static void Floor(const Vector2& value, Vector2& result) noexcept;
 
-	int GetHashCode();
+	int GetHashCode() const noexcept;
 
-	static Vector2 Hermite(Vector2 value1, Vector2 tangent1, Vector2 value2, Vector2 tangent2, float amount);
-	static void Hermite(Vector2& value1, Vector2& tangent1, Vector2& value2, Vector2& tangent2, float amount, Vector2& result);
+	static Vector2 Hermite(Vector2 value1, Vector2 tangent1, Vector2 value2, Vector2 tangent2, float amount) noexcept;
+	static void Hermite(const Vector2& value1, const Vector2& tangent1, const Vector2& value2, const Vector2& tangent2, float amount, Vector2& result) noexcept;
 
-	float Length();
-	float LengthSquared();
+	float Length() const noexcept;
+	float LengthSquared() const noexcept;
 
-	static Vector2 Lerp(Vector2 value1, Vector2 value2, float amount);
-	static void Lerp(Vector2& value1, Vector2& value2, float amount, Vector2& result);
+	static Vector2 Lerp(Vector2 value1, Vector2 value2, float amount) noexcept;
+	static void Lerp(const Vector2& value1, const Vector2& value2, float amount, Vector2& result) noexcept;
 
-	static Vector2 LerpPrecise(Vector2 value1, Vector2 value2, float amount);
-	static void LerpPrecise(Vector2& value1, Vector2& value2, float amount, Vector2& result);
+	static Vector2 LerpPrecise(Vector2 value1, Vector2 value2, float amount) noexcept;
+	static void LerpPrecise(const Vector2& value1, const Vector2& value2, float amount, Vector2& result) noexcept;
 
-	static Vector2 Max(Vector2 value1, Vector2 value2);
-	static void Max(Vector2& value1, Vector2& value2, Vector2& result);
+	static Vector2 Max(Vector2 value1, Vector2 value2) noexcept;
+	static void Max(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept;
 
-	static Vector2 Min(Vector2 value1, Vector2 value2);
-	static void Min(Vector2& value1, Vector2& value2, Vector2& result);
+	static Vector2 Min(Vector2 value1, Vector2 value2) noexcept;
+	static void Min(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept;
 
-	static Vector2 Multiply(Vector2 value1, Vector2 value2);
-	static void Multiply(Vector2& value1, Vector2& value2, Vector2& result);
+	static Vector2 Multiply(Vector2 value1, Vector2 value2) noexcept;
+	static void Multiply(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept;
 
-	static Vector2 Multiply(Vector2 value1, float scaleFactor);
-	static void Multiply(Vector2& value1, float scaleFactor, Vector2& result);
+	static Vector2 Multiply(Vector2 value1, float scaleFactor) noexcept;
+	static void Multiply(const Vector2& value1, float scaleFactor, Vector2& result) noexcept;
 
-	static Vector2 Negate(Vector2 value);
-	static void Negate(Vector2& value, Vector2& result);
+	static Vector2 Negate(Vector2 value) noexcept;
+	static void Negate(const Vector2& value, Vector2& result) noexcept;
 
-	void Normalize();
-	static Vector2 Normalize(Vector2 value);
-	static void Normalize(Vector2& value, Vector2& result);
+	void Normalize() noexcept;
+	static Vector2 Normalize(Vector2 value) noexcept;
+	static void Normalize(const Vector2& value, Vector2& result) noexcept;
+	// Normalize with the precision policy of NormalizePrecision.h, as in Normalize<RefinedPrecision>(value).
+	template<typename Precision> void Normalize() noexcept;
+	template<typename Precision> static Vector2 Normalize(Vector2 value) noexcept;
+	template<typename Precision> static void Normalize(const Vector2& value, Vector2& result) noexcept;
+	template<typename Precision> static void Normalize(const Vector2* sourceArray, Vector2* destinationArray, int length) noexcept;
 
-	static Vector2 Reflect(Vector2 vector, Vector2 normal);
-	static void Reflect(Vector2& vector, Vector2& normal, Vector2& result);
+	static Vector2 Reflect(Vector2 vector, Vector2 normal) noexcept;
+	static void Reflect(const Vector2& vector, const Vector2& normal, Vector2& result) noexcept;
 
-	void Round();
-	static Vector2 Round(Vector2 value);
-	static void Round(Vector2& value, Vector2& result);
+	void Round() noexcept;
+	static Vector2 Round(Vector2 value) noexcept;
+	static void Round(const Vector2& value, Vector2& result) noexcept;
 
-	static Vector2 SmoothStep(Vector2 value1, Vector2 value2, float amount);
-	static void SmoothStep(Vector2& value1, Vector2& value2, float amount, Vector2& result);
+	static Vector2 SmoothStep(Vector2 value1, Vector2 value2, float amount) noexcept;
+	static void SmoothStep(const Vector2& value1, const Vector2& value2, float amount, Vector2& result) noexcept;
 
-	static Vector2 Subtract(Vector2 value1, Vector2 value2);
-	static void Subtract(Vector2& value1, Vector2& value2, Vector2& result);
+	static Vector2 Subtract(Vector2 value1, Vector2 value2) noexcept;
+	static void Subtract(const Vector2& value1, const Vector2& value2, Vector2& result) noexcept;
 
-	std::string ToString();
+	static Vector2 Transform(Vector2 position, const Matrix& matrix) noexcept;
+	static void Transform(const Vector2& position, const Matrix& matrix, Vector2& result) noexcept;
+	static Vector2 Transform(Vector2 position, const Matrix3x2& matrix) noexcept;
+	static void Transform(const Vector2& position, const Matrix3x2& matrix, Vector2& result) noexcept;
+	static Vector2 Transform(Vector2 value, const Quaternion& rotation) noexcept;
+	static void Transform(const Vector2& value, const Quaternion& rotation, Vector2& result) noexcept;
+	static Vector2 TransformNormal(Vector2 normal, const Matrix& matrix) noexcept;
+	static void TransformNormal(const Vector2& normal, const Matrix& matrix, Vector2& result) noexcept;
+	static Vector2 TransformNormal(Vector2 normal, const Matrix3x2& matrix) noexcept;
+	static void TransformNormal(const Vector2& normal, const Matrix3x2& matrix, Vector2& result) noexcept;
+	// Works in place on strided data such as the corners of an interleaved sprite vertex buffer;
+	// the destination may be the source. Throws std::out_of_range if the counts differ.
+	static void Transform(StridedSpan<const Vector2> source, const Matrix3x2& matrix, StridedSpan<Vector2> destination);
+	static void TransformNormal(StridedSpan<const Vector2> source, const Matrix3x2& matrix, StridedSpan<Vector2> destination);
 
-	Point ToPoint();
+	std::string ToString() const;
 
-	//TODO Implement the rest of the methods that used Matrix and use Quarterion
+	Point ToPoint() const noexcept;
 };
 
+template<typename Precision>
+inline void Vector2::Normalize() noexcept
+{
+	Normalize<Precision>(*this, *this);
+}
+
+template<typename Precision>
+inline Vector2 Vector2::Normalize(Vector2 value) noexcept
+{
+	Normalize<Precision>(value, value);
+	return value;
+}
+
+template<typename Precision>
+inline void Vector2::Normalize(const Vector2& value, Vector2& result) noexcept
+{
+	float val = Precision::ReciprocalSqrt((value.X * value.X) + (value.Y * value.Y));
+	result.X = value.X * val;
+	result.Y = value.Y * val;
+}
+
+template<typename Precision>
+inline void Vector2::Normalize(const Vector2* sourceArray, Vector2* destinationArray, int length) noexcept
+{
+	VectorSimd::NormalizeArray(sourceArray, destinationArray, length, Precision::Value);
+}
@@ -1,6 +1,12 @@
 #pragma once
+#include <cmath>
 #include "Vector2.h"
-#include "Matrix.h"
+#include "StridedSpan.h"
+#include "VectorSimd.h"
+
+class Matrix;
+class Quaternion;
+
 struct Vector3
 {
 public:
@@ -9,10 +15,10 @@ public:
 	float Z;
 
 public:
-	Vector3() : X(0), Y(0), Z(0) {}
-	Vector3(float x, float y, float z) : X(x), Y(y), Z(z) {}
-	Vector3(float value) : X(value), Y(value), Z(value) {}
-	Vector3(Vector2 xy, float z) : X(xy.X), Y(xy.Y), Z(z) {}
+	constexpr Vector3() noexcept : X(0), Y(0), Z(0) {}
+	constexpr Vector3(float x, float y, float z) noexcept : X(x), Y(y), Z(z) {}
+	constexpr Vector3(float value) noexcept : X(value), Y(value), Z(value) {}
+	constexpr Vector3(Vector2 xy, float z) noexcept : X(xy.X), Y(xy.Y), Z(z) {}
 
 	// Static members  
 	static const Vector3 Zero;
@@ -28,88 +34,334 @@ public:
 	static const Vector3 Backward;
 
 	// Operator overloads
-	Vector3& operator=(const Vector3& other);
-	Vector3 operator+(const Vector3& other) const;
-	Vector3& operator+=(const Vector3& other);
-	Vector3 operator-(const Vector3& other) const;
-	Vector3& operator-=(const Vector3& other);
-	Vector3 operator*(float scalar) const;
-	Vector3& operator*=(float scalar);
-	Vector3 operator/(float scalar) const;
-	Vector3& operator/=(float scalar);
-	bool operator==(const Vector3& other) const;
-	bool operator!=(const Vector3& other) const;
-
-	void Round();
-	void Normalize();
-	void Ceiling();
-	void Floor();
+	Vector3& operator=(const Vector3& other) noexcept;
+	Vector3 operator+(const Vector3& other) const noexcept;
+	Vector3& operator+=(const Vector3& other) noexcept;
+	Vector3 operator-(const Vector3& other) const noexcept;
+	Vector3& operator-=(const Vector3& other) noexcept;
+	Vector3 operator*(float scalar) const noexcept;
+	Vector3& operator*=(float scalar) noexcept;
+	Vector3 operator/(float scalar) const noexcept;
+	Vector3& operator/=(float scalar) noexcept;
+	bool operator==(const Vector3& other) const noexcept;
+	bool operator!=(const Vector3& other) const noexcept;
+
+	void Round() noexcept;
+	void Normalize() noexcept;
+	void Ceiling() noexcept;
+	void Floor() noexcept;
 
 	// Static methods
-	static Vector3 Add(Vector3 value1, Vector3 value2);
-	static void Add(Vector3& value1, Vector3& value2, Vector3& result);
-	static Vector3 Barycentric(Vector3 value1, Vector3 value2, Vector3 value3, float amount1, float amount2);
-	static void Barycentric(Vector3& value1, Vector3& value2, Vector3& value3, float amount1, float amount2, Vector3& result);
-	static Vector3 CatmullRom(Vector3 value1, Vector3 value2, Vector3 value3, Vector3 value4, float amount);
-	static void CatmullRom(Vector3& value1, Vector3& value2, Vector3& value3, Vector3& value4, float amount, Vector3& result);
-	static Vector3 Ceiling(Vector3 value);
-	static void Ceiling(Vector3& value, Vector3& result);
-	static Vector3 Clamp(Vector3 value1, Vector3 min, Vector3 max);
-	static void Clamp(Vector3& value1, Vector3& min, Vector3& max, Vector3& result);
-	static Vector3 Cross(Vector3 vector1, Vector3 vector2);
-	static void Cross(Vector3& vector1, Vector3& vector2, Vector3& result);
-	static float Distance(Vector3 value1, Vector3 value2);
-	static void Distance(Vector3& value1, Vector3& value2, float& result);
-	static float DistanceSquared(Vector3 value1, Vector3 value2);
-	static void DistanceSquared(Vector3& value1, Vector3& value2, float& result);
-	static Vector3 Divide(Vector3 value1, Vector3 value2);
-	static Vector3 Divide(Vector3 value1, float divider);
-	static void Divide(Vector3& value1, float divider, Vector3& result);
-	static void Divide(Vector3& value1, Vector3& value2, Vector3& result);
-	static float Dot(Vector3& value1, Vector3& value2);
-	static void Dot(Vector3& value1, Vector3& value2, float& result);
-	static Vector3 Floor(Vector3 value);
-	static void Floor(Vector3& value, Vector3& result);
-	static Vector3 Hermite(Vector3 value1, Vector3 tangent1, Vector3 value2, Vector3 tangent2, float amount);
-	static void Hermite(Vector3& value1, Vector3& tangent1, Vector3& value2, Vector3& tangent2, float amount, Vector3& result);
-	static float Length(Vector3& vector);
-	static float LengthSquared(Vector3& vector);
-	float LengthSquared();
-	static Vector3 Lerp(Vector3 value1, Vector3 value2, float amount);
-	static void Lerp(Vector3& value1, Vector3& value2, float amount, Vector3& result);
-	static Vector3 LerpPrecise(Vector3 value1, Vector3 value2, float amount);
-	static void LerpPrecise(Vector3& value1, Vector3& value2, float amount, Vector3& result);
-	static Vector3 Max(Vector3 value1, Vector3 value2);
-	static void Max(Vector3& value1, Vector3& value2, Vector3& result);
-	static Vector3 Min(Vector3 value1, Vector3 value2);
-	static void Min(Vector3& value1, Vector3& value2, Vector3& result);
-	static Vector3 Multiply(Vector3 value1, Vector3 value2);
-	static Vector3 Multiply(Vector3 value1, float scaleFactor);
-	static void Multiply(Vector3& value1, float scaleFactor, Vector3& result);
-	static void Multiply(Vector3& value1, Vector3& value2, Vector3& result);
-	Vector3 Negate();
-	static Vector3 Negate(Vector3 value);
-	static void Negate(Vector3& value, Vector3& result);
-	static Vector3 Normalize(Vector3 value);
-	static void Normalize(Vector3& value, Vector3& result);
-	static Vector3 Reflect(Vector3 vector, Vector3 normal);
-	static void Reflect(Vector3& vector, Vector3& normal, Vector3& result);
-	static Vector3 Round(Vector3 value);
-	static void Round(Vector3& value, Vector3& result);
-	static Vector3 SmoothStep(Vector3 value1, Vector3 value2, float amount);
-	static void SmoothStep(Vector3& value1, Vector3& value2, float amount, Vector3& result);
-	static Vector3 Subtract(Vector3 value1, Vector3 value2);
-	static void Subtract(Vector3& value1, Vector3& value2, Vector3& result);
-
-	static Vector3 Transform(Vector3& position, Matrix& matrix);
-	static void Transform(Vector3& position, Matrix& matrix, Vector3& result);
-	static Vector3 Transform(Vector3& value, Quaternion& rotation);
-	static void Transform(Vector3& value, Quaternion& rotation, Vector3& result);
-	static void Transform(Vector3* sourceArray, int sourceIndex, Matrix& matrix, Vector3* destinationArray, int destinationIndex, int length);
-	static void Transform(Vector3* sourceArray, int sourceIndex, Quaternion& rotation, Vector3* destinationArray, int destinationIndex, int length);
-	static void Transform(Vector3* sourceArray, Matrix& matrix, Vector3* destinationArray);
-	static void Transform(Vector3* sourceArray, Quaternion rotation, Vector3* destinationArray);
-
-	//TODO implement Transform
+	static Vector3 Add(Vector3 value1, Vector3 value2) noexcept;
+	static void Add(const Vector3& value1, const Vector3& value2, Vector3& result) noexcept;
+	static Vector3 Barycentric(Vector3 value1, Vector3 value2, Vector3 value3, float amount1, float amount2) noexcept;
+	static void Barycentric(const Vector3& value1, const Vector3& value2, const Vector3& value3, float amount1, float amount2, Vector3& result) noexcept;
+	static Vector3 CatmullRom(Vector3 value1, Vector3 value2, Vector3 value3, Vector3 value4, float amount) noexcept;
+	static void CatmullRom(const Vector3& value1, const Vector3& value2, const Vector3& value3, const Vector3& value4, float amount, Vector3& result) noexcept;
+	static Vector3 Ceiling(Vector3 value) noexcept;
+	static void Ceiling(const Vector3& value, Vector3& result) noexcept;
+	static Vector3 Clamp(Vector3 value1, Vector3 min, Vector3 max) noexcept;
+	static void Clamp(const Vector3& value1, const Vector3& min, const Vector3& max, Vector3& result) noexcept;
+	static Vector3 Cross(Vector3 vector1, Vector3 vector2) noexcept;
+	static void Cross(const Vector3& vector1, const Vector3& vector2, Vector3& result) noexcept;
+	static float Distance(Vector3 value1, Vector3 value2) noexcept;
+	static void Distance(const Vector3& value1, const Vector3& value2, float& result) noexcept;
+	static float DistanceSquared(Vector3 value1, Vector3 value2) noexcept;
+	static void DistanceSquared(const Vector3& value1, const Vector3& value2, float& result) noexcept;
+	static Vector3 Divide(Vector3 value1, Vector3 value2) noexcept;
+	static Vector3 Divide(Vector3 value1, float divider) noexcept;
+	static void Divide(const Vector3& value1, float divider, Vector3& result) noexcept;
+	static void Divide(const Vector3& value1, const Vector3& value2, Vector3& result) noexcept;
+	static float Dot(const Vector3& value1, const Vector3& value2) noexcept;
+	static void Dot(const Vector3& value1, const Vector3& value2, float& result) noexcept;
+	static Vector3 Floor(Vector3 value) noexcept;
+	static void Floor(const Vector3& value, Vector3& result) noexcept;
+	static Vector3 Hermite(Vector3 value1, Vector3 tangent1, Vector3 value2, Vector3 tangent2, float amount) noexcept;
+	static void Hermite(const Vector3& value1, const Vector3& tangent1, const Vector3& value2, const Vector3& tangent2, float amount, Vector3& result) noexcept;
+	static float Length(const Vector3& vector) noexcept;
+	static float LengthSquared(const Vector3& vector) noexcept;
+	float Length() const noexcept;
+	float LengthSquared() const noexcept;
+	static Vector3 Lerp(Vector3 value1, Vector3 value2, float amount) noexcept;
+	static void Lerp(const Vector3& value1, const Vector3& value2, float amount, Vector3& result) noexcept;
+	static Vector3 LerpPrecise(Vector3 value1, Vector3 value2, float amount) noexcept;
+	static void LerpPrecise(const Vector3& value1, const Vector3& value2, float amount, Vector3& result) noexcept;
+	static Vector3 Max(Vector3 value1, Vector3 value2) noexcept;
+	static void Max(const Vector3& value1, const Vector3& value2, Vector3& result) noexcept;
+	static Vector3 Min(Vector3 value1, Vector3 value2) noexcept;
+	static void Min(const Vector3& value1, const Vector3& value2, Vector3& result) noexcept;
+	static Vector3 Multiply(Vector3 value1, Vector3 value2) noexcept;
+	static Vector3 Multiply(Vector3 value1, float scaleFactor) noexcept;
+	static void Multiply(const Vector3& value1, float scaleFactor, Vector3& result) noexcept;
+	static void Multiply(const Vector3& value1, const Vector3& value2, Vector3& result) noexcept;
+	Vector3 Negate() const noexcept;
+	static Vector3 Negate(Vector3 value) noexcept;
+	static void Negate(const Vector3& value, Vector3& result) noexcept;
+	static Vector3 Normalize(Vector3 value) noexcept;
+	static void Normalize(const Vector3& value, Vector3& result) noexcept;
+	// Normalize with the precision policy of NormalizePrecision.h, as in Normalize<RefinedPrecision>(value).
+	template<typename Precision> void Normalize() noexcept;
+	template<typename Precision> static Vector3 Normalize(Vector3 value) noexcept;
+	template<typename Precision> static void Normalize(const Vector3& value, Vector3& result) noexcept;
+	template<typename Precision> static void Normalize(const Vector3* sourceArray, Vector3* destinationArray, int length) noexcept;
+	static Vector3 Reflect(Vector3 vector, Vector3 normal) noexcept;
+	static void Reflect(const Vector3& vector, const Vector3& normal, Vector3& result) noexcept;
+	static Vector3 Round(Vector3 value) noexcept;
+	static void Round(const Vector3& value, Vector3& result) noexcept;
+	static Vector3 SmoothStep(Vector3 value1, Vector3 value2, float amount) noexcept;
+	static void SmoothStep(const Vector3& value1, const Vector3& value2, float amount, Vector3& result) noexcept;
+	static Vector3 Subtract(Vector3 value1, Vector3 value2) noexcept;
+	static void Subtract(const Vector3& value1, const Vector3& value2, Vector3& result) noexcept;
+
+	static Vector3 Transform(const Vector3& position, const Matrix& matrix) noexcept;
+	static void Transform(const Vector3& position, const Matrix& matrix, Vector3& result) noexcept;
+	static Vector3 Transform(const Vector3& value, const Quaternion& rotation) noexcept;
+	static void Transform(const Vector3& value, const Quaternion& rotation, Vector3& result) noexcept;
+	static void Transform(const Vector3* sourceArray, int sourceIndex, const Matrix& matrix, Vector3* destinationArray, int destinationIndex, int length) noexcept;
+	static void Transform(const Vector3* sourceArray, int sourceIndex, const Quaternion& rotation, Vector3* destinationArray, int destinationIndex, int length) noexcept;
+	static void Transform(const Vector3* sourceArray, const Matrix& matrix, Vector3* destinationArray, int length) noexcept;
+	static void Transform(const Vector3* sourceArray, const Quaternion& rotation, Vector3* destinationArray, int length) noexcept;
+	// Works in place on strided data such as the positions of an interleaved vertex buffer; the
+	// destination may be the source. Throws std::out_of_range if the counts differ.
+	static void Transform(StridedSpan<const Vector3> source, const Matrix& matrix, StridedSpan<Vector3> destination);
+	static void Transform(StridedSpan<const Vector3> source, const Quaternion& rotation, StridedSpan<Vector3> destination);
+	// Same results as Transform, with arrays longer than TransformParallelGrainSize split across
+	// the Parallel worker threads. The destination may be the source, but must not otherwise overlap it.
+	static void TransformParallel(const Vector3* sourceArray, const Matrix& matrix, Vector3* destinationArray, int length);
+	static void TransformParallel(const Vector3* sourceArray, const Quaternion& rotation, Vector3* destinationArray, int length);
+
+	// Smallest number of vectors TransformParallel hands to one thread.
+	static const int TransformParallelGrainSize = 16384;
 };
 
+// Static member definitions
+inline constexpr Vector3 Vector3::Zero(0.0f, 0.0f, 0.0f);
+inline constexpr Vector3 Vector3::One(1.0f, 1.0f, 1.0f);
+inline constexpr Vector3 Vector3::UnitX(1.0f, 0.0f, 0.0f);
+inline constexpr Vector3 Vector3::UnitY(0.0f, 1.0f, 0.0f);
+inline constexpr Vector3 Vector3::UnitZ(0.0f, 0.0f, 1.0f);
+inline constexpr Vector3 Vector3::Up(0.0f, 1.0f, 0.0f);
+inline constexpr Vector3 Vector3::Down(0.0f, -1.0f, 0.0f);
+inline constexpr Vector3 Vector3::Right(1.0f, 0.0f, 0.0f);
+inline constexpr Vector3 Vector3::Left(-1.0f, 0.0f, 0.0f);
+inline constexpr Vector3 Vector3::Forward(0.0f, 0.0f, -1.0f);
+inline constexpr Vector3 Vector3::Backward(0.0f, 0.0f, 1.0f);
+
+// Operator overloads
+inline Vector3& Vector3::operator=(const Vector3& other) noexcept
+{
+	if (this != &other)
+	{
+		X = other.X;
+		Y = other.Y;
+		Z = other.Z;
+	}
+	return *this;
+}
+
+inline Vector3 Vector3::operator+(const Vector3& other) const noexcept
+{
+	return Vector3(X + other.X, Y + other.Y, Z + other.Z);
+}
+
+inline Vector3& Vector3::operator+=(const Vector3& other) noexcept
+{
+	X += other.X;
+	Y += other.Y;
+	Z += other.Z;
+	return *this;
+}
+
+inline Vector3 Vector3::operator-(const Vector3& other) const noexcept
+{
+	return Vector3(X - other.X, Y - other.Y, Z - other.Z);
+}
+
+inline Vector3& Vector3::operator-=(const Vector3& other) noexcept
+{
+	X -= other.X;
+	Y -= other.Y;
+	Z -= other.Z;
+	return *this;
+}
+
+inline Vector3 Vector3::operator*(float scalar) const noexcept
+{
+	return Vector3(X * scalar, Y * scalar, Z * scalar);
+}
+
+inline Vector3& Vector3::operator*=(float scalar) noexcept
+{
+	X *= scalar;
+	Y *= scalar;
+	Z *= scalar;
+	return *this;
+}
+
+inline Vector3 Vector3::operator/(float scalar) const noexcept
+{
+	if (scalar != 0.0f)
+	{
+		float reciprocal = 1.0f / scalar;
+		return Vector3(X * reciprocal, Y * reciprocal, Z * reciprocal);
+	}
+	// Handle division by zero gracefully
+	return Vector3();
+}
+
+inline Vector3& Vector3::operator/=(float scalar) noexcept
+{
+	if (scalar != 0.0f)
+	{
+		float reciprocal = 1.0f / scalar;
+		X *= reciprocal;
+		Y *= reciprocal;
+		Z *= reciprocal;
+	}
+	// Handle division by zero gracefully
+	return *this;
+}
+
+inline bool Vector3::operator==(const Vector3& other) const noexcept
+{
+	return X == other.X && Y == other.Y && Z == other.Z;
+}
+
+inline bool Vector3::operator!=(const Vector3& other) const noexcept
+{
+	return !(*this == other);
+}
+
+inline Vector3 Vector3::Cross(Vector3 vector1, Vector3 vector2) noexcept
+{
+	Vector3 result;
+	Cross(vector1, vector2, result);
+	return result;
+}
+
+inline void Vector3::Cross(const Vector3& vector1, const Vector3& vector2, Vector3& result) noexcept
+{
+	float x = vector1.Y * vector2.Z - vector2.Y * vector1.Z;
+	float y = -(vector1.X * vector2.Z - vector2.X * vector1.Z);
+	float z = vector1.X * vector2.Y - vector2.X * vector1.Y;
+	result.X = x;
+	result.Y = y;
+	result.Z = z;
+}
+
+inline float Vector3::Distance(Vector3 value1, Vector3 value2) noexcept
+{
+	float result;
+	Distance(value1, value2, result);
+	return result;
+}
+
+inline void Vector3::Distance(const Vector3& value1, const Vector3& value2, float& result) noexcept
+{
+	DistanceSquared(value1, value2, result);
+	result = std::sqrt(result);
+}
+
+inline float Vector3::DistanceSquared(Vector3 value1, Vector3 value2) noexcept
+{
+	return (value1.X - value2.X) * (value1.X - value2.X) +
+		(value1.Y - value2.Y) * (value1.Y - value2.Y) +
+		(value1.Z - value2.Z) * (value1.Z - value2.Z);
+}
+
+inline void Vector3::DistanceSquared(const Vector3& value1, const Vector3& value2, float& result) noexcept
+{
+	result = (value1.X - value2.X) * (value1.X - value2.X) +
+		(value1.Y - value2.Y) * (value1.Y - value2.Y) +
+		(value1.Z - value2.Z) * (value1.Z - value2.Z);
+}
+
+inline float Vector3::Dot(const Vector3& value1, const Vector3& value2) noexcept
+{
+	return value1.X * value2.X + value1.Y * value2.Y + value1.Z * value2.Z;
+}
+
+inline void Vector3::Dot(const Vector3& value1, const Vector3& value2, float& result) noexcept
+{
+	result = value1.X * value2.X + value1.Y * value2.Y + value1.Z * value2.Z;
+}
+
+inline float Vector3::Length(const Vector3& vector) noexcept
+{
+	return std::sqrt((vector.X * vector.X) + (vector.Y * vector.Y) + (vector.Z * vector.Z));
+}
+
+inline float Vector3::LengthSquared(const Vector3& vector) noexcept
+{
+	return (vector.X * vector.X) + (vector.Y * vector.Y) + (vector.Z * vector.Z);
+}
+
+inline float Vector3::Length() const noexcept
+{
+	return std::sqrt((X * X) + (Y * Y) + (Z * Z));
+}
+
+inline float Vector3::LengthSquared() const noexcept
+{
+	return (X * X) + (Y * Y) + (Z * Z);
+}
+
+inline Vector3 Vector3::Max(Vector3 value1, Vector3 value2) noexcept
+{
+	return Vector3(
+		MathHelper::Max(value1.X, value2.X),
+		MathHelper::Max(value1.Y, value2.Y),
+		MathHelper::Max(value1.Z, value2.Z)
+	);
+}
+
+inline void Vector3::Max(const Vector3& value1, const Vector3& value2, Vector3& result) noexcept
+{
+	result.X = MathHelper::Max(value1.X, value2.X);
+	result.Y = MathHelper::Max(value1.Y, value2.Y);
+	result.Z = MathHelper::Max(value1.Z, value2.Z);
+}
+
+inline Vector3 Vector3::Min(Vector3 value1, Vector3 value2) noexcept
+{
+	return Vector3(
+		MathHelper::Min(value1.X, value2.X),
+		MathHelper::Min(value1.Y, value2.Y),
+		MathHelper::Min(value1.Z, value2.Z)
+	);
+}
+
+inline void Vector3::Min(const Vector3& value1, const Vector3& value2, Vector3& result) noexcept
+{
+	result.X = MathHelper::Min(value1.X, value2.X);
+	result.Y = MathHelper::Min(value1.Y, value2.Y);
+	result.Z = MathHelper::Min(value1.Z, value2.Z);
+}
+
+template<typename Precision>
+inline void Vector3::Normalize() noexcept
+{
+	Normalize<Precision>(*this, *this);
+}
+
+template<typename Precision>
+inline Vector3 Vector3::Normalize(Vector3 value) noexcept
+{
+	Normalize<Precision>(value, value);
+	return value;
+}
+
+template<typename Precision>
+inline void Vector3::Normalize(const Vector3& value, Vector3& result) noexcept
+{
+	float factor = Precision::ReciprocalSqrt((value.X * value.X) + (value.Y * value.Y) + (value.Z * value.Z));
+	result.X = value.X * factor;
+	result.Y = value.Y * factor;
+	result.Z = value.Z * factor;
+}
+
+template<typename Precision>
+inline void Vector3::Normalize(const Vector3* sourceArray, Vector3* destinationArray, int length) noexcept
+{
+	VectorSimd::NormalizeArray(sourceArray, destinationArray, length, Precision::Value);
+}
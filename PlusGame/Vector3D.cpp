@@ -0,0 +1,172 @@
+#include "Vector3D.h"
+#include "MatrixD.h"
+
+Vector3D Vector3D::Add(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	return Vector3D(value1.X + value2.X, value1.Y + value2.Y, value1.Z + value2.Z);
+}
+
+void Vector3D::Add(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept
+{
+	result.X = value1.X + value2.X;
+	result.Y = value1.Y + value2.Y;
+	result.Z = value1.Z + value2.Z;
+}
+
+Vector3D Vector3D::Clamp(const Vector3D& value1, const Vector3D& min, const Vector3D& max) noexcept
+{
+	Vector3D result;
+	Clamp(value1, min, max, result);
+	return result;
+}
+
+void Vector3D::Clamp(const Vector3D& value1, const Vector3D& min, const Vector3D& max, Vector3D& result) noexcept
+{
+	result.X = (value1.X > max.X) ? max.X : ((value1.X < min.X) ? min.X : value1.X);
+	result.Y = (value1.Y > max.Y) ? max.Y : ((value1.Y < min.Y) ? min.Y : value1.Y);
+	result.Z = (value1.Z > max.Z) ? max.Z : ((value1.Z < min.Z) ? min.Z : value1.Z);
+}
+
+Vector3D Vector3D::Divide(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	return Vector3D(value1.X / value2.X, value1.Y / value2.Y, value1.Z / value2.Z);
+}
+
+Vector3D Vector3D::Divide(const Vector3D& value1, double divider) noexcept
+{
+	double factor = 1.0 / divider;
+	return Vector3D(value1.X * factor, value1.Y * factor, value1.Z * factor);
+}
+
+void Vector3D::Divide(const Vector3D& value1, double divider, Vector3D& result) noexcept
+{
+	double factor = 1.0 / divider;
+	result.X = value1.X * factor;
+	result.Y = value1.Y * factor;
+	result.Z = value1.Z * factor;
+}
+
+void Vector3D::Divide(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept
+{
+	result.X = value1.X / value2.X;
+	result.Y = value1.Y / value2.Y;
+	result.Z = value1.Z / value2.Z;
+}
+
+Vector3D Vector3D::Lerp(const Vector3D& value1, const Vector3D& value2, double amount) noexcept
+{
+	Vector3D result;
+	Lerp(value1, value2, amount, result);
+	return result;
+}
+
+void Vector3D::Lerp(const Vector3D& value1, const Vector3D& value2, double amount, Vector3D& result) noexcept
+{
+	result.X = value1.X + (value2.X - value1.X) * amount;
+	result.Y = value1.Y + (value2.Y - value1.Y) * amount;
+	result.Z = value1.Z + (value2.Z - value1.Z) * amount;
+}
+
+Vector3D Vector3D::Max(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	Vector3D result;
+	Max(value1, value2, result);
+	return result;
+}
+
+void Vector3D::Max(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept
+{
+	result.X = (value1.X > value2.X) ? value1.X : value2.X;
+	result.Y = (value1.Y > value2.Y) ? value1.Y : value2.Y;
+	result.Z = (value1.Z > value2.Z) ? value1.Z : value2.Z;
+}
+
+Vector3D Vector3D::Min(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	Vector3D result;
+	Min(value1, value2, result);
+	return result;
+}
+
+void Vector3D::Min(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept
+{
+	result.X = (value1.X < value2.X) ? value1.X : value2.X;
+	result.Y = (value1.Y < value2.Y) ? value1.Y : value2.Y;
+	result.Z = (value1.Z < value2.Z) ? value1.Z : value2.Z;
+}
+
+Vector3D Vector3D::Multiply(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	return Vector3D(value1.X * value2.X, value1.Y * value2.Y, value1.Z * value2.Z);
+}
+
+Vector3D Vector3D::Multiply(const Vector3D& value1, double scaleFactor) noexcept
+{
+	return Vector3D(value1.X * scaleFactor, value1.Y * scaleFactor, value1.Z * scaleFactor);
+}
+
+void Vector3D::Multiply(const Vector3D& value1, double scaleFactor, Vector3D& result) noexcept
+{
+	result.X = value1.X * scaleFactor;
+	result.Y = value1.Y * scaleFactor;
+	result.Z = value1.Z * scaleFactor;
+}
+
+void Vector3D::Multiply(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept
+{
+	result.X = value1.X * value2.X;
+	result.Y = value1.Y * value2.Y;
+	result.Z = value1.Z * value2.Z;
+}
+
+Vector3D Vector3D::Negate() const noexcept
+{
+	return Vector3D(-X, -Y, -Z);
+}
+
+Vector3D Vector3D::Negate(const Vector3D& value) noexcept
+{
+	return Vector3D(-value.X, -value.Y, -value.Z);
+}
+
+void Vector3D::Negate(const Vector3D& value, Vector3D& result) noexcept
+{
+	result.X = -value.X;
+	result.Y = -value.Y;
+	result.Z = -value.Z;
+}
+
+void Vector3D::Normalize() noexcept
+{
+	double factor = 1.0 / std::sqrt((X * X) + (Y * Y) + (Z * Z));
+	X *= factor;
+	Y *= factor;
+	Z *= factor;
+}
+
+Vector3D Vector3D::Normalize(const Vector3D& value) noexcept
+{
+	Vector3D result;
+	Normalize(value, result);
+	return result;
+}
+
+void Vector3D::Normalize(const Vector3D& value, Vector3D& result) noexcept
+{
+	double factor = 1.0 / std::sqrt((value.X * value.X) + (value.Y * value.Y) + (value.Z * value.Z));
+	result.X = value.X * factor;
+	result.Y = value.Y * factor;
+	result.Z = value.Z * factor;
+}
+
+Vector3D Vector3D::Subtract(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	return Vector3D(value1.X - value2.X, value1.Y - value2.Y, value1.Z - value2.Z);
+}
+
+void Vector3D::Subtract(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept
+{
+	result.X = value1.X - value2.X;
+	result.Y = value1.Y - value2.Y;
+	result.Z = value1.Z - value2.Z;
+}
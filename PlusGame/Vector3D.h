@@ -0,0 +1,265 @@
+#pragma once
+#include <cmath>
+#include "Vector3.h"
+
+class MatrixD;
+
+// Double-precision counterpart of Vector3 for world-space positions that must keep
+// sub-millimetre precision far from the origin. Rendering math stays in Vector3: positions are
+// brought close to the camera with ToRelative before they are converted.
+struct Vector3D
+{
+public:
+	double X;
+	double Y;
+	double Z;
+
+public:
+	constexpr Vector3D() noexcept : X(0), Y(0), Z(0) {}
+	constexpr Vector3D(double x, double y, double z) noexcept : X(x), Y(y), Z(z) {}
+	constexpr Vector3D(double value) noexcept : X(value), Y(value), Z(value) {}
+	constexpr explicit Vector3D(const Vector3& value) noexcept : X(value.X), Y(value.Y), Z(value.Z) {}
+
+	// Static members
+	static const Vector3D Zero;
+	static const Vector3D One;
+	static const Vector3D UnitX;
+	static const Vector3D UnitY;
+	static const Vector3D UnitZ;
+	static const Vector3D Up;
+	static const Vector3D Down;
+	static const Vector3D Right;
+	static const Vector3D Left;
+	static const Vector3D Forward;
+	static const Vector3D Backward;
+
+	// Operator overloads
+	Vector3D operator+(const Vector3D& other) const noexcept;
+	Vector3D& operator+=(const Vector3D& other) noexcept;
+	Vector3D operator-(const Vector3D& other) const noexcept;
+	Vector3D& operator-=(const Vector3D& other) noexcept;
+	Vector3D operator*(double scalar) const noexcept;
+	Vector3D& operator*=(double scalar) noexcept;
+	Vector3D operator/(double scalar) const noexcept;
+	Vector3D& operator/=(double scalar) noexcept;
+	bool operator==(const Vector3D& other) const noexcept;
+	bool operator!=(const Vector3D& other) const noexcept;
+
+	void Normalize() noexcept;
+
+	// Conversions to single precision. ToRelative subtracts the origin before rounding, so the
+	// result keeps the full precision of a float near that origin.
+	Vector3 ToVector3() const noexcept;
+	Vector3 ToRelative(const Vector3D& origin) const noexcept;
+
+	// Static methods
+	static Vector3D Add(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static void Add(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept;
+	static Vector3D Clamp(const Vector3D& value1, const Vector3D& min, const Vector3D& max) noexcept;
+	static void Clamp(const Vector3D& value1, const Vector3D& min, const Vector3D& max, Vector3D& result) noexcept;
+	static Vector3D Cross(const Vector3D& vector1, const Vector3D& vector2) noexcept;
+	static void Cross(const Vector3D& vector1, const Vector3D& vector2, Vector3D& result) noexcept;
+	static double Distance(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static void Distance(const Vector3D& value1, const Vector3D& value2, double& result) noexcept;
+	static double DistanceSquared(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static void DistanceSquared(const Vector3D& value1, const Vector3D& value2, double& result) noexcept;
+	static Vector3D Divide(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static Vector3D Divide(const Vector3D& value1, double divider) noexcept;
+	static void Divide(const Vector3D& value1, double divider, Vector3D& result) noexcept;
+	static void Divide(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept;
+	static double Dot(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static void Dot(const Vector3D& value1, const Vector3D& value2, double& result) noexcept;
+	static double Length(const Vector3D& vector) noexcept;
+	static double LengthSquared(const Vector3D& vector) noexcept;
+	double Length() const noexcept;
+	double LengthSquared() const noexcept;
+	static Vector3D Lerp(const Vector3D& value1, const Vector3D& value2, double amount) noexcept;
+	static void Lerp(const Vector3D& value1, const Vector3D& value2, double amount, Vector3D& result) noexcept;
+	static Vector3D Max(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static void Max(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept;
+	static Vector3D Min(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static void Min(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept;
+	static Vector3D Multiply(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static Vector3D Multiply(const Vector3D& value1, double scaleFactor) noexcept;
+	static void Multiply(const Vector3D& value1, double scaleFactor, Vector3D& result) noexcept;
+	static void Multiply(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept;
+	Vector3D Negate() const noexcept;
+	static Vector3D Negate(const Vector3D& value) noexcept;
+	static void Negate(const Vector3D& value, Vector3D& result) noexcept;
+	static Vector3D Normalize(const Vector3D& value) noexcept;
+	static void Normalize(const Vector3D& value, Vector3D& result) noexcept;
+	static Vector3D Subtract(const Vector3D& value1, const Vector3D& value2) noexcept;
+	static void Subtract(const Vector3D& value1, const Vector3D& value2, Vector3D& result) noexcept;
+
+	static Vector3D Transform(const Vector3D& position, const MatrixD& matrix) noexcept;
+	static void Transform(const Vector3D& position, const MatrixD& matrix, Vector3D& result) noexcept;
+};
+
+// Static member definitions
+inline constexpr Vector3D Vector3D::Zero(0.0, 0.0, 0.0);
+inline constexpr Vector3D Vector3D::One(1.0, 1.0, 1.0);
+inline constexpr Vector3D Vector3D::UnitX(1.0, 0.0, 0.0);
+inline constexpr Vector3D Vector3D::UnitY(0.0, 1.0, 0.0);
+inline constexpr Vector3D Vector3D::UnitZ(0.0, 0.0, 1.0);
+inline constexpr Vector3D Vector3D::Up(0.0, 1.0, 0.0);
+inline constexpr Vector3D Vector3D::Down(0.0, -1.0, 0.0);
+inline constexpr Vector3D Vector3D::Right(1.0, 0.0, 0.0);
+inline constexpr Vector3D Vector3D::Left(-1.0, 0.0, 0.0);
+inline constexpr Vector3D Vector3D::Forward(0.0, 0.0, -1.0);
+inline constexpr Vector3D Vector3D::Backward(0.0, 0.0, 1.0);
+
+// Operator overloads
+inline Vector3D Vector3D::operator+(const Vector3D& other) const noexcept
+{
+	return Vector3D(X + other.X, Y + other.Y, Z + other.Z);
+}
+
+inline Vector3D& Vector3D::operator+=(const Vector3D& other) noexcept
+{
+	X += other.X;
+	Y += other.Y;
+	Z += other.Z;
+	return *this;
+}
+
+inline Vector3D Vector3D::operator-(const Vector3D& other) const noexcept
+{
+	return Vector3D(X - other.X, Y - other.Y, Z - other.Z);
+}
+
+inline Vector3D& Vector3D::operator-=(const Vector3D& other) noexcept
+{
+	X -= other.X;
+	Y -= other.Y;
+	Z -= other.Z;
+	return *this;
+}
+
+inline Vector3D Vector3D::operator*(double scalar) const noexcept
+{
+	return Vector3D(X * scalar, Y * scalar, Z * scalar);
+}
+
+inline Vector3D& Vector3D::operator*=(double scalar) noexcept
+{
+	X *= scalar;
+	Y *= scalar;
+	Z *= scalar;
+	return *this;
+}
+
+inline Vector3D Vector3D::operator/(double scalar) const noexcept
+{
+	if (scalar != 0.0)
+	{
+		double reciprocal = 1.0 / scalar;
+		return Vector3D(X * reciprocal, Y * reciprocal, Z * reciprocal);
+	}
+	// Handle division by zero gracefully
+	return Vector3D();
+}
+
+inline Vector3D& Vector3D::operator/=(double scalar) noexcept
+{
+	if (scalar != 0.0)
+	{
+		double reciprocal = 1.0 / scalar;
+		X *= reciprocal;
+		Y *= reciprocal;
+		Z *= reciprocal;
+	}
+	// Handle division by zero gracefully
+	return *this;
+}
+
+inline bool Vector3D::operator==(const Vector3D& other) const noexcept
+{
+	return X == other.X && Y == other.Y && Z == other.Z;
+}
+
+inline bool Vector3D::operator!=(const Vector3D& other) const noexcept
+{
+	return !(*this == other);
+}
+
+inline Vector3 Vector3D::ToVector3() const noexcept
+{
+	return Vector3((float)X, (float)Y, (float)Z);
+}
+
+inline Vector3 Vector3D::ToRelative(const Vector3D& origin) const noexcept
+{
+	return Vector3((float)(X - origin.X), (float)(Y - origin.Y), (float)(Z - origin.Z));
+}
+
+inline Vector3D Vector3D::Cross(const Vector3D& vector1, const Vector3D& vector2) noexcept
+{
+	Vector3D result;
+	Cross(vector1, vector2, result);
+	return result;
+}
+
+inline void Vector3D::Cross(const Vector3D& vector1, const Vector3D& vector2, Vector3D& result) noexcept
+{
+	double x = vector1.Y * vector2.Z - vector2.Y * vector1.Z;
+	double y = -(vector1.X * vector2.Z - vector2.X * vector1.Z);
+	double z = vector1.X * vector2.Y - vector2.X * vector1.Y;
+	result.X = x;
+	result.Y = y;
+	result.Z = z;
+}
+
+inline double Vector3D::Distance(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	double result;
+	Distance(value1, value2, result);
+	return result;
+}
+
+inline void Vector3D::Distance(const Vector3D& value1, const Vector3D& value2, double& result) noexcept
+{
+	DistanceSquared(value1, value2, result);
+	result = std::sqrt(result);
+}
+
+inline double Vector3D::DistanceSquared(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	return (value1.X - value2.X) * (value1.X - value2.X) +
+		(value1.Y - value2.Y) * (value1.Y - value2.Y) +
+		(value1.Z - value2.Z) * (value1.Z - value2.Z);
+}
+
+inline void Vector3D::DistanceSquared(const Vector3D& value1, const Vector3D& value2, double& result) noexcept
+{
+	result = DistanceSquared(value1, value2);
+}
+
+inline double Vector3D::Dot(const Vector3D& value1, const Vector3D& value2) noexcept
+{
+	return value1.X * value2.X + value1.Y * value2.Y + value1.Z * value2.Z;
+}
+
+inline void Vector3D::Dot(const Vector3D& value1, const Vector3D& value2, double& result) noexcept
+{
+	result = value1.X * value2.X + value1.Y * value2.Y + value1.Z * value2.Z;
+}
+
+inline double Vector3D::Length(const Vector3D& vector) noexcept
+{
+	return std::sqrt((vector.X * vector.X) + (vector.Y * vector.Y) + (vector.Z * vector.Z));
+}
+
+inline double Vector3D::LengthSquared(const Vector3D& vector) noexcept
+{
+	return (vector.X * vector.X) + (vector.Y * vector.Y) + (vector.Z * vector.Z);
+}
+
+inline double Vector3D::Length() const noexcept
+{
+	return std::sqrt((X * X) + (Y * Y) + (Z * Z));
+}
+
+inline double Vector3D::LengthSquared() const noexcept
+{
+	return (X * X) + (Y * Y) + (Z * Z);
+}
@@ -0,0 +1,342 @@
+#include "Vector3SoA.h"
+#include "VectorSimd.h"
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+Vector3SoA::Vector3SoA() noexcept : _data(nullptr), _count(0), _capacity(0)
+{
+}
+
+Vector3SoA::Vector3SoA(int count) : Vector3SoA()
+{
+	Resize(count);
+}
+
+Vector3SoA::Vector3SoA(const Vector3* sourceArray, int length) : Vector3SoA()
+{
+	Assign(sourceArray, length);
+}
+
+Vector3SoA::Vector3SoA(const Vector3SoA& other) : Vector3SoA()
+{
+	*this = other;
+}
+
+Vector3SoA::Vector3SoA(Vector3SoA&& other) noexcept : _data(other._data), _count(other._count), _capacity(other._capacity)
+{
+	other._data = nullptr;
+	other._count = 0;
+	other._capacity = 0;
+}
+
+Vector3SoA::~Vector3SoA()
+{
+	if (_data != nullptr)
+		::operator delete(_data, std::align_val_t(Alignment));
+}
+
+Vector3SoA& Vector3SoA::operator=(const Vector3SoA& other)
+{
+	if (this != &other)
+	{
+		_count = 0;
+		Resize(other._count);
+		if (_count > 0)
+		{
+			std::memcpy(GetX(), other.GetX(), _count * sizeof(float));
+			std::memcpy(GetY(), other.GetY(), _count * sizeof(float));
+			std::memcpy(GetZ(), other.GetZ(), _count * sizeof(float));
+		}
+	}
+	return *this;
+}
+
+Vector3SoA& Vector3SoA::operator=(Vector3SoA&& other) noexcept
+{
+	if (this != &other)
+	{
+		if (_data != nullptr)
+			::operator delete(_data, std::align_val_t(Alignment));
+		_data = other._data;
+		_count = other._count;
+		_capacity = other._capacity;
+		other._data = nullptr;
+		other._count = 0;
+		other._capacity = 0;
+	}
+	return *this;
+}
+
+int Vector3SoA::GetCount() const noexcept
+{
+	return _count;
+}
+
+int Vector3SoA::GetCapacity() const noexcept
+{
+	return _capacity;
+}
+
+/// <summary>
+/// Changes the number of elements. Elements past the old count are set to zero.
+/// </summary>
+/// <param name="count">The new number of elements.</param>
+void Vector3SoA::Resize(int count)
+{
+	if (count < 0)
+		throw std::out_of_range("Element count cannot be negative");
+	if (count > _capacity)
+		Reallocate(count > _capacity * 2 ? count : _capacity * 2);
+	if (count > _count)
+	{
+		std::memset(GetX() + _count, 0, (count - _count) * sizeof(float));
+		std::memset(GetY() + _count, 0, (count - _count) * sizeof(float));
+		std::memset(GetZ() + _count, 0, (count - _count) * sizeof(float));
+	}
+	_count = count;
+}
+
+void Vector3SoA::Reserve(int capacity)
+{
+	if (capacity > _capacity)
+		Reallocate(capacity);
+}
+
+void Vector3SoA::Clear() noexcept
+{
+	_count = 0;
+}
+
+float* Vector3SoA::GetX() noexcept
+{
+	return _data;
+}
+
+float* Vector3SoA::GetY() noexcept
+{
+	return _data + _capacity;
+}
+
+float* Vector3SoA::GetZ() noexcept
+{
+	return _data + 2 * _capacity;
+}
+
+const float* Vector3SoA::GetX() const noexcept
+{
+	return _data;
+}
+
+const float* Vector3SoA::GetY() const noexcept
+{
+	return _data + _capacity;
+}
+
+const float* Vector3SoA::GetZ() const noexcept
+{
+	return _data + 2 * _capacity;
+}
+
+Vector3 Vector3SoA::Get(int index) const noexcept
+{
+	return Vector3(GetX()[index], GetY()[index], GetZ()[index]);
+}
+
+void Vector3SoA::Set(int index, const Vector3& value) noexcept
+{
+	GetX()[index] = value.X;
+	GetY()[index] = value.Y;
+	GetZ()[index] = value.Z;
+}
+
+void Vector3SoA::Append(const Vector3& value)
+{
+	Resize(_count + 1);
+	Set(_count - 1, value);
+}
+
+/// <summary>
+/// Replaces the elements with the ones of an array of <see cref="Vector3"/>.
+/// </summary>
+/// <param name="sourceArray">Source array.</param>
+/// <param name="length">The number of vectors to copy.</param>
+void Vector3SoA::Assign(const Vector3* sourceArray, int length)
+{
+	_count = 0;
+	Resize(length);
+	VectorSimd::SplitVector3(sourceArray, GetX(), GetY(), GetZ(), length);
+}
+
+/// <summary>
+/// Copies all elements to an array of <see cref="Vector3"/>.
+/// </summary>
+/// <param name="destinationArray">Destination array of at least <see cref="GetCount"/> vectors.</param>
+void Vector3SoA::CopyTo(Vector3* destinationArray) const noexcept
+{
+	VectorSimd::JoinVector3(GetX(), GetY(), GetZ(), destinationArray, _count);
+}
+
+/// <summary>
+/// Copies a range of elements to an array of <see cref="Vector3"/>.
+/// </summary>
+/// <param name="sourceIndex">Index of the first element to copy.</param>
+/// <param name="destinationArray">Destination array.</param>
+/// <param name="length">The number of vectors to copy.</param>
+void Vector3SoA::CopyTo(int sourceIndex, Vector3* destinationArray, int length) const noexcept
+{
+	VectorSimd::JoinVector3(GetX() + sourceIndex, GetY() + sourceIndex, GetZ() + sourceIndex, destinationArray, length);
+}
+
+/// <summary>
+/// Adds the vectors at the same index in two arrays.
+/// </summary>
+void Vector3SoA::Add(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result)
+{
+	CheckCount(value1, value2);
+	result.Resize(value1._count);
+	VectorSimd::AddArray(value1.GetX(), value2.GetX(), result.GetX(), value1._count);
+	VectorSimd::AddArray(value1.GetY(), value2.GetY(), result.GetY(), value1._count);
+	VectorSimd::AddArray(value1.GetZ(), value2.GetZ(), result.GetZ(), value1._count);
+}
+
+/// <summary>
+/// Subtracts the vectors of the second array from the vectors at the same index in the first.
+/// </summary>
+void Vector3SoA::Subtract(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result)
+{
+	CheckCount(value1, value2);
+	result.Resize(value1._count);
+	VectorSimd::SubtractArray(value1.GetX(), value2.GetX(), result.GetX(), value1._count);
+	VectorSimd::SubtractArray(value1.GetY(), value2.GetY(), result.GetY(), value1._count);
+	VectorSimd::SubtractArray(value1.GetZ(), value2.GetZ(), result.GetZ(), value1._count);
+}
+
+/// <summary>
+/// Multiplies the components of the vectors at the same index in two arrays.
+/// </summary>
+void Vector3SoA::Multiply(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result)
+{
+	CheckCount(value1, value2);
+	result.Resize(value1._count);
+	VectorSimd::MultiplyArray(value1.GetX(), value2.GetX(), result.GetX(), value1._count);
+	VectorSimd::MultiplyArray(value1.GetY(), value2.GetY(), result.GetY(), value1._count);
+	VectorSimd::MultiplyArray(value1.GetZ(), value2.GetZ(), result.GetZ(), value1._count);
+}
+
+/// <summary>
+/// Multiplies every vector by a scalar.
+/// </summary>
+void Vector3SoA::Multiply(const Vector3SoA& value1, float scaleFactor, Vector3SoA& result)
+{
+	result.Resize(value1._count);
+	VectorSimd::MultiplyArray(value1.GetX(), scaleFactor, result.GetX(), value1._count);
+	VectorSimd::MultiplyArray(value1.GetY(), scaleFactor, result.GetY(), value1._count);
+	VectorSimd::MultiplyArray(value1.GetZ(), scaleFactor, result.GetZ(), value1._count);
+}
+
+/// <summary>
+/// Linearly interpolates the vectors at the same index in two arrays, as <see cref="Vector3.Lerp"/> does.
+/// </summary>
+void Vector3SoA::Lerp(const Vector3SoA& value1, const Vector3SoA& value2, float amount, Vector3SoA& result)
+{
+	CheckCount(value1, value2);
+	result.Resize(value1._count);
+	VectorSimd::LerpArray(value1.GetX(), value2.GetX(), amount, result.GetX(), value1._count);
+	VectorSimd::LerpArray(value1.GetY(), value2.GetY(), amount, result.GetY(), value1._count);
+	VectorSimd::LerpArray(value1.GetZ(), value2.GetZ(), amount, result.GetZ(), value1._count);
+}
+
+/// <summary>
+/// Takes the component-wise minimum of the vectors at the same index in two arrays.
+/// </summary>
+void Vector3SoA::Min(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result)
+{
+	CheckCount(value1, value2);
+	result.Resize(value1._count);
+	VectorSimd::MinArray(value1.GetX(), value2.GetX(), result.GetX(), value1._count);
+	VectorSimd::MinArray(value1.GetY(), value2.GetY(), result.GetY(), value1._count);
+	VectorSimd::MinArray(value1.GetZ(), value2.GetZ(), result.GetZ(), value1._count);
+}
+
+/// <summary>
+/// Takes the component-wise maximum of the vectors at the same index in two arrays.
+/// </summary>
+void Vector3SoA::Max(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result)
+{
+	CheckCount(value1, value2);
+	result.Resize(value1._count);
+	VectorSimd::MaxArray(value1.GetX(), value2.GetX(), result.GetX(), value1._count);
+	VectorSimd::MaxArray(value1.GetY(), value2.GetY(), result.GetY(), value1._count);
+	VectorSimd::MaxArray(value1.GetZ(), value2.GetZ(), result.GetZ(), value1._count);
+}
+
+/// <summary>
+/// Computes the dot products of the vectors at the same index in two arrays.
+/// </summary>
+/// <param name="resultArray">Receives one dot product per element.</param>
+void Vector3SoA::Dot(const Vector3SoA& value1, const Vector3SoA& value2, float* resultArray)
+{
+	CheckCount(value1, value2);
+	VectorSimd::DotSoA(value1.GetX(), value1.GetY(), value1.GetZ(), value2.GetX(), value2.GetY(), value2.GetZ(), resultArray, value1._count);
+}
+
+/// <summary>
+/// Computes the cross products of the vectors at the same index in two arrays.
+/// </summary>
+void Vector3SoA::Cross(const Vector3SoA& vector1, const Vector3SoA& vector2, Vector3SoA& result)
+{
+	CheckCount(vector1, vector2);
+	result.Resize(vector1._count);
+	VectorSimd::CrossSoA(vector1.GetX(), vector1.GetY(), vector1.GetZ(), vector2.GetX(), vector2.GetY(), vector2.GetZ(),
+		result.GetX(), result.GetY(), result.GetZ(), vector1._count);
+}
+
+/// <summary>
+/// Scales every vector to unit length. Zero vectors become NaN, as with <see cref="Vector3.Normalize"/>.
+/// </summary>
+void Vector3SoA::Normalize(const Vector3SoA& value, Vector3SoA& result)
+{
+	result.Resize(value._count);
+	VectorSimd::NormalizeSoA(value.GetX(), value.GetY(), value.GetZ(), result.GetX(), result.GetY(), result.GetZ(), value._count);
+}
+
+/// <summary>
+/// Transforms every position by a <see cref="Matrix"/>, translation included.
+/// </summary>
+void Vector3SoA::Transform(const Vector3SoA& position, const Matrix& matrix, Vector3SoA& result)
+{
+	result.Resize(position._count);
+	VectorSimd::TransformSoA(position.GetX(), position.GetY(), position.GetZ(), matrix, result.GetX(), result.GetY(), result.GetZ(), position._count);
+}
+
+/// <summary>
+/// Transforms every direction by the rotation and scale of a <see cref="Matrix"/>, ignoring its translation.
+/// </summary>
+void Vector3SoA::TransformNormal(const Vector3SoA& normal, const Matrix& matrix, Vector3SoA& result)
+{
+	result.Resize(normal._count);
+	VectorSimd::TransformNormalSoA(normal.GetX(), normal.GetY(), normal.GetZ(), matrix, result.GetX(), result.GetY(), result.GetZ(), normal._count);
+}
+
+void Vector3SoA::Reallocate(int capacity)
+{
+	capacity = (capacity + BlockLength - 1) / BlockLength * BlockLength;
+	auto data = (float*)::operator new(3 * (size_t)capacity * sizeof(float), std::align_val_t(Alignment));
+	if (_data != nullptr)
+	{
+		std::memcpy(data, GetX(), _count * sizeof(float));
+		std::memcpy(data + capacity, GetY(), _count * sizeof(float));
+		std::memcpy(data + 2 * capacity, GetZ(), _count * sizeof(float));
+		::operator delete(_data, std::align_val_t(Alignment));
+	}
+	_data = data;
+	_capacity = capacity;
+}
+
+void Vector3SoA::CheckCount(const Vector3SoA& value1, const Vector3SoA& value2)
+{
+	if (value1._count != value2._count)
+		throw std::out_of_range("Vector3SoA operands have different element counts");
+}
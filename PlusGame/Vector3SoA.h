@@ -0,0 +1,76 @@
+#pragma once
+#include "Vector3.h"
+
+class Matrix;
+
+// A growable array of Vector3 stored as structure-of-arrays: one float array per component,
+// each starting on a 64-byte boundary, so that bulk operations load full SIMD registers of a
+// single component instead of shuffling interleaved X, Y and Z. The static operations run
+// the VectorSimd kernels over the whole array; their results may be one of their operands,
+// and are resized to the element count of the operands, which must all be the same.
+class Vector3SoA
+{
+public:
+	// Alignment in bytes of the X, Y and Z arrays.
+	static const int Alignment = 64;
+
+	Vector3SoA() noexcept;
+	explicit Vector3SoA(int count);
+	Vector3SoA(const Vector3* sourceArray, int length);
+	Vector3SoA(const Vector3SoA& other);
+	Vector3SoA(Vector3SoA&& other) noexcept;
+	~Vector3SoA();
+
+	Vector3SoA& operator=(const Vector3SoA& other);
+	Vector3SoA& operator=(Vector3SoA&& other) noexcept;
+
+	int GetCount() const noexcept;
+	int GetCapacity() const noexcept;
+	// New elements are zero.
+	void Resize(int count);
+	void Reserve(int capacity);
+	void Clear() noexcept;
+
+	float* GetX() noexcept;
+	float* GetY() noexcept;
+	float* GetZ() noexcept;
+	const float* GetX() const noexcept;
+	const float* GetY() const noexcept;
+	const float* GetZ() const noexcept;
+
+	Vector3 Get(int index) const noexcept;
+	void Set(int index, const Vector3& value) noexcept;
+	void Append(const Vector3& value);
+
+	// Conversions from and to arrays of Vector3.
+	void Assign(const Vector3* sourceArray, int length);
+	void CopyTo(Vector3* destinationArray) const noexcept;
+	void CopyTo(int sourceIndex, Vector3* destinationArray, int length) const noexcept;
+
+	static void Add(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result);
+	static void Subtract(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result);
+	static void Multiply(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result);
+	static void Multiply(const Vector3SoA& value1, float scaleFactor, Vector3SoA& result);
+	static void Lerp(const Vector3SoA& value1, const Vector3SoA& value2, float amount, Vector3SoA& result);
+	static void Min(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result);
+	static void Max(const Vector3SoA& value1, const Vector3SoA& value2, Vector3SoA& result);
+	// Writes GetCount() dot products.
+	static void Dot(const Vector3SoA& value1, const Vector3SoA& value2, float* resultArray);
+	static void Cross(const Vector3SoA& vector1, const Vector3SoA& vector2, Vector3SoA& result);
+	static void Normalize(const Vector3SoA& value, Vector3SoA& result);
+	static void Transform(const Vector3SoA& position, const Matrix& matrix, Vector3SoA& result);
+	static void TransformNormal(const Vector3SoA& normal, const Matrix& matrix, Vector3SoA& result);
+
+private:
+	// Components per alignment block; the capacity is kept a multiple of it so that the Y and Z
+	// arrays, which follow the X array in the same allocation, stay aligned.
+	static const int BlockLength = Alignment / sizeof(float);
+
+	// X, Y and Z arrays of _capacity floats each, one after the other.
+	float* _data;
+	int _count;
+	int _capacity;
+
+	void Reallocate(int capacity);
+	static void CheckCount(const Vector3SoA& value1, const Vector3SoA& value2);
+};
@@ -1,75 +1,50 @@
 #include "Vector4.h"
+#include "Matrix.h"
+#include "VectorSimd.h"
+#include <stdexcept>
 
-Vector4 operator-(const Vector4& value) {
+Vector4 operator-(const Vector4& value) noexcept {
 	return Vector4(-value.X, -value.Y, -value.Z, -value.W);
 }
 
-Vector4 operator+(Vector4& value1, const Vector4& value2) {
-	value1.X += value2.X;
-	value1.Y += value2.Y;
-	value1.Z += value2.Z;
-	value1.W += value2.W;
-	return value1;
+Vector4 operator+(const Vector4& value1, const Vector4& value2) noexcept {
+	return Vector4(value1.X + value2.X, value1.Y + value2.Y, value1.Z + value2.Z, value1.W + value2.W);
 }
 
-Vector4 operator-(Vector4& value1, const Vector4& value2) {
-	value1.X -= value2.X;
-	value1.Y -= value2.Y;
-	value1.Z -= value2.Z;
-	value1.W -= value2.W;
-	return value1;
+Vector4 operator-(const Vector4& value1, const Vector4& value2) noexcept {
+	return Vector4(value1.X - value2.X, value1.Y - value2.Y, value1.Z - value2.Z, value1.W - value2.W);
 }
 
-Vector4 operator*(Vector4& value1, const Vector4& value2) {
-	value1.X *= value2.X;
-	value1.Y *= value2.Y;
-	value1.Z *= value2.Z;
-	value1.W *= value2.W;
-	return value1;
+Vector4 operator*(const Vector4& value1, const Vector4& value2) noexcept {
+	return Vector4(value1.X * value2.X, value1.Y * value2.Y, value1.Z * value2.Z, value1.W * value2.W);
 }
 
-Vector4 operator*(Vector4& value, float scaleFactor) {
-	value.X *= scaleFactor;
-	value.Y *= scaleFactor;
-	value.Z *= scaleFactor;
-	value.W *= scaleFactor;
-	return value;
+Vector4 operator*(const Vector4& value, float scaleFactor) noexcept {
+	return Vector4(value.X * scaleFactor, value.Y * scaleFactor, value.Z * scaleFactor, value.W * scaleFactor);
 }
 
-Vector4 operator*(float scaleFactor, Vector4& value) {
-	value.X *= scaleFactor;
-	value.Y *= scaleFactor;
-	value.Z *= scaleFactor;
-	value.W *= scaleFactor;
-	return value;
+Vector4 operator*(float scaleFactor, const Vector4& value) noexcept {
+	return Vector4(value.X * scaleFactor, value.Y * scaleFactor, value.Z * scaleFactor, value.W * scaleFactor);
 }
 
-Vector4 operator/(Vector4& value1, const Vector4& value2) {
-	value1.X /= value2.X;
-	value1.Y /= value2.Y;
-	value1.Z /= value2.Z;
-	value1.W /= value2.W;
-	return value1;
+Vector4 operator/(const Vector4& value1, const Vector4& value2) noexcept {
+	return Vector4(value1.X / value2.X, value1.Y / value2.Y, value1.Z / value2.Z, value1.W / value2.W);
 }
 
-Vector4 operator/(Vector4& value, float divider) {
+Vector4 operator/(const Vector4& value, float divider) noexcept {
 	float factor = 1.0f / divider;
-	value.X *= factor;
-	value.Y *= factor;
-	value.Z *= factor;
-	value.W *= factor;
-	return value;
+	return Vector4(value.X * factor, value.Y * factor, value.Z * factor, value.W * factor);
 }
 
-bool operator==(const Vector4& value1, const Vector4& value2) {
+bool operator==(const Vector4& value1, const Vector4& value2) noexcept {
 	return value1.X == value2.X && value1.Y == value2.Y && value1.Z == value2.Z && value1.W == value2.W;
 }
 
-bool operator!=(const Vector4& value1, const Vector4& value2) {
-	return value1.X != value2.X || value1.Y != value2.Y || value1.Z != value2.Z && value1.W != value2.W;
+bool operator!=(const Vector4& value1, const Vector4& value2) noexcept {
+	return value1.X != value2.X || value1.Y != value2.Y || value1.Z != value2.Z || value1.W != value2.W;
 }
 
-Vector4 Vector4::Barycentric(Vector4& value1, Vector4& value2, Vector4& value3, float amount1, float amount2)
+Vector4 Vector4::Barycentric(const Vector4& value1, const Vector4& value2, const Vector4& value3, float amount1, float amount2) noexcept
 {
 	return Vector4(
 		MathHelper::Barycentric(value1.X, value2.X, value3.X, amount1, amount2),
@@ -78,7 +53,7 @@ Vector4 Vector4::Barycentric(Vector4& value1, Vector4& value2, Vector4& value3,
 		MathHelper::Barycentric(value1.W, value2.W, value3.W, amount1, amount2));
 }
 
-void Vector4::Barycentric(Vector4& value1, Vector4& value2, Vector4& value3, float amount1, float amount2, Vector4& result)
+void Vector4::Barycentric(const Vector4& value1, const Vector4& value2, const Vector4& value3, float amount1, float amount2, Vector4& result) noexcept
 {
 	result.X = MathHelper::Barycentric(value1.X, value2.X, value3.X, amount1, amount2);
 	result.Y = MathHelper::Barycentric(value1.Y, value2.Y, value3.Y, amount1, amount2);
@@ -86,7 +61,7 @@ void Vector4::Barycentric(Vector4& value1, Vector4& value2, Vector4& value3, flo
 	result.W = MathHelper::Barycentric(value1.W, value2.W, value3.W, amount1, amount2);
 }
 
-Vector4 Vector4::CatmullRom(Vector4& value1, Vector4& value2, Vector4& value3, Vector4& value4, float amount)
+Vector4 Vector4::CatmullRom(const Vector4& value1, const Vector4& value2, const Vector4& value3, const Vector4& value4, float amount) noexcept
 {
 	return   Vector4(
 		MathHelper::CatmullRom(value1.X, value2.X, value3.X, value4.X, amount),
@@ -95,7 +70,7 @@ Vector4 Vector4::CatmullRom(Vector4& value1, Vector4& value2, Vector4& value3, V
 		MathHelper::CatmullRom(value1.W, value2.W, value3.W, value4.W, amount));
 }
 
-void Vector4::CatmullRom(Vector4& value1, Vector4& value2, Vector4& value3, Vector4& value4, float amount, Vector4& result)
+void Vector4::CatmullRom(const Vector4& value1, const Vector4& value2, const Vector4& value3, const Vector4& value4, float amount, Vector4& result) noexcept
 {
 	result.X = MathHelper::CatmullRom(value1.X, value2.X, value3.X, value4.X, amount);
 	result.Y = MathHelper::CatmullRom(value1.Y, value2.Y, value3.Y, value4.Y, amount);
@@ -103,7 +78,7 @@ void Vector4::CatmullRom(Vector4& value1, Vector4& value2, Vector4& value3, Vect
 	result.W = MathHelper::CatmullRom(value1.W, value2.W, value3.W, value4.W, amount);
 }
 
-void Vector4::Ceiling()
+void Vector4::Ceiling() noexcept
 {
 	X = ceil(X);
 	Y = ceil(Y);
@@ -111,7 +86,7 @@ void Vector4::Ceiling()
 	W = ceil(W);
 }
 
-void Vector4::Ceiling(Vector4& value)
+void Vector4::Ceiling(Vector4& value) noexcept
 {
 	value.X = ceil(value.X);
 	value.Y = ceil(value.Y);
@@ -119,7 +94,7 @@ void Vector4::Ceiling(Vector4& value)
 	value.W = ceil(value.W);
 }
 
-void Vector4::Ceiling(Vector4& value, Vector4& result)
+void Vector4::Ceiling(const Vector4& value, Vector4& result) noexcept
 {
 	result.X = ceil(value.X);
 	result.Y = ceil(value.Y);
@@ -127,7 +102,7 @@ void Vector4::Ceiling(Vector4& value, Vector4& result)
 	result.W = ceil(value.W);
 }
 
-Vector4 Vector4::Clamp(Vector4& value1, Vector4& min, Vector4 max)
+Vector4 Vector4::Clamp(const Vector4& value1, const Vector4& min, Vector4 max) noexcept
 {
 	return Vector4(
 		MathHelper::Clamp(value1.X, min.X, max.X),
@@ -136,7 +111,7 @@ Vector4 Vector4::Clamp(Vector4& value1, Vector4& min, Vector4 max)
 		MathHelper::Clamp(value1.W, min.W, max.W));
 }
 
-void Vector4::Clamp(Vector4& value1, Vector4& min, Vector4& max, Vector4& result)
+void Vector4::Clamp(const Vector4& value1, const Vector4& min, const Vector4& max, Vector4& result) noexcept
 {
 	result.X = MathHelper::Clamp(value1.X, min.X, max.X);
 	result.Y = MathHelper::Clamp(value1.Y, min.Y, max.Y);
@@ -144,17 +119,17 @@ void Vector4::Clamp(Vector4& value1, Vector4& min, Vector4& max, Vector4& result
 	result.W = MathHelper::Clamp(value1.W, min.W, max.W);
 }
 
-float Vector4::Distance(Vector4& value1, Vector4& value2)
+float Vector4::Distance(const Vector4& value1, const Vector4& value2) noexcept
 {
 	return sqrt(DistanceSquared(value1, value2));
 }
 
-void Vector4::Distance(Vector4& value1, Vector4& value2, float& result)
+void Vector4::Distance(const Vector4& value1, const Vector4& value2, float& result) noexcept
 {
 	result = sqrt(DistanceSquared(value1, value2));
 }
 
-float Vector4::DistanceSquared(Vector4& value1, Vector4& value2)
+float Vector4::DistanceSquared(const Vector4& value1, const Vector4& value2) noexcept
 {
 	return (value1.W - value2.W) * (value1.W - value2.W) +
 		(value1.X - value2.X) * (value1.X - value2.X) +
@@ -162,7 +137,7 @@ float Vector4::DistanceSquared(Vector4& value1, Vector4& value2)
 		(value1.Z - value2.Z) * (value1.Z - value2.Z);
 }
 
-void Vector4::DistanceSquared(Vector4& value1, Vector4& value2, float& result)
+void Vector4::DistanceSquared(const Vector4& value1, const Vector4& value2, float& result) noexcept
 {
 	result = (value1.W - value2.W) * (value1.W - value2.W) +
 		(value1.X - value2.X) * (value1.X - value2.X) +
@@ -170,17 +145,17 @@ void Vector4::DistanceSquared(Vector4& value1, Vector4& value2, float& result)
 		(value1.Z - value2.Z) * (value1.Z - value2.Z);
 }
 
-float Vector4::Dot(Vector4& value1, Vector4& value2)
+float Vector4::Dot(const Vector4& value1, const Vector4& value2) noexcept
 {
 	return value1.X * value2.X + value1.Y * value2.Y + value1.Z * value2.Z + value1.W * value2.W;
 }
 
-void Vector4::Dot(Vector4& value1, Vector4& value2, float& result)
+void Vector4::Dot(const Vector4& value1, const Vector4& value2, float& result) noexcept
 {
 	result = value1.X * value2.X + value1.Y * value2.Y + value1.Z * value2.Z + value1.W * value2.W;
 }
 
-void Vector4::Vector4::Floor()
+void Vector4::Floor() noexcept
 {
 	X = floor(X);
 	Y = floor(Y);
@@ -188,7 +163,7 @@ void Vector4::Vector4::Floor()
 	W = floor(W);
 }
 
-void Vector4::Floor(Vector4& value)
+void Vector4::Floor(Vector4& value) noexcept
 {
 	value.X = floor(value.X);
 	value.Y = floor(value.Y);
@@ -196,7 +171,7 @@ void Vector4::Floor(Vector4& value)
 	value.W = floor(value.W);
 }
 
-void Vector4::Floor(Vector4& value, Vector4& result)
+void Vector4::Floor(const Vector4& value, Vector4& result) noexcept
 {
 	result.X = floor(value.X);
 	result.Y = floor(value.Y);
@@ -204,7 +179,7 @@ void Vector4::Floor(Vector4& value, Vector4& result)
 	result.W = floor(value.W);
 }
 
-Vector4 Vector4::Hermite(Vector4& value1, Vector4& tangent1, Vector4& value2, Vector4& tangent2, float amount)
+Vector4 Vector4::Hermite(const Vector4& value1, const Vector4& tangent1, const Vector4& value2, const Vector4& tangent2, float amount) noexcept
 {
 	return Vector4(MathHelper::Hermite(value1.X, tangent1.X, value2.X, tangent2.X, amount),
 		MathHelper::Hermite(value1.Y, tangent1.Y, value2.Y, tangent2.Y, amount),
@@ -212,7 +187,7 @@ Vector4 Vector4::Hermite(Vector4& value1, Vector4& tangent1, Vector4& value2, Ve
 		MathHelper::Hermite(value1.W, tangent1.W, value2.W, tangent2.W, amount));
 }
 
-void Vector4::Hermite(Vector4& value1, Vector4& tangent1, Vector4& value2, Vector4& tangent2, float amount, Vector4& result)
+void Vector4::Hermite(const Vector4& value1, const Vector4& tangent1, const Vector4& value2, const Vector4& tangent2, float amount, Vector4& result) noexcept
 {
 	result.W = MathHelper::Hermite(value1.W, tangent1.W, value2.W, tangent2.W, amount);
 	result.X = MathHelper::Hermite(value1.X, tangent1.X, value2.X, tangent2.X, amount);
@@ -220,17 +195,17 @@ void Vector4::Hermite(Vector4& value1, Vector4& tangent1, Vector4& value2, Vecto
 	result.Z = MathHelper::Hermite(value1.Z, tangent1.Z, value2.Z, tangent2.Z, amount);
 }
 
-float Vector4::Vector4::Length()
+float Vector4::Length() const noexcept
 {
 	return sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W));
 }
 
-float Vector4::Vector4::LengthSquared()
+float Vector4::LengthSquared() const noexcept
 {
 	return (X * X) + (Y * Y) + (Z * Z) + (W * W);
 }
 
-Vector4 Vector4::Lerp(Vector4 value1, Vector4 value2, float amount)
+Vector4 Vector4::Lerp(Vector4 value1, Vector4 value2, float amount) noexcept
 {
 	return Vector4(
 		MathHelper::Lerp(value1.X, value2.X, amount),
@@ -239,7 +214,7 @@ Vector4 Vector4::Lerp(Vector4 value1, Vector4 value2, float amount)
 		MathHelper::Lerp(value1.W, value2.W, amount));
 }
 
-void Vector4::Lerp(Vector4& value1, Vector4& value2, float amount, Vector4& result)
+void Vector4::Lerp(const Vector4& value1, const Vector4& value2, float amount, Vector4& result) noexcept
 {
 	result.X = MathHelper::Lerp(value1.X, value2.X, amount);
 	result.Y = MathHelper::Lerp(value1.Y, value2.Y, amount);
@@ -247,7 +222,7 @@ void Vector4::Lerp(Vector4& value1, Vector4& value2, float amount, Vector4& resu
 	result.W = MathHelper::Lerp(value1.W, value2.W, amount);
 }
 
-Vector4 Vector4::LerpPrecise(Vector4& value1, Vector4& value2, float amount)
+Vector4 Vector4::LerpPrecise(const Vector4& value1, const Vector4& value2, float amount) noexcept
 {
 	return Vector4(
 		MathHelper::LerpPrecise(value1.X, value2.X, amount),
@@ -256,7 +231,7 @@ Vector4 Vector4::LerpPrecise(Vector4& value1, Vector4& value2, float amount)
 		MathHelper::LerpPrecise(value1.W, value2.W, amount));
 }
 
-void Vector4::LerpPrecise(Vector4& value1, Vector4& value2, float amount, Vector4& result)
+void Vector4::LerpPrecise(const Vector4& value1, const Vector4& value2, float amount, Vector4& result) noexcept
 {
 	result.X = MathHelper::LerpPrecise(value1.X, value2.X, amount);
 	result.Y = MathHelper::LerpPrecise(value1.Y, value2.Y, amount);
@@ -264,7 +239,7 @@ void Vector4::LerpPrecise(Vector4& value1, Vector4& value2, float amount, Vector
 	result.W = MathHelper::LerpPrecise(value1.W, value2.W, amount);
 }
 
-Vector4 Vector4::Max(Vector4& value1, Vector4& value2)
+Vector4 Vector4::Max(const Vector4& value1, const Vector4& value2) noexcept
 {
 	return Vector4(
 		MathHelper::Max(value1.X, value2.X),
@@ -273,7 +248,7 @@ Vector4 Vector4::Max(Vector4& value1, Vector4& value2)
 		MathHelper::Max(value1.W, value2.W));
 }
 
-void Vector4::Max(Vector4& value1, Vector4& value2, Vector4& result)
+void Vector4::Max(const Vector4& value1, const Vector4& value2, Vector4& result) noexcept
 {
 	result.X = MathHelper::Max(value1.X, value2.X);
 	result.Y = MathHelper::Max(value1.Y, value2.Y);
@@ -281,7 +256,7 @@ void Vector4::Max(Vector4& value1, Vector4& value2, Vector4& result)
 	result.W = MathHelper::Max(value1.W, value2.W);
 }
 
-Vector4 Vector4::Min(Vector4& value1, Vector4& value2)
+Vector4 Vector4::Min(const Vector4& value1, const Vector4& value2) noexcept
 {
 	return   Vector4(
 		MathHelper::Min(value1.X, value2.X),
@@ -290,7 +265,7 @@ Vector4 Vector4::Min(Vector4& value1, Vector4& value2)
 		MathHelper::Min(value1.W, value2.W));
 }
 
-void Vector4::Min(Vector4& value1, Vector4& value2, Vector4& result)
+void Vector4::Min(const Vector4& value1, const Vector4& value2, Vector4& result) noexcept
 {
 	result.X = MathHelper::Min(value1.X, value2.X);
 	result.Y = MathHelper::Min(value1.Y, value2.Y);
@@ -298,7 +273,7 @@ void Vector4::Min(Vector4& value1, Vector4& value2, Vector4& result)
 	result.W = MathHelper::Min(value1.W, value2.W);
 }
 
-void Vector4::Negate(Vector4& value)
+void Vector4::Negate(Vector4& value) noexcept
 {
 	value.X = -value.X;
 	value.Y = -value.Y;
@@ -306,7 +281,7 @@ void Vector4::Negate(Vector4& value)
 	value.W = -value.W;
 }
 
-void Vector4::Negate()
+void Vector4::Negate() noexcept
 {
 	X = -X;
 	Y = -Y;
@@ -314,7 +289,7 @@ void Vector4::Negate()
 	W = -W;
 }
 
-void Vector4::Normalize()
+void Vector4::Normalize() noexcept
 {
 	float factor = sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W));
 	factor = 1.0f / factor;
@@ -324,7 +299,7 @@ void Vector4::Normalize()
 	W *= factor;
 }
 
-void Vector4::Normalize(Vector4& value)
+void Vector4::Normalize(Vector4& value) noexcept
 {
 	float factor = sqrt((value.X * value.X) + (value.Y * value.Y) + (value.Z * value.Z) + (value.W * value.W));
 	factor = 1.0f / factor;
@@ -334,7 +309,7 @@ void Vector4::Normalize(Vector4& value)
 	value.Z *= factor;
 }
 
-void Vector4::Normalize(Vector4& value, Vector4& result)
+void Vector4::Normalize(const Vector4& value, Vector4& result) noexcept
 {
 	float factor = sqrt((value.X * value.X) + (value.Y * value.Y) + (value.Z * value.Z) + (value.W * value.W));
 	factor = 1.0f / factor;
@@ -344,7 +319,7 @@ void Vector4::Normalize(Vector4& value, Vector4& result)
 	result.Z = value.Z * factor;
 }
 
-void Vector4::Round()
+void Vector4::Round() noexcept
 {
 	X = round(X);
 	Y = round(Y);
@@ -352,7 +327,7 @@ void Vector4::Round()
 	W = round(W);
 }
 
-Vector4 Vector4::SmoothStep(Vector4& value1, Vector4& value2, float amount)
+Vector4 Vector4::SmoothStep(const Vector4& value1, const Vector4& value2, float amount) noexcept
 {
 	return Vector4(
 		MathHelper::SmoothStep(value1.X, value2.X, amount),
@@ -361,7 +336,7 @@ Vector4 Vector4::SmoothStep(Vector4& value1, Vector4& value2, float amount)
 		MathHelper::SmoothStep(value1.W, value2.W, amount));
 }
 
-void Vector4::SmoothStep(Vector4& value1, Vector4& value2, float amount, Vector4& result)
+void Vector4::SmoothStep(const Vector4& value1, const Vector4& value2, float amount, Vector4& result) noexcept
 {
 	result.X = MathHelper::SmoothStep(value1.X, value2.X, amount);
 	result.Y = MathHelper::SmoothStep(value1.Y, value2.Y, amount);
@@ -375,7 +350,7 @@ void Vector4::SmoothStep(Vector4& value1, Vector4& value2, float amount, Vector4
 /// <param name="value">Source <see cref="Vector2"/>.</param>
 /// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
 /// <returns>Transformed <see cref="Vector4"/>.</returns>
-Vector4 Vector4::Transform(Vector2 value, Matrix matrix)
+Vector4 Vector4::Transform(Vector2 value, const Matrix& matrix) noexcept
 {
 	Vector4 result;
 	Transform(value, matrix, result);
@@ -388,7 +363,7 @@ Vector4 Vector4::Transform(Vector2 value, Matrix matrix)
 /// <param name="value">Source <see cref="Vector2"/>.</param>
 /// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
 /// <returns>Transformed <see cref="Vector4"/>.</returns>
-Vector4 Vector4::Transform(Vector2& value, Quaternion& rotation)
+Vector4 Vector4::Transform(const Vector2& value, const Quaternion& rotation) noexcept
 {
 	Vector4 result;
 	Transform(value, rotation, result);
@@ -401,7 +376,7 @@ Vector4 Vector4::Transform(Vector2& value, Quaternion& rotation)
 /// <param name="value">Source <see cref="Vector3"/>.</param>
 /// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
 /// <returns>Transformed <see cref="Vector4"/>.</returns>
-Vector4 Vector4::Transform(Vector3& value, Matrix& matrix)
+Vector4 Vector4::Transform(const Vector3& value, const Matrix& matrix) noexcept
 {
 	Vector4 result;
 	Transform(value, matrix, result);
@@ -414,7 +389,7 @@ Vector4 Vector4::Transform(Vector3& value, Matrix& matrix)
 /// <param name="value">Source <see cref="Vector3"/>.</param>
 /// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
 /// <returns>Transformed <see cref="Vector4"/>.</returns>
-Vector4 Vector4::Transform(Vector3& value, Quaternion& rotation)
+Vector4 Vector4::Transform(const Vector3& value, const Quaternion& rotation) noexcept
 {
 	Vector4 result;
 	Transform(value, rotation, result);
@@ -427,10 +402,11 @@ Vector4 Vector4::Transform(Vector3& value, Quaternion& rotation)
 /// <param name="value">Source <see cref="Vector4"/>.</param>
 /// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
 /// <returns>Transformed <see cref="Vector4"/>.</returns>
-Vector4 Vector4::Transform(Vector4& value, Matrix& matrix)
+Vector4 Vector4::Transform(const Vector4& value, const Matrix& matrix) noexcept
 {
-	Transform(value, matrix, value);
-	return value;
+	Vector4 result;
+	Transform(value, matrix, result);
+	return result;
 }
 
 /// <summary>
@@ -439,7 +415,7 @@ Vector4 Vector4::Transform(Vector4& value, Matrix& matrix)
 /// <param name="value">Source <see cref="Vector4"/>.</param>
 /// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
 /// <returns>Transformed <see cref="Vector4"/>.</returns>
-Vector4 Vector4::Transform(Vector4& value, Quaternion& rotation)
+Vector4 Vector4::Transform(const Vector4& value, const Quaternion& rotation) noexcept
 {
 	Vector4 result;
 	Transform(value, rotation, result);
@@ -452,7 +428,7 @@ Vector4 Vector4::Transform(Vector4& value, Quaternion& rotation)
 /// <param name="value">Source <see cref="Vector2"/>.</param>
 /// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
 /// <param name="result">Transformed <see cref="Vector4"/> as an output parameter.</param>
-void Vector4::Transform(Vector2& value, Matrix& matrix, Vector4& result)
+void Vector4::Transform(const Vector2& value, const Matrix& matrix, Vector4& result) noexcept
 {
 	result.X = (value.X * matrix.M11) + (value.Y * matrix.M21) + matrix.M41;
 	result.Y = (value.X * matrix.M12) + (value.Y * matrix.M22) + matrix.M42;
@@ -466,9 +442,9 @@ void Vector4::Transform(Vector2& value, Matrix& matrix, Vector4& result)
 /// <param name="value">Source <see cref="Vector2"/>.</param>
 /// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
 /// <param name="result">Transformed <see cref="Vector4"/> as an output parameter.</param>
-void Vector4::Transform(Vector2& value, Quaternion& rotation, Vector4& result)
+void Vector4::Transform(const Vector2& value, const Quaternion& rotation, Vector4& result) noexcept
 {
-	//throw new NotImplementedException();
+	Transform(Vector4(value.X, value.Y, 0.0f, 1.0f), rotation, result);
 }
 
 /// <summary>
@@ -477,7 +453,7 @@ void Vector4::Transform(Vector2& value, Quaternion& rotation, Vector4& result)
 /// <param name="value">Source <see cref="Vector3"/>.</param>
 /// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
 /// <param name="result">Transformed <see cref="Vector4"/> as an output parameter.</param>
-void Vector4::Transform(Vector3& value, Matrix& matrix, Vector4& result)
+void Vector4::Transform(const Vector3& value, const Matrix& matrix, Vector4& result) noexcept
 {
 	result.X = (value.X * matrix.M11) + (value.Y * matrix.M21) + (value.Z * matrix.M31) + matrix.M41;
 	result.Y = (value.X * matrix.M12) + (value.Y * matrix.M22) + (value.Z * matrix.M32) + matrix.M42;
@@ -491,9 +467,9 @@ void Vector4::Transform(Vector3& value, Matrix& matrix, Vector4& result)
 /// <param name="value">Source <see cref="Vector3"/>.</param>
 /// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
 /// <param name="result">Transformed <see cref="Vector4"/> as an output parameter.</param>
-void Vector4::Transform(Vector3& value, Quaternion& rotation, Vector4& result)
+void Vector4::Transform(const Vector3& value, const Quaternion& rotation, Vector4& result) noexcept
 {
-	//throw new NotImplementedException();
+	Transform(Vector4(value, 1.0f), rotation, result);
 }
 
 /// <summary>
@@ -502,7 +478,7 @@ void Vector4::Transform(Vector3& value, Quaternion& rotation, Vector4& result)
 /// <param name="value">Source <see cref="Vector4"/>.</param>
 /// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
 /// <param name="result">Transformed <see cref="Vector4"/> as an output parameter.</param>
-void Vector4::Transform(Vector4& value, Matrix& matrix, Vector4& result)
+void Vector4::Transform(const Vector4& value, const Matrix& matrix, Vector4& result) noexcept
 {
 	auto x = (value.X * matrix.M11) + (value.Y * matrix.M21) + (value.Z * matrix.M31) + (value.W * matrix.M41);
 	auto y = (value.X * matrix.M12) + (value.Y * matrix.M22) + (value.Z * matrix.M32) + (value.W * matrix.M42);
@@ -520,9 +496,16 @@ void Vector4::Transform(Vector4& value, Matrix& matrix, Vector4& result)
 /// <param name="value">Source <see cref="Vector4"/>.</param>
 /// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
 /// <param name="result">Transformed <see cref="Vector4"/> as an output parameter.</param>
-void Vector4::Transform(Vector4& value, Quaternion& rotation, Vector4& result)
+void Vector4::Transform(const Vector4& value, const Quaternion& rotation, Vector4& result) noexcept
 {
-	//throw new NotImplementedException();
+	float x = 2 * (rotation.Y * value.Z - rotation.Z * value.Y);
+	float y = 2 * (rotation.Z * value.X - rotation.X * value.Z);
+	float z = 2 * (rotation.X * value.Y - rotation.Y * value.X);
+
+	result.X = value.X + x * rotation.W + (rotation.Y * z - rotation.Z * y);
+	result.Y = value.Y + y * rotation.W + (rotation.Z * x - rotation.X * z);
+	result.Z = value.Z + z * rotation.W + (rotation.X * y - rotation.Y * x);
+	result.W = value.W;
 }
 
 /// <summary>
@@ -534,13 +517,9 @@ void Vector4::Transform(Vector4& value, Quaternion& rotation, Vector4& result)
 /// <param name="destinationArray">Destination array.</param>
 /// <param name="destinationIndex">The starting index in the destination array, where the first <see cref="Vector4"/> should be written.</param>
 /// <param name="length">The number of vectors to be transformed.</param>
-void Vector4::Transform(Vector4* sourceArray, int sourceIndex, Matrix& matrix, Vector4* destinationArray, int destinationIndex, int length)
+void Vector4::Transform(const Vector4* sourceArray, int sourceIndex, const Matrix& matrix, Vector4* destinationArray, int destinationIndex, int length) noexcept
 {
-	for (auto i = 0; i < length; i++)
-	{
-		auto value = sourceArray[sourceIndex + i];
-		destinationArray[destinationIndex + i] = Transform(value, matrix);
-	}
+	VectorSimd::TransformArray(sourceArray + sourceIndex, matrix, destinationArray + destinationIndex, length);
 }
 
 /// <summary>
@@ -552,13 +531,9 @@ void Vector4::Transform(Vector4* sourceArray, int sourceIndex, Matrix& matrix, V
 /// <param name="destinationArray">Destination array.</param>
 /// <param name="destinationIndex">The starting index in the destination array, where the first <see cref="Vector4"/> should be written.</param>
 /// <param name="length">The number of vectors to be transformed.</param>
-void Vector4::Transform(Vector4* sourceArray, int sourceIndex, Quaternion& rotation, Vector4* destinationArray, int destinationIndex, int length)
+void Vector4::Transform(const Vector4* sourceArray, int sourceIndex, const Quaternion& rotation, Vector4* destinationArray, int destinationIndex, int length) noexcept
 {
-	for (auto i = 0; i < length; i++)
-	{
-		auto value = sourceArray[sourceIndex + i];
-		destinationArray[destinationIndex + i] = Transform(value, rotation);
-	}
+	VectorSimd::TransformArray(sourceArray + sourceIndex, rotation, destinationArray + destinationIndex, length);
 }
 
 /// <summary>
@@ -567,14 +542,10 @@ void Vector4::Transform(Vector4* sourceArray, int sourceIndex, Quaternion& rotat
 /// <param name="sourceArray">Source array.</param>
 /// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
 /// <param name="destinationArray">Destination array.</param>
-void Vector4::Transform(Vector4* sourceArray, Matrix& matrix, Vector4* destinationArray)
+/// <param name="length">The number of vectors in the source array.</param>
+void Vector4::Transform(const Vector4* sourceArray, const Matrix& matrix, Vector4* destinationArray, int length) noexcept
 {
-	int lenght = sizeof(sourceArray) / sizeof(sourceArray[0]);
-	for (auto i = 0; i < lenght; i++)
-	{
-		auto value = sourceArray[i];
-		destinationArray[i] = Transform(value, matrix);
-	}
+	VectorSimd::TransformArray(sourceArray, matrix, destinationArray, length);
 }
 
 /// <summary>
@@ -583,12 +554,38 @@ void Vector4::Transform(Vector4* sourceArray, Matrix& matrix, Vector4* destinati
 /// <param name="sourceArray">Source array.</param>
 /// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
 /// <param name="destinationArray">Destination array.</param>
-void Vector4::Transform(Vector4* sourceArray, Quaternion rotation, Vector4* destinationArray)
-{
-	int lenght = sizeof(sourceArray) / sizeof(sourceArray[0]);
-	for (auto i = 0; i < lenght; i++)
-	{
-		auto value = sourceArray[i];
-		destinationArray[i] = Transform(value, rotation);
-	}
+/// <param name="length">The number of vectors in the source array.</param>
+void Vector4::Transform(const Vector4* sourceArray, const Quaternion& rotation, Vector4* destinationArray, int length) noexcept
+{
+	VectorSimd::TransformArray(sourceArray, rotation, destinationArray, length);
+}
+
+/// <summary>
+/// Apply transformation on all vectors of a strided span of <see cref="Vector4"/> by the specified <see cref="Matrix"/>
+/// and places the results in another span, which may be the source.
+/// </summary>
+/// <param name="source">Source vectors.</param>
+/// <param name="matrix">The transformation <see cref="Matrix"/>.</param>
+/// <param name="destination">Destination vectors, as many as in the source.</param>
+void Vector4::Transform(StridedSpan<const Vector4> source, const Matrix& matrix, StridedSpan<Vector4> destination)
+{
+	if (source.GetCount() != destination.GetCount())
+		throw std::out_of_range("Source and destination spans have different element counts");
+
+	VectorSimd::TransformStrided(source.GetData(), source.GetStride(), matrix, destination.GetData(), destination.GetStride(), source.GetCount());
+}
+
+/// <summary>
+/// Apply transformation on all vectors of a strided span of <see cref="Vector4"/> by the specified <see cref="Quaternion"/>
+/// and places the results in another span, which may be the source.
+/// </summary>
+/// <param name="source">Source vectors.</param>
+/// <param name="rotation">The <see cref="Quaternion"/> which contains rotation transformation.</param>
+/// <param name="destination">Destination vectors, as many as in the source.</param>
+void Vector4::Transform(StridedSpan<const Vector4> source, const Quaternion& rotation, StridedSpan<Vector4> destination)
+{
+	if (source.GetCount() != destination.GetCount())
+		throw std::out_of_range("Source and destination spans have different element counts");
+
+	VectorSimd::TransformStrided(source.GetData(), source.GetStride(), rotation, destination.GetData(), destination.GetStride(), source.GetCount());
 }
\ No newline at end of file
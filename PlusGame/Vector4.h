@@ -2,7 +2,11 @@
 #include "MathHelper.h"
 #include <cmath>
 #include "Vector2.h"
-#include "Matrix.h"
+#include "Vector3.h"
+#include "VectorSimd.h"
+
+class Matrix;
+class Quaternion;
 
 class Vector4
 {
@@ -13,116 +17,151 @@ public:
 	float W;
 
 public:
-	Vector4(float x, float y, float z, float w) : X(x), Y(y), Z(z), W(w) {}
-	Vector4(float value) : X(value), Y(value), Z(value), W(value) {}
-	Vector4(Vector3 vector, float value) : X(vector.X), Y(vector.Y), Z(vector.Z), W(value) {}
-	Vector4() : X(0), Y(0), Z(0), W(0) {}
+	constexpr Vector4(float x, float y, float z, float w) noexcept : X(x), Y(y), Z(z), W(w) {}
+	constexpr Vector4(float value) noexcept : X(value), Y(value), Z(value), W(value) {}
+	constexpr Vector4(Vector3 vector, float value) noexcept : X(vector.X), Y(vector.Y), Z(vector.Z), W(value) {}
+	constexpr Vector4() noexcept : X(0), Y(0), Z(0), W(0) {}
 
-	friend Vector4 operator-(Vector4& value);
+	friend Vector4 operator-(const Vector4& value) noexcept;
 
 	// Binary addition
-	friend Vector4 operator+(Vector4& value1, Vector4& value2);
+	friend Vector4 operator+(const Vector4& value1, const Vector4& value2) noexcept;
 
 	// Binary subtraction
-	friend Vector4 operator-(Vector4& value1, Vector4& value2);
+	friend Vector4 operator-(const Vector4& value1, const Vector4& value2) noexcept;
 
 	// Component-wise multiplication
-	friend Vector4 operator*(Vector4& value1, Vector4& value2);
+	friend Vector4 operator*(const Vector4& value1, const Vector4& value2) noexcept;
 
 	// Scalar multiplication
-	friend Vector4 operator*(Vector4& value, float scaleFactor);
-	friend Vector4 operator*(float scaleFactor, Vector4& value);
+	friend Vector4 operator*(const Vector4& value, float scaleFactor) noexcept;
+	friend Vector4 operator*(float scaleFactor, const Vector4& value) noexcept;
 
 	// Component-wise division
-	friend Vector4 operator/(Vector4& value1, Vector4& value2);
+	friend Vector4 operator/(const Vector4& value1, const Vector4& value2) noexcept;
 
 	// Scalar division
-	friend Vector4 operator/(Vector4& value, float divider);
+	friend Vector4 operator/(const Vector4& value, float divider) noexcept;
 
 	// Equality comparison
-	friend bool operator==(Vector4& value1, Vector4& value2);
+	friend bool operator==(const Vector4& value1, const Vector4& value2) noexcept;
 
 	// Inequality comparison
-	friend bool operator!=(Vector4& value1, Vector4& value2);
+	friend bool operator!=(const Vector4& value1, const Vector4& value2) noexcept;
 
 	// Other member functions
-	static Vector4 Barycentric(Vector4& value1, Vector4& value2, Vector4& value3, float amount1, float amount2);
-	static void Barycentric(Vector4& value1, Vector4& value2, Vector4& value3, float amount1, float amount2, Vector4& result);
-
-	Vector4 CatmullRom(Vector4& value1, Vector4& value2, Vector4& value3, Vector4& value4, float amount);
-	void CatmullRom(Vector4& value1, Vector4& value2, Vector4& value3, Vector4& value4, float amount, Vector4& result);
+	static Vector4 Barycentric(const Vector4& value1, const Vector4& value2, const Vector4& value3, float amount1, float amount2) noexcept;
+	static void Barycentric(const Vector4& value1, const Vector4& value2, const Vector4& value3, float amount1, float amount2, Vector4& result) noexcept;
 
-	void Ceiling();
-	static void Ceiling(Vector4& value);
-	static void Ceiling(Vector4& value, Vector4& result);
+	static Vector4 CatmullRom(const Vector4& value1, const Vector4& value2, const Vector4& value3, const Vector4& value4, float amount) noexcept;
+	static void CatmullRom(const Vector4& value1, const Vector4& value2, const Vector4& value3, const Vector4& value4, float amount, Vector4& result) noexcept;
 
-	Vector4 Clamp(Vector4& value1, Vector4& min, Vector4 max);
-	static void Clamp(Vector4& value, Vector4& min, Vector4& max, Vector4& result);
+	void Ceiling() noexcept;
+	static void Ceiling(Vector4& value) noexcept;
+	static void Ceiling(const Vector4& value, Vector4& result) noexcept;
 
-	float Distance(Vector4& value1, Vector4& value2);
+	static Vector4 Clamp(const Vector4& value1, const Vector4& min, Vector4 max) noexcept;
+	static void Clamp(const Vector4& value, const Vector4& min, const Vector4& max, Vector4& result) noexcept;
 
-	static void Distance(Vector4& value1, Vector4& value2, float& result);
+	static float Distance(const Vector4& value1, const Vector4& value2) noexcept;
 
-	static float DistanceSquared(Vector4& value1, Vector4& value2);
+	static void Distance(const Vector4& value1, const Vector4& value2, float& result) noexcept;
 
-	static void DistanceSquared(Vector4& value1, Vector4& value2, float& result);
+	static float DistanceSquared(const Vector4& value1, const Vector4& value2) noexcept;
 
-	float Dot(Vector4& value1, Vector4& value2);
+	static void DistanceSquared(const Vector4& value1, const Vector4& value2, float& result) noexcept;
 
-	static void Dot(Vector4& value1, Vector4& value2, float& result);
+	static float Dot(const Vector4& value1, const Vector4& value2) noexcept;
 
-	void Floor();
-	static void Floor(Vector4& value);
-	static void Floor(Vector4& value, Vector4& result);
+	static void Dot(const Vector4& value1, const Vector4& value2, float& result) noexcept;
 
-	Vector4 Hermite(Vector4& value1, Vector4& tangent1, Vector4& value2, Vector4& tangent2, float amount);
+	void Floor() noexcept;
+	static void Floor(Vector4& value) noexcept;
+	static void Floor(const Vector4& value, Vector4& result) noexcept;
 
-	static void Hermite(Vector4& value1, Vector4& tangent1, Vector4& value2, Vector4& tangent2, float amount, Vector4& result);
+	static Vector4 Hermite(const Vector4& value1, const Vector4& tangent1, const Vector4& value2, const Vector4& tangent2, float amount) noexcept;
 
-	float Length();
-	float LengthSquared();
+	static void Hermite(const Vector4& value1, const Vector4& tangent1, const Vector4& value2, const Vector4& tangent2, float amount, Vector4& result) noexcept;
 
-	Vector4 Lerp(Vector4 value1, Vector4 value2, float amount);
-	static void Lerp(Vector4& value1, Vector4& value2, float amount, Vector4& result);
+	float Length() const noexcept;
+	float LengthSquared() const noexcept;
 
-	Vector4 LerpPrecise(Vector4& value1, Vector4& value2, float amount);
-	static void LerpPrecise(Vector4& value1, Vector4& value2, float amount, Vector4& result);
+	static Vector4 Lerp(Vector4 value1, Vector4 value2, float amount) noexcept;
+	static void Lerp(const Vector4& value1, const Vector4& value2, float amount, Vector4& result) noexcept;
 
-	Vector4 Max(Vector4& value1, Vector4& value2);
-	static void Max(Vector4& value1, Vector4& value2, Vector4& result);
+	static Vector4 LerpPrecise(const Vector4& value1, const Vector4& value2, float amount) noexcept;
+	static void LerpPrecise(const Vector4& value1, const Vector4& value2, float amount, Vector4& result) noexcept;
 
-	Vector4 Min(Vector4& value1, Vector4& value2);
-	static void Min(Vector4& value1, Vector4& value2, Vector4& result);
+	static Vector4 Max(const Vector4& value1, const Vector4& value2) noexcept;
+	static void Max(const Vector4& value1, const Vector4& value2, Vector4& result) noexcept;
 
-	void Negate(Vector4& value);
-	void Negate();
+	static Vector4 Min(const Vector4& value1, const Vector4& value2) noexcept;
+	static void Min(const Vector4& value1, const Vector4& value2, Vector4& result) noexcept;
 
-	void Normalize();
-	void Normalize(Vector4& value);
-	static void Normalize(Vector4& value, Vector4& result);
+	void Negate(Vector4& value) noexcept;
+	void Negate() noexcept;
 
-	void Round();
+	void Normalize() noexcept;
+	void Normalize(Vector4& value) noexcept;
+	static void Normalize(const Vector4& value, Vector4& result) noexcept;
+	// Normalize with the precision policy of NormalizePrecision.h, as in Normalize<RefinedPrecision>(value).
+	template<typename Precision> void Normalize() noexcept;
+	template<typename Precision> static Vector4 Normalize(Vector4 value) noexcept;
+	template<typename Precision> static void Normalize(const Vector4& value, Vector4& result) noexcept;
+	template<typename Precision> static void Normalize(const Vector4* sourceArray, Vector4* destinationArray, int length) noexcept;
 
-	Vector4 SmoothStep(Vector4& value1, Vector4& value2, float amount);
-	static void SmoothStep(Vector4& value1, Vector4& value2, float amount, Vector4& result);
+	void Round() noexcept;
 
-	static Vector4 Transform(Vector2 value, Matrix matrix);
-	static Vector4 Transform(Vector2& value, Quaternion& rotation);
-	static Vector4 Transform(Vector3& value, Matrix& matrix);
-	static Vector4 Transform(Vector3& value, Quaternion& rotation);
-	static Vector4 Transform(Vector4& value, Matrix& matrix);
-	static Vector4 Transform(Vector4& value, Quaternion& rotation);
-	static void Transform(Vector2& value, Matrix& matrix, Vector4& result);
-	static void Transform(Vector2& value, Quaternion& rotation, Vector4& result);
-	static void Transform(Vector3& value, Matrix& matrix, Vector4& result);
-	static void Transform(Vector3& value, Quaternion& rotation, Vector4& result);
-	static void Transform(Vector4& value, Matrix& matrix, Vector4& result);
-	static void Transform(Vector4& value, Quaternion& rotation, Vector4& result);
-	static void Transform(Vector4* sourceArray, int sourceIndex, Matrix& matrix, Vector4* destinationArray, int destinationIndex, int length);
-	static void Transform(Vector4* sourceArray, int sourceIndex, Quaternion& rotation, Vector4* destinationArray, int destinationIndex, int length);
-	static void Transform(Vector4* sourceArray, Matrix& matrix, Vector4* destinationArray);
-	static void Transform(Vector4* sourceArray, Quaternion rotation, Vector4* destinationArray);
+	static Vector4 SmoothStep(const Vector4& value1, const Vector4& value2, float amount) noexcept;
+	static void SmoothStep(const Vector4& value1, const Vector4& value2, float amount, Vector4& result) noexcept;
 
-	//TODO complete the transform region
+	static Vector4 Transform(Vector2 value, const Matrix& matrix) noexcept;
+	static Vector4 Transform(const Vector2& value, const Quaternion& rotation) noexcept;
+	static Vector4 Transform(const Vector3& value, const Matrix& matrix) noexcept;
+	static Vector4 Transform(const Vector3& value, const Quaternion& rotation) noexcept;
+	static Vector4 Transform(const Vector4& value, const Matrix& matrix) noexcept;
+	static Vector4 Transform(const Vector4& value, const Quaternion& rotation) noexcept;
+	static void Transform(const Vector2& value, const Matrix& matrix, Vector4& result) noexcept;
+	static void Transform(const Vector2& value, const Quaternion& rotation, Vector4& result) noexcept;
+	static void Transform(const Vector3& value, const Matrix& matrix, Vector4& result) noexcept;
+	static void Transform(const Vector3& value, const Quaternion& rotation, Vector4& result) noexcept;
+	static void Transform(const Vector4& value, const Matrix& matrix, Vector4& result) noexcept;
+	static void Transform(const Vector4& value, const Quaternion& rotation, Vector4& result) noexcept;
+	static void Transform(const Vector4* sourceArray, int sourceIndex, const Matrix& matrix, Vector4* destinationArray, int destinationIndex, int length) noexcept;
+	static void Transform(const Vector4* sourceArray, int sourceIndex, const Quaternion& rotation, Vector4* destinationArray, int destinationIndex, int length) noexcept;
+	static void Transform(const Vector4* sourceArray, const Matrix& matrix, Vector4* destinationArray, int length) noexcept;
+	static void Transform(const Vector4* sourceArray, const Quaternion& rotation, Vector4* destinationArray, int length) noexcept;
+	// Works in place on strided data such as the vectors of an interleaved vertex buffer; the
+	// destination may be the source. Throws std::out_of_range if the counts differ.
+	static void Transform(StridedSpan<const Vector4> source, const Matrix& matrix, StridedSpan<Vector4> destination);
+	static void Transform(StridedSpan<const Vector4> source, const Quaternion& rotation, StridedSpan<Vector4> destination);
 };
 
+template<typename Precision>
+inline void Vector4::Normalize() noexcept
+{
+	Normalize<Precision>(*this, *this);
+}
+
+template<typename Precision>
+inline Vector4 Vector4::Normalize(Vector4 value) noexcept
+{
+	Normalize<Precision>(value, value);
+	return value;
+}
+
+template<typename Precision>
+inline void Vector4::Normalize(const Vector4& value, Vector4& result) noexcept
+{
+	float factor = Precision::ReciprocalSqrt((value.X * value.X) + (value.Y * value.Y) + (value.Z * value.Z) + (value.W * value.W));
+	result.X = value.X * factor;
+	result.Y = value.Y * factor;
+	result.Z = value.Z * factor;
+	result.W = value.W * factor;
+}
+
+template<typename Precision>
+inline void Vector4::Normalize(const Vector4* sourceArray, Vector4* destinationArray, int length) noexcept
+{
+	VectorSimd::NormalizeArray(sourceArray, destinationArray, length, Precision::Value);
+}
@@ -0,0 +1,2355 @@
+#include "VectorSimd.h"
+#include "Matrix.h"
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Matrix3x2.h"
+#include "Quaternion.h"
+#include "PackedVector.h"
+#include "CpuFeatures.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if defined(PLUSGAME_X86)
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(Vector2) == 2 * sizeof(float), "Vector2 must be 2 tightly packed floats");
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be 3 tightly packed floats");
+static_assert(sizeof(Vector4) == 4 * sizeof(float), "Vector4 must be 4 tightly packed floats");
+static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must be 4 tightly packed floats");
+
+// Element index of an array whose elements start stride bytes apart.
+template<typename T>
+static inline T* StridedElement(T* first, int stride, int index)
+{
+	typedef typename std::conditional<std::is_const<T>::value, const char, char>::type Byte;
+	return reinterpret_cast<T*>(reinterpret_cast<Byte*>(first) + static_cast<std::ptrdiff_t>(index) * stride);
+}
+
+// The scalar kernels are the reference for the vectorized ones, which also use them for the
+// elements left over after the last full register.
+
+static void AddArrayScalar(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		resultArray[i] = value1Array[i] + value2Array[i];
+}
+
+static void SubtractArrayScalar(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		resultArray[i] = value1Array[i] - value2Array[i];
+}
+
+static void MultiplyArrayScalar(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		resultArray[i] = value1Array[i] * value2Array[i];
+}
+
+static void ScaleArrayScalar(const float* value1Array, float scaleFactor, float* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		resultArray[i] = value1Array[i] * scaleFactor;
+}
+
+static void LerpArrayScalar(const float* value1Array, const float* value2Array, float amount, float* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		resultArray[i] = value1Array[i] + (value2Array[i] - value1Array[i]) * amount;
+}
+
+// Same comparisons as MathHelper::Min and MathHelper::Max, which is also what minps and maxps
+// compute: the second operand is returned when the values are equal or either is NaN.
+static void MinArrayScalar(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		resultArray[i] = (value1Array[i] < value2Array[i]) ? value1Array[i] : value2Array[i];
+}
+
+static void MaxArrayScalar(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		resultArray[i] = (value1Array[i] > value2Array[i]) ? value1Array[i] : value2Array[i];
+}
+
+static void DotSoAScalar(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2, float* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		resultArray[i] = x1[i] * x2[i] + y1[i] * y2[i] + z1[i] * z2[i];
+}
+
+static void CrossSoAScalar(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2,
+	float* resultX, float* resultY, float* resultZ, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		float x = y1[i] * z2[i] - y2[i] * z1[i];
+		float y = -(x1[i] * z2[i] - x2[i] * z1[i]);
+		float z = x1[i] * y2[i] - x2[i] * y1[i];
+		resultX[i] = x;
+		resultY[i] = y;
+		resultZ[i] = z;
+	}
+}
+
+static void NormalizeSoAScalar(const float* x, const float* y, const float* z, float* resultX, float* resultY, float* resultZ, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		float factor = std::sqrt((x[i] * x[i]) + (y[i] * y[i]) + (z[i] * z[i]));
+		factor = 1.0f / factor;
+		resultX[i] = x[i] * factor;
+		resultY[i] = y[i] * factor;
+		resultZ[i] = z[i] * factor;
+	}
+}
+
+static void TransformSoAScalar(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		float tx = (x[i] * matrix.M11) + (y[i] * matrix.M21) + (z[i] * matrix.M31) + matrix.M41;
+		float ty = (x[i] * matrix.M12) + (y[i] * matrix.M22) + (z[i] * matrix.M32) + matrix.M42;
+		float tz = (x[i] * matrix.M13) + (y[i] * matrix.M23) + (z[i] * matrix.M33) + matrix.M43;
+		resultX[i] = tx;
+		resultY[i] = ty;
+		resultZ[i] = tz;
+	}
+}
+
+static void TransformNormalSoAScalar(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		float tx = (x[i] * matrix.M11) + (y[i] * matrix.M21) + (z[i] * matrix.M31);
+		float ty = (x[i] * matrix.M12) + (y[i] * matrix.M22) + (z[i] * matrix.M32);
+		float tz = (x[i] * matrix.M13) + (y[i] * matrix.M23) + (z[i] * matrix.M33);
+		resultX[i] = tx;
+		resultY[i] = ty;
+		resultZ[i] = tz;
+	}
+}
+
+static void TransformVector3Scalar(const Vector3* sourceArray, const Matrix& matrix, Vector3* destinationArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		auto position = sourceArray[i];
+		destinationArray[i] =
+			Vector3(
+				(position.X * matrix.M11) + (position.Y * matrix.M21) + (position.Z * matrix.M31) + matrix.M41,
+				(position.X * matrix.M12) + (position.Y * matrix.M22) + (position.Z * matrix.M32) + matrix.M42,
+				(position.X * matrix.M13) + (position.Y * matrix.M23) + (position.Z * matrix.M33) + matrix.M43);
+	}
+}
+
+static void RotateVector3Scalar(const Vector3* sourceArray, const Quaternion& rotation, Vector3* destinationArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		auto position = sourceArray[i];
+
+		float x = 2 * (rotation.Y * position.Z - rotation.Z * position.Y);
+		float y = 2 * (rotation.Z * position.X - rotation.X * position.Z);
+		float z = 2 * (rotation.X * position.Y - rotation.Y * position.X);
+
+		destinationArray[i] =
+			Vector3(
+				position.X + x * rotation.W + (rotation.Y * z - rotation.Z * y),
+				position.Y + y * rotation.W + (rotation.Z * x - rotation.X * z),
+				position.Z + z * rotation.W + (rotation.X * y - rotation.Y * x));
+	}
+}
+
+static void TransformVector3StridedScalar(const Vector3* sourceArray, int sourceStride, const Matrix& matrix, Vector3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		TransformVector3Scalar(StridedElement(sourceArray, sourceStride, i), matrix, StridedElement(destinationArray, destinationStride, i), 1);
+}
+
+static void RotateVector3StridedScalar(const Vector3* sourceArray, int sourceStride, const Quaternion& rotation, Vector3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		RotateVector3Scalar(StridedElement(sourceArray, sourceStride, i), rotation, StridedElement(destinationArray, destinationStride, i), 1);
+}
+
+static void RotateVector4Scalar(const Vector4* sourceArray, const Quaternion& rotation, Vector4* destinationArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector4::Transform(sourceArray[i], rotation, destinationArray[i]);
+}
+
+static void RotateVector4StridedScalar(const Vector4* sourceArray, int sourceStride, const Quaternion& rotation, Vector4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector4::Transform(*StridedElement(sourceArray, sourceStride, i), rotation, *StridedElement(destinationArray, destinationStride, i));
+}
+
+static void TransformVector2StridedScalar(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector2::Transform(*StridedElement(sourceArray, sourceStride, i), matrix, *StridedElement(destinationArray, destinationStride, i));
+}
+
+static void TransformNormalVector2StridedScalar(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector2::TransformNormal(*StridedElement(sourceArray, sourceStride, i), matrix, *StridedElement(destinationArray, destinationStride, i));
+}
+
+#if !defined(PLUSGAME_X86)
+static void TransformVector2Scalar(const Vector2* sourceArray, const Matrix3x2& matrix, Vector2* destinationArray, int length)
+{
+	TransformVector2StridedScalar(sourceArray, sizeof(Vector2), matrix, destinationArray, sizeof(Vector2), length);
+}
+
+static void TransformNormalVector2Scalar(const Vector2* sourceArray, const Matrix3x2& matrix, Vector2* destinationArray, int length)
+{
+	TransformNormalVector2StridedScalar(sourceArray, sizeof(Vector2), matrix, destinationArray, sizeof(Vector2), length);
+}
+
+static void TransformVector4Scalar(const Vector4* sourceArray, const Matrix& matrix, Vector4* destinationArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector4::Transform(sourceArray[i], matrix, destinationArray[i]);
+}
+
+static void TransformVector4StridedScalar(const Vector4* sourceArray, int sourceStride, const Matrix& matrix, Vector4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector4::Transform(*StridedElement(sourceArray, sourceStride, i), matrix, *StridedElement(destinationArray, destinationStride, i));
+}
+#endif
+
+template<typename Precision>
+static void NormalizeVector2Scalar(const Vector2* sourceArray, Vector2* destinationArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector2::Normalize<Precision>(sourceArray[i], destinationArray[i]);
+}
+
+template<typename Precision>
+static void NormalizeVector3Scalar(const Vector3* sourceArray, Vector3* destinationArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector3::Normalize<Precision>(sourceArray[i], destinationArray[i]);
+}
+
+template<typename Precision>
+static void NormalizeVector4Scalar(const Vector4* sourceArray, Vector4* destinationArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Vector4::Normalize<Precision>(sourceArray[i], destinationArray[i]);
+}
+
+template<typename Trig>
+static void SinCosScalar(const float* angleArray, float* sinArray, float* cosArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Trig::SinCos(angleArray[i], sinArray[i], cosArray[i]);
+}
+
+template<typename Trig>
+static void SlerpScalar(const Quaternion* quaternion1Array, const Quaternion* quaternion2Array, const float* amountArray, Quaternion* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Quaternion::Slerp<Trig>(quaternion1Array[i], quaternion2Array[i], amountArray[i], resultArray[i]);
+}
+
+template<typename Trig>
+static void CreateFromYawPitchRollScalar(const float* yawArray, const float* pitchArray, const float* rollArray, Quaternion* resultArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		Quaternion::CreateFromYawPitchRoll<Trig>(yawArray[i], pitchArray[i], rollArray[i], resultArray[i]);
+}
+
+static void PackOctahedral16Scalar(const Vector3* sourceArray, int sourceStride, Octahedral16* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = Octahedral16(*StridedElement(sourceArray, sourceStride, i));
+}
+
+static void UnpackOctahedral16Scalar(const Octahedral16* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = StridedElement(sourceArray, sourceStride, i)->ToVector3();
+}
+
+static void PackSnorm1010102Scalar(const Vector4* sourceArray, int sourceStride, Snorm1010102* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = Snorm1010102(*StridedElement(sourceArray, sourceStride, i));
+}
+
+static void UnpackSnorm1010102Scalar(const Snorm1010102* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = StridedElement(sourceArray, sourceStride, i)->ToVector4();
+}
+
+#if !defined(PLUSGAME_X86)
+static void PackHalf3Scalar(const Vector3* sourceArray, int sourceStride, Half3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = Half3(*StridedElement(sourceArray, sourceStride, i));
+}
+
+static void UnpackHalf3Scalar(const Half3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = StridedElement(sourceArray, sourceStride, i)->ToVector3();
+}
+
+static void PackHalf4Scalar(const Vector4* sourceArray, int sourceStride, Half4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = Half4(*StridedElement(sourceArray, sourceStride, i));
+}
+
+static void UnpackHalf4Scalar(const Half4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = StridedElement(sourceArray, sourceStride, i)->ToVector4();
+}
+
+static void PackSnorm16x3Scalar(const Vector3* sourceArray, int sourceStride, Snorm16x3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = Snorm16x3(*StridedElement(sourceArray, sourceStride, i));
+}
+
+static void UnpackSnorm16x3Scalar(const Snorm16x3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = StridedElement(sourceArray, sourceStride, i)->ToVector3();
+}
+
+static void PackSnorm16x4Scalar(const Vector4* sourceArray, int sourceStride, Snorm16x4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = Snorm16x4(*StridedElement(sourceArray, sourceStride, i));
+}
+
+static void UnpackSnorm16x4Scalar(const Snorm16x4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		*StridedElement(destinationArray, destinationStride, i) = StridedElement(sourceArray, sourceStride, i)->ToVector4();
+}
+#endif
+
+static void SplitVector3Scalar(const Vector3* sourceArray, float* x, float* y, float* z, int length)
+{
+	for (auto i = 0; i < length; i++)
+	{
+		auto value = sourceArray[i];
+		x[i] = value.X;
+		y[i] = value.Y;
+		z[i] = value.Z;
+	}
+}
+
+static void JoinVector3Scalar(const float* x, const float* y, const float* z, Vector3* destinationArray, int length)
+{
+	for (auto i = 0; i < length; i++)
+		destinationArray[i] = Vector3(x[i], y[i], z[i]);
+}
+
+#if defined(PLUSGAME_X86)
+
+static void AddArraySse(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+		_mm_storeu_ps(resultArray + i, _mm_add_ps(_mm_loadu_ps(value1Array + i), _mm_loadu_ps(value2Array + i)));
+	AddArrayScalar(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+static void SubtractArraySse(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+		_mm_storeu_ps(resultArray + i, _mm_sub_ps(_mm_loadu_ps(value1Array + i), _mm_loadu_ps(value2Array + i)));
+	SubtractArrayScalar(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+static void MultiplyArraySse(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+		_mm_storeu_ps(resultArray + i, _mm_mul_ps(_mm_loadu_ps(value1Array + i), _mm_loadu_ps(value2Array + i)));
+	MultiplyArrayScalar(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+static void ScaleArraySse(const float* value1Array, float scaleFactor, float* resultArray, int length)
+{
+	auto factor = _mm_set1_ps(scaleFactor);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+		_mm_storeu_ps(resultArray + i, _mm_mul_ps(_mm_loadu_ps(value1Array + i), factor));
+	ScaleArrayScalar(value1Array + i, scaleFactor, resultArray + i, length - i);
+}
+
+static void LerpArraySse(const float* value1Array, const float* value2Array, float amount, float* resultArray, int length)
+{
+	auto t = _mm_set1_ps(amount);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto from = _mm_loadu_ps(value1Array + i);
+		_mm_storeu_ps(resultArray + i, _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(value2Array + i), from), t)));
+	}
+	LerpArrayScalar(value1Array + i, value2Array + i, amount, resultArray + i, length - i);
+}
+
+static void MinArraySse(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+		_mm_storeu_ps(resultArray + i, _mm_min_ps(_mm_loadu_ps(value1Array + i), _mm_loadu_ps(value2Array + i)));
+	MinArrayScalar(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+static void MaxArraySse(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+		_mm_storeu_ps(resultArray + i, _mm_max_ps(_mm_loadu_ps(value1Array + i), _mm_loadu_ps(value2Array + i)));
+	MaxArrayScalar(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+static void DotSoASse(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto xx = _mm_mul_ps(_mm_loadu_ps(x1 + i), _mm_loadu_ps(x2 + i));
+		auto yy = _mm_mul_ps(_mm_loadu_ps(y1 + i), _mm_loadu_ps(y2 + i));
+		auto zz = _mm_mul_ps(_mm_loadu_ps(z1 + i), _mm_loadu_ps(z2 + i));
+		_mm_storeu_ps(resultArray + i, _mm_add_ps(_mm_add_ps(xx, yy), zz));
+	}
+	DotSoAScalar(x1 + i, y1 + i, z1 + i, x2 + i, y2 + i, z2 + i, resultArray + i, length - i);
+}
+
+static void CrossSoASse(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2,
+	float* resultX, float* resultY, float* resultZ, int length)
+{
+	auto sign = _mm_set1_ps(-0.0f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto ax = _mm_loadu_ps(x1 + i), ay = _mm_loadu_ps(y1 + i), az = _mm_loadu_ps(z1 + i);
+		auto bx = _mm_loadu_ps(x2 + i), by = _mm_loadu_ps(y2 + i), bz = _mm_loadu_ps(z2 + i);
+		auto x = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(by, az));
+		auto y = _mm_xor_ps(_mm_sub_ps(_mm_mul_ps(ax, bz), _mm_mul_ps(bx, az)), sign);
+		auto z = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(bx, ay));
+		_mm_storeu_ps(resultX + i, x);
+		_mm_storeu_ps(resultY + i, y);
+		_mm_storeu_ps(resultZ + i, z);
+	}
+	CrossSoAScalar(x1 + i, y1 + i, z1 + i, x2 + i, y2 + i, z2 + i, resultX + i, resultY + i, resultZ + i, length - i);
+}
+
+static void NormalizeSoASse(const float* x, const float* y, const float* z, float* resultX, float* resultY, float* resultZ, int length)
+{
+	auto one = _mm_set1_ps(1.0f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+		auto lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+		auto factor = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+		_mm_storeu_ps(resultX + i, _mm_mul_ps(vx, factor));
+		_mm_storeu_ps(resultY + i, _mm_mul_ps(vy, factor));
+		_mm_storeu_ps(resultZ + i, _mm_mul_ps(vz, factor));
+	}
+	NormalizeSoAScalar(x + i, y + i, z + i, resultX + i, resultY + i, resultZ + i, length - i);
+}
+
+static void TransformSoASse(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length)
+{
+	auto m11 = _mm_set1_ps(matrix.M11), m12 = _mm_set1_ps(matrix.M12), m13 = _mm_set1_ps(matrix.M13);
+	auto m21 = _mm_set1_ps(matrix.M21), m22 = _mm_set1_ps(matrix.M22), m23 = _mm_set1_ps(matrix.M23);
+	auto m31 = _mm_set1_ps(matrix.M31), m32 = _mm_set1_ps(matrix.M32), m33 = _mm_set1_ps(matrix.M33);
+	auto m41 = _mm_set1_ps(matrix.M41), m42 = _mm_set1_ps(matrix.M42), m43 = _mm_set1_ps(matrix.M43);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+		auto tx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m11), _mm_mul_ps(vy, m21)), _mm_mul_ps(vz, m31)), m41);
+		auto ty = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m12), _mm_mul_ps(vy, m22)), _mm_mul_ps(vz, m32)), m42);
+		auto tz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m13), _mm_mul_ps(vy, m23)), _mm_mul_ps(vz, m33)), m43);
+		_mm_storeu_ps(resultX + i, tx);
+		_mm_storeu_ps(resultY + i, ty);
+		_mm_storeu_ps(resultZ + i, tz);
+	}
+	TransformSoAScalar(x + i, y + i, z + i, matrix, resultX + i, resultY + i, resultZ + i, length - i);
+}
+
+static void TransformNormalSoASse(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length)
+{
+	auto m11 = _mm_set1_ps(matrix.M11), m12 = _mm_set1_ps(matrix.M12), m13 = _mm_set1_ps(matrix.M13);
+	auto m21 = _mm_set1_ps(matrix.M21), m22 = _mm_set1_ps(matrix.M22), m23 = _mm_set1_ps(matrix.M23);
+	auto m31 = _mm_set1_ps(matrix.M31), m32 = _mm_set1_ps(matrix.M32), m33 = _mm_set1_ps(matrix.M33);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+		auto tx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m11), _mm_mul_ps(vy, m21)), _mm_mul_ps(vz, m31));
+		auto ty = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m12), _mm_mul_ps(vy, m22)), _mm_mul_ps(vz, m32));
+		auto tz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m13), _mm_mul_ps(vy, m23)), _mm_mul_ps(vz, m33));
+		_mm_storeu_ps(resultX + i, tx);
+		_mm_storeu_ps(resultY + i, ty);
+		_mm_storeu_ps(resultZ + i, tz);
+	}
+	TransformNormalSoAScalar(x + i, y + i, z + i, matrix, resultX + i, resultY + i, resultZ + i, length - i);
+}
+
+// Four Vector3 are three registers; these move them to and from one register per component.
+static inline void LoadVector3x4Sse(const Vector3* vectors, __m128& x, __m128& y, __m128& z)
+{
+	const float* v = &vectors[0].X;
+	auto a = _mm_loadu_ps(v);
+	auto b = _mm_loadu_ps(v + 4);
+	auto c = _mm_loadu_ps(v + 8);
+	auto xPairs = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 0));
+	auto yPairs0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+	auto yPairs1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+	auto zPairs = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 1, 3, 2));
+	x = _mm_shuffle_ps(a, xPairs, _MM_SHUFFLE(3, 1, 3, 0));
+	y = _mm_shuffle_ps(yPairs0, yPairs1, _MM_SHUFFLE(2, 0, 2, 0));
+	z = _mm_shuffle_ps(zPairs, c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// Each store spills one float into the next vector, which the following store overwrites.
+static inline void StoreVector3x4Sse(Vector3* vectors, __m128 x, __m128 y, __m128 z)
+{
+	auto w = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+	float* v = &vectors[0].X;
+	_mm_storeu_ps(v, x);
+	_mm_storeu_ps(v + 3, y);
+	_mm_storeu_ps(v + 6, z);
+	_mm_storel_pi((__m64*)(v + 9), w);
+	_mm_store_ss(v + 11, _mm_movehl_ps(w, w));
+}
+
+static void SplitVector3Sse(const Vector3* sourceArray, float* x, float* y, float* z, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 vx, vy, vz;
+		LoadVector3x4Sse(sourceArray + i, vx, vy, vz);
+		_mm_storeu_ps(x + i, vx);
+		_mm_storeu_ps(y + i, vy);
+		_mm_storeu_ps(z + i, vz);
+	}
+	SplitVector3Scalar(sourceArray + i, x + i, y + i, z + i, length - i);
+}
+
+static void JoinVector3Sse(const float* x, const float* y, const float* z, Vector3* destinationArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+		StoreVector3x4Sse(destinationArray + i, _mm_loadu_ps(x + i), _mm_loadu_ps(y + i), _mm_loadu_ps(z + i));
+	JoinVector3Scalar(x + i, y + i, z + i, destinationArray + i, length - i);
+}
+
+// The four vectors are fully loaded before they are stored, so the destination may be the source.
+static void TransformVector3Sse(const Vector3* sourceArray, const Matrix& matrix, Vector3* destinationArray, int length)
+{
+	auto m11 = _mm_set1_ps(matrix.M11), m12 = _mm_set1_ps(matrix.M12), m13 = _mm_set1_ps(matrix.M13);
+	auto m21 = _mm_set1_ps(matrix.M21), m22 = _mm_set1_ps(matrix.M22), m23 = _mm_set1_ps(matrix.M23);
+	auto m31 = _mm_set1_ps(matrix.M31), m32 = _mm_set1_ps(matrix.M32), m33 = _mm_set1_ps(matrix.M33);
+	auto m41 = _mm_set1_ps(matrix.M41), m42 = _mm_set1_ps(matrix.M42), m43 = _mm_set1_ps(matrix.M43);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 vx, vy, vz;
+		LoadVector3x4Sse(sourceArray + i, vx, vy, vz);
+		auto tx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m11), _mm_mul_ps(vy, m21)), _mm_mul_ps(vz, m31)), m41);
+		auto ty = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m12), _mm_mul_ps(vy, m22)), _mm_mul_ps(vz, m32)), m42);
+		auto tz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m13), _mm_mul_ps(vy, m23)), _mm_mul_ps(vz, m33)), m43);
+		StoreVector3x4Sse(destinationArray + i, tx, ty, tz);
+	}
+	TransformVector3Scalar(sourceArray + i, matrix, destinationArray + i, length - i);
+}
+
+static inline void RotateSse(__m128 px, __m128 py, __m128 pz, __m128 qx, __m128 qy, __m128 qz, __m128 qw, __m128& rx, __m128& ry, __m128& rz)
+{
+	auto two = _mm_set1_ps(2.0f);
+	auto x = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qy, pz), _mm_mul_ps(qz, py)));
+	auto y = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qz, px), _mm_mul_ps(qx, pz)));
+	auto z = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qx, py), _mm_mul_ps(qy, px)));
+	rx = _mm_add_ps(_mm_add_ps(px, _mm_mul_ps(x, qw)), _mm_sub_ps(_mm_mul_ps(qy, z), _mm_mul_ps(qz, y)));
+	ry = _mm_add_ps(_mm_add_ps(py, _mm_mul_ps(y, qw)), _mm_sub_ps(_mm_mul_ps(qz, x), _mm_mul_ps(qx, z)));
+	rz = _mm_add_ps(_mm_add_ps(pz, _mm_mul_ps(z, qw)), _mm_sub_ps(_mm_mul_ps(qx, y), _mm_mul_ps(qy, x)));
+}
+
+static void RotateVector3Sse(const Vector3* sourceArray, const Quaternion& rotation, Vector3* destinationArray, int length)
+{
+	auto qx = _mm_set1_ps(rotation.X), qy = _mm_set1_ps(rotation.Y), qz = _mm_set1_ps(rotation.Z), qw = _mm_set1_ps(rotation.W);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 px, py, pz, rx, ry, rz;
+		LoadVector3x4Sse(sourceArray + i, px, py, pz);
+		RotateSse(px, py, pz, qx, qy, qz, qw, rx, ry, rz);
+		StoreVector3x4Sse(destinationArray + i, rx, ry, rz);
+	}
+	RotateVector3Scalar(sourceArray + i, rotation, destinationArray + i, length - i);
+}
+
+// Strided vectors are loaded and stored one at a time with 8 and 4 byte moves, so that nothing
+// outside the vectors themselves is touched, and transposed to and from component registers.
+static inline __m128 LoadVector3Sse(const Vector3* vector)
+{
+	auto xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&vector->X));
+	return _mm_movelh_ps(xy, _mm_load_ss(&vector->Z));
+}
+
+static inline void StoreVector3Sse(Vector3* vector, __m128 value)
+{
+	_mm_storel_pi(reinterpret_cast<__m64*>(&vector->X), value);
+	_mm_store_ss(&vector->Z, _mm_movehl_ps(value, value));
+}
+
+static inline void LoadVector3x4StridedSse(const Vector3* first, int stride, __m128& x, __m128& y, __m128& z)
+{
+	x = LoadVector3Sse(first);
+	y = LoadVector3Sse(StridedElement(first, stride, 1));
+	z = LoadVector3Sse(StridedElement(first, stride, 2));
+	auto w = LoadVector3Sse(StridedElement(first, stride, 3));
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+}
+
+static inline void StoreVector3x4StridedSse(Vector3* first, int stride, __m128 x, __m128 y, __m128 z)
+{
+	auto w = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+	StoreVector3Sse(first, x);
+	StoreVector3Sse(StridedElement(first, stride, 1), y);
+	StoreVector3Sse(StridedElement(first, stride, 2), z);
+	StoreVector3Sse(StridedElement(first, stride, 3), w);
+}
+
+static void TransformVector3StridedSse(const Vector3* sourceArray, int sourceStride, const Matrix& matrix, Vector3* destinationArray, int destinationStride, int length)
+{
+	auto m11 = _mm_set1_ps(matrix.M11), m12 = _mm_set1_ps(matrix.M12), m13 = _mm_set1_ps(matrix.M13);
+	auto m21 = _mm_set1_ps(matrix.M21), m22 = _mm_set1_ps(matrix.M22), m23 = _mm_set1_ps(matrix.M23);
+	auto m31 = _mm_set1_ps(matrix.M31), m32 = _mm_set1_ps(matrix.M32), m33 = _mm_set1_ps(matrix.M33);
+	auto m41 = _mm_set1_ps(matrix.M41), m42 = _mm_set1_ps(matrix.M42), m43 = _mm_set1_ps(matrix.M43);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 vx, vy, vz;
+		LoadVector3x4StridedSse(StridedElement(sourceArray, sourceStride, i), sourceStride, vx, vy, vz);
+		auto tx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m11), _mm_mul_ps(vy, m21)), _mm_mul_ps(vz, m31)), m41);
+		auto ty = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m12), _mm_mul_ps(vy, m22)), _mm_mul_ps(vz, m32)), m42);
+		auto tz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m13), _mm_mul_ps(vy, m23)), _mm_mul_ps(vz, m33)), m43);
+		StoreVector3x4StridedSse(StridedElement(destinationArray, destinationStride, i), destinationStride, tx, ty, tz);
+	}
+	TransformVector3StridedScalar(StridedElement(sourceArray, sourceStride, i), sourceStride, matrix,
+		StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+static void RotateVector3StridedSse(const Vector3* sourceArray, int sourceStride, const Quaternion& rotation, Vector3* destinationArray, int destinationStride, int length)
+{
+	auto qx = _mm_set1_ps(rotation.X), qy = _mm_set1_ps(rotation.Y), qz = _mm_set1_ps(rotation.Z), qw = _mm_set1_ps(rotation.W);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 px, py, pz, rx, ry, rz;
+		LoadVector3x4StridedSse(StridedElement(sourceArray, sourceStride, i), sourceStride, px, py, pz);
+		RotateSse(px, py, pz, qx, qy, qz, qw, rx, ry, rz);
+		StoreVector3x4StridedSse(StridedElement(destinationArray, destinationStride, i), destinationStride, rx, ry, rz);
+	}
+	RotateVector3StridedScalar(StridedElement(sourceArray, sourceStride, i), sourceStride, rotation,
+		StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+// A Vector4 fills a register, so each one is transformed on its own as the sum of the matrix
+// rows scaled by its components, which is the scalar order of operations for every component.
+static inline __m128 TransformVector4Sse(__m128 value, __m128 row1, __m128 row2, __m128 row3, __m128 row4)
+{
+	auto x = _mm_shuffle_ps(value, value, _MM_SHUFFLE(0, 0, 0, 0));
+	auto y = _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1));
+	auto z = _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 2, 2, 2));
+	auto w = _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3));
+	return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, row1), _mm_mul_ps(y, row2)), _mm_mul_ps(z, row3)), _mm_mul_ps(w, row4));
+}
+
+static void TransformVector4Sse(const Vector4* sourceArray, const Matrix& matrix, Vector4* destinationArray, int length)
+{
+	auto row1 = _mm_loadu_ps(&matrix.M11);
+	auto row2 = _mm_loadu_ps(&matrix.M21);
+	auto row3 = _mm_loadu_ps(&matrix.M31);
+	auto row4 = _mm_loadu_ps(&matrix.M41);
+	for (auto i = 0; i < length; i++)
+		_mm_storeu_ps(&destinationArray[i].X, TransformVector4Sse(_mm_loadu_ps(&sourceArray[i].X), row1, row2, row3, row4));
+}
+
+static void TransformVector4StridedSse(const Vector4* sourceArray, int sourceStride, const Matrix& matrix, Vector4* destinationArray, int destinationStride, int length)
+{
+	auto row1 = _mm_loadu_ps(&matrix.M11);
+	auto row2 = _mm_loadu_ps(&matrix.M21);
+	auto row3 = _mm_loadu_ps(&matrix.M31);
+	auto row4 = _mm_loadu_ps(&matrix.M41);
+	for (auto i = 0; i < length; i++)
+	{
+		auto value = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i)->X);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i)->X, TransformVector4Sse(value, row1, row2, row3, row4));
+	}
+}
+
+// Rotation works on four vectors transposed into component registers; W is carried through.
+static inline void RotateVector4x4Sse(__m128& v0, __m128& v1, __m128& v2, __m128& v3, __m128 qx, __m128 qy, __m128 qz, __m128 qw)
+{
+	_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+	__m128 rx, ry, rz;
+	RotateSse(v0, v1, v2, qx, qy, qz, qw, rx, ry, rz);
+	v0 = rx;
+	v1 = ry;
+	v2 = rz;
+	_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+}
+
+static void RotateVector4Sse(const Vector4* sourceArray, const Quaternion& rotation, Vector4* destinationArray, int length)
+{
+	auto qx = _mm_set1_ps(rotation.X), qy = _mm_set1_ps(rotation.Y), qz = _mm_set1_ps(rotation.Z), qw = _mm_set1_ps(rotation.W);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto v0 = _mm_loadu_ps(&sourceArray[i].X);
+		auto v1 = _mm_loadu_ps(&sourceArray[i + 1].X);
+		auto v2 = _mm_loadu_ps(&sourceArray[i + 2].X);
+		auto v3 = _mm_loadu_ps(&sourceArray[i + 3].X);
+		RotateVector4x4Sse(v0, v1, v2, v3, qx, qy, qz, qw);
+		_mm_storeu_ps(&destinationArray[i].X, v0);
+		_mm_storeu_ps(&destinationArray[i + 1].X, v1);
+		_mm_storeu_ps(&destinationArray[i + 2].X, v2);
+		_mm_storeu_ps(&destinationArray[i + 3].X, v3);
+	}
+	RotateVector4Scalar(sourceArray + i, rotation, destinationArray + i, length - i);
+}
+
+static void RotateVector4StridedSse(const Vector4* sourceArray, int sourceStride, const Quaternion& rotation, Vector4* destinationArray, int destinationStride, int length)
+{
+	auto qx = _mm_set1_ps(rotation.X), qy = _mm_set1_ps(rotation.Y), qz = _mm_set1_ps(rotation.Z), qw = _mm_set1_ps(rotation.W);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto v0 = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i)->X);
+		auto v1 = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i + 1)->X);
+		auto v2 = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i + 2)->X);
+		auto v3 = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i + 3)->X);
+		RotateVector4x4Sse(v0, v1, v2, v3, qx, qy, qz, qw);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i)->X, v0);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i + 1)->X, v1);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i + 2)->X, v2);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i + 3)->X, v3);
+	}
+	RotateVector4StridedScalar(StridedElement(sourceArray, sourceStride, i), sourceStride, rotation,
+		StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+// Two Vector2 share a register against the matrix rows repeated in both halves, which keeps the
+// scalar order of operations.
+static inline __m128 TransformVector2x2Sse(__m128 value, __m128 row1, __m128 row2)
+{
+	auto x = _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 2, 0, 0));
+	auto y = _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 1, 1));
+	return _mm_add_ps(_mm_mul_ps(x, row1), _mm_mul_ps(y, row2));
+}
+
+static void TransformVector2Sse(const Vector2* sourceArray, const Matrix3x2& matrix, Vector2* destinationArray, int length)
+{
+	auto row1 = _mm_setr_ps(matrix.M11, matrix.M12, matrix.M11, matrix.M12);
+	auto row2 = _mm_setr_ps(matrix.M21, matrix.M22, matrix.M21, matrix.M22);
+	auto row3 = _mm_setr_ps(matrix.M31, matrix.M32, matrix.M31, matrix.M32);
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+		_mm_storeu_ps(&destinationArray[i].X, _mm_add_ps(TransformVector2x2Sse(_mm_loadu_ps(&sourceArray[i].X), row1, row2), row3));
+	TransformVector2StridedScalar(sourceArray + i, sizeof(Vector2), matrix, destinationArray + i, sizeof(Vector2), length - i);
+}
+
+static void TransformNormalVector2Sse(const Vector2* sourceArray, const Matrix3x2& matrix, Vector2* destinationArray, int length)
+{
+	auto row1 = _mm_setr_ps(matrix.M11, matrix.M12, matrix.M11, matrix.M12);
+	auto row2 = _mm_setr_ps(matrix.M21, matrix.M22, matrix.M21, matrix.M22);
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+		_mm_storeu_ps(&destinationArray[i].X, TransformVector2x2Sse(_mm_loadu_ps(&sourceArray[i].X), row1, row2));
+	TransformNormalVector2StridedScalar(sourceArray + i, sizeof(Vector2), matrix, destinationArray + i, sizeof(Vector2), length - i);
+}
+
+static inline __m128 LoadVector2x2StridedSse(const Vector2* first, int stride)
+{
+	auto low = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&first->X));
+	return _mm_loadh_pi(low, reinterpret_cast<const __m64*>(&StridedElement(first, stride, 1)->X));
+}
+
+static inline void StoreVector2x2StridedSse(Vector2* first, int stride, __m128 value)
+{
+	_mm_storel_pi(reinterpret_cast<__m64*>(&first->X), value);
+	_mm_storeh_pi(reinterpret_cast<__m64*>(&StridedElement(first, stride, 1)->X), value);
+}
+
+static void TransformVector2StridedSse(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length)
+{
+	auto row1 = _mm_setr_ps(matrix.M11, matrix.M12, matrix.M11, matrix.M12);
+	auto row2 = _mm_setr_ps(matrix.M21, matrix.M22, matrix.M21, matrix.M22);
+	auto row3 = _mm_setr_ps(matrix.M31, matrix.M32, matrix.M31, matrix.M32);
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		auto value = LoadVector2x2StridedSse(StridedElement(sourceArray, sourceStride, i), sourceStride);
+		auto result = _mm_add_ps(TransformVector2x2Sse(value, row1, row2), row3);
+		StoreVector2x2StridedSse(StridedElement(destinationArray, destinationStride, i), destinationStride, result);
+	}
+	TransformVector2StridedScalar(StridedElement(sourceArray, sourceStride, i), sourceStride, matrix,
+		StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+static void TransformNormalVector2StridedSse(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length)
+{
+	auto row1 = _mm_setr_ps(matrix.M11, matrix.M12, matrix.M11, matrix.M12);
+	auto row2 = _mm_setr_ps(matrix.M21, matrix.M22, matrix.M21, matrix.M22);
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		auto value = LoadVector2x2StridedSse(StridedElement(sourceArray, sourceStride, i), sourceStride);
+		StoreVector2x2StridedSse(StridedElement(destinationArray, destinationStride, i), destinationStride, TransformVector2x2Sse(value, row1, row2));
+	}
+	TransformNormalVector2StridedScalar(StridedElement(sourceArray, sourceStride, i), sourceStride, matrix,
+		StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+// Reciprocal square roots of squared lengths, with the instructions and the order of
+// operations of the ReciprocalSqrt of each precision policy.
+static inline __m128 ReciprocalSqrtSse(__m128 value, ExactPrecision)
+{
+	return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(value));
+}
+
+static inline __m128 ReciprocalSqrtSse(__m128 value, RefinedPrecision)
+{
+	auto estimate = _mm_rsqrt_ps(value);
+	auto correction = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), value), estimate), estimate);
+	return _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), correction));
+}
+
+static inline __m128 ReciprocalSqrtSse(__m128 value, EstimatePrecision)
+{
+	return _mm_rsqrt_ps(value);
+}
+
+// Four Vector2 are two registers; their X and Y are gathered to compute four factors at once,
+// which are then spread back over the pairs.
+template<typename Precision>
+static void NormalizeVector2Sse(const Vector2* sourceArray, Vector2* destinationArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto a = _mm_loadu_ps(&sourceArray[i].X);
+		auto b = _mm_loadu_ps(&sourceArray[i + 2].X);
+		auto x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		auto y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		auto factor = ReciprocalSqrtSse(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), Precision());
+		_mm_storeu_ps(&destinationArray[i].X, _mm_mul_ps(a, _mm_unpacklo_ps(factor, factor)));
+		_mm_storeu_ps(&destinationArray[i + 2].X, _mm_mul_ps(b, _mm_unpackhi_ps(factor, factor)));
+	}
+	NormalizeVector2Scalar<Precision>(sourceArray + i, destinationArray + i, length - i);
+}
+
+template<typename Precision>
+static void NormalizeVector3Sse(const Vector3* sourceArray, Vector3* destinationArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 x, y, z;
+		LoadVector3x4Sse(sourceArray + i, x, y, z);
+		auto factor = ReciprocalSqrtSse(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), Precision());
+		StoreVector3x4Sse(destinationArray + i, _mm_mul_ps(x, factor), _mm_mul_ps(y, factor), _mm_mul_ps(z, factor));
+	}
+	NormalizeVector3Scalar<Precision>(sourceArray + i, destinationArray + i, length - i);
+}
+
+template<typename Precision>
+static void NormalizeVector4Sse(const Vector4* sourceArray, Vector4* destinationArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto x = _mm_loadu_ps(&sourceArray[i].X);
+		auto y = _mm_loadu_ps(&sourceArray[i + 1].X);
+		auto z = _mm_loadu_ps(&sourceArray[i + 2].X);
+		auto w = _mm_loadu_ps(&sourceArray[i + 3].X);
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		auto lengthSquared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(w, w));
+		auto factor = ReciprocalSqrtSse(lengthSquared, Precision());
+		x = _mm_mul_ps(x, factor);
+		y = _mm_mul_ps(y, factor);
+		z = _mm_mul_ps(z, factor);
+		w = _mm_mul_ps(w, factor);
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_storeu_ps(&destinationArray[i].X, x);
+		_mm_storeu_ps(&destinationArray[i + 1].X, y);
+		_mm_storeu_ps(&destinationArray[i + 2].X, z);
+		_mm_storeu_ps(&destinationArray[i + 3].X, w);
+	}
+	NormalizeVector4Scalar<Precision>(sourceArray + i, destinationArray + i, length - i);
+}
+
+// (a * b) + c with both roundings, as the scalar polynomials of FastTrig are evaluated.
+static inline __m128 MultiplyAddSse(__m128 a, __m128 b, __m128 c)
+{
+	return _mm_add_ps(_mm_mul_ps(a, b), c);
+}
+
+static inline __m128 SelectSse(__m128 mask, __m128 ifTrue, __m128 ifFalse)
+{
+	return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+
+// Replaces the lanes whose angle is beyond FastTrig::MaxAngle, or NaN, by the standard library
+// results, as FastTrig::SinCos does. Such angles are rare, so the lanes are fixed one by one.
+static void SinCosOutOfRange(const float* value, float* sin, float* cos, int mask, int count)
+{
+	for (auto lane = 0; lane < count; lane++)
+	{
+		if (mask & (1 << lane))
+		{
+			sin[lane] = std::sin(value[lane]);
+			cos[lane] = std::cos(value[lane]);
+		}
+	}
+}
+
+// FastTrig::SinCos on four angles. The quadrant picks and negates the polynomials through
+// masks, which selects the same values as the scalar branches.
+static inline void SinCosSse(__m128 value, __m128& sin, __m128& cos)
+{
+	auto bias = _mm_set1_ps(FastTrig::RoundingBias);
+	auto biased = _mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(FastTrig::TwoOverPi)), bias);
+	auto quadrant = _mm_sub_ps(biased, bias);
+	auto x = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(value, _mm_mul_ps(quadrant, _mm_set1_ps(FastTrig::PiOver2A))),
+		_mm_mul_ps(quadrant, _mm_set1_ps(FastTrig::PiOver2B))), _mm_mul_ps(quadrant, _mm_set1_ps(FastTrig::PiOver2C)));
+	auto z = _mm_mul_ps(x, x);
+	auto sinX = MultiplyAddSse(MultiplyAddSse(_mm_set1_ps(FastTrig::Sin3), z, _mm_set1_ps(FastTrig::Sin2)), z, _mm_set1_ps(FastTrig::Sin1));
+	sinX = MultiplyAddSse(_mm_mul_ps(sinX, z), x, x);
+	auto cosX = MultiplyAddSse(MultiplyAddSse(_mm_set1_ps(FastTrig::Cos3), z, _mm_set1_ps(FastTrig::Cos2)), z, _mm_set1_ps(FastTrig::Cos1));
+	cosX = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(cosX, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_set1_ps(1.0f));
+
+	auto index = _mm_castps_si128(biased);
+	auto one = _mm_set1_epi32(1), two = _mm_set1_epi32(2);
+	auto swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(index, one), one));
+	sin = _mm_xor_ps(SelectSse(swap, cosX, sinX), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(index, two), 30)));
+	cos = _mm_xor_ps(SelectSse(swap, sinX, cosX), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(index, one), two), 30)));
+
+	auto outOfRange = _mm_movemask_ps(_mm_cmpnle_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), value), _mm_set1_ps(FastTrig::MaxAngle)));
+	if (outOfRange != 0)
+	{
+		alignas(16) float values[4], sins[4], coss[4];
+		_mm_store_ps(values, value);
+		_mm_store_ps(sins, sin);
+		_mm_store_ps(coss, cos);
+		SinCosOutOfRange(values, sins, coss, outOfRange, 4);
+		sin = _mm_load_ps(sins);
+		cos = _mm_load_ps(coss);
+	}
+}
+
+// FastTrig::Acos on four values.
+static inline __m128 AcosSse(__m128 value)
+{
+	auto x = _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+	auto polynomial = MultiplyAddSse(_mm_set1_ps(FastTrig::Acos7), x, _mm_set1_ps(FastTrig::Acos6));
+	polynomial = MultiplyAddSse(polynomial, x, _mm_set1_ps(FastTrig::Acos5));
+	polynomial = MultiplyAddSse(polynomial, x, _mm_set1_ps(FastTrig::Acos4));
+	polynomial = MultiplyAddSse(polynomial, x, _mm_set1_ps(FastTrig::Acos3));
+	polynomial = MultiplyAddSse(polynomial, x, _mm_set1_ps(FastTrig::Acos2));
+	polynomial = MultiplyAddSse(polynomial, x, _mm_set1_ps(FastTrig::Acos1));
+	polynomial = MultiplyAddSse(polynomial, x, _mm_set1_ps(FastTrig::Acos0));
+	auto result = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), x)), polynomial);
+	return SelectSse(_mm_cmplt_ps(value, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(MathHelper::Pi), result), result);
+}
+
+static void SinCosFastSse(const float* angleArray, float* sinArray, float* cosArray, int length)
+{
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 sin, cos;
+		SinCosSse(_mm_loadu_ps(angleArray + i), sin, cos);
+		_mm_storeu_ps(sinArray + i, sin);
+		_mm_storeu_ps(cosArray + i, cos);
+	}
+	SinCosScalar<FastTrig>(angleArray + i, sinArray + i, cosArray + i, length - i);
+}
+
+// Both branches of Quaternion::Slerp are computed for four pairs of quaternions transposed into
+// component registers, and the weights of each pair are selected from them.
+static void SlerpFastSse(const Quaternion* quaternion1Array, const Quaternion* quaternion2Array, const float* amountArray, Quaternion* resultArray, int length)
+{
+	auto one = _mm_set1_ps(1.0f);
+	auto sign = _mm_set1_ps(-0.0f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto x1 = _mm_loadu_ps(&quaternion1Array[i].X), y1 = _mm_loadu_ps(&quaternion1Array[i + 1].X);
+		auto z1 = _mm_loadu_ps(&quaternion1Array[i + 2].X), w1 = _mm_loadu_ps(&quaternion1Array[i + 3].X);
+		auto x2 = _mm_loadu_ps(&quaternion2Array[i].X), y2 = _mm_loadu_ps(&quaternion2Array[i + 1].X);
+		auto z2 = _mm_loadu_ps(&quaternion2Array[i + 2].X), w2 = _mm_loadu_ps(&quaternion2Array[i + 3].X);
+		_MM_TRANSPOSE4_PS(x1, y1, z1, w1);
+		_MM_TRANSPOSE4_PS(x2, y2, z2, w2);
+		auto amount = _mm_loadu_ps(amountArray + i);
+
+		auto dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x1, x2), _mm_mul_ps(y1, y2)), _mm_mul_ps(z1, z2)), _mm_mul_ps(w1, w2));
+		auto flip = _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), sign);
+		dot = _mm_xor_ps(dot, flip);
+		auto close = _mm_cmpgt_ps(dot, _mm_set1_ps(0.999999f));
+
+		__m128 sinAngle, cosAngle, sinAmountAngle, cosAmountAngle;
+		auto angle = AcosSse(dot);
+		SinCosSse(angle, sinAngle, cosAngle);
+		SinCosSse(_mm_mul_ps(amount, angle), sinAmountAngle, cosAmountAngle);
+		auto inverseSinAngle = _mm_div_ps(one, sinAngle);
+		auto weight1 = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(sinAngle, cosAmountAngle), _mm_mul_ps(cosAngle, sinAmountAngle)), inverseSinAngle);
+		auto weight2 = _mm_mul_ps(sinAmountAngle, inverseSinAngle);
+		weight1 = SelectSse(close, _mm_sub_ps(one, amount), weight1);
+		weight2 = _mm_xor_ps(SelectSse(close, amount, weight2), flip);
+
+		auto x = _mm_add_ps(_mm_mul_ps(weight1, x1), _mm_mul_ps(weight2, x2));
+		auto y = _mm_add_ps(_mm_mul_ps(weight1, y1), _mm_mul_ps(weight2, y2));
+		auto z = _mm_add_ps(_mm_mul_ps(weight1, z1), _mm_mul_ps(weight2, z2));
+		auto w = _mm_add_ps(_mm_mul_ps(weight1, w1), _mm_mul_ps(weight2, w2));
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_storeu_ps(&resultArray[i].X, x);
+		_mm_storeu_ps(&resultArray[i + 1].X, y);
+		_mm_storeu_ps(&resultArray[i + 2].X, z);
+		_mm_storeu_ps(&resultArray[i + 3].X, w);
+	}
+	SlerpScalar<FastTrig>(quaternion1Array + i, quaternion2Array + i, amountArray + i, resultArray + i, length - i);
+}
+
+static void CreateFromYawPitchRollFastSse(const float* yawArray, const float* pitchArray, const float* rollArray, Quaternion* resultArray, int length)
+{
+	auto half = _mm_set1_ps(0.5f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 sinRoll, cosRoll, sinPitch, cosPitch, sinYaw, cosYaw;
+		SinCosSse(_mm_mul_ps(_mm_loadu_ps(rollArray + i), half), sinRoll, cosRoll);
+		SinCosSse(_mm_mul_ps(_mm_loadu_ps(pitchArray + i), half), sinPitch, cosPitch);
+		SinCosSse(_mm_mul_ps(_mm_loadu_ps(yawArray + i), half), sinYaw, cosYaw);
+
+		auto x = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(cosYaw, sinPitch), cosRoll), _mm_mul_ps(_mm_mul_ps(sinYaw, cosPitch), sinRoll));
+		auto y = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(sinYaw, cosPitch), cosRoll), _mm_mul_ps(_mm_mul_ps(cosYaw, sinPitch), sinRoll));
+		auto z = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(cosYaw, cosPitch), sinRoll), _mm_mul_ps(_mm_mul_ps(sinYaw, sinPitch), cosRoll));
+		auto w = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(cosYaw, cosPitch), cosRoll), _mm_mul_ps(_mm_mul_ps(sinYaw, sinPitch), sinRoll));
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_storeu_ps(&resultArray[i].X, x);
+		_mm_storeu_ps(&resultArray[i + 1].X, y);
+		_mm_storeu_ps(&resultArray[i + 2].X, z);
+		_mm_storeu_ps(&resultArray[i + 3].X, w);
+	}
+	CreateFromYawPitchRollScalar<FastTrig>(yawArray + i, pitchArray + i, rollArray + i, resultArray + i, length - i);
+}
+
+// Packed formats. Lanes of 16-bit values are kept in 32-bit lanes for the conversions; the
+// shifts by 16 keep their low half, sign-extended, so that the saturating pack below is exact.
+static inline __m128i PackShortsSse(__m128i value)
+{
+	value = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+	return _mm_packs_epi32(value, value);
+}
+
+static inline __m128i SelectSse(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+{
+	return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+// Three 16-bit values are moved as 4 and 2 bytes, so that nothing past the element is touched.
+static inline __m128i LoadShort3Sse(const void* element)
+{
+	int xy;
+	unsigned short z;
+	std::memcpy(&xy, element, sizeof(xy));
+	std::memcpy(&z, static_cast<const char*>(element) + 4, sizeof(z));
+	return _mm_insert_epi16(_mm_cvtsi32_si128(xy), z, 2);
+}
+
+static inline void StoreShort3Sse(void* element, __m128i value)
+{
+	int xy = _mm_cvtsi128_si32(value);
+	auto z = static_cast<unsigned short>(_mm_extract_epi16(value, 2));
+	std::memcpy(element, &xy, sizeof(xy));
+	std::memcpy(static_cast<char*>(element) + 4, &z, sizeof(z));
+}
+
+static inline __m128i LoadShort4Sse(const void* element)
+{
+	return _mm_loadl_epi64(static_cast<const __m128i*>(element));
+}
+
+static inline void StoreShort4Sse(void* element, __m128i value)
+{
+	_mm_storel_epi64(static_cast<__m128i*>(element), value);
+}
+
+// HalfHelper::Pack on four lanes, giving the halves in the low bits of 32-bit lanes.
+static inline __m128i PackHalfSse(__m128 value)
+{
+	auto bits = _mm_castps_si128(value);
+	auto sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+	auto magnitude = _mm_xor_si128(bits, sign);
+
+	auto payload = _mm_and_si128(_mm_srli_epi32(magnitude, 13), _mm_set1_epi32(0x3FF));
+	auto isNaN = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7F800000));
+	auto special = _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(isNaN, _mm_or_si128(_mm_set1_epi32(0x200), payload)));
+	auto subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(magnitude), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3F000000));
+	auto odd = _mm_and_si128(_mm_srli_epi32(magnitude, 13), _mm_set1_epi32(1));
+	auto normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(magnitude, _mm_set1_epi32(static_cast<int>(0xC8000FFFu))), odd), 13);
+
+	auto result = SelectSse(_mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x38800000)), subnormal, normal);
+	result = SelectSse(_mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x477FFFFF)), special, result);
+	return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+}
+
+// HalfHelper::Unpack on four lanes holding halves in their low bits.
+static inline __m128 UnpackHalfSse(__m128i value)
+{
+	auto bits = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x7FFF)), 13);
+	auto exponent = _mm_and_si128(bits, _mm_set1_epi32(0x0F800000));
+	bits = _mm_add_epi32(bits, _mm_set1_epi32(0x38000000));
+
+	auto special = _mm_add_epi32(bits, _mm_set1_epi32(0x38000000));
+	auto isNaN = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(special, _mm_set1_epi32(0x007FFFFF)), _mm_setzero_si128()), _mm_set1_epi32(0x00400000));
+	special = _mm_or_si128(special, isNaN);
+	auto subnormal = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(0x00800000))), _mm_set1_ps(6.103515625e-05f)));
+
+	bits = SelectSse(_mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x0F800000)), special, bits);
+	bits = SelectSse(_mm_cmpeq_epi32(exponent, _mm_setzero_si128()), subnormal, bits);
+	return _mm_castsi128_ps(_mm_or_si128(bits, _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x8000)), 16)));
+}
+
+// MathHelper::Clamp, then the rounding of std::lrint in the default rounding mode.
+static inline __m128i PackSnormSse(__m128 value, __m128 scale)
+{
+	value = _mm_max_ps(_mm_set1_ps(-1.0f), _mm_min_ps(_mm_set1_ps(1.0f), value));
+	return _mm_cvtps_epi32(_mm_mul_ps(value, scale));
+}
+
+static inline __m128 UnpackSnormSse(__m128i value, __m128 scale)
+{
+	return _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(value), scale), _mm_set1_ps(-1.0f));
+}
+
+static void PackHalf3Sse(const Vector3* sourceArray, int sourceStride, Half3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		StoreShort3Sse(StridedElement(destinationArray, destinationStride, i), PackShortsSse(PackHalfSse(LoadVector3Sse(StridedElement(sourceArray, sourceStride, i)))));
+}
+
+static void PackHalf4Sse(const Vector4* sourceArray, int sourceStride, Half4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		StoreShort4Sse(StridedElement(destinationArray, destinationStride, i), PackShortsSse(PackHalfSse(_mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i)->X))));
+}
+
+static void UnpackHalf3Sse(const Half3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		StoreVector3Sse(StridedElement(destinationArray, destinationStride, i), UnpackHalfSse(_mm_unpacklo_epi16(LoadShort3Sse(StridedElement(sourceArray, sourceStride, i)), _mm_setzero_si128())));
+}
+
+static void UnpackHalf4Sse(const Half4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i)->X, UnpackHalfSse(_mm_unpacklo_epi16(LoadShort4Sse(StridedElement(sourceArray, sourceStride, i)), _mm_setzero_si128())));
+}
+
+static void PackSnorm16x3Sse(const Vector3* sourceArray, int sourceStride, Snorm16x3* destinationArray, int destinationStride, int length)
+{
+	auto scale = _mm_set1_ps(32767.0f);
+	for (auto i = 0; i < length; i++)
+		StoreShort3Sse(StridedElement(destinationArray, destinationStride, i), PackShortsSse(PackSnormSse(LoadVector3Sse(StridedElement(sourceArray, sourceStride, i)), scale)));
+}
+
+static void PackSnorm16x4Sse(const Vector4* sourceArray, int sourceStride, Snorm16x4* destinationArray, int destinationStride, int length)
+{
+	auto scale = _mm_set1_ps(32767.0f);
+	for (auto i = 0; i < length; i++)
+		StoreShort4Sse(StridedElement(destinationArray, destinationStride, i), PackShortsSse(PackSnormSse(_mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i)->X), scale)));
+}
+
+// Interleaving a register with itself and shifting back sign-extends the 16-bit values.
+static void UnpackSnorm16x3Sse(const Snorm16x3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	auto scale = _mm_set1_ps(32767.0f);
+	for (auto i = 0; i < length; i++)
+	{
+		auto value = LoadShort3Sse(StridedElement(sourceArray, sourceStride, i));
+		StoreVector3Sse(StridedElement(destinationArray, destinationStride, i), UnpackSnormSse(_mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16), scale));
+	}
+}
+
+static void UnpackSnorm16x4Sse(const Snorm16x4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	auto scale = _mm_set1_ps(32767.0f);
+	for (auto i = 0; i < length; i++)
+	{
+		auto value = LoadShort4Sse(StridedElement(sourceArray, sourceStride, i));
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i)->X, UnpackSnormSse(_mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16), scale));
+	}
+}
+
+// The 4-byte formats go four at a time through component registers, one 32-bit lane per element.
+static inline __m128i LoadPacked32x4Sse(const void* first, int stride)
+{
+	int values[4];
+	for (auto i = 0; i < 4; i++)
+		std::memcpy(&values[i], StridedElement(static_cast<const char*>(first), stride, i), sizeof(int));
+	return _mm_setr_epi32(values[0], values[1], values[2], values[3]);
+}
+
+static inline void StorePacked32x4Sse(void* first, int stride, __m128i value)
+{
+	for (auto i = 0; i < 4; i++)
+	{
+		int element = _mm_cvtsi128_si32(value);
+		std::memcpy(StridedElement(static_cast<char*>(first), stride, i), &element, sizeof(element));
+		value = _mm_srli_si128(value, 4);
+	}
+}
+
+static void PackOctahedral16Sse(const Vector3* sourceArray, int sourceStride, Octahedral16* destinationArray, int destinationStride, int length)
+{
+	auto one = _mm_set1_ps(1.0f);
+	auto minusOne = _mm_set1_ps(-1.0f);
+	auto zero = _mm_setzero_ps();
+	auto sign = _mm_set1_ps(-0.0f);
+	auto scale = _mm_set1_ps(32767.0f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128 x, y, z;
+		LoadVector3x4StridedSse(StridedElement(sourceArray, sourceStride, i), sourceStride, x, y, z);
+		auto inverseNorm = _mm_div_ps(one, _mm_add_ps(_mm_add_ps(_mm_andnot_ps(sign, x), _mm_andnot_ps(sign, y)), _mm_andnot_ps(sign, z)));
+		auto u = _mm_mul_ps(x, inverseNorm);
+		auto v = _mm_mul_ps(y, inverseNorm);
+		auto foldedU = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(sign, v)), SelectSse(_mm_cmpge_ps(u, zero), one, minusOne));
+		auto foldedV = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(sign, u)), SelectSse(_mm_cmpge_ps(v, zero), one, minusOne));
+		auto lower = _mm_cmplt_ps(z, zero);
+		auto packedU = PackSnormSse(SelectSse(lower, foldedU, u), scale);
+		auto packedV = PackSnormSse(SelectSse(lower, foldedV, v), scale);
+		StorePacked32x4Sse(StridedElement(destinationArray, destinationStride, i), destinationStride,
+			_mm_or_si128(_mm_and_si128(packedU, _mm_set1_epi32(0xFFFF)), _mm_slli_epi32(packedV, 16)));
+	}
+	PackOctahedral16Scalar(StridedElement(sourceArray, sourceStride, i), sourceStride, StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+static void UnpackOctahedral16Sse(const Octahedral16* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	auto one = _mm_set1_ps(1.0f);
+	auto zero = _mm_setzero_ps();
+	auto sign = _mm_set1_ps(-0.0f);
+	auto scale = _mm_set1_ps(32767.0f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto packed = LoadPacked32x4Sse(StridedElement(sourceArray, sourceStride, i), sourceStride);
+		auto u = UnpackSnormSse(_mm_srai_epi32(_mm_slli_epi32(packed, 16), 16), scale);
+		auto v = UnpackSnormSse(_mm_srai_epi32(packed, 16), scale);
+		auto z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(sign, u)), _mm_andnot_ps(sign, v));
+		auto fold = _mm_max_ps(_mm_xor_ps(z, sign), zero);
+		u = SelectSse(_mm_cmpge_ps(u, zero), _mm_sub_ps(u, fold), _mm_add_ps(u, fold));
+		v = SelectSse(_mm_cmpge_ps(v, zero), _mm_sub_ps(v, fold), _mm_add_ps(v, fold));
+
+		auto factor = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(u, u), _mm_mul_ps(v, v)), _mm_mul_ps(z, z))));
+		StoreVector3x4StridedSse(StridedElement(destinationArray, destinationStride, i), destinationStride,
+			_mm_mul_ps(u, factor), _mm_mul_ps(v, factor), _mm_mul_ps(z, factor));
+	}
+	UnpackOctahedral16Scalar(StridedElement(sourceArray, sourceStride, i), sourceStride, StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+static void PackSnorm1010102Sse(const Vector4* sourceArray, int sourceStride, Snorm1010102* destinationArray, int destinationStride, int length)
+{
+	auto scale = _mm_set1_ps(511.0f);
+	auto mask = _mm_set1_epi32(0x3FF);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto x = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i)->X);
+		auto y = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i + 1)->X);
+		auto z = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i + 2)->X);
+		auto w = _mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i + 3)->X);
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		auto packed = _mm_or_si128(
+			_mm_or_si128(_mm_and_si128(PackSnormSse(x, scale), mask), _mm_slli_epi32(_mm_and_si128(PackSnormSse(y, scale), mask), 10)),
+			_mm_or_si128(_mm_slli_epi32(_mm_and_si128(PackSnormSse(z, scale), mask), 20), _mm_slli_epi32(PackSnormSse(w, _mm_set1_ps(1.0f)), 30)));
+		StorePacked32x4Sse(StridedElement(destinationArray, destinationStride, i), destinationStride, packed);
+	}
+	PackSnorm1010102Scalar(StridedElement(sourceArray, sourceStride, i), sourceStride, StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+static void UnpackSnorm1010102Sse(const Snorm1010102* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	auto scale = _mm_set1_ps(511.0f);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto packed = LoadPacked32x4Sse(StridedElement(sourceArray, sourceStride, i), sourceStride);
+		auto x = UnpackSnormSse(_mm_srai_epi32(_mm_slli_epi32(packed, 22), 22), scale);
+		auto y = UnpackSnormSse(_mm_srai_epi32(_mm_slli_epi32(packed, 12), 22), scale);
+		auto z = UnpackSnormSse(_mm_srai_epi32(_mm_slli_epi32(packed, 2), 22), scale);
+		auto w = UnpackSnormSse(_mm_srai_epi32(packed, 30), _mm_set1_ps(1.0f));
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i)->X, x);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i + 1)->X, y);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i + 2)->X, z);
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i + 3)->X, w);
+	}
+	UnpackSnorm1010102Scalar(StridedElement(sourceArray, sourceStride, i), sourceStride, StridedElement(destinationArray, destinationStride, i), destinationStride, length - i);
+}
+
+// The AVX kernels handle eight elements per iteration and leave the rest to the SSE kernels.
+
+PLUSGAME_TARGET_AVX
+static void AddArrayAvx(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+		_mm256_storeu_ps(resultArray + i, _mm256_add_ps(_mm256_loadu_ps(value1Array + i), _mm256_loadu_ps(value2Array + i)));
+	AddArraySse(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void SubtractArrayAvx(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+		_mm256_storeu_ps(resultArray + i, _mm256_sub_ps(_mm256_loadu_ps(value1Array + i), _mm256_loadu_ps(value2Array + i)));
+	SubtractArraySse(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void MultiplyArrayAvx(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+		_mm256_storeu_ps(resultArray + i, _mm256_mul_ps(_mm256_loadu_ps(value1Array + i), _mm256_loadu_ps(value2Array + i)));
+	MultiplyArraySse(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void ScaleArrayAvx(const float* value1Array, float scaleFactor, float* resultArray, int length)
+{
+	auto factor = _mm256_set1_ps(scaleFactor);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+		_mm256_storeu_ps(resultArray + i, _mm256_mul_ps(_mm256_loadu_ps(value1Array + i), factor));
+	ScaleArraySse(value1Array + i, scaleFactor, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void LerpArrayAvx(const float* value1Array, const float* value2Array, float amount, float* resultArray, int length)
+{
+	auto t = _mm256_set1_ps(amount);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto from = _mm256_loadu_ps(value1Array + i);
+		_mm256_storeu_ps(resultArray + i, _mm256_add_ps(from, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(value2Array + i), from), t)));
+	}
+	LerpArraySse(value1Array + i, value2Array + i, amount, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void MinArrayAvx(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+		_mm256_storeu_ps(resultArray + i, _mm256_min_ps(_mm256_loadu_ps(value1Array + i), _mm256_loadu_ps(value2Array + i)));
+	MinArraySse(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void MaxArrayAvx(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+		_mm256_storeu_ps(resultArray + i, _mm256_max_ps(_mm256_loadu_ps(value1Array + i), _mm256_loadu_ps(value2Array + i)));
+	MaxArraySse(value1Array + i, value2Array + i, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void DotSoAAvx(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2, float* resultArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto xx = _mm256_mul_ps(_mm256_loadu_ps(x1 + i), _mm256_loadu_ps(x2 + i));
+		auto yy = _mm256_mul_ps(_mm256_loadu_ps(y1 + i), _mm256_loadu_ps(y2 + i));
+		auto zz = _mm256_mul_ps(_mm256_loadu_ps(z1 + i), _mm256_loadu_ps(z2 + i));
+		_mm256_storeu_ps(resultArray + i, _mm256_add_ps(_mm256_add_ps(xx, yy), zz));
+	}
+	DotSoASse(x1 + i, y1 + i, z1 + i, x2 + i, y2 + i, z2 + i, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void CrossSoAAvx(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2,
+	float* resultX, float* resultY, float* resultZ, int length)
+{
+	auto sign = _mm256_set1_ps(-0.0f);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto ax = _mm256_loadu_ps(x1 + i), ay = _mm256_loadu_ps(y1 + i), az = _mm256_loadu_ps(z1 + i);
+		auto bx = _mm256_loadu_ps(x2 + i), by = _mm256_loadu_ps(y2 + i), bz = _mm256_loadu_ps(z2 + i);
+		auto x = _mm256_sub_ps(_mm256_mul_ps(ay, bz), _mm256_mul_ps(by, az));
+		auto y = _mm256_xor_ps(_mm256_sub_ps(_mm256_mul_ps(ax, bz), _mm256_mul_ps(bx, az)), sign);
+		auto z = _mm256_sub_ps(_mm256_mul_ps(ax, by), _mm256_mul_ps(bx, ay));
+		_mm256_storeu_ps(resultX + i, x);
+		_mm256_storeu_ps(resultY + i, y);
+		_mm256_storeu_ps(resultZ + i, z);
+	}
+	CrossSoASse(x1 + i, y1 + i, z1 + i, x2 + i, y2 + i, z2 + i, resultX + i, resultY + i, resultZ + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void NormalizeSoAAvx(const float* x, const float* y, const float* z, float* resultX, float* resultY, float* resultZ, int length)
+{
+	auto one = _mm256_set1_ps(1.0f);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+		auto lengthSquared = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)), _mm256_mul_ps(vz, vz));
+		auto factor = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared));
+		_mm256_storeu_ps(resultX + i, _mm256_mul_ps(vx, factor));
+		_mm256_storeu_ps(resultY + i, _mm256_mul_ps(vy, factor));
+		_mm256_storeu_ps(resultZ + i, _mm256_mul_ps(vz, factor));
+	}
+	NormalizeSoASse(x + i, y + i, z + i, resultX + i, resultY + i, resultZ + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void TransformSoAAvx(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length)
+{
+	auto m11 = _mm256_set1_ps(matrix.M11), m12 = _mm256_set1_ps(matrix.M12), m13 = _mm256_set1_ps(matrix.M13);
+	auto m21 = _mm256_set1_ps(matrix.M21), m22 = _mm256_set1_ps(matrix.M22), m23 = _mm256_set1_ps(matrix.M23);
+	auto m31 = _mm256_set1_ps(matrix.M31), m32 = _mm256_set1_ps(matrix.M32), m33 = _mm256_set1_ps(matrix.M33);
+	auto m41 = _mm256_set1_ps(matrix.M41), m42 = _mm256_set1_ps(matrix.M42), m43 = _mm256_set1_ps(matrix.M43);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+		auto tx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m11), _mm256_mul_ps(vy, m21)), _mm256_mul_ps(vz, m31)), m41);
+		auto ty = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m12), _mm256_mul_ps(vy, m22)), _mm256_mul_ps(vz, m32)), m42);
+		auto tz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m13), _mm256_mul_ps(vy, m23)), _mm256_mul_ps(vz, m33)), m43);
+		_mm256_storeu_ps(resultX + i, tx);
+		_mm256_storeu_ps(resultY + i, ty);
+		_mm256_storeu_ps(resultZ + i, tz);
+	}
+	TransformSoASse(x + i, y + i, z + i, matrix, resultX + i, resultY + i, resultZ + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void TransformNormalSoAAvx(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length)
+{
+	auto m11 = _mm256_set1_ps(matrix.M11), m12 = _mm256_set1_ps(matrix.M12), m13 = _mm256_set1_ps(matrix.M13);
+	auto m21 = _mm256_set1_ps(matrix.M21), m22 = _mm256_set1_ps(matrix.M22), m23 = _mm256_set1_ps(matrix.M23);
+	auto m31 = _mm256_set1_ps(matrix.M31), m32 = _mm256_set1_ps(matrix.M32), m33 = _mm256_set1_ps(matrix.M33);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+		auto tx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m11), _mm256_mul_ps(vy, m21)), _mm256_mul_ps(vz, m31));
+		auto ty = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m12), _mm256_mul_ps(vy, m22)), _mm256_mul_ps(vz, m32));
+		auto tz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m13), _mm256_mul_ps(vy, m23)), _mm256_mul_ps(vz, m33));
+		_mm256_storeu_ps(resultX + i, tx);
+		_mm256_storeu_ps(resultY + i, ty);
+		_mm256_storeu_ps(resultZ + i, tz);
+	}
+	TransformNormalSoASse(x + i, y + i, z + i, matrix, resultX + i, resultY + i, resultZ + i, length - i);
+}
+
+// Eight Vector3 are deinterleaved as two groups of four and joined into 256-bit registers;
+// the arithmetic then runs at full width.
+PLUSGAME_TARGET_AVX
+static inline void LoadVector3x8Avx(const Vector3* vectors, __m256& x, __m256& y, __m256& z)
+{
+	__m128 x0, y0, z0, x1, y1, z1;
+	LoadVector3x4Sse(vectors, x0, y0, z0);
+	LoadVector3x4Sse(vectors + 4, x1, y1, z1);
+	x = _mm256_insertf128_ps(_mm256_castps128_ps256(x0), x1, 1);
+	y = _mm256_insertf128_ps(_mm256_castps128_ps256(y0), y1, 1);
+	z = _mm256_insertf128_ps(_mm256_castps128_ps256(z0), z1, 1);
+}
+
+PLUSGAME_TARGET_AVX
+static inline void StoreVector3x8Avx(Vector3* vectors, __m256 x, __m256 y, __m256 z)
+{
+	StoreVector3x4Sse(vectors, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+	StoreVector3x4Sse(vectors + 4, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+}
+
+PLUSGAME_TARGET_AVX
+static void TransformVector3Avx(const Vector3* sourceArray, const Matrix& matrix, Vector3* destinationArray, int length)
+{
+	auto m11 = _mm256_set1_ps(matrix.M11), m12 = _mm256_set1_ps(matrix.M12), m13 = _mm256_set1_ps(matrix.M13);
+	auto m21 = _mm256_set1_ps(matrix.M21), m22 = _mm256_set1_ps(matrix.M22), m23 = _mm256_set1_ps(matrix.M23);
+	auto m31 = _mm256_set1_ps(matrix.M31), m32 = _mm256_set1_ps(matrix.M32), m33 = _mm256_set1_ps(matrix.M33);
+	auto m41 = _mm256_set1_ps(matrix.M41), m42 = _mm256_set1_ps(matrix.M42), m43 = _mm256_set1_ps(matrix.M43);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		__m256 vx, vy, vz;
+		LoadVector3x8Avx(sourceArray + i, vx, vy, vz);
+		auto tx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m11), _mm256_mul_ps(vy, m21)), _mm256_mul_ps(vz, m31)), m41);
+		auto ty = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m12), _mm256_mul_ps(vy, m22)), _mm256_mul_ps(vz, m32)), m42);
+		auto tz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m13), _mm256_mul_ps(vy, m23)), _mm256_mul_ps(vz, m33)), m43);
+		StoreVector3x8Avx(destinationArray + i, tx, ty, tz);
+	}
+	TransformVector3Sse(sourceArray + i, matrix, destinationArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void RotateVector3Avx(const Vector3* sourceArray, const Quaternion& rotation, Vector3* destinationArray, int length)
+{
+	auto qx = _mm256_set1_ps(rotation.X), qy = _mm256_set1_ps(rotation.Y), qz = _mm256_set1_ps(rotation.Z), qw = _mm256_set1_ps(rotation.W);
+	auto two = _mm256_set1_ps(2.0f);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		__m256 px, py, pz;
+		LoadVector3x8Avx(sourceArray + i, px, py, pz);
+		auto x = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qy, pz), _mm256_mul_ps(qz, py)));
+		auto y = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qz, px), _mm256_mul_ps(qx, pz)));
+		auto z = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qx, py), _mm256_mul_ps(qy, px)));
+		auto rx = _mm256_add_ps(_mm256_add_ps(px, _mm256_mul_ps(x, qw)), _mm256_sub_ps(_mm256_mul_ps(qy, z), _mm256_mul_ps(qz, y)));
+		auto ry = _mm256_add_ps(_mm256_add_ps(py, _mm256_mul_ps(y, qw)), _mm256_sub_ps(_mm256_mul_ps(qz, x), _mm256_mul_ps(qx, z)));
+		auto rz = _mm256_add_ps(_mm256_add_ps(pz, _mm256_mul_ps(z, qw)), _mm256_sub_ps(_mm256_mul_ps(qx, y), _mm256_mul_ps(qy, x)));
+		StoreVector3x8Avx(destinationArray + i, rx, ry, rz);
+	}
+	RotateVector3Sse(sourceArray + i, rotation, destinationArray + i, length - i);
+}
+
+// Two Vector4 per register, each in its own 128-bit lane, against the matrix rows repeated in both lanes.
+PLUSGAME_TARGET_AVX
+static void TransformVector4Avx(const Vector4* sourceArray, const Matrix& matrix, Vector4* destinationArray, int length)
+{
+	auto row1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.M11));
+	auto row2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.M21));
+	auto row3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.M31));
+	auto row4 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix.M41));
+	auto i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		auto value = _mm256_loadu_ps(&sourceArray[i].X);
+		auto x = _mm256_permute_ps(value, _MM_SHUFFLE(0, 0, 0, 0));
+		auto y = _mm256_permute_ps(value, _MM_SHUFFLE(1, 1, 1, 1));
+		auto z = _mm256_permute_ps(value, _MM_SHUFFLE(2, 2, 2, 2));
+		auto w = _mm256_permute_ps(value, _MM_SHUFFLE(3, 3, 3, 3));
+		auto result = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, row1), _mm256_mul_ps(y, row2)), _mm256_mul_ps(z, row3)), _mm256_mul_ps(w, row4));
+		_mm256_storeu_ps(&destinationArray[i].X, result);
+	}
+	TransformVector4Sse(sourceArray + i, matrix, destinationArray + i, length - i);
+}
+
+// Vectors i and i + 4 share a register, one per lane, so that the in-lane transpose of
+// _MM_TRANSPOSE4_PS yields the components of all eight.
+PLUSGAME_TARGET_AVX
+static inline void TransposeVector4x8Avx(__m256& v0, __m256& v1, __m256& v2, __m256& v3)
+{
+	auto t0 = _mm256_unpacklo_ps(v0, v1);
+	auto t1 = _mm256_unpacklo_ps(v2, v3);
+	auto t2 = _mm256_unpackhi_ps(v0, v1);
+	auto t3 = _mm256_unpackhi_ps(v2, v3);
+	v0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	v1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	v2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	v3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+PLUSGAME_TARGET_AVX
+static void RotateVector4Avx(const Vector4* sourceArray, const Quaternion& rotation, Vector4* destinationArray, int length)
+{
+	auto qx = _mm256_set1_ps(rotation.X), qy = _mm256_set1_ps(rotation.Y), qz = _mm256_set1_ps(rotation.Z), qw = _mm256_set1_ps(rotation.W);
+	auto two = _mm256_set1_ps(2.0f);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto a = _mm256_loadu_ps(&sourceArray[i].X);
+		auto b = _mm256_loadu_ps(&sourceArray[i + 2].X);
+		auto c = _mm256_loadu_ps(&sourceArray[i + 4].X);
+		auto d = _mm256_loadu_ps(&sourceArray[i + 6].X);
+		auto px = _mm256_permute2f128_ps(a, c, 0x20);
+		auto py = _mm256_permute2f128_ps(a, c, 0x31);
+		auto pz = _mm256_permute2f128_ps(b, d, 0x20);
+		auto pw = _mm256_permute2f128_ps(b, d, 0x31);
+		TransposeVector4x8Avx(px, py, pz, pw);
+		auto x = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qy, pz), _mm256_mul_ps(qz, py)));
+		auto y = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qz, px), _mm256_mul_ps(qx, pz)));
+		auto z = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qx, py), _mm256_mul_ps(qy, px)));
+		auto rx = _mm256_add_ps(_mm256_add_ps(px, _mm256_mul_ps(x, qw)), _mm256_sub_ps(_mm256_mul_ps(qy, z), _mm256_mul_ps(qz, y)));
+		auto ry = _mm256_add_ps(_mm256_add_ps(py, _mm256_mul_ps(y, qw)), _mm256_sub_ps(_mm256_mul_ps(qz, x), _mm256_mul_ps(qx, z)));
+		auto rz = _mm256_add_ps(_mm256_add_ps(pz, _mm256_mul_ps(z, qw)), _mm256_sub_ps(_mm256_mul_ps(qx, y), _mm256_mul_ps(qy, x)));
+		TransposeVector4x8Avx(rx, ry, rz, pw);
+		_mm256_storeu_ps(&destinationArray[i].X, _mm256_permute2f128_ps(rx, ry, 0x20));
+		_mm256_storeu_ps(&destinationArray[i + 2].X, _mm256_permute2f128_ps(rz, pw, 0x20));
+		_mm256_storeu_ps(&destinationArray[i + 4].X, _mm256_permute2f128_ps(rx, ry, 0x31));
+		_mm256_storeu_ps(&destinationArray[i + 6].X, _mm256_permute2f128_ps(rz, pw, 0x31));
+	}
+	RotateVector4Sse(sourceArray + i, rotation, destinationArray + i, length - i);
+}
+
+// Four Vector2 per register, against the matrix rows repeated in every pair of floats.
+PLUSGAME_TARGET_AVX
+static void TransformVector2Avx(const Vector2* sourceArray, const Matrix3x2& matrix, Vector2* destinationArray, int length)
+{
+	auto row1 = _mm256_setr_ps(matrix.M11, matrix.M12, matrix.M11, matrix.M12, matrix.M11, matrix.M12, matrix.M11, matrix.M12);
+	auto row2 = _mm256_setr_ps(matrix.M21, matrix.M22, matrix.M21, matrix.M22, matrix.M21, matrix.M22, matrix.M21, matrix.M22);
+	auto row3 = _mm256_setr_ps(matrix.M31, matrix.M32, matrix.M31, matrix.M32, matrix.M31, matrix.M32, matrix.M31, matrix.M32);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto value = _mm256_loadu_ps(&sourceArray[i].X);
+		auto x = _mm256_permute_ps(value, _MM_SHUFFLE(2, 2, 0, 0));
+		auto y = _mm256_permute_ps(value, _MM_SHUFFLE(3, 3, 1, 1));
+		_mm256_storeu_ps(&destinationArray[i].X, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, row1), _mm256_mul_ps(y, row2)), row3));
+	}
+	TransformVector2Sse(sourceArray + i, matrix, destinationArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void TransformNormalVector2Avx(const Vector2* sourceArray, const Matrix3x2& matrix, Vector2* destinationArray, int length)
+{
+	auto row1 = _mm256_setr_ps(matrix.M11, matrix.M12, matrix.M11, matrix.M12, matrix.M11, matrix.M12, matrix.M11, matrix.M12);
+	auto row2 = _mm256_setr_ps(matrix.M21, matrix.M22, matrix.M21, matrix.M22, matrix.M21, matrix.M22, matrix.M21, matrix.M22);
+	auto i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		auto value = _mm256_loadu_ps(&sourceArray[i].X);
+		auto x = _mm256_permute_ps(value, _MM_SHUFFLE(2, 2, 0, 0));
+		auto y = _mm256_permute_ps(value, _MM_SHUFFLE(3, 3, 1, 1));
+		_mm256_storeu_ps(&destinationArray[i].X, _mm256_add_ps(_mm256_mul_ps(x, row1), _mm256_mul_ps(y, row2)));
+	}
+	TransformNormalVector2Sse(sourceArray + i, matrix, destinationArray + i, length - i);
+}
+
+// vrsqrtps gives the estimates of rsqrtps and rsqrtss, so the estimate tiers also match the
+// single-value Normalize.
+PLUSGAME_TARGET_AVX
+static inline __m256 ReciprocalSqrtAvx(__m256 value, ExactPrecision)
+{
+	return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(value));
+}
+
+PLUSGAME_TARGET_AVX
+static inline __m256 ReciprocalSqrtAvx(__m256 value, RefinedPrecision)
+{
+	auto estimate = _mm256_rsqrt_ps(value);
+	auto correction = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), value), estimate), estimate);
+	return _mm256_mul_ps(estimate, _mm256_sub_ps(_mm256_set1_ps(1.5f), correction));
+}
+
+PLUSGAME_TARGET_AVX
+static inline __m256 ReciprocalSqrtAvx(__m256 value, EstimatePrecision)
+{
+	return _mm256_rsqrt_ps(value);
+}
+
+// The in-lane shuffles pair vectors 0, 1, 4 and 5 in the low lane and 2, 3, 6 and 7 in the
+// high one, which the in-lane unpacks undo for the factors.
+template<typename Precision>
+PLUSGAME_TARGET_AVX
+static void NormalizeVector2Avx(const Vector2* sourceArray, Vector2* destinationArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto a = _mm256_loadu_ps(&sourceArray[i].X);
+		auto b = _mm256_loadu_ps(&sourceArray[i + 4].X);
+		auto x = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		auto y = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		auto factor = ReciprocalSqrtAvx(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), Precision());
+		_mm256_storeu_ps(&destinationArray[i].X, _mm256_mul_ps(a, _mm256_unpacklo_ps(factor, factor)));
+		_mm256_storeu_ps(&destinationArray[i + 4].X, _mm256_mul_ps(b, _mm256_unpackhi_ps(factor, factor)));
+	}
+	NormalizeVector2Sse<Precision>(sourceArray + i, destinationArray + i, length - i);
+}
+
+template<typename Precision>
+PLUSGAME_TARGET_AVX
+static void NormalizeVector3Avx(const Vector3* sourceArray, Vector3* destinationArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		__m256 x, y, z;
+		LoadVector3x8Avx(sourceArray + i, x, y, z);
+		auto factor = ReciprocalSqrtAvx(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z)), Precision());
+		StoreVector3x8Avx(destinationArray + i, _mm256_mul_ps(x, factor), _mm256_mul_ps(y, factor), _mm256_mul_ps(z, factor));
+	}
+	NormalizeVector3Sse<Precision>(sourceArray + i, destinationArray + i, length - i);
+}
+
+template<typename Precision>
+PLUSGAME_TARGET_AVX
+static void NormalizeVector4Avx(const Vector4* sourceArray, Vector4* destinationArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		auto a = _mm256_loadu_ps(&sourceArray[i].X);
+		auto b = _mm256_loadu_ps(&sourceArray[i + 2].X);
+		auto c = _mm256_loadu_ps(&sourceArray[i + 4].X);
+		auto d = _mm256_loadu_ps(&sourceArray[i + 6].X);
+		auto x = _mm256_permute2f128_ps(a, c, 0x20);
+		auto y = _mm256_permute2f128_ps(a, c, 0x31);
+		auto z = _mm256_permute2f128_ps(b, d, 0x20);
+		auto w = _mm256_permute2f128_ps(b, d, 0x31);
+		TransposeVector4x8Avx(x, y, z, w);
+		auto lengthSquared = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z)), _mm256_mul_ps(w, w));
+		auto factor = ReciprocalSqrtAvx(lengthSquared, Precision());
+		x = _mm256_mul_ps(x, factor);
+		y = _mm256_mul_ps(y, factor);
+		z = _mm256_mul_ps(z, factor);
+		w = _mm256_mul_ps(w, factor);
+		TransposeVector4x8Avx(x, y, z, w);
+		_mm256_storeu_ps(&destinationArray[i].X, _mm256_permute2f128_ps(x, y, 0x20));
+		_mm256_storeu_ps(&destinationArray[i + 2].X, _mm256_permute2f128_ps(z, w, 0x20));
+		_mm256_storeu_ps(&destinationArray[i + 4].X, _mm256_permute2f128_ps(x, y, 0x31));
+		_mm256_storeu_ps(&destinationArray[i + 6].X, _mm256_permute2f128_ps(z, w, 0x31));
+	}
+	NormalizeVector4Sse<Precision>(sourceArray + i, destinationArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static inline __m256 MultiplyAddAvx(__m256 a, __m256 b, __m256 c)
+{
+	return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+}
+
+// AVX has no 256-bit integer operations, so the quadrant number is reduced modulo 4 as a float,
+// which is exact, and tested by comparisons; the selected values are those of SinCosSse.
+PLUSGAME_TARGET_AVX
+static inline void SinCosAvx(__m256 value, __m256& sin, __m256& cos)
+{
+	auto bias = _mm256_set1_ps(FastTrig::RoundingBias);
+	auto quadrant = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(value, _mm256_set1_ps(FastTrig::TwoOverPi)), bias), bias);
+	auto x = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(value, _mm256_mul_ps(quadrant, _mm256_set1_ps(FastTrig::PiOver2A))),
+		_mm256_mul_ps(quadrant, _mm256_set1_ps(FastTrig::PiOver2B))), _mm256_mul_ps(quadrant, _mm256_set1_ps(FastTrig::PiOver2C)));
+	auto z = _mm256_mul_ps(x, x);
+	auto sinX = MultiplyAddAvx(MultiplyAddAvx(_mm256_set1_ps(FastTrig::Sin3), z, _mm256_set1_ps(FastTrig::Sin2)), z, _mm256_set1_ps(FastTrig::Sin1));
+	sinX = MultiplyAddAvx(_mm256_mul_ps(sinX, z), x, x);
+	auto cosX = MultiplyAddAvx(MultiplyAddAvx(_mm256_set1_ps(FastTrig::Cos3), z, _mm256_set1_ps(FastTrig::Cos2)), z, _mm256_set1_ps(FastTrig::Cos1));
+	cosX = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(cosX, z), z), _mm256_mul_ps(_mm256_set1_ps(0.5f), z)), _mm256_set1_ps(1.0f));
+
+	auto index = _mm256_sub_ps(quadrant, _mm256_mul_ps(_mm256_floor_ps(_mm256_mul_ps(quadrant, _mm256_set1_ps(0.25f))), _mm256_set1_ps(4.0f)));
+	auto parity = _mm256_sub_ps(index, _mm256_mul_ps(_mm256_floor_ps(_mm256_mul_ps(index, _mm256_set1_ps(0.5f))), _mm256_set1_ps(2.0f)));
+	auto swap = _mm256_cmp_ps(parity, _mm256_set1_ps(1.0f), _CMP_EQ_OQ);
+	auto sign = _mm256_set1_ps(-0.0f);
+	auto negateSin = _mm256_and_ps(_mm256_cmp_ps(index, _mm256_set1_ps(2.0f), _CMP_GE_OQ), sign);
+	auto negateCos = _mm256_and_ps(_mm256_cmp_ps(_mm256_andnot_ps(sign, _mm256_sub_ps(index, _mm256_set1_ps(1.5f))), _mm256_set1_ps(1.0f), _CMP_LT_OQ), sign);
+	sin = _mm256_xor_ps(_mm256_blendv_ps(sinX, cosX, swap), negateSin);
+	cos = _mm256_xor_ps(_mm256_blendv_ps(cosX, sinX, swap), negateCos);
+
+	auto outOfRange = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(sign, value), _mm256_set1_ps(FastTrig::MaxAngle), _CMP_NLE_UQ));
+	if (outOfRange != 0)
+	{
+		alignas(32) float values[8], sins[8], coss[8];
+		_mm256_store_ps(values, value);
+		_mm256_store_ps(sins, sin);
+		_mm256_store_ps(coss, cos);
+		SinCosOutOfRange(values, sins, coss, outOfRange, 8);
+		sin = _mm256_load_ps(sins);
+		cos = _mm256_load_ps(coss);
+	}
+}
+
+PLUSGAME_TARGET_AVX
+static inline __m256 AcosAvx(__m256 value)
+{
+	auto x = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value);
+	auto polynomial = MultiplyAddAvx(_mm256_set1_ps(FastTrig::Acos7), x, _mm256_set1_ps(FastTrig::Acos6));
+	polynomial = MultiplyAddAvx(polynomial, x, _mm256_set1_ps(FastTrig::Acos5));
+	polynomial = MultiplyAddAvx(polynomial, x, _mm256_set1_ps(FastTrig::Acos4));
+	polynomial = MultiplyAddAvx(polynomial, x, _mm256_set1_ps(FastTrig::Acos3));
+	polynomial = MultiplyAddAvx(polynomial, x, _mm256_set1_ps(FastTrig::Acos2));
+	polynomial = MultiplyAddAvx(polynomial, x, _mm256_set1_ps(FastTrig::Acos1));
+	polynomial = MultiplyAddAvx(polynomial, x, _mm256_set1_ps(FastTrig::Acos0));
+	auto result = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), x)), polynomial);
+	return _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(MathHelper::Pi), result), _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_LT_OQ));
+}
+
+PLUSGAME_TARGET_AVX
+static void SinCosFastAvx(const float* angleArray, float* sinArray, float* cosArray, int length)
+{
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		__m256 sin, cos;
+		SinCosAvx(_mm256_loadu_ps(angleArray + i), sin, cos);
+		_mm256_storeu_ps(sinArray + i, sin);
+		_mm256_storeu_ps(cosArray + i, cos);
+	}
+	SinCosFastSse(angleArray + i, sinArray + i, cosArray + i, length - i);
+}
+
+// Eight quaternions are loaded as in RotateVector4Avx; after the transpose the component
+// registers hold them in order, so the amounts load directly.
+PLUSGAME_TARGET_AVX
+static inline void LoadQuaternion4x8Avx(const Quaternion* quaternions, __m256& x, __m256& y, __m256& z, __m256& w)
+{
+	auto a = _mm256_loadu_ps(&quaternions[0].X);
+	auto b = _mm256_loadu_ps(&quaternions[2].X);
+	auto c = _mm256_loadu_ps(&quaternions[4].X);
+	auto d = _mm256_loadu_ps(&quaternions[6].X);
+	x = _mm256_permute2f128_ps(a, c, 0x20);
+	y = _mm256_permute2f128_ps(a, c, 0x31);
+	z = _mm256_permute2f128_ps(b, d, 0x20);
+	w = _mm256_permute2f128_ps(b, d, 0x31);
+	TransposeVector4x8Avx(x, y, z, w);
+}
+
+PLUSGAME_TARGET_AVX
+static inline void StoreQuaternion4x8Avx(Quaternion* quaternions, __m256 x, __m256 y, __m256 z, __m256 w)
+{
+	TransposeVector4x8Avx(x, y, z, w);
+	_mm256_storeu_ps(&quaternions[0].X, _mm256_permute2f128_ps(x, y, 0x20));
+	_mm256_storeu_ps(&quaternions[2].X, _mm256_permute2f128_ps(z, w, 0x20));
+	_mm256_storeu_ps(&quaternions[4].X, _mm256_permute2f128_ps(x, y, 0x31));
+	_mm256_storeu_ps(&quaternions[6].X, _mm256_permute2f128_ps(z, w, 0x31));
+}
+
+PLUSGAME_TARGET_AVX
+static void SlerpFastAvx(const Quaternion* quaternion1Array, const Quaternion* quaternion2Array, const float* amountArray, Quaternion* resultArray, int length)
+{
+	auto one = _mm256_set1_ps(1.0f);
+	auto sign = _mm256_set1_ps(-0.0f);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		__m256 x1, y1, z1, w1, x2, y2, z2, w2;
+		LoadQuaternion4x8Avx(quaternion1Array + i, x1, y1, z1, w1);
+		LoadQuaternion4x8Avx(quaternion2Array + i, x2, y2, z2, w2);
+		auto amount = _mm256_loadu_ps(amountArray + i);
+
+		auto dot = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x1, x2), _mm256_mul_ps(y1, y2)), _mm256_mul_ps(z1, z2)), _mm256_mul_ps(w1, w2));
+		auto flip = _mm256_and_ps(_mm256_cmp_ps(dot, _mm256_setzero_ps(), _CMP_LT_OQ), sign);
+		dot = _mm256_xor_ps(dot, flip);
+		auto close = _mm256_cmp_ps(dot, _mm256_set1_ps(0.999999f), _CMP_GT_OQ);
+
+		__m256 sinAngle, cosAngle, sinAmountAngle, cosAmountAngle;
+		auto angle = AcosAvx(dot);
+		SinCosAvx(angle, sinAngle, cosAngle);
+		SinCosAvx(_mm256_mul_ps(amount, angle), sinAmountAngle, cosAmountAngle);
+		auto inverseSinAngle = _mm256_div_ps(one, sinAngle);
+		auto weight1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(sinAngle, cosAmountAngle), _mm256_mul_ps(cosAngle, sinAmountAngle)), inverseSinAngle);
+		auto weight2 = _mm256_mul_ps(sinAmountAngle, inverseSinAngle);
+		weight1 = _mm256_blendv_ps(weight1, _mm256_sub_ps(one, amount), close);
+		weight2 = _mm256_xor_ps(_mm256_blendv_ps(weight2, amount, close), flip);
+
+		StoreQuaternion4x8Avx(resultArray + i,
+			_mm256_add_ps(_mm256_mul_ps(weight1, x1), _mm256_mul_ps(weight2, x2)),
+			_mm256_add_ps(_mm256_mul_ps(weight1, y1), _mm256_mul_ps(weight2, y2)),
+			_mm256_add_ps(_mm256_mul_ps(weight1, z1), _mm256_mul_ps(weight2, z2)),
+			_mm256_add_ps(_mm256_mul_ps(weight1, w1), _mm256_mul_ps(weight2, w2)));
+	}
+	SlerpFastSse(quaternion1Array + i, quaternion2Array + i, amountArray + i, resultArray + i, length - i);
+}
+
+PLUSGAME_TARGET_AVX
+static void CreateFromYawPitchRollFastAvx(const float* yawArray, const float* pitchArray, const float* rollArray, Quaternion* resultArray, int length)
+{
+	auto half = _mm256_set1_ps(0.5f);
+	auto i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		__m256 sinRoll, cosRoll, sinPitch, cosPitch, sinYaw, cosYaw;
+		SinCosAvx(_mm256_mul_ps(_mm256_loadu_ps(rollArray + i), half), sinRoll, cosRoll);
+		SinCosAvx(_mm256_mul_ps(_mm256_loadu_ps(pitchArray + i), half), sinPitch, cosPitch);
+		SinCosAvx(_mm256_mul_ps(_mm256_loadu_ps(yawArray + i), half), sinYaw, cosYaw);
+
+		StoreQuaternion4x8Avx(resultArray + i,
+			_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(cosYaw, sinPitch), cosRoll), _mm256_mul_ps(_mm256_mul_ps(sinYaw, cosPitch), sinRoll)),
+			_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(sinYaw, cosPitch), cosRoll), _mm256_mul_ps(_mm256_mul_ps(cosYaw, sinPitch), sinRoll)),
+			_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(cosYaw, cosPitch), sinRoll), _mm256_mul_ps(_mm256_mul_ps(sinYaw, sinPitch), cosRoll)),
+			_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(cosYaw, cosPitch), cosRoll), _mm256_mul_ps(_mm256_mul_ps(sinYaw, sinPitch), sinRoll)));
+	}
+	CreateFromYawPitchRollFastSse(yawArray + i, pitchArray + i, rollArray + i, resultArray + i, length - i);
+}
+
+// The F16C conversions round to nearest even, which HalfHelper and the SSE kernels reproduce.
+PLUSGAME_TARGET_F16C
+static void PackHalf3F16c(const Vector3* sourceArray, int sourceStride, Half3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		StoreShort3Sse(StridedElement(destinationArray, destinationStride, i), _mm_cvtps_ph(LoadVector3Sse(StridedElement(sourceArray, sourceStride, i)), _MM_FROUND_TO_NEAREST_INT));
+}
+
+PLUSGAME_TARGET_F16C
+static void PackHalf4F16c(const Vector4* sourceArray, int sourceStride, Half4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		StoreShort4Sse(StridedElement(destinationArray, destinationStride, i), _mm_cvtps_ph(_mm_loadu_ps(&StridedElement(sourceArray, sourceStride, i)->X), _MM_FROUND_TO_NEAREST_INT));
+}
+
+PLUSGAME_TARGET_F16C
+static void UnpackHalf3F16c(const Half3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		StoreVector3Sse(StridedElement(destinationArray, destinationStride, i), _mm_cvtph_ps(LoadShort3Sse(StridedElement(sourceArray, sourceStride, i))));
+}
+
+PLUSGAME_TARGET_F16C
+static void UnpackHalf4F16c(const Half4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	for (auto i = 0; i < length; i++)
+		_mm_storeu_ps(&StridedElement(destinationArray, destinationStride, i)->X, _mm_cvtph_ps(LoadShort4Sse(StridedElement(sourceArray, sourceStride, i))));
+}
+#endif
+
+/// <summary>
+/// Adds the elements at the same index in two arrays.
+/// </summary>
+void VectorSimd::AddArray(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	Kernels().AddArray(value1Array, value2Array, resultArray, length);
+}
+
+/// <summary>
+/// Subtracts the elements of the second array from the elements at the same index in the first.
+/// </summary>
+void VectorSimd::SubtractArray(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	Kernels().SubtractArray(value1Array, value2Array, resultArray, length);
+}
+
+/// <summary>
+/// Multiplies the elements at the same index in two arrays.
+/// </summary>
+void VectorSimd::MultiplyArray(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	Kernels().MultiplyArray(value1Array, value2Array, resultArray, length);
+}
+
+/// <summary>
+/// Multiplies every element of an array by a scalar.
+/// </summary>
+void VectorSimd::MultiplyArray(const float* value1Array, float scaleFactor, float* resultArray, int length)
+{
+	Kernels().ScaleArray(value1Array, scaleFactor, resultArray, length);
+}
+
+/// <summary>
+/// Linearly interpolates the elements at the same index in two arrays, as <see cref="MathHelper.Lerp"/> does.
+/// </summary>
+void VectorSimd::LerpArray(const float* value1Array, const float* value2Array, float amount, float* resultArray, int length)
+{
+	Kernels().LerpArray(value1Array, value2Array, amount, resultArray, length);
+}
+
+/// <summary>
+/// Takes the smaller of the elements at the same index in two arrays, as <see cref="MathHelper.Min"/> does.
+/// </summary>
+void VectorSimd::MinArray(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	Kernels().MinArray(value1Array, value2Array, resultArray, length);
+}
+
+/// <summary>
+/// Takes the larger of the elements at the same index in two arrays, as <see cref="MathHelper.Max"/> does.
+/// </summary>
+void VectorSimd::MaxArray(const float* value1Array, const float* value2Array, float* resultArray, int length)
+{
+	Kernels().MaxArray(value1Array, value2Array, resultArray, length);
+}
+
+/// <summary>
+/// Computes the dot products of the vectors at the same index, as <see cref="Vector3.Dot"/> does.
+/// </summary>
+void VectorSimd::DotSoA(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2, float* resultArray, int length)
+{
+	Kernels().DotSoA(x1, y1, z1, x2, y2, z2, resultArray, length);
+}
+
+/// <summary>
+/// Computes the cross products of the vectors at the same index, as <see cref="Vector3.Cross"/> does.
+/// </summary>
+void VectorSimd::CrossSoA(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2,
+	float* resultX, float* resultY, float* resultZ, int length)
+{
+	Kernels().CrossSoA(x1, y1, z1, x2, y2, z2, resultX, resultY, resultZ, length);
+}
+
+/// <summary>
+/// Scales every vector to unit length, as <see cref="Vector3.Normalize"/> does.
+/// </summary>
+void VectorSimd::NormalizeSoA(const float* x, const float* y, const float* z, float* resultX, float* resultY, float* resultZ, int length)
+{
+	Kernels().NormalizeSoA(x, y, z, resultX, resultY, resultZ, length);
+}
+
+/// <summary>
+/// Transforms every position by a matrix, as <see cref="Vector3.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformSoA(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length)
+{
+	Kernels().TransformSoA(x, y, z, matrix, resultX, resultY, resultZ, length);
+}
+
+/// <summary>
+/// Transforms every direction by the rotation and scale of a matrix, ignoring its translation.
+/// </summary>
+void VectorSimd::TransformNormalSoA(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length)
+{
+	Kernels().TransformNormalSoA(x, y, z, matrix, resultX, resultY, resultZ, length);
+}
+
+/// <summary>
+/// Transforms every position of an array by a matrix, as <see cref="Vector3.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformArray(const Vector3* sourceArray, const Matrix& matrix, Vector3* destinationArray, int length)
+{
+	Kernels().TransformVector3(sourceArray, matrix, destinationArray, length);
+}
+
+/// <summary>
+/// Rotates every vector of an array by a quaternion, as <see cref="Vector3.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformArray(const Vector3* sourceArray, const Quaternion& rotation, Vector3* destinationArray, int length)
+{
+	Kernels().RotateVector3(sourceArray, rotation, destinationArray, length);
+}
+
+/// <summary>
+/// Transforms every vector of an array by a matrix, as <see cref="Vector4.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformArray(const Vector4* sourceArray, const Matrix& matrix, Vector4* destinationArray, int length)
+{
+	Kernels().TransformVector4(sourceArray, matrix, destinationArray, length);
+}
+
+/// <summary>
+/// Rotates every vector of an array by a quaternion, as <see cref="Vector4.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformArray(const Vector4* sourceArray, const Quaternion& rotation, Vector4* destinationArray, int length)
+{
+	Kernels().RotateVector4(sourceArray, rotation, destinationArray, length);
+}
+
+/// <summary>
+/// Transforms every position of a strided array by a matrix, as <see cref="Vector3.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformStrided(const Vector3* sourceArray, int sourceStride, const Matrix& matrix, Vector3* destinationArray, int destinationStride, int length)
+{
+	if (sourceStride == sizeof(Vector3) && destinationStride == sizeof(Vector3))
+		Kernels().TransformVector3(sourceArray, matrix, destinationArray, length);
+	else
+		Kernels().TransformVector3Strided(sourceArray, sourceStride, matrix, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Rotates every vector of a strided array by a quaternion, as <see cref="Vector3.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformStrided(const Vector3* sourceArray, int sourceStride, const Quaternion& rotation, Vector3* destinationArray, int destinationStride, int length)
+{
+	if (sourceStride == sizeof(Vector3) && destinationStride == sizeof(Vector3))
+		Kernels().RotateVector3(sourceArray, rotation, destinationArray, length);
+	else
+		Kernels().RotateVector3Strided(sourceArray, sourceStride, rotation, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Transforms every vector of a strided array by a matrix, as <see cref="Vector4.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformStrided(const Vector4* sourceArray, int sourceStride, const Matrix& matrix, Vector4* destinationArray, int destinationStride, int length)
+{
+	if (sourceStride == sizeof(Vector4) && destinationStride == sizeof(Vector4))
+		Kernels().TransformVector4(sourceArray, matrix, destinationArray, length);
+	else
+		Kernels().TransformVector4Strided(sourceArray, sourceStride, matrix, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Rotates every vector of a strided array by a quaternion, as <see cref="Vector4.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformStrided(const Vector4* sourceArray, int sourceStride, const Quaternion& rotation, Vector4* destinationArray, int destinationStride, int length)
+{
+	if (sourceStride == sizeof(Vector4) && destinationStride == sizeof(Vector4))
+		Kernels().RotateVector4(sourceArray, rotation, destinationArray, length);
+	else
+		Kernels().RotateVector4Strided(sourceArray, sourceStride, rotation, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Transforms every position of a strided array by a 2D matrix, as <see cref="Vector2.Transform"/> does.
+/// </summary>
+void VectorSimd::TransformStrided(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length)
+{
+	if (sourceStride == sizeof(Vector2) && destinationStride == sizeof(Vector2))
+		Kernels().TransformVector2(sourceArray, matrix, destinationArray, length);
+	else
+		Kernels().TransformVector2Strided(sourceArray, sourceStride, matrix, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Transforms every normal of a strided array by the linear part of a 2D matrix, as <see cref="Vector2.TransformNormal"/> does.
+/// </summary>
+void VectorSimd::TransformNormalStrided(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length)
+{
+	if (sourceStride == sizeof(Vector2) && destinationStride == sizeof(Vector2))
+		Kernels().TransformNormalVector2(sourceArray, matrix, destinationArray, length);
+	else
+		Kernels().TransformNormalVector2Strided(sourceArray, sourceStride, matrix, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Scales every vector to unit length, as <see cref="Vector2.Normalize"/> does at the given precision.
+/// </summary>
+void VectorSimd::NormalizeArray(const Vector2* sourceArray, Vector2* destinationArray, int length, NormalizePrecision precision)
+{
+	Kernels().NormalizeVector2[precision](sourceArray, destinationArray, length);
+}
+
+/// <summary>
+/// Scales every vector to unit length, as <see cref="Vector3.Normalize"/> does at the given precision.
+/// </summary>
+void VectorSimd::NormalizeArray(const Vector3* sourceArray, Vector3* destinationArray, int length, NormalizePrecision precision)
+{
+	Kernels().NormalizeVector3[precision](sourceArray, destinationArray, length);
+}
+
+/// <summary>
+/// Scales every vector to unit length, as <see cref="Vector4.Normalize"/> does at the given precision.
+/// </summary>
+void VectorSimd::NormalizeArray(const Vector4* sourceArray, Vector4* destinationArray, int length, NormalizePrecision precision)
+{
+	Kernels().NormalizeVector4[precision](sourceArray, destinationArray, length);
+}
+
+/// <summary>
+/// Scales every quaternion to unit length, as <see cref="Quaternion.Normalize"/> does at the given precision.
+/// A quaternion has the layout and the normalization of a <see cref="Vector4"/>.
+/// </summary>
+void VectorSimd::NormalizeArray(const Quaternion* sourceArray, Quaternion* destinationArray, int length, NormalizePrecision precision)
+{
+	Kernels().NormalizeVector4[precision](reinterpret_cast<const Vector4*>(sourceArray), reinterpret_cast<Vector4*>(destinationArray), length);
+}
+
+/// <summary>
+/// Computes the sine and the cosine of every angle of an array, as the SinCos of the policy of the given precision does.
+/// </summary>
+void VectorSimd::SinCosArray(const float* angleArray, float* sinArray, float* cosArray, int length, TrigPrecision precision)
+{
+	Kernels().SinCos[precision](angleArray, sinArray, cosArray, length);
+}
+
+/// <summary>
+/// Interpolates the quaternions at the same index of two arrays, as <see cref="Quaternion.Slerp"/> does at the given precision.
+/// </summary>
+void VectorSimd::SlerpArray(const Quaternion* quaternion1Array, const Quaternion* quaternion2Array, const float* amountArray, Quaternion* resultArray, int length, TrigPrecision precision)
+{
+	Kernels().Slerp[precision](quaternion1Array, quaternion2Array, amountArray, resultArray, length);
+}
+
+/// <summary>
+/// Creates one rotation per index of the yaw, pitch and roll arrays, as <see cref="Quaternion.CreateFromYawPitchRoll"/> does at the given precision.
+/// </summary>
+void VectorSimd::CreateFromYawPitchRollArray(const float* yawArray, const float* pitchArray, const float* rollArray, Quaternion* resultArray, int length, TrigPrecision precision)
+{
+	Kernels().CreateFromYawPitchRoll[precision](yawArray, pitchArray, rollArray, resultArray, length);
+}
+
+/// <summary>
+/// Packs every vector of a strided array into a <see cref="Half3"/>, as its constructor does.
+/// </summary>
+void VectorSimd::PackStrided(const Vector3* sourceArray, int sourceStride, Half3* destinationArray, int destinationStride, int length)
+{
+	Kernels().PackHalf3(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Packs every vector of a strided array into a <see cref="Half4"/>, as its constructor does.
+/// </summary>
+void VectorSimd::PackStrided(const Vector4* sourceArray, int sourceStride, Half4* destinationArray, int destinationStride, int length)
+{
+	Kernels().PackHalf4(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Packs every vector of a strided array into a <see cref="Snorm16x3"/>, as its constructor does.
+/// </summary>
+void VectorSimd::PackStrided(const Vector3* sourceArray, int sourceStride, Snorm16x3* destinationArray, int destinationStride, int length)
+{
+	Kernels().PackSnorm16x3(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Packs every vector of a strided array into a <see cref="Snorm16x4"/>, as its constructor does.
+/// </summary>
+void VectorSimd::PackStrided(const Vector4* sourceArray, int sourceStride, Snorm16x4* destinationArray, int destinationStride, int length)
+{
+	Kernels().PackSnorm16x4(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Packs every vector of a strided array into an <see cref="Octahedral16"/>, as its constructor does.
+/// </summary>
+void VectorSimd::PackStrided(const Vector3* sourceArray, int sourceStride, Octahedral16* destinationArray, int destinationStride, int length)
+{
+	Kernels().PackOctahedral16(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Packs every vector of a strided array into a <see cref="Snorm1010102"/>, as its constructor does.
+/// </summary>
+void VectorSimd::PackStrided(const Vector4* sourceArray, int sourceStride, Snorm1010102* destinationArray, int destinationStride, int length)
+{
+	Kernels().PackSnorm1010102(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Unpacks every <see cref="Half3"/> of a strided array, as its ToVector3 method does.
+/// </summary>
+void VectorSimd::UnpackStrided(const Half3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	Kernels().UnpackHalf3(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Unpacks every <see cref="Half4"/> of a strided array, as its ToVector4 method does.
+/// </summary>
+void VectorSimd::UnpackStrided(const Half4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	Kernels().UnpackHalf4(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Unpacks every <see cref="Snorm16x3"/> of a strided array, as its ToVector3 method does.
+/// </summary>
+void VectorSimd::UnpackStrided(const Snorm16x3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	Kernels().UnpackSnorm16x3(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Unpacks every <see cref="Snorm16x4"/> of a strided array, as its ToVector4 method does.
+/// </summary>
+void VectorSimd::UnpackStrided(const Snorm16x4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	Kernels().UnpackSnorm16x4(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Unpacks every <see cref="Octahedral16"/> of a strided array, as its ToVector3 method does.
+/// </summary>
+void VectorSimd::UnpackStrided(const Octahedral16* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length)
+{
+	Kernels().UnpackOctahedral16(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Unpacks every <see cref="Snorm1010102"/> of a strided array, as its ToVector4 method does.
+/// </summary>
+void VectorSimd::UnpackStrided(const Snorm1010102* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length)
+{
+	Kernels().UnpackSnorm1010102(sourceArray, sourceStride, destinationArray, destinationStride, length);
+}
+
+/// <summary>
+/// Copies an array of <see cref="Vector3"/> into one array per component.
+/// </summary>
+void VectorSimd::SplitVector3(const Vector3* sourceArray, float* x, float* y, float* z, int length)
+{
+	Kernels().SplitVector3(sourceArray, x, y, z, length);
+}
+
+/// <summary>
+/// Copies one array per component into an array of <see cref="Vector3"/>.
+/// </summary>
+void VectorSimd::JoinVector3(const float* x, const float* y, const float* z, Vector3* destinationArray, int length)
+{
+	Kernels().JoinVector3(x, y, z, destinationArray, length);
+}
+
+/// <summary>
+/// Returns the name of the kernel set selected for this processor.
+/// </summary>
+const char* VectorSimd::GetKernelName()
+{
+	return Kernels().Name;
+}
+
+const VectorSimd::KernelTable& VectorSimd::Kernels()
+{
+	static const KernelTable table = []()
+	{
+#if defined(PLUSGAME_X86)
+		// Strided access, packing, splitting and joining are bound by the shuffles and memory,
+		// wider registers do not help them.
+		if (CpuFeatures::HasAVX())
+		{
+			KernelTable avx{ "AVX", AddArrayAvx, SubtractArrayAvx, MultiplyArrayAvx, ScaleArrayAvx, LerpArrayAvx, MinArrayAvx, MaxArrayAvx,
+				DotSoAAvx, CrossSoAAvx, NormalizeSoAAvx, TransformSoAAvx, TransformNormalSoAAvx, TransformVector3Avx, RotateVector3Avx, TransformVector4Avx, RotateVector4Avx,
+				TransformVector3StridedSse, RotateVector3StridedSse, TransformVector4StridedSse, RotateVector4StridedSse,
+				TransformVector2Avx, TransformNormalVector2Avx, TransformVector2StridedSse, TransformNormalVector2StridedSse,
+				{ NormalizeVector2Avx<ExactPrecision>, NormalizeVector2Avx<RefinedPrecision>, NormalizeVector2Avx<EstimatePrecision> },
+				{ NormalizeVector3Avx<ExactPrecision>, NormalizeVector3Avx<RefinedPrecision>, NormalizeVector3Avx<EstimatePrecision> },
+				{ NormalizeVector4Avx<ExactPrecision>, NormalizeVector4Avx<RefinedPrecision>, NormalizeVector4Avx<EstimatePrecision> },
+				{ SinCosScalar<ExactTrig>, SinCosFastAvx }, { SlerpScalar<ExactTrig>, SlerpFastAvx },
+				{ CreateFromYawPitchRollScalar<ExactTrig>, CreateFromYawPitchRollFastAvx },
+				PackHalf3Sse, PackHalf4Sse, PackSnorm16x3Sse, PackSnorm16x4Sse, PackOctahedral16Sse, PackSnorm1010102Sse,
+				UnpackHalf3Sse, UnpackHalf4Sse, UnpackSnorm16x3Sse, UnpackSnorm16x4Sse, UnpackOctahedral16Sse, UnpackSnorm1010102Sse,
+				SplitVector3Sse, JoinVector3Sse };
+			// Half-precision conversions are single instructions with F16C.
+			if (CpuFeatures::HasF16C())
+			{
+				avx.PackHalf3 = PackHalf3F16c;
+				avx.PackHalf4 = PackHalf4F16c;
+				avx.UnpackHalf3 = UnpackHalf3F16c;
+				avx.UnpackHalf4 = UnpackHalf4F16c;
+			}
+			return avx;
+		}
+		return KernelTable{ "SSE", AddArraySse, SubtractArraySse, MultiplyArraySse, ScaleArraySse, LerpArraySse, MinArraySse, MaxArraySse,
+			DotSoASse, CrossSoASse, NormalizeSoASse, TransformSoASse, TransformNormalSoASse, TransformVector3Sse, RotateVector3Sse, TransformVector4Sse, RotateVector4Sse,
+			TransformVector3StridedSse, RotateVector3StridedSse, TransformVector4StridedSse, RotateVector4StridedSse,
+			TransformVector2Sse, TransformNormalVector2Sse, TransformVector2StridedSse, TransformNormalVector2StridedSse,
+			{ NormalizeVector2Sse<ExactPrecision>, NormalizeVector2Sse<RefinedPrecision>, NormalizeVector2Sse<EstimatePrecision> },
+			{ NormalizeVector3Sse<ExactPrecision>, NormalizeVector3Sse<RefinedPrecision>, NormalizeVector3Sse<EstimatePrecision> },
+			{ NormalizeVector4Sse<ExactPrecision>, NormalizeVector4Sse<RefinedPrecision>, NormalizeVector4Sse<EstimatePrecision> },
+			{ SinCosScalar<ExactTrig>, SinCosFastSse }, { SlerpScalar<ExactTrig>, SlerpFastSse },
+			{ CreateFromYawPitchRollScalar<ExactTrig>, CreateFromYawPitchRollFastSse },
+			PackHalf3Sse, PackHalf4Sse, PackSnorm16x3Sse, PackSnorm16x4Sse, PackOctahedral16Sse, PackSnorm1010102Sse,
+			UnpackHalf3Sse, UnpackHalf4Sse, UnpackSnorm16x3Sse, UnpackSnorm16x4Sse, UnpackOctahedral16Sse, UnpackSnorm1010102Sse,
+			SplitVector3Sse, JoinVector3Sse };
+#else
+		return KernelTable{ "Scalar", AddArrayScalar, SubtractArrayScalar, MultiplyArrayScalar, ScaleArrayScalar, LerpArrayScalar, MinArrayScalar, MaxArrayScalar,
+			DotSoAScalar, CrossSoAScalar, NormalizeSoAScalar, TransformSoAScalar, TransformNormalSoAScalar, TransformVector3Scalar, RotateVector3Scalar, TransformVector4Scalar, RotateVector4Scalar,
+			TransformVector3StridedScalar, RotateVector3StridedScalar, TransformVector4StridedScalar, RotateVector4StridedScalar,
+			TransformVector2Scalar, TransformNormalVector2Scalar, TransformVector2StridedScalar, TransformNormalVector2StridedScalar,
+			{ NormalizeVector2Scalar<ExactPrecision>, NormalizeVector2Scalar<RefinedPrecision>, NormalizeVector2Scalar<EstimatePrecision> },
+			{ NormalizeVector3Scalar<ExactPrecision>, NormalizeVector3Scalar<RefinedPrecision>, NormalizeVector3Scalar<EstimatePrecision> },
+			{ NormalizeVector4Scalar<ExactPrecision>, NormalizeVector4Scalar<RefinedPrecision>, NormalizeVector4Scalar<EstimatePrecision> },
+			{ SinCosScalar<ExactTrig>, SinCosScalar<FastTrig> }, { SlerpScalar<ExactTrig>, SlerpScalar<FastTrig> },
+			{ CreateFromYawPitchRollScalar<ExactTrig>, CreateFromYawPitchRollScalar<FastTrig> },
+			PackHalf3Scalar, PackHalf4Scalar, PackSnorm16x3Scalar, PackSnorm16x4Scalar, PackOctahedral16Scalar, PackSnorm1010102Scalar,
+			UnpackHalf3Scalar, UnpackHalf4Scalar, UnpackSnorm16x3Scalar, UnpackSnorm16x4Scalar, UnpackOctahedral16Scalar, UnpackSnorm1010102Scalar,
+			SplitVector3Scalar, JoinVector3Scalar };
+#endif
+	}();
+	return table;
+}
@@ -0,0 +1,184 @@
+#pragma once
+#include "NormalizePrecision.h"
+#include "TrigPrecision.h"
+
+class Matrix;
+class Matrix3x2;
+class Quaternion;
+struct Vector2;
+struct Vector3;
+class Vector4;
+struct Half3;
+struct Half4;
+struct Snorm16x3;
+struct Snorm16x4;
+struct Octahedral16;
+struct Snorm1010102;
+
+// Vectorized kernels behind the vector batch operations, picked once through CpuFeatures like
+// the MatrixSimd ones and with the same guarantee: every kernel keeps the scalar operation
+// order and avoids fused multiply-add, so results are bit-identical on every path.
+// The structure-of-arrays kernels take one float array per component. Every result may be
+// the same array as a source.
+class VectorSimd
+{
+public:
+	// Element-wise operations on single component arrays.
+	static void AddArray(const float* value1Array, const float* value2Array, float* resultArray, int length);
+	static void SubtractArray(const float* value1Array, const float* value2Array, float* resultArray, int length);
+	static void MultiplyArray(const float* value1Array, const float* value2Array, float* resultArray, int length);
+	static void MultiplyArray(const float* value1Array, float scaleFactor, float* resultArray, int length);
+	static void LerpArray(const float* value1Array, const float* value2Array, float amount, float* resultArray, int length);
+	static void MinArray(const float* value1Array, const float* value2Array, float* resultArray, int length);
+	static void MaxArray(const float* value1Array, const float* value2Array, float* resultArray, int length);
+
+	// Operations on X, Y and Z component arrays.
+	static void DotSoA(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2, float* resultArray, int length);
+	static void CrossSoA(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2,
+		float* resultX, float* resultY, float* resultZ, int length);
+	static void NormalizeSoA(const float* x, const float* y, const float* z, float* resultX, float* resultY, float* resultZ, int length);
+	static void TransformSoA(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length);
+	static void TransformNormalSoA(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length);
+
+	// Operations on arrays of Vector3.
+	static void TransformArray(const Vector3* sourceArray, const Matrix& matrix, Vector3* destinationArray, int length);
+	static void TransformArray(const Vector3* sourceArray, const Quaternion& rotation, Vector3* destinationArray, int length);
+	static void TransformArray(const Vector4* sourceArray, const Matrix& matrix, Vector4* destinationArray, int length);
+	static void TransformArray(const Vector4* sourceArray, const Quaternion& rotation, Vector4* destinationArray, int length);
+
+	// Operations on vectors that start a stride of bytes apart, such as the positions inside an
+	// interleaved vertex buffer. The destination may be the source.
+	static void TransformStrided(const Vector3* sourceArray, int sourceStride, const Matrix& matrix, Vector3* destinationArray, int destinationStride, int length);
+	static void TransformStrided(const Vector3* sourceArray, int sourceStride, const Quaternion& rotation, Vector3* destinationArray, int destinationStride, int length);
+	static void TransformStrided(const Vector4* sourceArray, int sourceStride, const Matrix& matrix, Vector4* destinationArray, int destinationStride, int length);
+	static void TransformStrided(const Vector4* sourceArray, int sourceStride, const Quaternion& rotation, Vector4* destinationArray, int destinationStride, int length);
+	static void TransformStrided(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length);
+	static void TransformNormalStrided(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length);
+
+	// Normalization of every vector of an array at the given precision tier.
+	static void NormalizeArray(const Vector2* sourceArray, Vector2* destinationArray, int length, NormalizePrecision precision);
+	static void NormalizeArray(const Vector3* sourceArray, Vector3* destinationArray, int length, NormalizePrecision precision);
+	static void NormalizeArray(const Vector4* sourceArray, Vector4* destinationArray, int length, NormalizePrecision precision);
+	static void NormalizeArray(const Quaternion* sourceArray, Quaternion* destinationArray, int length, NormalizePrecision precision);
+
+	// Trigonometry at the given precision tier. Only the fast tier is vectorized; the exact one
+	// calls the standard library for every element.
+	static void SinCosArray(const float* angleArray, float* sinArray, float* cosArray, int length, TrigPrecision precision);
+	static void SlerpArray(const Quaternion* quaternion1Array, const Quaternion* quaternion2Array, const float* amountArray, Quaternion* resultArray, int length, TrigPrecision precision);
+	static void CreateFromYawPitchRollArray(const float* yawArray, const float* pitchArray, const float* rollArray, Quaternion* resultArray, int length, TrigPrecision precision);
+
+	// Conversions to and from the packed formats of PackedVector.h, for elements that start a
+	// stride of bytes apart. Half precision uses the F16C instructions when the processor has them.
+	static void PackStrided(const Vector3* sourceArray, int sourceStride, Half3* destinationArray, int destinationStride, int length);
+	static void PackStrided(const Vector4* sourceArray, int sourceStride, Half4* destinationArray, int destinationStride, int length);
+	static void PackStrided(const Vector3* sourceArray, int sourceStride, Snorm16x3* destinationArray, int destinationStride, int length);
+	static void PackStrided(const Vector4* sourceArray, int sourceStride, Snorm16x4* destinationArray, int destinationStride, int length);
+	static void PackStrided(const Vector3* sourceArray, int sourceStride, Octahedral16* destinationArray, int destinationStride, int length);
+	static void PackStrided(const Vector4* sourceArray, int sourceStride, Snorm1010102* destinationArray, int destinationStride, int length);
+	static void UnpackStrided(const Half3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length);
+	static void UnpackStrided(const Half4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length);
+	static void UnpackStrided(const Snorm16x3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length);
+	static void UnpackStrided(const Snorm16x4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length);
+	static void UnpackStrided(const Octahedral16* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length);
+	static void UnpackStrided(const Snorm1010102* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length);
+
+	// Conversions between Vector3 arrays and component arrays.
+	static void SplitVector3(const Vector3* sourceArray, float* x, float* y, float* z, int length);
+	static void JoinVector3(const float* x, const float* y, const float* z, Vector3* destinationArray, int length);
+
+	// Name of the kernel set in use ("Scalar", "SSE" or "AVX").
+	static const char* GetKernelName();
+
+private:
+	typedef void (*CombineArrayKernel)(const float* value1Array, const float* value2Array, float* resultArray, int length);
+	typedef void (*ScaleArrayKernel)(const float* value1Array, float scaleFactor, float* resultArray, int length);
+	typedef void (*LerpArrayKernel)(const float* value1Array, const float* value2Array, float amount, float* resultArray, int length);
+	typedef void (*DotSoAKernel)(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2, float* resultArray, int length);
+	typedef void (*CrossSoAKernel)(const float* x1, const float* y1, const float* z1, const float* x2, const float* y2, const float* z2,
+		float* resultX, float* resultY, float* resultZ, int length);
+	typedef void (*NormalizeSoAKernel)(const float* x, const float* y, const float* z, float* resultX, float* resultY, float* resultZ, int length);
+	typedef void (*TransformSoAKernel)(const float* x, const float* y, const float* z, const Matrix& matrix, float* resultX, float* resultY, float* resultZ, int length);
+	typedef void (*TransformVector3Kernel)(const Vector3* sourceArray, const Matrix& matrix, Vector3* destinationArray, int length);
+	typedef void (*RotateVector3Kernel)(const Vector3* sourceArray, const Quaternion& rotation, Vector3* destinationArray, int length);
+	typedef void (*TransformVector4Kernel)(const Vector4* sourceArray, const Matrix& matrix, Vector4* destinationArray, int length);
+	typedef void (*RotateVector4Kernel)(const Vector4* sourceArray, const Quaternion& rotation, Vector4* destinationArray, int length);
+	typedef void (*TransformVector3StridedKernel)(const Vector3* sourceArray, int sourceStride, const Matrix& matrix, Vector3* destinationArray, int destinationStride, int length);
+	typedef void (*RotateVector3StridedKernel)(const Vector3* sourceArray, int sourceStride, const Quaternion& rotation, Vector3* destinationArray, int destinationStride, int length);
+	typedef void (*TransformVector4StridedKernel)(const Vector4* sourceArray, int sourceStride, const Matrix& matrix, Vector4* destinationArray, int destinationStride, int length);
+	typedef void (*RotateVector4StridedKernel)(const Vector4* sourceArray, int sourceStride, const Quaternion& rotation, Vector4* destinationArray, int destinationStride, int length);
+	typedef void (*TransformVector2Kernel)(const Vector2* sourceArray, const Matrix3x2& matrix, Vector2* destinationArray, int length);
+	typedef void (*TransformVector2StridedKernel)(const Vector2* sourceArray, int sourceStride, const Matrix3x2& matrix, Vector2* destinationArray, int destinationStride, int length);
+	typedef void (*NormalizeVector2Kernel)(const Vector2* sourceArray, Vector2* destinationArray, int length);
+	typedef void (*NormalizeVector3Kernel)(const Vector3* sourceArray, Vector3* destinationArray, int length);
+	typedef void (*NormalizeVector4Kernel)(const Vector4* sourceArray, Vector4* destinationArray, int length);
+	typedef void (*SinCosKernel)(const float* angleArray, float* sinArray, float* cosArray, int length);
+	typedef void (*SlerpKernel)(const Quaternion* quaternion1Array, const Quaternion* quaternion2Array, const float* amountArray, Quaternion* resultArray, int length);
+	typedef void (*YawPitchRollKernel)(const float* yawArray, const float* pitchArray, const float* rollArray, Quaternion* resultArray, int length);
+	typedef void (*PackHalf3Kernel)(const Vector3* sourceArray, int sourceStride, Half3* destinationArray, int destinationStride, int length);
+	typedef void (*PackHalf4Kernel)(const Vector4* sourceArray, int sourceStride, Half4* destinationArray, int destinationStride, int length);
+	typedef void (*PackSnorm16x3Kernel)(const Vector3* sourceArray, int sourceStride, Snorm16x3* destinationArray, int destinationStride, int length);
+	typedef void (*PackSnorm16x4Kernel)(const Vector4* sourceArray, int sourceStride, Snorm16x4* destinationArray, int destinationStride, int length);
+	typedef void (*PackOctahedral16Kernel)(const Vector3* sourceArray, int sourceStride, Octahedral16* destinationArray, int destinationStride, int length);
+	typedef void (*PackSnorm1010102Kernel)(const Vector4* sourceArray, int sourceStride, Snorm1010102* destinationArray, int destinationStride, int length);
+	typedef void (*UnpackHalf3Kernel)(const Half3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length);
+	typedef void (*UnpackHalf4Kernel)(const Half4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length);
+	typedef void (*UnpackSnorm16x3Kernel)(const Snorm16x3* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length);
+	typedef void (*UnpackSnorm16x4Kernel)(const Snorm16x4* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length);
+	typedef void (*UnpackOctahedral16Kernel)(const Octahedral16* sourceArray, int sourceStride, Vector3* destinationArray, int destinationStride, int length);
+	typedef void (*UnpackSnorm1010102Kernel)(const Snorm1010102* sourceArray, int sourceStride, Vector4* destinationArray, int destinationStride, int length);
+	typedef void (*SplitVector3Kernel)(const Vector3* sourceArray, float* x, float* y, float* z, int length);
+	typedef void (*JoinVector3Kernel)(const float* x, const float* y, const float* z, Vector3* destinationArray, int length);
+
+	struct KernelTable
+	{
+		const char* Name;
+		CombineArrayKernel AddArray;
+		CombineArrayKernel SubtractArray;
+		CombineArrayKernel MultiplyArray;
+		ScaleArrayKernel ScaleArray;
+		LerpArrayKernel LerpArray;
+		CombineArrayKernel MinArray;
+		CombineArrayKernel MaxArray;
+		DotSoAKernel DotSoA;
+		CrossSoAKernel CrossSoA;
+		NormalizeSoAKernel NormalizeSoA;
+		TransformSoAKernel TransformSoA;
+		TransformSoAKernel TransformNormalSoA;
+		TransformVector3Kernel TransformVector3;
+		RotateVector3Kernel RotateVector3;
+		TransformVector4Kernel TransformVector4;
+		RotateVector4Kernel RotateVector4;
+		TransformVector3StridedKernel TransformVector3Strided;
+		RotateVector3StridedKernel RotateVector3Strided;
+		TransformVector4StridedKernel TransformVector4Strided;
+		RotateVector4StridedKernel RotateVector4Strided;
+		TransformVector2Kernel TransformVector2;
+		TransformVector2Kernel TransformNormalVector2;
+		TransformVector2StridedKernel TransformVector2Strided;
+		TransformVector2StridedKernel TransformNormalVector2Strided;
+		// Indexed by NormalizePrecision.
+		NormalizeVector2Kernel NormalizeVector2[NormalizePrecisionCount];
+		NormalizeVector3Kernel NormalizeVector3[NormalizePrecisionCount];
+		NormalizeVector4Kernel NormalizeVector4[NormalizePrecisionCount];
+		// Indexed by TrigPrecision.
+		SinCosKernel SinCos[TrigPrecisionCount];
+		SlerpKernel Slerp[TrigPrecisionCount];
+		YawPitchRollKernel CreateFromYawPitchRoll[TrigPrecisionCount];
+		PackHalf3Kernel PackHalf3;
+		PackHalf4Kernel PackHalf4;
+		PackSnorm16x3Kernel PackSnorm16x3;
+		PackSnorm16x4Kernel PackSnorm16x4;
+		PackOctahedral16Kernel PackOctahedral16;
+		PackSnorm1010102Kernel PackSnorm1010102;
+		UnpackHalf3Kernel UnpackHalf3;
+		UnpackHalf4Kernel UnpackHalf4;
+		UnpackSnorm16x3Kernel UnpackSnorm16x3;
+		UnpackSnorm16x4Kernel UnpackSnorm16x4;
+		UnpackOctahedral16Kernel UnpackOctahedral16;
+		UnpackSnorm1010102Kernel UnpackSnorm1010102;
+		SplitVector3Kernel SplitVector3;
+		JoinVector3Kernel JoinVector3;
+	};
+
+	static const KernelTable& Kernels();
+};